@@ -0,0 +1,37 @@
+#include "Core/HAL/PlatformType.h"
+
+#include "Core/Engine.h"
+#include "Core/Config/ConfigManager.h"
+#include "Core/Container/Array.h"
+#include "Core/Container/String.h"
+#include "Core/Headless/HeadlessSettings.h"
+
+
+/**
+ * JungleEngineHeadless 진입점 (CMakeLists.txt)
+ *
+ * Window, Device, UI 없이 World의 Tick만 실행합니다. -headless 인자가 없어도 항상 Headless 모드입니다.
+ * 예) JungleEngineHeadless -frames=1000 -fixeddt=0.016 -script=Contents/Scripts/Spawn.txt
+ */
+int main(int argc, char* argv[])
+{
+	TArray<FString> Args;
+	for (int Index = 1; Index < argc; ++Index)
+	{
+		Args.Add(argv[Index]);
+	}
+
+	FHeadlessSettings Settings = FHeadlessSettings::ParseCommandLine(Args);
+	Settings.bEnabled = true;
+
+	UConfigManager::Get().LoadConfig("editor.ini");
+
+	UEngine& Engine = UEngine::Get();
+	Engine.InitializeHeadless(Settings, 1920, 1080);
+
+	Engine.Run();
+
+	Engine.Shutdown();
+
+	return Engine.GetExitCode();
+}
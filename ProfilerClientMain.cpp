@@ -0,0 +1,406 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "Core/HAL/PlatformSocket.h"
+#include "Core/HAL/PlatformType.h"
+#include "Core/Stats/ProfilerProtocol.h"
+
+
+/**
+ * JungleProfilerClient 진입점 (CMakeLists.txt)
+ *
+ * 실행 중인 엔진의 FProfilerServer에 접속해서 Scope / Counter 통계를 주기적으로 출력합니다.
+ * 예) JungleProfilerClient -port=27100 -interval=1 -top=20
+ *
+ * - -port=N     : 접속할 127.0.0.1 Port (기본 27100)
+ * - -interval=X : X초마다 그 사이의 통계를 출력 (기본 1)
+ * - -top=N      : Exclusive 시간이 큰 순서로 N개의 Scope만 출력 (기본 20)
+ * - -frames=N   : N 프레임을 받으면 종료 (0 = 연결이 끊길 때까지)
+ */
+namespace
+{
+struct FClientSettings
+{
+	uint16 Port = ProfilerProtocol::DefaultPort;
+	double IntervalSeconds = 1.0;
+	int32 TopScopes = 20;
+	uint64 MaxFrames = 0;
+};
+
+struct FScopeStats
+{
+	std::string ThreadName;
+	std::string ScopeName;
+	uint64 Calls = 0;
+	double InclusiveNs = 0.0;
+	double ExclusiveNs = 0.0;
+	double MaxNs = 0.0;
+};
+
+struct FCounterStats
+{
+	double Last = 0.0;
+	double Sum = 0.0;
+	double Min = 0.0;
+	double Max = 0.0;
+	uint64 Samples = 0;
+};
+
+/** 한 출력 주기 동안 받은 프레임의 통계 */
+struct FIntervalStats
+{
+	uint64 NumFrames = 0;
+	uint64 FirstFrame = 0;
+	uint64 LastFrame = 0;
+	double FrameNsSum = 0.0;
+	double FrameNsMax = 0.0;
+
+	/** FrameIndex가 건너뛴 수 (Server가 버린 프레임) */
+	uint64 NumMissingFrames = 0;
+	uint32 ServerDroppedFrames = 0;
+
+	std::unordered_map<std::string, FScopeStats> Scopes;
+	std::unordered_map<std::string, FCounterStats> Counters;
+	std::vector<std::string> CounterOrder;
+};
+
+bool ParseValue(std::string_view Arg, std::string_view Key, std::string_view& OutValue)
+{
+	if (Arg.size() <= Key.size() + 1 || !Arg.starts_with(Key) || Arg[Key.size()] != '=')
+	{
+		return false;
+	}
+	OutValue = Arg.substr(Key.size() + 1);
+	return true;
+}
+
+FClientSettings ParseCommandLine(int argc, char* argv[])
+{
+	FClientSettings Settings;
+	for (int Index = 1; Index < argc; ++Index)
+	{
+		const std::string_view Arg = argv[Index];
+		std::string_view Value;
+		if (ParseValue(Arg, "-port", Value))
+		{
+			Settings.Port = static_cast<uint16>(std::atoi(Value.data()));
+		}
+		else if (ParseValue(Arg, "-interval", Value))
+		{
+			Settings.IntervalSeconds = std::max(0.1, std::atof(Value.data()));
+		}
+		else if (ParseValue(Arg, "-top", Value))
+		{
+			Settings.TopScopes = std::max(1, std::atoi(Value.data()));
+		}
+		else if (ParseValue(Arg, "-frames", Value))
+		{
+			Settings.MaxFrames = static_cast<uint64>(std::max(0, std::atoi(Value.data())));
+		}
+	}
+	return Settings;
+}
+
+class FProfilerClient
+{
+public:
+	explicit FProfilerClient(const FClientSettings& InSettings) : Settings(InSettings) {}
+
+	/** @return 0 = 정상 종료, 1 = 연결 실패 / 끊김 / Stream 오류 */
+	int Run()
+	{
+		// 엔진이 아직 뜨는 중일 수 있으므로 잠깐 다시 시도
+		const auto ConnectDeadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+		while (!Socket.Connect(Settings.Port))
+		{
+			if (std::chrono::steady_clock::now() > ConnectDeadline)
+			{
+				std::printf("Failed to connect to 127.0.0.1:%u\n", Settings.Port);
+				return 1;
+			}
+			std::this_thread::sleep_for(std::chrono::milliseconds(100));
+		}
+
+		uint8 Handshake[ProfilerProtocol::HandshakeSize];
+		uint32 Magic = 0;
+		uint16 Version = 0;
+		if (!Socket.ReceiveAll(Handshake, sizeof(Handshake)))
+		{
+			std::printf("Connection closed during handshake\n");
+			return 1;
+		}
+		std::memcpy(&Magic, Handshake, sizeof(uint32));
+		std::memcpy(&Version, Handshake + sizeof(uint32), sizeof(uint16));
+		if (Magic != ProfilerProtocol::Magic || Version != ProfilerProtocol::Version)
+		{
+			std::printf("Unexpected stream (magic %08X, version %u)\n", Magic, Version);
+			return 1;
+		}
+		std::printf("Connected to 127.0.0.1:%u\n", Settings.Port);
+
+		LastPrint = std::chrono::steady_clock::now();
+		std::vector<uint8> Payload;
+		while (Settings.MaxFrames == 0 || TotalFrames < Settings.MaxFrames)
+		{
+			uint8 Header[ProfilerProtocol::PacketHeaderSize];
+			if (!Socket.ReceiveAll(Header, sizeof(Header)))
+			{
+				PrintInterval();
+				std::printf("Connection closed after %llu frames\n", static_cast<unsigned long long>(TotalFrames));
+				return Settings.MaxFrames == 0 ? 0 : 1;
+			}
+
+			uint32 PayloadSize = 0;
+			std::memcpy(&PayloadSize, Header + 1, sizeof(uint32));
+			if (PayloadSize > ProfilerProtocol::MaxPayloadSize)
+			{
+				std::printf("Corrupted stream (payload %u bytes)\n", PayloadSize);
+				return 1;
+			}
+			Payload.resize(PayloadSize);
+			if (PayloadSize > 0 && !Socket.ReceiveAll(Payload.data(), PayloadSize))
+			{
+				std::printf("Connection closed inside a packet\n");
+				return 1;
+			}
+
+			ProfilerProtocol::FReader Reader(Payload.data(), Payload.size());
+			HandlePacket(static_cast<ProfilerProtocol::EPacketType>(Header[0]), Reader);
+			if (Reader.HasOverflowed())
+			{
+				std::printf("Corrupted packet (type %u)\n", Header[0]);
+				return 1;
+			}
+
+			const auto Now = std::chrono::steady_clock::now();
+			if (std::chrono::duration<double>(Now - LastPrint).count() >= Settings.IntervalSeconds)
+			{
+				PrintInterval();
+				LastPrint = Now;
+			}
+		}
+
+		PrintInterval();
+		return 0;
+	}
+
+private:
+	void HandlePacket(ProfilerProtocol::EPacketType Type, ProfilerProtocol::FReader& Reader)
+	{
+		using ProfilerProtocol::EPacketType;
+		switch (Type)
+		{
+		case EPacketType::Name:
+		{
+			const uint16 NameId = Reader.Read<uint16>();
+			if (NameId >= Names.size())
+			{
+				Names.resize(NameId + 1);
+			}
+			Names[NameId] = Reader.ReadString();
+			break;
+		}
+		case EPacketType::ThreadName:
+		{
+			const uint16 ThreadIndex = Reader.Read<uint16>();
+			if (ThreadIndex >= ThreadNames.size())
+			{
+				ThreadNames.resize(ThreadIndex + 1);
+			}
+			ThreadNames[ThreadIndex] = Reader.ReadString();
+			break;
+		}
+		case EPacketType::Reset:
+			Names.clear();
+			ThreadNames.clear();
+			break;
+		case EPacketType::Frame:
+			HandleFrame(Reader);
+			break;
+		default:
+			// 모르는 Packet은 크기만큼 건너뜀 (이미 다 읽음)
+			break;
+		}
+	}
+
+	void HandleFrame(ProfilerProtocol::FReader& Reader)
+	{
+		const uint64 FrameIndex = Reader.Read<uint64>();
+		const uint32 FrameNs = Reader.Read<uint32>();
+		const uint32 ServerDropped = Reader.Read<uint32>();
+
+		if (Interval.NumFrames == 0)
+		{
+			Interval.FirstFrame = FrameIndex;
+		}
+		else if (FrameIndex > Interval.LastFrame + 1)
+		{
+			Interval.NumMissingFrames += FrameIndex - Interval.LastFrame - 1;
+		}
+		Interval.LastFrame = FrameIndex;
+		Interval.ServerDroppedFrames = ServerDropped;
+		++Interval.NumFrames;
+		++TotalFrames;
+		Interval.FrameNsSum += FrameNs;
+		Interval.FrameNsMax = std::max(Interval.FrameNsMax, static_cast<double>(FrameNs));
+
+		struct FOpenScope
+		{
+			FScopeStats* Stats;
+			uint64 EndNs;
+			uint8 Depth;
+		};
+		std::vector<FOpenScope> OpenScopes;
+
+		const uint16 NumThreads = Reader.Read<uint16>();
+		for (uint16 Thread = 0; Thread < NumThreads && !Reader.HasOverflowed(); ++Thread)
+		{
+			const uint16 ThreadIndex = Reader.Read<uint16>();
+			const std::string& ThreadName = GetName(ThreadNames, ThreadIndex);
+			const uint32 NumEvents = Reader.Read<uint32>();
+
+			// Event는 시작 순서, 바깥 Scope의 Exclusive 시간에서 자식 시간을 뺌
+			OpenScopes.clear();
+			for (uint32 Event = 0; Event < NumEvents && !Reader.HasOverflowed(); ++Event)
+			{
+				const uint16 NameId = Reader.Read<uint16>();
+				const uint8 Depth = Reader.Read<uint8>();
+				const uint32 StartNs = Reader.Read<uint32>();
+				const uint32 DurationNs = Reader.Read<uint32>();
+
+				FScopeStats& Stats = FindScope(ThreadName, GetName(Names, NameId));
+				++Stats.Calls;
+				Stats.InclusiveNs += DurationNs;
+				Stats.ExclusiveNs += DurationNs;
+				Stats.MaxNs = std::max(Stats.MaxNs, static_cast<double>(DurationNs));
+
+				while (!OpenScopes.empty() && (OpenScopes.back().EndNs <= StartNs || OpenScopes.back().Depth >= Depth))
+				{
+					OpenScopes.pop_back();
+				}
+				if (!OpenScopes.empty())
+				{
+					OpenScopes.back().Stats->ExclusiveNs -= DurationNs;
+				}
+				OpenScopes.push_back({ &Stats, static_cast<uint64>(StartNs) + DurationNs, Depth });
+			}
+		}
+
+		const uint16 NumCounters = Reader.Read<uint16>();
+		for (uint16 Counter = 0; Counter < NumCounters && !Reader.HasOverflowed(); ++Counter)
+		{
+			const std::string& Name = GetName(Names, Reader.Read<uint16>());
+			const double Value = Reader.Read<double>();
+
+			auto [Found, bInserted] = Interval.Counters.try_emplace(Name);
+			FCounterStats& Stats = Found->second;
+			if (bInserted)
+			{
+				Interval.CounterOrder.push_back(Name);
+				Stats.Min = Stats.Max = Value;
+			}
+			Stats.Last = Value;
+			Stats.Sum += Value;
+			Stats.Min = std::min(Stats.Min, Value);
+			Stats.Max = std::max(Stats.Max, Value);
+			++Stats.Samples;
+		}
+	}
+
+	FScopeStats& FindScope(const std::string& ThreadName, const std::string& ScopeName)
+	{
+		auto [Found, bInserted] = Interval.Scopes.try_emplace(ThreadName + '\n' + ScopeName);
+		if (bInserted)
+		{
+			Found->second.ThreadName = ThreadName;
+			Found->second.ScopeName = ScopeName;
+		}
+		return Found->second;
+	}
+
+	static const std::string& GetName(const std::vector<std::string>& Table, uint16 Id)
+	{
+		static const std::string Unknown = "?";
+		return Id < Table.size() && !Table[Id].empty() ? Table[Id] : Unknown;
+	}
+
+	void PrintInterval()
+	{
+		if (Interval.NumFrames == 0)
+		{
+			return;
+		}
+
+		const double NumFrames = static_cast<double>(Interval.NumFrames);
+		std::printf(
+			"\n[Frames %llu-%llu] %llu frames, avg %.3f ms (max %.3f), %llu missing, %u dropped by server in total\n",
+			static_cast<unsigned long long>(Interval.FirstFrame), static_cast<unsigned long long>(Interval.LastFrame),
+			static_cast<unsigned long long>(Interval.NumFrames), Interval.FrameNsSum / NumFrames * 1e-6, Interval.FrameNsMax * 1e-6,
+			static_cast<unsigned long long>(Interval.NumMissingFrames), Interval.ServerDroppedFrames
+		);
+
+		std::vector<const FScopeStats*> Sorted;
+		for (const auto& [Key, Stats] : Interval.Scopes)
+		{
+			Sorted.push_back(&Stats);
+		}
+		std::sort(Sorted.begin(), Sorted.end(), [](const FScopeStats* A, const FScopeStats* B) { return A->ExclusiveNs > B->ExclusiveNs; });
+		if (Sorted.size() > static_cast<size_t>(Settings.TopScopes))
+		{
+			Sorted.resize(Settings.TopScopes);
+		}
+
+		std::printf("%-16s %-28s %9s %11s %11s %9s\n", "Thread", "Scope", "Calls/f", "Incl ms/f", "Excl ms/f", "Max ms");
+		for (const FScopeStats* Stats : Sorted)
+		{
+			std::printf(
+				"%-16s %-28s %9.2f %11.4f %11.4f %9.4f\n",
+				Stats->ThreadName.c_str(), Stats->ScopeName.c_str(), static_cast<double>(Stats->Calls) / NumFrames,
+				Stats->InclusiveNs / NumFrames * 1e-6, Stats->ExclusiveNs / NumFrames * 1e-6, Stats->MaxNs * 1e-6
+			);
+		}
+
+		if (!Interval.CounterOrder.empty())
+		{
+			std::printf("%-45s %11s %11s %11s %11s\n", "Counter", "Last", "Avg", "Min", "Max");
+			for (const std::string& Name : Interval.CounterOrder)
+			{
+				const FCounterStats& Stats = Interval.Counters[Name];
+				std::printf(
+					"%-45s %11.3f %11.3f %11.3f %11.3f\n",
+					Name.c_str(), Stats.Last, Stats.Sum / static_cast<double>(Stats.Samples), Stats.Min, Stats.Max
+				);
+			}
+		}
+		std::fflush(stdout);
+
+		Interval = FIntervalStats();
+	}
+
+private:
+	FClientSettings Settings;
+	FPlatformSocket Socket;
+
+	std::vector<std::string> Names;
+	std::vector<std::string> ThreadNames;
+
+	FIntervalStats Interval;
+	uint64 TotalFrames = 0;
+	std::chrono::steady_clock::time_point LastPrint;
+};
+}
+
+
+int main(int argc, char* argv[])
+{
+	FProfilerClient Client(ParseCommandLine(argc, argv));
+	return Client.Run();
+}
@@ -1,4 +1,5 @@
 ﻿#pragma once
+#include <cstdlib>
 
 /**
  * Singleton 객체 템플릿
@@ -0,0 +1,373 @@
+#include "JobSystem.h"
+
+#include <string>
+
+#include "Core/Stats/Stats.h"
+
+#if PLATFORM_LINUX
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+
+namespace
+{
+// 현재 스레드가 Worker로 속한 FJobSystem과 그 안의 Index, 다른 인스턴스에서 보면 외부 스레드
+thread_local const FJobSystem* GWorkerOwner = nullptr;
+thread_local int32 GWorkerIndex = -1;
+
+// 스레드를 재우기 전에 Job을 다시 찾아볼 횟수
+constexpr int32 SpinCountBeforeSleep = 64;
+
+FORCEINLINE uint32 XorShift(uint32& State)
+{
+	State ^= State << 13;
+	State ^= State >> 17;
+	State ^= State << 5;
+	return State;
+}
+}
+
+
+FJobSystem::~FJobSystem()
+{
+	Shutdown();
+}
+
+void FJobSystem::Initialize(int32 InNumWorkerThreads, bool bInPinThreads)
+{
+	if (bIsInitialized)
+	{
+		return;
+	}
+
+	if (InNumWorkerThreads < 0)
+	{
+		const int32 NumCores = static_cast<int32>(std::thread::hardware_concurrency());
+		InNumWorkerThreads = NumCores > 1 ? NumCores - 1 : 0;
+	}
+
+	bIsStopping = false;
+	Workers.clear();
+	for (int32 Index = 0; Index < InNumWorkerThreads + 1; ++Index)
+	{
+		Workers.push_back(std::make_unique<FWorker>());
+		Workers.back()->RandomState = 0x9E3779B9u * static_cast<uint32>(Index + 1);
+	}
+
+	// 0번 Worker는 Initialize를 호출한 Main Thread, 이미 다른 인스턴스의 Worker라면 그대로 두고 외부 스레드로 취급
+	if (GWorkerOwner == nullptr)
+	{
+		GWorkerOwner = this;
+		GWorkerIndex = EJobAffinity::MainThread;
+	}
+	bIsInitialized = true;
+
+	for (int32 Index = 1; Index < GetNumWorkers(); ++Index)
+	{
+		Workers[Index]->Thread = std::thread([this, Index, bInPinThreads]
+		{
+			if (bInPinThreads)
+			{
+				PinCurrentThread(Index);
+			}
+			PROFILER_THREAD_NAME("Worker " + std::to_string(Index));
+			WorkerMain(Index);
+		});
+	}
+}
+
+void FJobSystem::Shutdown()
+{
+	if (!bIsInitialized)
+	{
+		return;
+	}
+
+	// 남은 Job을 모두 처리한 뒤 종료
+	while (FJob* Job = FindJob(GetCurrentWorkerIndex()))
+	{
+		Execute(Job);
+	}
+
+	bIsStopping = true;
+	WakeWorkers(true);
+
+	for (int32 Index = 1; Index < GetNumWorkers(); ++Index)
+	{
+		if (Workers[Index]->Thread.joinable())
+		{
+			Workers[Index]->Thread.join();
+		}
+	}
+
+	Workers.clear();
+	bIsInitialized = false;
+
+	if (GWorkerOwner == this)
+	{
+		GWorkerOwner = nullptr;
+		GWorkerIndex = -1;
+	}
+}
+
+int32 FJobSystem::GetCurrentWorkerIndex() const
+{
+	return GWorkerOwner == this ? GWorkerIndex : -1;
+}
+
+void FJobSystem::Submit(std::function<void()> Task, FJobCounter* Counter, EJobPriority::Type Priority, int32 Affinity)
+{
+	if (Counter)
+	{
+		Counter->Add();
+	}
+
+	FJob* Job = new FJob{std::move(Task), Counter};
+
+	// 초기화 전에는 바로 실행
+	if (!bIsInitialized)
+	{
+		Execute(Job);
+		return;
+	}
+
+	const int32 WorkerIndex = GetCurrentWorkerIndex();
+	if (Affinity >= 0 && Affinity < GetNumWorkers())
+	{
+		FWorker& Target = *Workers[Affinity];
+		{
+			std::lock_guard Lock(Target.MailboxMutex);
+			Target.Mailbox[Priority].push_back(Job);
+		}
+		Target.MailboxCount.fetch_add(1, std::memory_order_release);
+
+		// 어떤 Worker가 깨어날지 모르므로 전부 깨움
+		WakeWorkers(true);
+		return;
+	}
+
+	if (WorkerIndex >= 0)
+	{
+		Workers[WorkerIndex]->Queues[Priority].Push(Job);
+	}
+	else
+	{
+		{
+			std::lock_guard Lock(InjectionMutex);
+			InjectionQueue[Priority].push_back(Job);
+		}
+		InjectionCount.fetch_add(1, std::memory_order_release);
+	}
+	WakeWorkers(false);
+}
+
+void FJobSystem::Wait(const FJobCounter& Counter)
+{
+	const int32 WorkerIndex = GetCurrentWorkerIndex();
+	while (!Counter.IsDone())
+	{
+		if (FJob* Job = FindJob(WorkerIndex))
+		{
+			Execute(Job);
+		}
+		else
+		{
+			std::this_thread::yield();
+		}
+	}
+}
+
+void FJobSystem::ProcessMainThreadJobs()
+{
+	if (!bIsInitialized || !IsInMainThread())
+	{
+		return;
+	}
+
+	FWorker& MainWorker = *Workers[EJobAffinity::MainThread];
+	while (MainWorker.MailboxCount.load(std::memory_order_acquire) > 0)
+	{
+		FJob* Job = nullptr;
+		{
+			std::lock_guard Lock(MainWorker.MailboxMutex);
+			for (std::deque<FJob*>& Mailbox : MainWorker.Mailbox)
+			{
+				if (!Mailbox.empty())
+				{
+					Job = Mailbox.front();
+					Mailbox.pop_front();
+					break;
+				}
+			}
+		}
+
+		if (Job == nullptr)
+		{
+			break;
+		}
+		MainWorker.MailboxCount.fetch_sub(1, std::memory_order_relaxed);
+		Execute(Job);
+	}
+}
+
+void FJobSystem::WorkerMain(int32 WorkerIndex)
+{
+	GWorkerOwner = this;
+	GWorkerIndex = WorkerIndex;
+
+	int32 SpinCount = 0;
+	while (true)
+	{
+		const uint64 Generation = WakeGeneration.load(std::memory_order_acquire);
+
+		if (FJob* Job = FindJob(WorkerIndex))
+		{
+			Execute(Job);
+			SpinCount = 0;
+			continue;
+		}
+
+		if (bIsStopping.load(std::memory_order_acquire))
+		{
+			break;
+		}
+
+		if (++SpinCount < SpinCountBeforeSleep)
+		{
+			std::this_thread::yield();
+			continue;
+		}
+
+		// Generation이 바뀌었다면 그 사이 새로운 Job이 들어온 것
+		std::unique_lock Lock(SleepMutex);
+		NumSleepingWorkers.fetch_add(1, std::memory_order_seq_cst);
+		SleepCondition.wait(Lock, [this, Generation]
+		{
+			return WakeGeneration.load(std::memory_order_seq_cst) != Generation || bIsStopping.load(std::memory_order_acquire);
+		});
+		NumSleepingWorkers.fetch_sub(1, std::memory_order_relaxed);
+		SpinCount = 0;
+	}
+}
+
+FJob* FJobSystem::FindJob(int32 WorkerIndex)
+{
+	if (!bIsInitialized)
+	{
+		return nullptr;
+	}
+
+	const int32 NumWorkers = GetNumWorkers();
+	FWorker* Self = WorkerIndex >= 0 ? Workers[WorkerIndex].get() : nullptr;
+
+	for (int32 Priority = 0; Priority < EJobPriority::Num; ++Priority)
+	{
+		if (Self)
+		{
+			// 1. 나에게 지정된 Job
+			if (Self->MailboxCount.load(std::memory_order_acquire) > 0)
+			{
+				std::lock_guard Lock(Self->MailboxMutex);
+				std::deque<FJob*>& Mailbox = Self->Mailbox[Priority];
+				if (!Mailbox.empty())
+				{
+					FJob* Job = Mailbox.front();
+					Mailbox.pop_front();
+					Self->MailboxCount.fetch_sub(1, std::memory_order_relaxed);
+					return Job;
+				}
+			}
+
+			// 2. 내 Deque
+			if (FJob* Job = Self->Queues[Priority].Pop())
+			{
+				return Job;
+			}
+		}
+
+		// 3. 외부 스레드에서 들어온 Job
+		if (InjectionCount.load(std::memory_order_acquire) > 0)
+		{
+			std::lock_guard Lock(InjectionMutex);
+			std::deque<FJob*>& Queue = InjectionQueue[Priority];
+			if (!Queue.empty())
+			{
+				FJob* Job = Queue.front();
+				Queue.pop_front();
+				InjectionCount.fetch_sub(1, std::memory_order_relaxed);
+				return Job;
+			}
+		}
+
+		// 4. 다른 Worker의 Deque에서 훔쳐오기, 매번 같은 Worker만 노리지 않도록 시작 위치를 섞습니다.
+		uint32 RandomSeed = Self ? XorShift(Self->RandomState) : static_cast<uint32>(Priority) * 7919u;
+		const int32 Start = static_cast<int32>(RandomSeed % static_cast<uint32>(NumWorkers));
+		for (int32 Offset = 0; Offset < NumWorkers; ++Offset)
+		{
+			const int32 Victim = (Start + Offset) % NumWorkers;
+			if (Victim == WorkerIndex)
+			{
+				continue;
+			}
+
+			if (FJob* Job = Workers[Victim]->Queues[Priority].Steal())
+			{
+				return Job;
+			}
+		}
+	}
+
+	return nullptr;
+}
+
+void FJobSystem::Execute(FJob* Job)
+{
+	{
+		SCOPE_CYCLE_COUNTER("Job");
+		Job->Task();
+	}
+	if (Job->Counter)
+	{
+		Job->Counter->Done();
+	}
+	delete Job;
+}
+
+void FJobSystem::WakeWorkers(bool bWakeAll)
+{
+	WakeGeneration.fetch_add(1, std::memory_order_seq_cst);
+	if (NumSleepingWorkers.load(std::memory_order_seq_cst) == 0)
+	{
+		return;
+	}
+
+	std::lock_guard Lock(SleepMutex);
+	if (bWakeAll)
+	{
+		SleepCondition.notify_all();
+	}
+	else
+	{
+		SleepCondition.notify_one();
+	}
+}
+
+void FJobSystem::PinCurrentThread(int32 CoreIndex)
+{
+	const int32 NumCores = static_cast<int32>(std::thread::hardware_concurrency());
+	if (NumCores <= 0)
+	{
+		return;
+	}
+	CoreIndex %= NumCores;
+
+#if PLATFORM_WINDOWS
+	SetThreadAffinityMask(GetCurrentThread(), static_cast<DWORD_PTR>(1ull) << CoreIndex);
+#else
+	cpu_set_t CpuSet;
+	CPU_ZERO(&CpuSet);
+	CPU_SET(CoreIndex, &CpuSet);
+	pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &CpuSet);
+#endif
+}
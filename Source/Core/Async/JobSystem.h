@@ -0,0 +1,236 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "WorkStealingQueue.h"
+#include "Core/AbstractClass/Singleton.h"
+#include "Core/HAL/PlatformType.h"
+
+
+namespace EJobPriority
+{
+	enum Type : uint8
+	{
+		High,
+		Normal,
+		Low,
+
+		Num
+	};
+}
+
+namespace EJobAffinity
+{
+	enum Type : int32
+	{
+		/** 아무 Worker에서나 실행 (Work-Stealing 대상) */
+		AnyWorker = -1,
+
+		/** Main Thread에서만 실행 (Main Thread가 Wait 하거나 ProcessMainThreadJobs를 호출할 때 실행) */
+		MainThread = 0,
+	};
+}
+
+
+/**
+ * Job의 완료를 기다리기 위한 카운터 (Fence)
+ *
+ * Job을 Submit할 때 카운터가 1 증가하고, Job이 끝나면 1 감소합니다.
+ * 0이 되면 연결된 모든 Job이 끝난 것입니다.
+ */
+class FJobCounter
+{
+public:
+	FJobCounter() = default;
+	FJobCounter(const FJobCounter&) = delete;
+	FJobCounter& operator=(const FJobCounter&) = delete;
+
+	void Add(int32 Amount = 1) { Count.fetch_add(Amount, std::memory_order_relaxed); }
+	void Done() { Count.fetch_sub(1, std::memory_order_release); }
+
+	bool IsDone() const { return Count.load(std::memory_order_acquire) == 0; }
+	int32 GetValue() const { return Count.load(std::memory_order_acquire); }
+
+private:
+	std::atomic<int32> Count = 0;
+};
+
+
+struct FJob
+{
+	std::function<void()> Task;
+	FJobCounter* Counter = nullptr;
+};
+
+
+/**
+ * Work-Stealing 기반 Job System
+ *
+ * - Worker마다 우선순위별 Chase-Lev Deque를 가지며, 일이 없으면 다른 Worker의 Deque에서 훔쳐옵니다.
+ * - Main Thread는 0번 Worker로 취급되어, Wait 하는 동안 다른 Job을 실행합니다.
+ * - Worker 스레드가 아닌 곳에서 Submit한 Job은 전역 Injection Queue로 들어갑니다.
+ *   다른 인스턴스의 Worker (Main Thread 포함)도 이 인스턴스에서는 외부 스레드입니다.
+ */
+class FJobSystem : public TSingleton<FJobSystem>
+{
+	struct FWorker
+	{
+		TWorkStealingQueue<FJob*> Queues[EJobPriority::Num];
+
+		// Affinity가 지정된 Job은 훔쳐갈 수 없도록 Mailbox로 들어갑니다.
+		std::mutex MailboxMutex;
+		std::deque<FJob*> Mailbox[EJobPriority::Num];
+		std::atomic<int32> MailboxCount = 0;
+
+		std::thread Thread;
+		uint32 RandomState = 0;
+	};
+
+public:
+	FJobSystem() = default;
+	~FJobSystem();
+
+	/**
+	 * Worker 스레드를 생성합니다. 호출한 스레드가 Main Thread(0번 Worker)가 됩니다.
+	 * 호출한 스레드가 이미 다른 인스턴스의 Worker라면 0번 Worker 없이 외부 스레드로 남습니다. (Benchmark용 인스턴스 등)
+	 * @param InNumWorkerThreads 생성할 Worker 스레드 수, 음수면 (코어 수 - 1)
+	 * @param bInPinThreads Worker 스레드를 코어에 고정할지 여부
+	 */
+	void Initialize(int32 InNumWorkerThreads = -1, bool bInPinThreads = false);
+	void Shutdown();
+
+	bool IsInitialized() const { return bIsInitialized; }
+
+	/** Main Thread를 포함한 전체 Worker 수 */
+	int32 GetNumWorkers() const { return static_cast<int32>(Workers.size()); }
+
+	/** 이 인스턴스에서 현재 스레드의 Worker Index, 이 인스턴스의 Worker가 아니라면 -1 */
+	int32 GetCurrentWorkerIndex() const;
+	bool IsInMainThread() const { return GetCurrentWorkerIndex() == EJobAffinity::MainThread; }
+
+	/**
+	 * Job을 등록합니다.
+	 * @param Task 실행할 함수
+	 * @param Counter 완료 시 감소시킬 카운터 (nullptr 가능)
+	 * @param Priority 우선순위 힌트
+	 * @param Affinity 실행할 Worker Index, EJobAffinity::AnyWorker면 아무 Worker
+	 */
+	void Submit(
+		std::function<void()> Task, FJobCounter* Counter = nullptr,
+		EJobPriority::Type Priority = EJobPriority::Normal, int32 Affinity = EJobAffinity::AnyWorker
+	);
+
+	/** Counter가 0이 될 때까지 기다립니다. 기다리는 동안 현재 스레드가 다른 Job을 실행합니다. */
+	void Wait(const FJobCounter& Counter);
+
+	/** Main Thread에 Affinity가 지정된 Job을 모두 실행합니다. */
+	void ProcessMainThreadJobs();
+
+	/**
+	 * [0, Num) 범위를 Batch로 나누어 병렬로 실행합니다.
+	 * @param Num 반복 횟수
+	 * @param Func void(int32 Begin, int32 End)
+	 * @param MinBatchSize Batch 하나의 최소 크기, Num이 이보다 작으면 현재 스레드에서 바로 실행합니다.
+	 * @param Priority 우선순위 힌트
+	 */
+	template <typename FuncType>
+		requires std::is_invocable_v<FuncType, int32, int32>
+	void ParallelForRange(int32 Num, const FuncType& Func, int32 MinBatchSize = 1, EJobPriority::Type Priority = EJobPriority::High);
+
+	/**
+	 * [0, Num) 범위를 병렬로 실행합니다.
+	 * @param Func void(int32 Index)
+	 */
+	template <typename FuncType>
+		requires std::is_invocable_v<FuncType, int32>
+	void ParallelFor(int32 Num, const FuncType& Func, int32 MinBatchSize = 1, EJobPriority::Type Priority = EJobPriority::High);
+
+	/** Worker 하나당 만들 Batch 수, 값이 클수록 부하 분산이 좋아지지만 Job 오버헤드가 늘어납니다. */
+	static constexpr int32 BatchesPerWorker = 4;
+
+private:
+	void WorkerMain(int32 WorkerIndex);
+
+	FJob* FindJob(int32 WorkerIndex);
+	void Execute(FJob* Job);
+	void WakeWorkers(bool bWakeAll);
+
+	static void PinCurrentThread(int32 CoreIndex);
+
+private:
+	bool bIsInitialized = false;
+	std::atomic<bool> bIsStopping = false;
+
+	std::vector<std::unique_ptr<FWorker>> Workers;
+
+	// Worker가 아닌 스레드에서 Submit한 Job
+	std::mutex InjectionMutex;
+	std::deque<FJob*> InjectionQueue[EJobPriority::Num];
+	std::atomic<int32> InjectionCount = 0;
+
+	// Worker 재우기 / 깨우기
+	std::mutex SleepMutex;
+	std::condition_variable SleepCondition;
+	std::atomic<int32> NumSleepingWorkers = 0;
+	std::atomic<uint64> WakeGeneration = 0;
+};
+
+
+template <typename FuncType>
+	requires std::is_invocable_v<FuncType, int32, int32>
+void FJobSystem::ParallelForRange(int32 Num, const FuncType& Func, int32 MinBatchSize, EJobPriority::Type Priority)
+{
+	if (Num <= 0)
+	{
+		return;
+	}
+
+	MinBatchSize = MinBatchSize < 1 ? 1 : MinBatchSize;
+	const int32 MaxBatches = bIsInitialized ? GetNumWorkers() * BatchesPerWorker : 1;
+	int32 NumBatches = (Num + MinBatchSize - 1) / MinBatchSize;
+	NumBatches = NumBatches < MaxBatches ? NumBatches : MaxBatches;
+
+	// 나눌 필요가 없으면 현재 스레드에서 바로 실행
+	if (NumBatches <= 1)
+	{
+		Func(0, Num);
+		return;
+	}
+
+	const int32 BatchSize = Num / NumBatches;
+	const int32 Remainder = Num % NumBatches;
+
+	FJobCounter Counter;
+	int32 Begin = 0;
+	for (int32 BatchIndex = 0; BatchIndex < NumBatches - 1; ++BatchIndex)
+	{
+		const int32 End = Begin + BatchSize + (BatchIndex < Remainder ? 1 : 0);
+		Submit([&Func, Begin, End] { Func(Begin, End); }, &Counter, Priority);
+		Begin = End;
+	}
+
+	// 마지막 Batch는 현재 스레드에서 실행
+	Func(Begin, Num);
+	Wait(Counter);
+}
+
+template <typename FuncType>
+	requires std::is_invocable_v<FuncType, int32>
+void FJobSystem::ParallelFor(int32 Num, const FuncType& Func, int32 MinBatchSize, EJobPriority::Type Priority)
+{
+	ParallelForRange(
+		Num, [&Func](int32 Begin, int32 End)
+		{
+			for (int32 Index = Begin; Index < End; ++Index)
+			{
+				Func(Index);
+			}
+		}, MinBatchSize, Priority
+	);
+}
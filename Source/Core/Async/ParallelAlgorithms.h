@@ -0,0 +1,481 @@
+#pragma once
+#include <algorithm>
+#include <cstring>
+#include <span>
+#include <type_traits>
+
+#include "JobSystem.h"
+#include "Core/Container/Array.h"
+#include "Core/HAL/PlatformType.h"
+
+
+/**
+ * TArray / std::span 위에서 동작하는 병렬 알고리즘 모음
+ *
+ * 모든 함수는 원소 수가 임계값보다 작으면 현재 스레드에서 직렬로 실행합니다.
+ * 임계값은 Job 하나를 만드는 비용(약 수 μs)보다 일이 충분히 클 때를 기준으로 잡았습니다.
+ */
+namespace ParallelAlgo
+{
+	/** 병렬 실행 임계값 */
+	namespace Threshold
+	{
+		constexpr int32 For = 4096;
+		constexpr int32 Reduce = 16384;
+		constexpr int32 PrefixSum = 32768;
+		constexpr int32 RadixSort = 65536;
+		constexpr int32 MergeSort = 16384;
+
+		/** 이보다 작으면 Radix Sort 대신 비교 정렬을 사용합니다. */
+		constexpr int32 RadixSortMinimum = 256;
+	}
+
+	/** Chunk 하나의 최소 크기에 맞춰 [0, Num)을 나눌 Chunk 수를 계산합니다. */
+	inline int32 GetNumChunks(int32 Num, int32 MinChunkSize)
+	{
+		FJobSystem& JobSystem = FJobSystem::Get();
+		if (!JobSystem.IsInitialized() || Num <= MinChunkSize)
+		{
+			return 1;
+		}
+
+		const int32 MaxChunks = JobSystem.GetNumWorkers() * FJobSystem::BatchesPerWorker;
+		const int32 NumChunks = (Num + MinChunkSize - 1) / MinChunkSize;
+		return NumChunks < MaxChunks ? NumChunks : MaxChunks;
+	}
+
+	/** ChunkIndex 번째 Chunk의 [Begin, End) */
+	FORCEINLINE void GetChunkRange(int32 Num, int32 NumChunks, int32 ChunkIndex, int32& OutBegin, int32& OutEnd)
+	{
+		const int64 Begin = static_cast<int64>(Num) * ChunkIndex / NumChunks;
+		const int64 End = static_cast<int64>(Num) * (ChunkIndex + 1) / NumChunks;
+		OutBegin = static_cast<int32>(Begin);
+		OutEnd = static_cast<int32>(End);
+	}
+
+	/**
+	 * [0, Num)을 Chunk 단위로 나눠 병렬 실행합니다.
+	 * @param Func void(int32 Begin, int32 End)
+	 */
+	template <typename FuncType>
+		requires std::is_invocable_v<FuncType, int32, int32>
+	void ParallelForChunked(int32 Num, const FuncType& Func, int32 MinChunkSize = Threshold::For)
+	{
+		FJobSystem::Get().ParallelForRange(Num, Func, MinChunkSize);
+	}
+
+	/**
+	 * 모든 원소에 Func를 병렬로 적용합니다.
+	 * @param Func void(T& Element)
+	 */
+	template <typename T, typename FuncType>
+		requires std::is_invocable_v<FuncType, T&>
+	void ParallelForEach(std::span<T> Items, const FuncType& Func, int32 MinChunkSize = Threshold::For)
+	{
+		T* Data = Items.data();
+		ParallelForChunked(static_cast<int32>(Items.size()), [Data, &Func](int32 Begin, int32 End)
+		{
+			for (int32 Index = Begin; Index < End; ++Index)
+			{
+				Func(Data[Index]);
+			}
+		}, MinChunkSize);
+	}
+
+	template <typename T, typename Allocator, typename FuncType>
+		requires std::is_invocable_v<FuncType, T&>
+	void ParallelForEach(TArray<T, Allocator>& Items, const FuncType& Func, int32 MinChunkSize = Threshold::For)
+	{
+		ParallelForEach(std::span<T>(Items.GetData(), Items.Num()), Func, MinChunkSize);
+	}
+
+	/**
+	 * [0, Num)의 원소를 Map으로 변환한 뒤 Reduce로 합칩니다.
+	 * Chunk 분할이 원소 수로만 결정되므로, 같은 입력이라면 결합 순서가 항상 같습니다.
+	 *
+	 * @param Identity Reduce의 항등원
+	 * @param Map T(int32 Index)
+	 * @param Reduce T(const T&, const T&), 결합 법칙을 만족해야 합니다.
+	 */
+	template <typename T, typename MapFuncType, typename ReduceFuncType>
+		requires std::is_invocable_r_v<T, MapFuncType, int32> && std::is_invocable_r_v<T, ReduceFuncType, const T&, const T&>
+	T ParallelReduce(
+		int32 Num, const T& Identity, const MapFuncType& Map, const ReduceFuncType& Reduce, int32 MinChunkSize = Threshold::Reduce
+	)
+	{
+		const int32 NumChunks = GetNumChunks(Num, MinChunkSize);
+		if (NumChunks <= 1)
+		{
+			T Result = Identity;
+			for (int32 Index = 0; Index < Num; ++Index)
+			{
+				Result = Reduce(Result, Map(Index));
+			}
+			return Result;
+		}
+
+		TArray<T> Partials;
+		Partials.Init(Identity, NumChunks);
+		T* PartialData = Partials.GetData();
+
+		FJobSystem::Get().ParallelFor(NumChunks, [&](int32 ChunkIndex)
+		{
+			int32 Begin, End;
+			GetChunkRange(Num, NumChunks, ChunkIndex, Begin, End);
+
+			T Partial = Identity;
+			for (int32 Index = Begin; Index < End; ++Index)
+			{
+				Partial = Reduce(Partial, Map(Index));
+			}
+			PartialData[ChunkIndex] = Partial;
+		});
+
+		T Result = Identity;
+		for (const T& Partial : Partials)
+		{
+			Result = Reduce(Result, Partial);
+		}
+		return Result;
+	}
+
+	template <typename T, typename ReduceFuncType>
+		requires std::is_invocable_r_v<std::remove_const_t<T>, ReduceFuncType, const T&, const T&>
+	std::remove_const_t<T> ParallelReduce(
+		std::span<T> Items, const std::remove_const_t<T>& Identity, const ReduceFuncType& Reduce, int32 MinChunkSize = Threshold::Reduce
+	)
+	{
+		const T* Data = Items.data();
+		return ParallelReduce(
+			static_cast<int32>(Items.size()), Identity, [Data](int32 Index) -> std::remove_const_t<T> { return Data[Index]; },
+			Reduce, MinChunkSize
+		);
+	}
+
+	template <typename T, typename Allocator, typename ReduceFuncType>
+	T ParallelReduce(const TArray<T, Allocator>& Items, const T& Identity, const ReduceFuncType& Reduce, int32 MinChunkSize = Threshold::Reduce)
+	{
+		return ParallelReduce(std::span<const T>(Items.GetData(), Items.Num()), Identity, Reduce, MinChunkSize);
+	}
+
+	/**
+	 * Prefix Sum (Scan)
+	 *
+	 * 1. Chunk별 합계를 병렬로 구하고
+	 * 2. Chunk 합계를 직렬로 Scan한 뒤
+	 * 3. 각 Chunk를 자신의 Offset부터 병렬로 Scan합니다.
+	 *
+	 * @param In 입력, Out과 같아도 됩니다 (In-place)
+	 * @param Out 결과
+	 * @param bInclusive true면 Out[i] = In[0] + ... + In[i], false면 Out[i] = In[0] + ... + In[i - 1]
+	 */
+	template <typename T>
+	void ParallelPrefixSum(std::span<const T> In, std::span<T> Out, bool bInclusive = true, int32 MinChunkSize = Threshold::PrefixSum)
+	{
+		const int32 Num = static_cast<int32>(In.size() < Out.size() ? In.size() : Out.size());
+		const T* InData = In.data();
+		T* OutData = Out.data();
+
+		auto ScanRange = [InData, OutData, bInclusive](int32 Begin, int32 End, T Offset)
+		{
+			for (int32 Index = Begin; Index < End; ++Index)
+			{
+				const T Value = InData[Index];
+				if (bInclusive)
+				{
+					Offset += Value;
+					OutData[Index] = Offset;
+				}
+				else
+				{
+					OutData[Index] = Offset;
+					Offset += Value;
+				}
+			}
+		};
+
+		const int32 NumChunks = GetNumChunks(Num, MinChunkSize);
+		if (NumChunks <= 1)
+		{
+			ScanRange(0, Num, T{});
+			return;
+		}
+
+		TArray<T> ChunkOffsets;
+		ChunkOffsets.Init(T{}, NumChunks);
+		T* ChunkOffsetData = ChunkOffsets.GetData();
+
+		FJobSystem::Get().ParallelFor(NumChunks, [&](int32 ChunkIndex)
+		{
+			int32 Begin, End;
+			GetChunkRange(Num, NumChunks, ChunkIndex, Begin, End);
+
+			T Sum{};
+			for (int32 Index = Begin; Index < End; ++Index)
+			{
+				Sum += InData[Index];
+			}
+			ChunkOffsetData[ChunkIndex] = Sum;
+		});
+
+		T Running{};
+		for (T& ChunkOffset : ChunkOffsets)
+		{
+			const T ChunkSum = ChunkOffset;
+			ChunkOffset = Running;
+			Running += ChunkSum;
+		}
+
+		FJobSystem::Get().ParallelFor(NumChunks, [&](int32 ChunkIndex)
+		{
+			int32 Begin, End;
+			GetChunkRange(Num, NumChunks, ChunkIndex, Begin, End);
+			ScanRange(Begin, End, ChunkOffsetData[ChunkIndex]);
+		});
+	}
+
+	template <typename T, typename Allocator>
+	void ParallelPrefixSum(TArray<T, Allocator>& Items, bool bInclusive = true, int32 MinChunkSize = Threshold::PrefixSum)
+	{
+		std::span<T> Span(Items.GetData(), Items.Num());
+		ParallelPrefixSum(std::span<const T>(Span), Span, bInclusive, MinChunkSize);
+	}
+
+	/** float를 정렬 순서가 유지되는 uint32로 바꿉니다. (Radix Sort Key용) */
+	FORCEINLINE uint32 FloatToRadixKey(float Value)
+	{
+		uint32 Bits;
+		std::memcpy(&Bits, &Value, sizeof(float));
+		// 음수는 모든 비트를 뒤집고, 양수는 부호 비트만 뒤집음
+		const uint32 Mask = (Bits & 0x80000000u) ? 0xFFFFFFFFu : 0x80000000u;
+		return Bits ^ Mask;
+	}
+
+	/**
+	 * 안정(Stable) LSD Radix Sort, 8bit씩 Key의 크기만큼 Pass를 돕니다.
+	 *
+	 * 각 Pass는 Chunk별 Histogram을 병렬로 만들고, (Digit, Chunk) 순서로 Offset을 계산한 뒤 병렬로 Scatter합니다.
+	 * 모든 원소의 Digit이 같은 Pass는 건너뜁니다.
+	 *
+	 * @param Items 정렬할 배열
+	 * @param KeyFunc KeyType(const T&), KeyType은 부호 없는 정수 타입
+	 */
+	template <typename T, typename KeyFuncType>
+		requires std::is_unsigned_v<std::invoke_result_t<KeyFuncType, const T&>>
+	void ParallelRadixSort(std::span<T> Items, const KeyFuncType& KeyFunc, int32 MinChunkSize = Threshold::RadixSort)
+	{
+		using KeyType = std::invoke_result_t<KeyFuncType, const T&>;
+		constexpr int32 NumBuckets = 256;
+		constexpr int32 NumPasses = static_cast<int32>(sizeof(KeyType));
+
+		const int32 Num = static_cast<int32>(Items.size());
+		if (Num < Threshold::RadixSortMinimum)
+		{
+			std::stable_sort(Items.begin(), Items.end(), [&KeyFunc](const T& A, const T& B) { return KeyFunc(A) < KeyFunc(B); });
+			return;
+		}
+
+		const int32 NumChunks = GetNumChunks(Num, MinChunkSize);
+
+		TArray<T> Scratch;
+		Scratch.SetNum(Num);
+		TArray<uint32> Histograms;
+		Histograms.SetNum(NumChunks * NumBuckets);
+
+		T* Src = Items.data();
+		T* Dst = Scratch.GetData();
+		uint32* HistogramData = Histograms.GetData();
+
+		auto ForEachChunk = [NumChunks](const auto& Func)
+		{
+			if (NumChunks <= 1)
+			{
+				Func(0);
+			}
+			else
+			{
+				FJobSystem::Get().ParallelFor(NumChunks, Func);
+			}
+		};
+
+		for (int32 Pass = 0; Pass < NumPasses; ++Pass)
+		{
+			const int32 Shift = Pass * 8;
+
+			// 1. Chunk별 Histogram
+			ForEachChunk([&](int32 ChunkIndex)
+			{
+				uint32* Histogram = HistogramData + ChunkIndex * NumBuckets;
+				std::memset(Histogram, 0, sizeof(uint32) * NumBuckets);
+
+				int32 Begin, End;
+				GetChunkRange(Num, NumChunks, ChunkIndex, Begin, End);
+				for (int32 Index = Begin; Index < End; ++Index)
+				{
+					++Histogram[(KeyFunc(Src[Index]) >> Shift) & 0xFF];
+				}
+			});
+
+			// 모든 원소가 같은 Bucket이면 이 Pass는 순서를 바꾸지 않음
+			bool bSkipPass = false;
+			for (int32 Bucket = 0; Bucket < NumBuckets; ++Bucket)
+			{
+				uint32 Total = 0;
+				for (int32 ChunkIndex = 0; ChunkIndex < NumChunks; ++ChunkIndex)
+				{
+					Total += HistogramData[ChunkIndex * NumBuckets + Bucket];
+				}
+				if (Total == static_cast<uint32>(Num))
+				{
+					bSkipPass = true;
+					break;
+				}
+				if (Total != 0)
+				{
+					break;
+				}
+			}
+			if (bSkipPass)
+			{
+				continue;
+			}
+
+			// 2. (Digit, Chunk) 순서의 Exclusive Scan → 각 Chunk의 Bucket별 시작 위치
+			uint32 Offset = 0;
+			for (int32 Bucket = 0; Bucket < NumBuckets; ++Bucket)
+			{
+				for (int32 ChunkIndex = 0; ChunkIndex < NumChunks; ++ChunkIndex)
+				{
+					uint32& Count = HistogramData[ChunkIndex * NumBuckets + Bucket];
+					const uint32 BucketCount = Count;
+					Count = Offset;
+					Offset += BucketCount;
+				}
+			}
+
+			// 3. Scatter
+			ForEachChunk([&](int32 ChunkIndex)
+			{
+				uint32* Offsets = HistogramData + ChunkIndex * NumBuckets;
+
+				int32 Begin, End;
+				GetChunkRange(Num, NumChunks, ChunkIndex, Begin, End);
+				for (int32 Index = Begin; Index < End; ++Index)
+				{
+					const uint32 Bucket = static_cast<uint32>((KeyFunc(Src[Index]) >> Shift) & 0xFF);
+					Dst[Offsets[Bucket]++] = std::move(Src[Index]);
+				}
+			});
+
+			std::swap(Src, Dst);
+		}
+
+		// 홀수 번 Swap 했다면 결과가 Scratch에 있음
+		if (Src != Items.data())
+		{
+			T* Out = Items.data();
+			ParallelForChunked(Num, [Src, Out](int32 Begin, int32 End)
+			{
+				std::move(Src + Begin, Src + End, Out + Begin);
+			}, MinChunkSize);
+		}
+	}
+
+	template <typename T, typename Allocator, typename KeyFuncType>
+	void ParallelRadixSort(TArray<T, Allocator>& Items, const KeyFuncType& KeyFunc, int32 MinChunkSize = Threshold::RadixSort)
+	{
+		ParallelRadixSort(std::span<T>(Items.GetData(), Items.Num()), KeyFunc, MinChunkSize);
+	}
+
+	/**
+	 * 안정(Stable) Merge Sort
+	 *
+	 * Chunk별로 std::stable_sort를 병렬 실행한 뒤, 인접한 Chunk 쌍을 병렬로 Merge하는 단계를 반복합니다.
+	 *
+	 * @param Less bool(const T&, const T&)
+	 */
+	template <typename T, typename CompareType>
+		requires std::is_invocable_r_v<bool, CompareType, const T&, const T&>
+	void ParallelMergeSort(std::span<T> Items, const CompareType& Less, int32 MinChunkSize = Threshold::MergeSort)
+	{
+		const int32 Num = static_cast<int32>(Items.size());
+		const int32 NumChunks = GetNumChunks(Num, MinChunkSize);
+		if (NumChunks <= 1)
+		{
+			std::stable_sort(Items.begin(), Items.end(), Less);
+			return;
+		}
+
+		// Chunk 경계
+		TArray<int32> Bounds;
+		Bounds.SetNum(NumChunks + 1);
+		for (int32 ChunkIndex = 0; ChunkIndex < NumChunks; ++ChunkIndex)
+		{
+			int32 Begin, End;
+			GetChunkRange(Num, NumChunks, ChunkIndex, Begin, End);
+			Bounds[ChunkIndex] = Begin;
+		}
+		Bounds[NumChunks] = Num;
+
+		T* Src = Items.data();
+		FJobSystem::Get().ParallelFor(NumChunks, [&](int32 ChunkIndex)
+		{
+			std::stable_sort(Src + Bounds[ChunkIndex], Src + Bounds[ChunkIndex + 1], Less);
+		});
+
+		TArray<T> Scratch;
+		Scratch.SetNum(Num);
+		T* Dst = Scratch.GetData();
+
+		// 정렬된 Run들을 두 개씩 합침
+		for (int32 Width = 1; Width < NumChunks; Width *= 2)
+		{
+			const int32 NumMerges = (NumChunks + Width * 2 - 1) / (Width * 2);
+			FJobSystem::Get().ParallelFor(NumMerges, [&](int32 MergeIndex)
+			{
+				const int32 Left = MergeIndex * Width * 2;
+				const int32 Mid = Left + Width < NumChunks ? Left + Width : NumChunks;
+				const int32 Right = Left + Width * 2 < NumChunks ? Left + Width * 2 : NumChunks;
+
+				std::merge(
+					std::make_move_iterator(Src + Bounds[Left]), std::make_move_iterator(Src + Bounds[Mid]),
+					std::make_move_iterator(Src + Bounds[Mid]), std::make_move_iterator(Src + Bounds[Right]),
+					Dst + Bounds[Left], Less
+				);
+			});
+			std::swap(Src, Dst);
+		}
+
+		if (Src != Items.data())
+		{
+			T* Out = Items.data();
+			ParallelForChunked(Num, [Src, Out](int32 Begin, int32 End)
+			{
+				std::move(Src + Begin, Src + End, Out + Begin);
+			}, MinChunkSize);
+		}
+	}
+
+	/**
+	 * Key 추출 함수로 비교하는 안정 Merge Sort
+	 * @param KeyFunc KeyType(const T&), KeyType은 operator<를 지원해야 합니다.
+	 */
+	template <typename T, typename KeyFuncType>
+		requires (!std::is_invocable_v<KeyFuncType, const T&, const T&>)
+	void ParallelMergeSortByKey(std::span<T> Items, const KeyFuncType& KeyFunc, int32 MinChunkSize = Threshold::MergeSort)
+	{
+		ParallelMergeSort(Items, [&KeyFunc](const T& A, const T& B) { return KeyFunc(A) < KeyFunc(B); }, MinChunkSize);
+	}
+
+	template <typename T, typename Allocator, typename CompareType>
+	void ParallelMergeSort(TArray<T, Allocator>& Items, const CompareType& Less, int32 MinChunkSize = Threshold::MergeSort)
+	{
+		ParallelMergeSort(std::span<T>(Items.GetData(), Items.Num()), Less, MinChunkSize);
+	}
+
+	template <typename T, typename Allocator, typename KeyFuncType>
+	void ParallelMergeSortByKey(TArray<T, Allocator>& Items, const KeyFuncType& KeyFunc, int32 MinChunkSize = Threshold::MergeSort)
+	{
+		ParallelMergeSortByKey(std::span<T>(Items.GetData(), Items.Num()), KeyFunc, MinChunkSize);
+	}
+}
@@ -0,0 +1,148 @@
+#pragma once
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "Core/HAL/PlatformType.h"
+
+
+/**
+ * Chase-Lev Work-Stealing Deque
+ *
+ * Owner 스레드만 Push / Pop (Bottom 쪽)을 호출할 수 있고,
+ * 다른 스레드는 Steal (Top 쪽)으로만 작업을 가져갈 수 있습니다.
+ *
+ * 메모리 순서는 "Correct and Efficient Work-Stealing for Weak Memory Models" (Lê et al. 2013)를 따릅니다.
+ *
+ * @tparam T 포인터 타입 (nullptr는 '비어있음'을 의미합니다)
+ */
+template <typename T>
+	requires std::is_pointer_v<T>
+class TWorkStealingQueue
+{
+	struct FRingBuffer
+	{
+		int64 Capacity;
+		int64 Mask;
+		std::unique_ptr<std::atomic<T>[]> Items;
+
+		explicit FRingBuffer(int64 InCapacity)
+			: Capacity(InCapacity)
+			, Mask(InCapacity - 1)
+			, Items(new std::atomic<T>[InCapacity])
+		{
+		}
+
+		FORCEINLINE void Put(int64 Index, T Item) { Items[Index & Mask].store(Item, std::memory_order_relaxed); }
+		FORCEINLINE T Get(int64 Index) const { return Items[Index & Mask].load(std::memory_order_relaxed); }
+	};
+
+public:
+	/** @param InitialCapacity 초기 용량, 2의 거듭제곱이어야 합니다. */
+	explicit TWorkStealingQueue(int64 InitialCapacity = 1024)
+	{
+		Buffers.push_back(std::make_unique<FRingBuffer>(InitialCapacity));
+		Buffer.store(Buffers.back().get(), std::memory_order_relaxed);
+	}
+
+	TWorkStealingQueue(const TWorkStealingQueue&) = delete;
+	TWorkStealingQueue& operator=(const TWorkStealingQueue&) = delete;
+
+	/** Owner 스레드 전용: Bottom에 Item을 넣습니다. */
+	void Push(T Item)
+	{
+		const int64 B = Bottom.load(std::memory_order_relaxed);
+		const int64 Tp = Top.load(std::memory_order_acquire);
+		FRingBuffer* Buf = Buffer.load(std::memory_order_relaxed);
+
+		if (B - Tp > Buf->Capacity - 1)
+		{
+			Buf = Grow(Buf, B, Tp);
+		}
+
+		Buf->Put(B, Item);
+		std::atomic_thread_fence(std::memory_order_release);
+		Bottom.store(B + 1, std::memory_order_relaxed);
+	}
+
+	/** Owner 스레드 전용: Bottom에서 Item을 꺼냅니다. (LIFO) */
+	T Pop()
+	{
+		const int64 B = Bottom.load(std::memory_order_relaxed) - 1;
+		FRingBuffer* Buf = Buffer.load(std::memory_order_relaxed);
+		Bottom.store(B, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		int64 Tp = Top.load(std::memory_order_relaxed);
+
+		T Item = nullptr;
+		if (Tp <= B)
+		{
+			Item = Buf->Get(B);
+			if (Tp == B)
+			{
+				// 마지막 하나를 Steal과 경쟁
+				if (!Top.compare_exchange_strong(Tp, Tp + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+				{
+					Item = nullptr;
+				}
+				Bottom.store(B + 1, std::memory_order_relaxed);
+			}
+		}
+		else
+		{
+			Bottom.store(B + 1, std::memory_order_relaxed);
+		}
+		return Item;
+	}
+
+	/** 아무 스레드: Top에서 Item을 훔쳐옵니다. (FIFO) */
+	T Steal()
+	{
+		int64 Tp = Top.load(std::memory_order_acquire);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		const int64 B = Bottom.load(std::memory_order_acquire);
+
+		if (Tp < B)
+		{
+			const FRingBuffer* Buf = Buffer.load(std::memory_order_acquire);
+			T Item = Buf->Get(Tp);
+			if (!Top.compare_exchange_strong(Tp, Tp + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+			{
+				return nullptr;
+			}
+			return Item;
+		}
+		return nullptr;
+	}
+
+	bool IsEmpty() const
+	{
+		const int64 B = Bottom.load(std::memory_order_relaxed);
+		const int64 Tp = Top.load(std::memory_order_relaxed);
+		return B <= Tp;
+	}
+
+private:
+	FRingBuffer* Grow(FRingBuffer* OldBuf, int64 B, int64 Tp)
+	{
+		auto NewBuf = std::make_unique<FRingBuffer>(OldBuf->Capacity * 2);
+		for (int64 Index = Tp; Index < B; ++Index)
+		{
+			NewBuf->Put(Index, OldBuf->Get(Index));
+		}
+
+		// Steal 중인 스레드가 이전 버퍼를 읽고 있을 수 있으므로, 이전 버퍼는 Queue가 소멸될 때 해제합니다.
+		FRingBuffer* Result = NewBuf.get();
+		Buffers.push_back(std::move(NewBuf));
+		Buffer.store(Result, std::memory_order_release);
+		return Result;
+	}
+
+private:
+	alignas(64) std::atomic<int64> Top = 0;
+	alignas(64) std::atomic<int64> Bottom = 0;
+	alignas(64) std::atomic<FRingBuffer*> Buffer = nullptr;
+
+	// Owner 스레드만 수정합니다.
+	std::vector<std::unique_ptr<FRingBuffer>> Buffers;
+};
@@ -73,6 +73,7 @@ public:
     SizeType RemoveAll(const Predicate& Pred);
 
     T* GetData();
+    const T* GetData() const;
 
     /**
      * Array에서 Item을 찾습니다.
@@ -241,6 +242,12 @@ T* TArray<T, Allocator>::GetData()
     return PrivateVector.data();
 }
 
+template <typename T, typename Allocator>
+const T* TArray<T, Allocator>::GetData() const
+{
+    return PrivateVector.data();
+}
+
 template <typename T, typename Allocator>
 typename TArray<T, Allocator>::SizeType TArray<T, Allocator>::Find(const T& Item)
 {
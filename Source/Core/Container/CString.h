@@ -2,6 +2,9 @@
 #include <cstring>
 #include <cwchar>
 #include <cctype>
+#include <cwctype>
+
+#include "Core/HAL/PlatformType.h"
 
 
 template <typename T>
@@ -22,7 +25,7 @@ public:
         }
         else
         {
-            static_assert(false, "Unsupported character type!");
+            static_assert(TAlwaysFalse<CharType>, "Unsupported character type!");
             return nullptr;
         }
     }
@@ -39,7 +42,7 @@ public:
         }
         else
         {
-            static_assert(false, "Unsupported character type!");
+            static_assert(TAlwaysFalse<CharType>, "Unsupported character type!");
             return nullptr;
         }
     }
@@ -56,7 +59,7 @@ public:
         }
         else
         {
-            static_assert(false, "Unsupported character type!");
+            static_assert(TAlwaysFalse<CharType>, "Unsupported character type!");
             return nullptr;
         }
     }
@@ -102,7 +105,7 @@ public:
         }
         else
         {
-            static_assert(false, "Unsupported character type!");
+            static_assert(TAlwaysFalse<CharType>, "Unsupported character type!");
             return 0;
         }
     }
@@ -119,7 +122,7 @@ public:
         }
         else
         {
-            static_assert(false, "Unsupported character type!");
+            static_assert(TAlwaysFalse<CharType>, "Unsupported character type!");
             return 0;
         }
     }
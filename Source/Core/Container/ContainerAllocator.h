@@ -25,7 +25,7 @@ struct TBitsToSizeType
 {
     // ReSharper disable once CppStaticAssertFailure
     // IndexSize가 8, 16, 32, 64중에 하나가 아니라면 컴파일 에러
-    static_assert(false, "Unsupported allocator index size.");
+    static_assert(TAlwaysFalseValue<IndexSize>, "Unsupported allocator index size.");
 };
 
 template <> struct TBitsToSizeType<8>  { using Type = int8; };
@@ -76,6 +76,10 @@ public:
 public:
     constexpr T* allocate(size_type n) noexcept;
     constexpr void deallocate(T* p, size_type n) noexcept;
+
+    // 상태가 없는 Allocator이므로 항상 같습니다.
+    template <typename U>
+    constexpr bool operator==(const TContainerAllocator<U, IndexSize>&) const noexcept { return true; }
 };
 
 template <typename T, int IndexSize>
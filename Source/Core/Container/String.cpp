@@ -87,6 +87,11 @@ int32 FString::Find(
     const ElementType* SubStrPtr = *SubStr;
     const int32 StrLen = Len();
     const int32 SubStrLen = SubStr.Len();
+    if (SubStrLen > StrLen)
+    {
+        // 아래 Clamp 범위가 뒤집혀서 문자열 밖을 읽게 됨
+        return INDEX_NONE;
+    }
 
     auto CompareFunc = [SearchCase](ElementType A, ElementType B) -> bool {
         return (SearchCase == ESearchCase::IgnoreCase) ? 
@@ -249,7 +249,7 @@ struct std::hash<FString>
 {
 	size_t operator()(const FString& Key) const noexcept
 	{
-		return hash<FString::BaseStringType>()(Key.PrivateString);
+		return std::hash<std::basic_string_view<FString::ElementType>>()(Key.PrivateString);
 	}
 };
 
@@ -1,6 +1,14 @@
 #include "Engine.h"
 
+#include <algorithm>
+#include <cfloat>
+#include <cstring>
+
+#include "Async/JobSystem.h"
+#include "Config/ConfigManager.h"
 #include "Debug/DebugDrawManager.h"
+#include "HAL/PlatformTime.h"
+#include "Headless/HeadlessScript.h"
 #include "Input/PlayerController.h"
 #include "Input/PlayerInput.h"
 #include "Math/Vector.h"
@@ -8,12 +16,33 @@
 #include "Object/Assets/AssetManager.h"
 #include "Object/World/World.h"
 #include "Rendering/FDevice.h"
+#include "Rendering/RenderingThread.h"
+#include "RHI/D3D11RHI.h"
+#include "RHI/NullRHI.h"
+#include "RHI/RHIStateTracking.h"
+#include "RHI/RHIStatsContext.h"
+#include "Stats/ProfilerServer.h"
+#include "Stats/StatCounter.h"
+#include "Stats/Stats.h"
 #include "Static/FEditorManager.h"
+#include "Static/FPickingManager.h"
 #include "Static/FLineBatchManager.h"
 
 
 class AArrow;
 class APicker;
+
+namespace
+{
+/** 한 프레임의 RHI 명령이 모두 실행된 뒤 (Render Thread 또는 Inline), 렌더링 Counter를 지난 프레임 값으로 넘김 */
+void EndRenderStatsFrame()
+{
+	FRHI::Get().EndFrame();
+	FStatCounterRegistry::Get().EndFrame();
+}
+}
+
+#if PLATFORM_WINDOWS
 // ImGui WndProc 정의
 extern LRESULT ImGui_ImplWin32_WndProcHandler(HWND hWnd, UINT msg, WPARAM wParam, LPARAM lParam);
 
@@ -53,6 +82,7 @@ LRESULT UEngine::WndProc(HWND hWnd, UINT uMsg, WPARAM wParam, LPARAM lParam)
 
 	return 0;
 }
+#endif
 
 void UEngine::Initialize(
 	HINSTANCE hInstance, const WCHAR* InWindowTitle, const WCHAR* InWindowClassName, uint32 InScreenWidth,
@@ -67,10 +97,24 @@ void UEngine::Initialize(
 	ScreenWidth = InScreenWidth;
 	ScreenHeight = InScreenHeight;
 
+	PROFILER_THREAD_NAME("GameThread");
+	FJobSystem::Get().Initialize();
+
     InitWindow(InScreenWidth, InScreenHeight);
 
 	InitWorld();
 	FDevice::Get().Init(WindowHandle);
+	{
+		// 이미 같은 값이 바인딩되어 있는 Set* 호출은 D3D11까지 가지 않도록 걸러냄
+		std::unique_ptr<FRHICommandContext> Context = std::make_unique<FRHIStateTrackingContext>(
+			std::make_unique<FD3D11RHI>(FDevice::Get().GetDevice(), FDevice::Get().GetDeviceContext())
+		);
+#if STATS
+		// Draw Call / 바인딩 / 업로드를 세서 Render Stats 창과 stat 명령에서 표시, 중복 바인딩은 걸러내기 전 기준
+		Context = std::make_unique<FRHIStatsContext>(std::move(Context));
+#endif
+		FRHI::SetContext(std::move(Context));
+	}
     InitRenderer();
 	UDebugDrawManager::Get().Initialize();
 
@@ -78,57 +122,197 @@ void UEngine::Initialize(
 	InitializedScreenHeight = ScreenHeight;
     ui.Initialize(WindowHandle, FDevice::Get(), ScreenWidth, ScreenHeight);
 
-	UAssetManager::Get().RegisterAssetMetaDatas(); // 나중에 멀티쓰레드로?
-	FEditorManager::Get().Init(); // 나중에 멀티쓰레드로?
+	// 파일 시스템 탐색은 Worker에서, UUID 텍스처 생성은 Main Thread에서 동시에 진행
+	FJobCounter InitCounter;
+	FJobSystem::Get().Submit([] { UAssetManager::Get().RegisterAssetMetaDatas(); }, &InitCounter, EJobPriority::High);
+	FEditorManager::Get().Init();
+	FJobSystem::Get().Wait(InitCounter);
+
+	// [Render] RenderThread = false면 기존처럼 Main Thread에서 렌더링
+	const FString RenderThreadValue = UConfigManager::Get().GetValue(TEXT("Render"), TEXT("RenderThread"));
+	const FString MaxFrameLagValue = UConfigManager::Get().GetValue(TEXT("Render"), TEXT("MaxFrameLag"));
+	const int32 MaxFrameLag = MaxFrameLagValue.IsEmpty() ? 1 : std::stoi(MaxFrameLagValue.GetData());
+	FRenderingThread::Get().Start(MaxFrameLag, RenderThreadValue != "false");
+
+	// [World] FixedTickRate = 0이면 기존처럼 렌더링 프레임마다 Tick만 실행
+	const FString FixedTickRateValue = UConfigManager::Get().GetValue(TEXT("World"), TEXT("FixedTickRate"));
+	const FString MaxFixedStepsValue = UConfigManager::Get().GetValue(TEXT("World"), TEXT("MaxFixedStepsPerFrame"));
+	SetFixedTickRate(
+		FixedTickRateValue.IsEmpty() ? 0 : std::stoi(FixedTickRateValue.GetData()),
+		MaxFixedStepsValue.IsEmpty() ? 8 : std::stoi(MaxFixedStepsValue.GetData())
+	);
+
+	// [Render] FrameRateLimit = 0이면 제한 없음
+	const FString FrameRateLimitValue = UConfigManager::Get().GetValue(TEXT("Render"), TEXT("FrameRateLimit"));
+	FramePacer.SetTargetFPS(FrameRateLimitValue.IsEmpty() ? 750 : std::stoi(FrameRateLimitValue.GetData()));
+
+	// [Stats] HitchThresholdMs = 0이면 Hitch 감지 안 함, HitchCapture = true면 Hitch마다 Trace 저장
+	FHitchSettings HitchSettings;
+	const FString HitchThresholdValue = UConfigManager::Get().GetValue(TEXT("Stats"), TEXT("HitchThresholdMs"));
+	const FString HitchCaptureValue = UConfigManager::Get().GetValue(TEXT("Stats"), TEXT("HitchCapture"));
+	if (!HitchThresholdValue.IsEmpty())
+	{
+		HitchSettings.ThresholdMs = std::stod(HitchThresholdValue.GetData());
+	}
+	HitchSettings.bCapture = HitchCaptureValue == "true";
+	FrameStats.SetHitchSettings(HitchSettings);
+
+	// [Profiler] ServerPort = 0이면 Live Profiler 전송 안 함
+	const FString ProfilerPortValue = UConfigManager::Get().GetValue(TEXT("Profiler"), TEXT("ServerPort"));
+	if (!ProfilerPortValue.IsEmpty() && std::stoi(ProfilerPortValue.GetData()) > 0)
+	{
+		FProfilerServer::Get().Start(static_cast<uint16>(std::stoi(ProfilerPortValue.GetData())));
+	}
+
 	UE_LOG("Engine Initialized!");
 }
 
+void UEngine::InitializeHeadless(const FHeadlessSettings& InSettings, uint32 InScreenWidth, uint32 InScreenHeight)
+{
+	bIsHeadless = true;
+	HeadlessSettings = InSettings;
+	ScreenWidth = InitializedScreenWidth = InScreenWidth;
+	ScreenHeight = InitializedScreenHeight = InScreenHeight;
+
+	// Console 창이 없으므로 로그를 표준 출력으로
+	Debug::SetEchoToStdout(true);
+
+	PROFILER_THREAD_NAME("GameThread");
+	FJobSystem::Get().Initialize();
+
+	// Window, Device, Renderer, UI는 만들지 않고, RHI는 Null 백엔드 사용
+	{
+		// Shader / Input Layout이 없으므로 바인딩 검사는 끄고 Window 모드와 같은 Decorator만 씌움
+		std::unique_ptr<FRHICommandContext> Context = std::make_unique<FRHIStateTrackingContext>(std::make_unique<FNullRHI>(false));
+#if STATS
+		Context = std::make_unique<FRHIStatsContext>(std::move(Context));
+#endif
+		FRHI::SetContext(std::move(Context));
+	}
+	// World Render가 기록한 Command는 Window 모드와 같이 Render Thread에서 Null RHI로 실행
+	FRenderingThread::Get().Start(HeadlessSettings.MaxFrameLag, HeadlessSettings.bRenderThread);
+
+	// Bounds 계산에 필요한 Mesh만 CPU 데이터로 생성
+	FDevice::Get().InitMeshResource();
+	InitWorld();
+
+	// editor.ini와 상관없이 명령줄로만 정해서 실행 결과가 설정 파일에 따라 바뀌지 않게 함
+	SetFixedTickRate(HeadlessSettings.FixedTickRate, HeadlessSettings.MaxFixedStepsPerFrame);
+	FramePacer.SetTargetFPS(HeadlessSettings.TargetFPS);
+	if (HeadlessSettings.ProfilerPort > 0)
+	{
+		FProfilerServer::Get().Start(static_cast<uint16>(HeadlessSettings.ProfilerPort));
+	}
+
+	FHitchSettings HitchSettings;
+	HitchSettings.ThresholdMs = HeadlessSettings.HitchThresholdMs;
+	HitchSettings.bCapture = !HeadlessSettings.HitchCaptureDirectory.IsEmpty();
+	if (HitchSettings.bCapture)
+	{
+		HitchSettings.CaptureDirectory = HeadlessSettings.HitchCaptureDirectory;
+	}
+	FrameStats.SetHitchSettings(HitchSettings);
+
+	UE_LOG(
+		"Engine Initialized! (headless, frames %d, fps %d, fixed dt %.4f, fixed rate %d)",
+		HeadlessSettings.MaxFrames, HeadlessSettings.TargetFPS, HeadlessSettings.FixedDeltaTime, HeadlessSettings.FixedTickRate
+	);
+}
+
+void UEngine::SetFixedTickRate(int32 TicksPerSecond, int32 MaxStepsPerFrame)
+{
+	FixedTimestep.Configure(TicksPerSecond, MaxStepsPerFrame);
+	if (!FixedTimestep.IsEnabled() && World)
+	{
+		World->ClearRenderTransforms();
+	}
+}
+
+void UEngine::TickFixedSteps(float DeltaTime)
+{
+	const int32 NumSteps = FixedTimestep.Advance(DeltaTime);
+	for (int32 Step = 0; Step < NumSteps; ++Step)
+	{
+		World->TickFixed(FixedTimestep.GetStepSeconds());
+	}
+}
+
+void UEngine::UpdateProfilerCounters()
+{
+	PROFILER_COUNTER("Frame ms", EngineDeltaTime * 1000.0f);
+	PROFILER_COUNTER("Actors", World->GetActors().Num());
+
+	const FViewCullingStats& Culling = World->GetCullingStats();
+	PROFILER_COUNTER("Visible Primitives", Culling.NumVisible);
+	PROFILER_COUNTER("Culled Primitives", Culling.NumCulled);
+	PROFILER_COUNTER("Occluded Primitives", Culling.NumOccluded);
+
+	PROFILER_COUNTER("RenderThread ms", FRenderingThread::Get().GetRenderThreadFrameMs());
+}
+
 void UEngine::Run()
 {
-	// FPS 제한
-	constexpr int TargetFPS = 750;
-	constexpr double TargetDeltaTime = 1000.0f / TargetFPS; // 1 FPS의 목표 시간 (ms)
+#if PLATFORM_WINDOWS
+	if (!bIsHeadless)
+	{
+		RunWindowed();
+		return;
+	}
+#endif
+	RunHeadless();
+}
 
-	// 고성능 타이머 초기화
-	LARGE_INTEGER Frequency;
-	QueryPerformanceFrequency(&Frequency);
+#if PLATFORM_WINDOWS
+void UEngine::RunWindowed()
+{
+	uint64 StartTime = FPlatformTime::Cycles64();
 
-	LARGE_INTEGER StartTime;
-	QueryPerformanceCounter(&StartTime);
+	// Scene 로드도 첫 프레임으로 기록해서 오래 걸리면 Hitch로 잡히게 함
+	PROFILER_FRAME_MARKER();
+	FrameStats.BeginFrame();
 
-	UAssetManager::Get().LoadAssets(); // 나중에 멀티쓰레드로?
+	// Scene 로드는 FObjectFactory로 GObjects에 등록하므로 Main Thread에서 진행
+	UAssetManager::Get().LoadAssets();
 
 	IsRunning = true;
 	while (IsRunning)
 	{
+		PROFILER_FRAME_MARKER();
+		FProfilerServer::Get().Tick();
+		FrameStats.BeginFrame();
+
 		// DeltaTime 계산 (초 단위)
-		const LARGE_INTEGER EndTime = StartTime;
-		QueryPerformanceCounter(&StartTime);
+		const uint64 EndTime = StartTime;
+		StartTime = FPlatformTime::Cycles64();
 
-		EngineDeltaTime = static_cast<float>(StartTime.QuadPart - EndTime.QuadPart) / static_cast<float>(Frequency.QuadPart);
+		EngineDeltaTime = static_cast<float>(FPlatformTime::ToSeconds(StartTime - EndTime));
 		// 메시지(이벤트) 처리
-		MSG Msg;
-		while (PeekMessage(&Msg, nullptr, 0, 0, PM_REMOVE))
 		{
-			// 키 입력 메시지를 번역
-			TranslateMessage(&Msg);
+			SCOPE_CYCLE_COUNTER("Input");
 
-			// 메시지를 등록한 Proc에 전달
-			DispatchMessage(&Msg);
-
-			if (Msg.message == WM_QUIT)
+			MSG Msg;
+			while (PeekMessage(&Msg, nullptr, 0, 0, PM_REMOVE))
 			{
-				IsRunning = false;
-				break;
-			}
+				// 키 입력 메시지를 번역
+				TranslateMessage(&Msg);
 
-		}
+				// 메시지를 등록한 Proc에 전달
+				DispatchMessage(&Msg);
+
+				if (Msg.message == WM_QUIT)
+				{
+					IsRunning = false;
+					break;
+				}
 
-		if (!ImGui::GetIO().WantCaptureMouse)
-		{		
-			FVector winSize = Renderer->GetFrameBufferWindowSize();
-			APlayerInput::Get().Update(WindowHandle, winSize.X, winSize.Y);
-			APlayerController::Get().ProcessPlayerInput(EngineDeltaTime);
+			}
+
+			if (!ImGui::GetIO().WantCaptureMouse)
+			{		
+				FVector winSize = Renderer->GetFrameBufferWindowSize();
+				APlayerInput::Get().Update(WindowHandle, winSize.X, winSize.Y);
+				APlayerController::Get().ProcessPlayerInput(EngineDeltaTime);
+			}
 		}
 
 
@@ -137,14 +321,24 @@ void UEngine::Run()
 
 
 		// World Update
+		// Render Thread가 이전 프레임을 그리는 동안 이번 프레임의 Render Command를 기록
 		if (World)
 		{
-			FDevice::Get().Prepare();
+			ENQUEUE_RENDER_COMMAND([] { FDevice::Get().Prepare(); });
+			TickFixedSteps(EngineDeltaTime);
 			World->Tick(EngineDeltaTime);
+			if (FixedTimestep.IsEnabled())
+			{
+				World->InterpolateRenderTransforms(FixedTimestep.GetAlpha());
+			}
 			World->Render();
 
-			FEditorManager::Get().LateTick(EngineDeltaTime);
+			{
+				SCOPE_CYCLE_COUNTER("Editor LateTick");
+				FEditorManager::Get().LateTick(EngineDeltaTime);
+			}
 		    World->LateTick(EngineDeltaTime);
+			UpdateProfilerCounters();
 		}
 
         //각 Actor에서 TickActor() -> PlayerTick() -> TickPlayerInput() 호출하는데 지금은 Message에서 처리하고 있다
@@ -155,34 +349,207 @@ void UEngine::Run()
 		// ui Update
         ui.Update();
 
-        FDevice::Get().SwapBuffer();
-
-        // FPS 제한
-        double ElapsedTime;
-        do
+        ENQUEUE_RENDER_COMMAND([]
         {
-            Sleep(0);
+            FDevice::Get().SwapBuffer();
+            EndRenderStatsFrame();
+        });
 
-            LARGE_INTEGER CurrentTime;
-            QueryPerformanceCounter(&CurrentTime);
+        // 기록한 프레임을 넘기고, Render Thread가 MaxFrameLag 프레임 이상 밀려 있으면 대기
+        FRenderingThread::Get().EndFrame();
 
-            ElapsedTime = static_cast<double>(CurrentTime.QuadPart - StartTime.QuadPart) * 1000.0 / static_cast<double>(Frequency.QuadPart);
-        } while (ElapsedTime < TargetDeltaTime);
+        // FPS 제한, 대부분은 OS Sleep으로 쉬고 마지막 수십 us만 Spin
+        FramePacer.WaitForNextFrame();
     }
 }
+#endif
+
+void UEngine::RunHeadless()
+{
+	FHeadlessScript Script;
+	if (!HeadlessSettings.ScriptPath.IsEmpty() && !Script.Load(HeadlessSettings.ScriptPath))
+	{
+		return;
+	}
+
+	PROFILER_FRAME_MARKER();
+	FrameStats.BeginFrame();
+	if (!HeadlessSettings.SceneName.IsEmpty())
+	{
+		World->LoadWorld(*HeadlessSettings.SceneName);
+	}
+
+	uint64 FrameCount = 0;
+	double TotalWorkMs = 0.0;
+	double MinWorkMs = DBL_MAX;
+	double MaxWorkMs = 0.0;
+
+	const uint64 RunStart = FPlatformTime::Cycles64();
+	uint64 LastFrameStart = RunStart;
+	FramePacer.ResetStats();
+
+	IsRunning = true;
+	while (IsRunning)
+	{
+		PROFILER_FRAME_MARKER();
+		FProfilerServer::Get().Tick();
+		FrameStats.BeginFrame();
+
+		const uint64 FrameStart = FPlatformTime::Cycles64();
+		if (HeadlessSettings.FixedDeltaTime > 0.0f)
+		{
+			EngineDeltaTime = HeadlessSettings.FixedDeltaTime;
+		}
+		else if (FixedTimestep.IsEnabled())
+		{
+			// 실제 경과 시간 대신 한 프레임에 Step 하나, -fps=0이면 시뮬레이션을 최대한 빨리 진행
+			EngineDeltaTime = FixedTimestep.GetStepSeconds();
+		}
+		else
+		{
+			EngineDeltaTime = static_cast<float>(FPlatformTime::ToSeconds(FrameStart - LastFrameStart));
+		}
+		LastFrameStart = FrameStart;
+
+		if (Script.IsLoaded())
+		{
+			SCOPE_CYCLE_COUNTER("Headless Script");
+			if (!Script.Tick(*World))
+			{
+				IsRunning = false;
+			}
+		}
+
+		TickFixedSteps(EngineDeltaTime);
+		World->Tick(EngineDeltaTime);
+		if (FixedTimestep.IsEnabled())
+		{
+			World->InterpolateRenderTransforms(FixedTimestep.GetAlpha());
+		}
+		World->Render();
+		World->LateTick(EngineDeltaTime);
+		UpdateProfilerCounters();
+
+		ENQUEUE_RENDER_COMMAND([] { EndRenderStatsFrame(); });
+		FRenderingThread::Get().EndFrame();
+
+		const double WorkMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - FrameStart);
+		TotalWorkMs += WorkMs;
+		MinWorkMs = std::min(MinWorkMs, WorkMs);
+		MaxWorkMs = std::max(MaxWorkMs, WorkMs);
+
+		++FrameCount;
+		if (HeadlessSettings.MaxFrames > 0 && FrameCount >= static_cast<uint64>(HeadlessSettings.MaxFrames))
+		{
+			IsRunning = false;
+		}
+
+		// FPS 제한, 0이면 제한 없이 바로 다음 프레임
+		FramePacer.WaitForNextFrame();
+	}
+
+	// 아직 Render Thread에 남은 프레임까지 실행해야 아래 stat 합계에 들어감
+	FRenderingThread::Get().Flush();
+
+	const double TotalSeconds = FPlatformTime::ToSeconds(FPlatformTime::Cycles64() - RunStart);
+	UE_LOG(
+		"[Headless] %llu frames in %.3f s, tick avg %.4f ms (min %.4f, max %.4f), %d actors",
+		FrameCount, TotalSeconds, FrameCount > 0 ? TotalWorkMs / FrameCount : 0.0,
+		FrameCount > 0 ? MinWorkMs : 0.0, MaxWorkMs, World->GetActors().Num()
+	);
+	if (FramePacer.GetTargetFPS() > 0)
+	{
+		const FFramePacerStats& Pacing = FramePacer.GetStats();
+		UE_LOG(
+			"[Headless] paced to %d fps: frame avg %.4f ms, jitter %.1f us, wake error avg %.1f us (max %.1f), %llu late, wait CPU %.1f%%",
+			FramePacer.GetTargetFPS(), Pacing.AverageFrameMs, Pacing.FrameJitterUs, Pacing.AverageWakeErrorUs, Pacing.MaxWakeErrorUs,
+			Pacing.NumLateFrames, Pacing.WaitCPUPercent
+		);
+	}
+	if (FixedTimestep.IsEnabled())
+	{
+		UE_LOG(
+			"[Headless] %llu fixed steps at %d Hz (%llu dropped over %d per frame)",
+			FixedTimestep.GetNumSteps(), FixedTimestep.GetTicksPerSecond(), FixedTimestep.GetNumDroppedSteps(), FixedTimestep.GetMaxStepsPerFrame()
+		);
+	}
+
+
+	// 마지막 프레임은 아직 기록 전이므로 여기서 닫음
+	FrameStats.BeginFrame();
+	const FFrameTimeSummary FrameTimes = FrameStats.GetTotalSummary();
+	UE_LOG(
+		"[Headless] frame time p50 %.3f ms, p95 %.3f ms, p99 %.3f ms, max %.3f ms, %llu hitch(es) over %.1f ms (worst %.2f ms, %d captured)",
+		FrameTimes.P50Ms, FrameTimes.P95Ms, FrameTimes.P99Ms, FrameTimes.MaxMs,
+		FrameStats.GetNumHitches(), FrameStats.GetHitchSettings().ThresholdMs, FrameStats.GetWorstHitchMs(), FrameStats.GetNumHitchCaptures()
+	);
+
+	// 한 번이라도 값이 있었던 Counter만 Group별로 프레임당 평균
+	const FStatCounterRegistry& StatCounters = FStatCounterRegistry::Get();
+	for (const char* Group : StatCounters.GetGroups())
+	{
+		FString Line;
+		for (const FStatCounter* Counter : StatCounters.GetCounters())
+		{
+			if (std::strcmp(Counter->GetGroup(), Group) == 0 && Counter->GetTotalValue() > 0)
+			{
+				char Entry[128];
+				snprintf(Entry, sizeof(Entry), "%s%s %.1f", Line.IsEmpty() ? "" : ", ", Counter->GetName(),
+					static_cast<double>(Counter->GetTotalValue()) / static_cast<double>(std::max<uint64>(1, StatCounters.GetNumFrames())));
+				Line += Entry;
+			}
+		}
+		if (!Line.IsEmpty())
+		{
+			UE_LOG("[Headless] stat %s (per frame): %s", Group, *Line);
+		}
+	}
+
+	if (FProfilerServer::Get().IsRunning())
+	{
+		const FProfilerServerStats ProfilerStats = FProfilerServer::Get().GetStats();
+		UE_LOG(
+			"[Headless] profiler stream: %llu frames sent (%.1f KB), %llu dropped",
+			ProfilerStats.SentFrames, ProfilerStats.SentBytes / 1024.0, ProfilerStats.DroppedFrames
+		);
+	}
+
+	if (Script.GetNumFailures() > 0)
+	{
+		UE_LOG("[Headless] %d script command(s) failed", Script.GetNumFailures());
+		ExitCode = 1;
+	}
+}
 
 
 void UEngine::Shutdown()
 {
+	FProfilerServer::Get().Stop();
+	FrameStats.WaitForCaptures();
+
+	FRenderingThread::Get().Stop();
+
+	if (bIsHeadless)
+	{
+		World->OnDestroy();
+		FJobSystem::Get().Shutdown();
+		return;
+	}
+
 	World->OnDestroy();
+	FPickingManager::Get().Release();
 	Renderer->Release();
+	FRHI::SetContext(nullptr);
 	FDevice::Get().Release();
     ShutdownWindow();
+
+	FJobSystem::Get().Shutdown();
 }
 
 
 void UEngine::InitWindow(int InScreenWidth, int InScreenHeight)
 {
+#if PLATFORM_WINDOWS
     // 윈도우 클래스 등록
     WNDCLASSW wnd_class{};
     wnd_class.lpfnWndProc = WndProc;
@@ -217,6 +584,9 @@ void UEngine::InitWindow(int InScreenWidth, int InScreenHeight)
     //freopen_s((FILE**)stdin, "CONIN$", "r", stdin);
 
     //std::cout << "Debug Console Opened!" << '\n';
+#else
+    MsgBoxAssert("Windowed mode is not supported on this platform, use the headless mode");
+#endif
 }
 
 void UEngine::InitRenderer()
@@ -243,7 +613,10 @@ void UEngine::InitWorld()
 	//FLineBatchManager::Get().AddLine(FVector{ 6.0f,6.0f,7.0f }, { -6.f,-6.f,-7.0f });
 	//FLineBatchManager::Get().AddLine(FVector{ 6.0f,6.0f,8.0f }, { -6.f,-6.f,-8.0f });
 
-	FLineBatchManager::Get().DrawWorldGrid(World->GetGridSize(), World->GetGridSize() / 100.f);
+	if (!bIsHeadless)
+	{
+		FLineBatchManager::Get().DrawWorldGrid(World->GetGridSize(), World->GetGridSize() / 100.f);
+	}
 
     //// Test
     //AArrow* Arrow = World->SpawnActor<AArrow>();
@@ -254,11 +627,13 @@ void UEngine::InitWorld()
 
 void UEngine::ShutdownWindow()
 {
+#if PLATFORM_WINDOWS
     DestroyWindow(WindowHandle);
     WindowHandle = nullptr;
 
     UnregisterClassW(WindowClassName, WindowInstance);
     WindowInstance = nullptr;
+#endif
 
 	ui.Shutdown();
 }
@@ -273,6 +648,9 @@ void UEngine::UpdateWindowSize(uint32 InScreenWidth, uint32 InScreenHeight)
 	{
 		return;
 	}
+
+	// 버퍼를 다시 만들기 전에 Render Thread가 이전 프레임을 모두 그릴 때까지 대기
+	FRenderingThread::Get().Flush();
 	
 	FDevice::Get().OnUpdateWindowSize(ScreenWidth, ScreenHeight);
 
@@ -298,3 +676,12 @@ UObject* UEngine::GetObjectByUUID(uint32 InUUID) const
     }
     return nullptr;
 }
+
+void UEngine::RemoveObject(uint32 InUUID)
+{
+    if (const auto Obj = GObjects.Find(InUUID))
+    {
+        FRenderingThread::Get().DeferRelease(*Obj);
+        GObjects.Remove(InUUID);
+    }
+}
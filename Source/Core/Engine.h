@@ -3,9 +3,13 @@
 
 #include "AbstractClass/Singleton.h"
 #include "Container/Map.h"
+#include "FixedTimestep.h"
+#include "FramePacer.h"
 #include "HAL/PlatformType.h"
+#include "Headless/HeadlessSettings.h"
 #include "Rendering/UI.h"
 #include "Rendering/URenderer.h"
+#include "Stats/FrameStats.h"
 #include "UObject/Casts.h"
 
 class UObject;
@@ -38,6 +42,15 @@ public:
         HINSTANCE hInstance, const WCHAR* InWindowTitle, const WCHAR* InWindowClassName, uint32 InScreenWidth,
 		uint32 InScreenHeight, EScreenMode InScreenMode = EScreenMode::Windowed
     );
+
+    /**
+     * Window, Device, UI 없이 World만 실행하도록 초기화합니다. RHI는 Null 백엔드를 사용합니다.
+     * @param InSettings 종료 조건, 프레임 속도, Script 등
+     * @param InScreenWidth Camera 투영에 사용할 화면 너비
+     * @param InScreenHeight Camera 투영에 사용할 화면 높이
+     */
+    void InitializeHeadless(const FHeadlessSettings& InSettings, uint32 InScreenWidth, uint32 InScreenHeight);
+
     void Run();
 
     /**
@@ -54,7 +67,35 @@ public:
 
 	static float GetDeltaTime() { return UEngine::Get().EngineDeltaTime; }
 
+    /**
+     * 초당 TicksPerSecond번 UWorld::TickFixed를 실행하고, 렌더링은 마지막 두 Step 사이를 보간합니다.
+     * @param TicksPerSecond 0이면 끄고 Tick만 실행
+     * @param MaxStepsPerFrame 한 프레임에 따라잡을 최대 Step 수, 그보다 밀린 시간은 버림
+     */
+    void SetFixedTickRate(int32 TicksPerSecond, int32 MaxStepsPerFrame);
+    const FFixedTimestep& GetFixedTimestep() const { return FixedTimestep; }
+
+    /** 프레임 끝에서 목표 FPS까지 기다리는 Frame Limiter, 목표 FPS / 통계는 여기서 바꾸고 읽음 */
+    FFramePacer& GetFramePacer() { return FramePacer; }
+
+    /** 프레임 시간 백분위수 / Hitch 감지 */
+    FFrameStats& GetFrameStats() { return FrameStats; }
+
+    bool IsHeadless() const { return bIsHeadless; }
+
+    /** Headless Script의 compare가 실패하면 1 */
+    int GetExitCode() const { return ExitCode; }
+
 private:
+    void RunWindowed();
+    void RunHeadless();
+
+    /** 이번 프레임의 DeltaTime만큼 Fixed Step을 실행 (World->Tick 전) */
+    void TickFixedSteps(float DeltaTime);
+
+    /** 이번 프레임의 Actor 수, Culling 결과 등을 Profiler Counter로 (Live Profiler에서 표시) */
+    void UpdateProfilerCounters();
+
     void InitWindow(int InScreenWidth, int InScreenHeight);
     //void InitDevice();
     void InitRenderer();
@@ -72,11 +113,18 @@ public:
     ObjectType* GetObjectByUUID(uint32 InUUID) const;
     UObject* GetObjectByUUID(uint32 InUUID) const;
 
+    /** GObjects에서 제거합니다. Render Thread가 아직 참조할 수 있으므로 실제 해제는 프레임이 끝난 뒤에 합니다. */
+    void RemoveObject(uint32 InUUID);
+
 
 private:
     bool IsRunning = false;
     EScreenMode ScreenMode = EScreenMode::Windowed;
 
+    bool bIsHeadless = false;
+    FHeadlessSettings HeadlessSettings;
+    int ExitCode = 0;
+
     const WCHAR* WindowTitle = nullptr;
     const WCHAR* WindowClassName = nullptr;
     HWND WindowHandle = nullptr;
@@ -90,6 +138,10 @@ private:
 
 	float EngineDeltaTime = 0.0f;
 
+	FFixedTimestep FixedTimestep;
+	FFramePacer FramePacer;
+	FFrameStats FrameStats;
+
 private:
 	std::unique_ptr<URenderer> Renderer;
 
@@ -0,0 +1,44 @@
+#include "FixedTimestep.h"
+
+#include <algorithm>
+#include <cmath>
+
+
+void FFixedTimestep::Configure(int32 InTicksPerSecond, int32 InMaxStepsPerFrame)
+{
+	TicksPerSecond = std::max(0, InTicksPerSecond);
+	MaxStepsPerFrame = std::max(1, InMaxStepsPerFrame);
+	StepSeconds = TicksPerSecond > 0 ? 1.0 / TicksPerSecond : 0.0;
+	Reset();
+}
+
+void FFixedTimestep::Reset()
+{
+	Accumulator = 0.0;
+	NumSteps = 0;
+	NumDroppedSteps = 0;
+}
+
+int32 FFixedTimestep::Advance(float DeltaTime)
+{
+	if (!IsEnabled())
+	{
+		return 0;
+	}
+
+	Accumulator += std::max(0.0f, DeltaTime);
+
+	// DeltaTime이 Step 간격과 같을 때 반올림 오차로 Step이 0, 2번으로 갈리지 않도록 조금 여유를 둠
+	constexpr double StepTolerance = 1e-6;
+	int64 Steps = static_cast<int64>(std::floor(Accumulator / StepSeconds + StepTolerance));
+	Accumulator = std::max(0.0, Accumulator - static_cast<double>(Steps) * StepSeconds);
+
+	if (Steps > MaxStepsPerFrame)
+	{
+		NumDroppedSteps += static_cast<uint64>(Steps - MaxStepsPerFrame);
+		Steps = MaxStepsPerFrame;
+	}
+
+	NumSteps += static_cast<uint64>(Steps);
+	return static_cast<int32>(Steps);
+}
@@ -0,0 +1,46 @@
+#pragma once
+#include "HAL/PlatformType.h"
+
+
+/**
+ * 고정 간격 시뮬레이션의 시간 누적기
+ *
+ * 프레임마다 흐른 시간을 쌓아 두고 Step 간격만큼 꺼내서 UWorld::TickFixed를 몇 번 실행할지 정합니다.
+ * 렌더링이 느려져도 한 프레임에 MaxStepsPerFrame번까지만 따라잡고, 그보다 밀린 시간은 버립니다.
+ * 남은 시간 / Step 간격이 렌더링 보간 비율(Alpha)입니다.
+ */
+class FFixedTimestep
+{
+public:
+	/** @param InTicksPerSecond 0이면 끔 */
+	void Configure(int32 InTicksPerSecond, int32 InMaxStepsPerFrame);
+	void Reset();
+
+	bool IsEnabled() const { return TicksPerSecond > 0; }
+
+	/** DeltaTime(초)을 쌓고 이번 프레임에 실행할 Step 수를 반환합니다. */
+	int32 Advance(float DeltaTime);
+
+	int32 GetTicksPerSecond() const { return TicksPerSecond; }
+	int32 GetMaxStepsPerFrame() const { return MaxStepsPerFrame; }
+	float GetStepSeconds() const { return static_cast<float>(StepSeconds); }
+
+	/** 마지막 Step 뒤에 쌓인 시간 / Step 간격, [0, 1) */
+	float GetAlpha() const { return IsEnabled() ? static_cast<float>(Accumulator / StepSeconds) : 1.0f; }
+
+	uint64 GetNumSteps() const { return NumSteps; }
+
+	/** MaxStepsPerFrame을 넘어서 버린 Step 수 */
+	uint64 GetNumDroppedSteps() const { return NumDroppedSteps; }
+
+private:
+	int32 TicksPerSecond = 0;
+	int32 MaxStepsPerFrame = 8;
+	double StepSeconds = 0.0;
+
+	// float DeltaTime을 오래 더해도 오차가 쌓이지 않도록 double
+	double Accumulator = 0.0;
+
+	uint64 NumSteps = 0;
+	uint64 NumDroppedSteps = 0;
+};
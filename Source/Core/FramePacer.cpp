@@ -0,0 +1,235 @@
+#include "FramePacer.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <thread>
+
+#include "HAL/PlatformTime.h"
+#include "Stats/Stats.h"
+
+#if PLATFORM_LINUX
+#include <ctime>
+#endif
+
+#if defined(_M_X64) || defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define FRAMEPACER_CPU_PAUSE() _mm_pause()
+#else
+#define FRAMEPACER_CPU_PAUSE() std::this_thread::yield()
+#endif
+
+// Windows 10 1803 이전 SDK에는 없음
+#if PLATFORM_WINDOWS && !defined(CREATE_WAITABLE_TIMER_HIGH_RESOLUTION)
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+#endif
+
+
+namespace
+{
+/** Overshoot 추정치의 범위, 아래로는 Spin이 너무 짧아 Sleep이 늦게 깨면 바로 놓치고, 위로는 CPU를 너무 오래 씀 */
+constexpr double MinOvershootSeconds = 20e-6;
+constexpr double MaxOvershootSeconds = 4e-3;
+
+/** 처음에는 보수적으로 1ms 일찍 깨어남 */
+constexpr double InitialOvershootSeconds = 1e-3;
+
+/** 지수 이동 평균의 가중치, Sleep 수십 번이면 OS 상태 변화에 맞춰짐 */
+constexpr double OvershootSmoothing = 0.05;
+
+/** 남은 시간이 이보다 짧으면 Sleep하지 않고 Spin */
+constexpr double MinSleepSeconds = 50e-6;
+}
+
+
+FFramePacer::FFramePacer()
+{
+#if PLATFORM_WINDOWS
+	// 고해상도 Timer가 없는 Windows면 일반 Timer, 늦게 깨어나는 만큼은 Overshoot 추정으로 보정됨
+	WaitableTimer = CreateWaitableTimerExW(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+	if (WaitableTimer == nullptr)
+	{
+		WaitableTimer = CreateWaitableTimerExW(nullptr, nullptr, 0, TIMER_ALL_ACCESS);
+	}
+#endif
+	ResetStats();
+}
+
+FFramePacer::~FFramePacer()
+{
+#if PLATFORM_WINDOWS
+	if (WaitableTimer != nullptr)
+	{
+		CloseHandle(WaitableTimer);
+	}
+#endif
+}
+
+void FFramePacer::SetTargetFPS(int32 InTargetFPS)
+{
+	TargetFPS = std::max(0, InTargetFPS);
+	FramePeriodCycles = TargetFPS > 0 ? FPlatformTime::SecondsToCycles(1.0 / TargetFPS) : 0;
+	NextFrameCycles = 0;
+	Stats.TargetFrameMs = TargetFPS > 0 ? 1000.0 / TargetFPS : 0.0;
+}
+
+void FFramePacer::ResetStats()
+{
+	OvershootMean = InitialOvershootSeconds;
+	OvershootVariance = 0.0;
+	OvershootEstimate = InitialOvershootSeconds;
+	NumOvershootSamples = 0;
+
+	FrameMeanSeconds = 0.0;
+	FrameM2 = 0.0;
+	WakeErrorSumSeconds = 0.0;
+	WaitWallSeconds = 0.0;
+	WaitCPUSeconds = 0.0;
+	LastFrameCycles = 0;
+
+	Stats = FFramePacerStats();
+	Stats.TargetFrameMs = TargetFPS > 0 ? 1000.0 / TargetFPS : 0.0;
+	Stats.SleepOvershootUs = OvershootEstimate * 1e6;
+}
+
+void FFramePacer::WaitForNextFrame()
+{
+	SCOPE_CYCLE_COUNTER("Frame Pacer Wait");
+	uint64 Now = FPlatformTime::Cycles64();
+	if (FramePeriodCycles == 0)
+	{
+		RecordFrame(Now, 0);
+		return;
+	}
+
+	if (NextFrameCycles == 0)
+	{
+		NextFrameCycles = Now + FramePeriodCycles;
+	}
+
+	if (Now >= NextFrameCycles)
+	{
+		// 늦은 프레임은 바로 시작하고 격자를 지금부터 다시 맞춤, 밀린 프레임을 몰아서 실행하지 않음
+		++Stats.NumLateFrames;
+		NextFrameCycles = Now + FramePeriodCycles;
+		RecordFrame(Now, 0);
+		return;
+	}
+
+	const uint64 TargetCycles = NextFrameCycles;
+	const double CPUStart = FPlatformTime::ThreadCPUSeconds();
+	WaitUntil(TargetCycles);
+	Now = FPlatformTime::Cycles64();
+	WaitCPUSeconds += FPlatformTime::ThreadCPUSeconds() - CPUStart;
+
+	NextFrameCycles += FramePeriodCycles;
+	RecordFrame(Now, Now - TargetCycles);
+}
+
+void FFramePacer::WaitUntil(uint64 TargetCycles)
+{
+	const uint64 WaitStart = FPlatformTime::Cycles64();
+
+	// 예상 Overshoot만큼 일찍 깨어나도록 Sleep, 일찍 깨어났으면 남은 시간으로 다시
+	for (;;)
+	{
+		const uint64 Now = FPlatformTime::Cycles64();
+		if (Now >= TargetCycles)
+		{
+			break;
+		}
+
+		const double SleepSeconds = FPlatformTime::ToSeconds(TargetCycles - Now) - OvershootEstimate;
+		if (SleepSeconds < MinSleepSeconds)
+		{
+			break;
+		}
+
+		SleepUntil(Now + FPlatformTime::SecondsToCycles(SleepSeconds));
+	}
+	const uint64 SpinStart = FPlatformTime::Cycles64();
+
+	while (FPlatformTime::Cycles64() < TargetCycles)
+	{
+		FRAMEPACER_CPU_PAUSE();
+	}
+
+	const uint64 WaitEnd = FPlatformTime::Cycles64();
+	Stats.SleepMs += FPlatformTime::ToMilliseconds(SpinStart - WaitStart);
+	Stats.SpinMs += FPlatformTime::ToMilliseconds(WaitEnd > SpinStart ? WaitEnd - SpinStart : 0);
+	WaitWallSeconds += FPlatformTime::ToSeconds(WaitEnd - WaitStart);
+	Stats.WaitCPUPercent = WaitWallSeconds > 0.0 ? 100.0 * WaitCPUSeconds / WaitWallSeconds : 0.0;
+}
+
+void FFramePacer::SleepUntil(uint64 WakeCycles)
+{
+	const uint64 SleepStart = FPlatformTime::Cycles64();
+	if (WakeCycles <= SleepStart)
+	{
+		return;
+	}
+
+#if PLATFORM_WINDOWS
+	if (WaitableTimer != nullptr)
+	{
+		// 음수는 상대 시간, 100ns 단위
+		LARGE_INTEGER DueTime;
+		DueTime.QuadPart = -static_cast<LONGLONG>(FPlatformTime::ToSeconds(WakeCycles - SleepStart) * 1e7);
+		if (SetWaitableTimer(WaitableTimer, &DueTime, 0, nullptr, nullptr, FALSE))
+		{
+			WaitForSingleObject(WaitableTimer, INFINITE);
+		}
+	}
+	else
+	{
+		Sleep(static_cast<DWORD>(FPlatformTime::ToMilliseconds(WakeCycles - SleepStart)));
+	}
+#else
+	// Cycles64가 CLOCK_MONOTONIC의 ns이므로 절대 시각으로 바로 기다림, Signal로 깨면 남은 시간만큼 다시
+	timespec WakeTime;
+	WakeTime.tv_sec = static_cast<time_t>(WakeCycles / 1'000'000'000ull);
+	WakeTime.tv_nsec = static_cast<long>(WakeCycles % 1'000'000'000ull);
+	while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &WakeTime, nullptr) == EINTR)
+	{
+	}
+#endif
+
+	const uint64 SleepEnd = FPlatformTime::Cycles64();
+	RecordOvershoot(SleepEnd > WakeCycles ? FPlatformTime::ToSeconds(SleepEnd - WakeCycles) : 0.0);
+}
+
+void FFramePacer::RecordOvershoot(double OvershootSeconds)
+{
+	// 처음 몇 번은 단순 평균처럼 빠르게 맞추고, 이후에는 지수 이동 평균
+	++NumOvershootSamples;
+	const double Smoothing = std::max(OvershootSmoothing, 1.0 / static_cast<double>(NumOvershootSamples));
+
+	const double Delta = OvershootSeconds - OvershootMean;
+	OvershootMean += Smoothing * Delta;
+	OvershootVariance = (1.0 - Smoothing) * (OvershootVariance + Smoothing * Delta * Delta);
+
+	OvershootEstimate = std::clamp(OvershootMean + 2.0 * std::sqrt(OvershootVariance), MinOvershootSeconds, MaxOvershootSeconds);
+	Stats.SleepOvershootUs = OvershootEstimate * 1e6;
+}
+
+void FFramePacer::RecordFrame(uint64 FrameCycles, uint64 WakeErrorCycles)
+{
+	if (LastFrameCycles != 0)
+	{
+		const double FrameSeconds = FPlatformTime::ToSeconds(FrameCycles - LastFrameCycles);
+		++Stats.NumFrames;
+
+		const double Delta = FrameSeconds - FrameMeanSeconds;
+		FrameMeanSeconds += Delta / static_cast<double>(Stats.NumFrames);
+		FrameM2 += Delta * (FrameSeconds - FrameMeanSeconds);
+
+		const double WakeErrorSeconds = FPlatformTime::ToSeconds(WakeErrorCycles);
+		WakeErrorSumSeconds += WakeErrorSeconds;
+
+		Stats.AverageFrameMs = FrameMeanSeconds * 1000.0;
+		Stats.FrameJitterUs = Stats.NumFrames > 1 ? std::sqrt(FrameM2 / static_cast<double>(Stats.NumFrames - 1)) * 1e6 : 0.0;
+		Stats.AverageWakeErrorUs = WakeErrorSumSeconds / static_cast<double>(Stats.NumFrames) * 1e6;
+		Stats.MaxWakeErrorUs = std::max(Stats.MaxWakeErrorUs, WakeErrorSeconds * 1e6);
+	}
+	LastFrameCycles = FrameCycles;
+}
@@ -0,0 +1,95 @@
+#pragma once
+#include "HAL/PlatformType.h"
+
+
+/** FFramePacer의 누적 통계, ResetStats 이후 값 */
+struct FFramePacerStats
+{
+	uint64 NumFrames = 0;
+
+	/** 작업만으로 목표 간격을 넘겨서 기다리지 않은 프레임 */
+	uint64 NumLateFrames = 0;
+
+	double TargetFrameMs = 0.0;
+	double AverageFrameMs = 0.0;
+
+	/** 프레임 간격의 표준편차 */
+	double FrameJitterUs = 0.0;
+
+	/** 목표 시각보다 늦게 깨어난 시간 */
+	double AverageWakeErrorUs = 0.0;
+	double MaxWakeErrorUs = 0.0;
+
+	/** OS Sleep이 요청보다 늦게 깨어나는 시간의 현재 추정치, 이만큼 일찍 깨어나서 나머지는 Spin */
+	double SleepOvershootUs = 0.0;
+
+	/** 대기 시간 중 OS Sleep / Spin으로 보낸 시간 */
+	double SleepMs = 0.0;
+	double SpinMs = 0.0;
+
+	/** 대기하는 동안 사용한 CPU 시간 / 대기 시간 (0 = 완전히 쉼, 100 = Busy Wait) */
+	double WaitCPUPercent = 0.0;
+};
+
+
+/**
+ * 목표 FPS에 맞춰 프레임 시작 시각을 맞추는 Frame Limiter
+ *
+ * 대부분은 OS Sleep으로 쉬고 (Windows는 고해상도 Waitable Timer, Linux는 clock_nanosleep),
+ * Sleep이 늦게 깨어나는 시간을 측정해서 그만큼 일찍 깨어난 뒤 남은 시간만 Spin합니다.
+ * 프레임 시작 시각은 목표 간격의 격자에 맞추므로 대기 오차가 다음 프레임으로 쌓이지 않습니다.
+ */
+class FFramePacer
+{
+public:
+	FFramePacer();
+	~FFramePacer();
+
+	FFramePacer(const FFramePacer&) = delete;
+	FFramePacer& operator=(const FFramePacer&) = delete;
+
+	/** @param InTargetFPS 0이면 제한 없음 (통계만 기록) */
+	void SetTargetFPS(int32 InTargetFPS);
+	int32 GetTargetFPS() const { return TargetFPS; }
+
+	/** 프레임 끝에서 호출, 다음 프레임을 시작할 시각까지 기다립니다. */
+	void WaitForNextFrame();
+
+	/** FPlatformTime::Cycles64 기준 시각까지 OS Sleep + Spin으로 기다립니다. */
+	void WaitUntil(uint64 TargetCycles);
+
+	const FFramePacerStats& GetStats() const { return Stats; }
+	void ResetStats();
+
+private:
+	/** WakeCycles 근처까지 OS Sleep, 늦게 깨어난 시간으로 Overshoot 추정치를 갱신 */
+	void SleepUntil(uint64 WakeCycles);
+
+	void RecordOvershoot(double OvershootSeconds);
+	void RecordFrame(uint64 FrameCycles, uint64 WakeErrorCycles);
+
+private:
+	int32 TargetFPS = 0;
+	uint64 FramePeriodCycles = 0;
+	uint64 NextFrameCycles = 0;
+	uint64 LastFrameCycles = 0;
+
+	// Overshoot의 지수 이동 평균 / 분산, 추정치 = 평균 + 표준편차 * 2
+	double OvershootMean = 0.0;
+	double OvershootVariance = 0.0;
+	double OvershootEstimate = 0.0;
+	uint64 NumOvershootSamples = 0;
+
+	// 프레임 간격의 평균 / 분산 (Welford)
+	double FrameMeanSeconds = 0.0;
+	double FrameM2 = 0.0;
+	double WakeErrorSumSeconds = 0.0;
+	double WaitWallSeconds = 0.0;
+	double WaitCPUSeconds = 0.0;
+
+	FFramePacerStats Stats;
+
+#if PLATFORM_WINDOWS
+	HANDLE WaitableTimer = nullptr;
+#endif
+};
@@ -0,0 +1,10 @@
+#pragma once
+#include <d3d11.h>
+
+
+/** Headless 빌드용 DirectXTK DDSTextureLoader 대체품 */
+namespace DirectX
+{
+template <typename... ArgTypes>
+HRESULT CreateDDSTextureFromFile(ArgTypes&&...) { return E_NOTIMPL; }
+}
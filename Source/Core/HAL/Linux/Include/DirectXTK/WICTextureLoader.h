@@ -0,0 +1,10 @@
+#pragma once
+#include <d3d11.h>
+
+
+/** Headless 빌드용 DirectXTK WICTextureLoader 대체품 */
+namespace DirectX
+{
+template <typename... ArgTypes>
+HRESULT CreateWICTextureFromFile(ArgTypes&&...) { return E_NOTIMPL; }
+}
@@ -0,0 +1,494 @@
+#pragma once
+#include "d3dcommon.h"
+
+
+/**
+ * Headless 빌드용 d3d11.h / dxgi.h 대체품
+ *
+ * 엔진 코드가 사용하는 타입과 필드만 원본과 같은 이름으로 선언합니다.
+ */
+
+//~ DXGI
+enum DXGI_FORMAT
+{
+    DXGI_FORMAT_UNKNOWN = 0,
+    DXGI_FORMAT_R32G32B32A32_FLOAT = 2,
+    DXGI_FORMAT_R32G32B32A32_UINT = 3,
+    DXGI_FORMAT_R32G32B32_FLOAT = 6,
+    DXGI_FORMAT_R32G32_FLOAT = 16,
+    DXGI_FORMAT_R8G8B8A8_UNORM = 28,
+    DXGI_FORMAT_R8G8B8A8_UNORM_SRGB = 29,
+    DXGI_FORMAT_D32_FLOAT = 40,
+    DXGI_FORMAT_R32_FLOAT = 41,
+    DXGI_FORMAT_R32_UINT = 42,
+    DXGI_FORMAT_D24_UNORM_S8_UINT = 45,
+    DXGI_FORMAT_R16_UINT = 57,
+};
+
+enum DXGI_SWAP_EFFECT
+{
+    DXGI_SWAP_EFFECT_DISCARD = 0,
+    DXGI_SWAP_EFFECT_SEQUENTIAL = 1,
+    DXGI_SWAP_EFFECT_FLIP_SEQUENTIAL = 3,
+    DXGI_SWAP_EFFECT_FLIP_DISCARD = 4,
+};
+
+typedef UINT DXGI_USAGE;
+#define DXGI_USAGE_RENDER_TARGET_OUTPUT (1UL << (1 + 4))
+
+struct DXGI_RATIONAL
+{
+    UINT Numerator;
+    UINT Denominator;
+};
+
+struct DXGI_MODE_DESC
+{
+    UINT Width;
+    UINT Height;
+    DXGI_RATIONAL RefreshRate;
+    DXGI_FORMAT Format;
+    UINT ScanlineOrdering;
+    UINT Scaling;
+};
+
+struct DXGI_SAMPLE_DESC
+{
+    UINT Count;
+    UINT Quality;
+};
+
+struct DXGI_SWAP_CHAIN_DESC
+{
+    DXGI_MODE_DESC BufferDesc;
+    DXGI_SAMPLE_DESC SampleDesc;
+    DXGI_USAGE BufferUsage;
+    UINT BufferCount;
+    HWND OutputWindow;
+    BOOL Windowed;
+    DXGI_SWAP_EFFECT SwapEffect;
+    UINT Flags;
+};
+
+struct IDXGISwapChain : IUnknown
+{
+    D3D_STUB_METHOD(GetBuffer)
+    D3D_STUB_METHOD(GetDesc)
+    D3D_STUB_METHOD(Present)
+    D3D_STUB_METHOD(ResizeBuffers)
+};
+//~ DXGI
+
+
+//~ Enums
+#define D3D11_SDK_VERSION 7
+#define D3D11_FLOAT32_MAX 3.402823466e+38f
+#define D3D11_APPEND_ALIGNED_ELEMENT 0xffffffff
+#define D3D11_DEFAULT_STENCIL_READ_MASK 0xff
+#define D3D11_DEFAULT_STENCIL_WRITE_MASK 0xff
+#define D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT 14
+
+enum D3D11_USAGE
+{
+    D3D11_USAGE_DEFAULT = 0,
+    D3D11_USAGE_IMMUTABLE = 1,
+    D3D11_USAGE_DYNAMIC = 2,
+    D3D11_USAGE_STAGING = 3,
+};
+
+enum D3D11_BIND_FLAG
+{
+    D3D11_BIND_VERTEX_BUFFER = 0x1L,
+    D3D11_BIND_INDEX_BUFFER = 0x2L,
+    D3D11_BIND_CONSTANT_BUFFER = 0x4L,
+    D3D11_BIND_SHADER_RESOURCE = 0x8L,
+    D3D11_BIND_RENDER_TARGET = 0x20L,
+    D3D11_BIND_DEPTH_STENCIL = 0x40L,
+};
+
+enum D3D11_CPU_ACCESS_FLAG
+{
+    D3D11_CPU_ACCESS_WRITE = 0x10000L,
+    D3D11_CPU_ACCESS_READ = 0x20000L,
+};
+
+enum D3D11_MAP
+{
+    D3D11_MAP_READ = 1,
+    D3D11_MAP_WRITE = 2,
+    D3D11_MAP_READ_WRITE = 3,
+    D3D11_MAP_WRITE_DISCARD = 4,
+    D3D11_MAP_WRITE_NO_OVERWRITE = 5,
+};
+
+enum D3D11_MAP_FLAG
+{
+    D3D11_MAP_FLAG_DO_NOT_WAIT = 0x100000L,
+};
+
+enum D3D11_CLEAR_FLAG
+{
+    D3D11_CLEAR_DEPTH = 0x1L,
+    D3D11_CLEAR_STENCIL = 0x2L,
+};
+
+enum D3D11_CREATE_DEVICE_FLAG
+{
+    D3D11_CREATE_DEVICE_DEBUG = 0x2,
+    D3D11_CREATE_DEVICE_BGRA_SUPPORT = 0x20,
+};
+
+enum D3D11_RLDO_FLAGS
+{
+    D3D11_RLDO_SUMMARY = 0x1,
+    D3D11_RLDO_DETAIL = 0x2,
+};
+
+enum D3D11_FILL_MODE
+{
+    D3D11_FILL_WIREFRAME = 2,
+    D3D11_FILL_SOLID = 3,
+};
+
+enum D3D11_CULL_MODE
+{
+    D3D11_CULL_NONE = 1,
+    D3D11_CULL_FRONT = 2,
+    D3D11_CULL_BACK = 3,
+};
+
+enum D3D11_COMPARISON_FUNC
+{
+    D3D11_COMPARISON_NEVER = 1,
+    D3D11_COMPARISON_LESS = 2,
+    D3D11_COMPARISON_EQUAL = 3,
+    D3D11_COMPARISON_LESS_EQUAL = 4,
+    D3D11_COMPARISON_GREATER = 5,
+    D3D11_COMPARISON_NOT_EQUAL = 6,
+    D3D11_COMPARISON_GREATER_EQUAL = 7,
+    D3D11_COMPARISON_ALWAYS = 8,
+};
+
+enum D3D11_DEPTH_WRITE_MASK
+{
+    D3D11_DEPTH_WRITE_MASK_ZERO = 0,
+    D3D11_DEPTH_WRITE_MASK_ALL = 1,
+};
+
+enum D3D11_STENCIL_OP
+{
+    D3D11_STENCIL_OP_KEEP = 1,
+};
+
+enum D3D11_BLEND
+{
+    D3D11_BLEND_ZERO = 1,
+    D3D11_BLEND_ONE = 2,
+    D3D11_BLEND_SRC_ALPHA = 5,
+    D3D11_BLEND_INV_SRC_ALPHA = 6,
+};
+
+enum D3D11_BLEND_OP
+{
+    D3D11_BLEND_OP_ADD = 1,
+};
+
+enum D3D11_COLOR_WRITE_ENABLE
+{
+    D3D11_COLOR_WRITE_ENABLE_ALL = 0xf,
+};
+
+enum D3D11_FILTER
+{
+    D3D11_FILTER_MIN_MAG_MIP_POINT = 0,
+    D3D11_FILTER_MIN_MAG_MIP_LINEAR = 0x15,
+};
+
+enum D3D11_TEXTURE_ADDRESS_MODE
+{
+    D3D11_TEXTURE_ADDRESS_WRAP = 1,
+    D3D11_TEXTURE_ADDRESS_MIRROR = 2,
+    D3D11_TEXTURE_ADDRESS_CLAMP = 3,
+};
+
+enum D3D11_INPUT_CLASSIFICATION
+{
+    D3D11_INPUT_PER_VERTEX_DATA = 0,
+    D3D11_INPUT_PER_INSTANCE_DATA = 1,
+};
+
+enum D3D11_RTV_DIMENSION
+{
+    D3D11_RTV_DIMENSION_UNKNOWN = 0,
+    D3D11_RTV_DIMENSION_TEXTURE2D = 4,
+};
+
+enum D3D11_DSV_DIMENSION
+{
+    D3D11_DSV_DIMENSION_UNKNOWN = 0,
+    D3D11_DSV_DIMENSION_TEXTURE2D = 3,
+};
+
+enum D3D11_SRV_DIMENSION
+{
+    D3D11_SRV_DIMENSION_UNKNOWN = 0,
+    D3D11_SRV_DIMENSION_TEXTURE2D = 4,
+};
+//~ Enums
+
+
+//~ Structs
+struct D3D11_BUFFER_DESC
+{
+    UINT ByteWidth;
+    D3D11_USAGE Usage;
+    UINT BindFlags;
+    UINT CPUAccessFlags;
+    UINT MiscFlags;
+    UINT StructureByteStride;
+};
+
+struct D3D11_SUBRESOURCE_DATA
+{
+    const void* pSysMem;
+    UINT SysMemPitch;
+    UINT SysMemSlicePitch;
+};
+
+struct D3D11_MAPPED_SUBRESOURCE
+{
+    void* pData;
+    UINT RowPitch;
+    UINT DepthPitch;
+};
+
+struct D3D11_BOX
+{
+    UINT left;
+    UINT top;
+    UINT front;
+    UINT right;
+    UINT bottom;
+    UINT back;
+};
+
+struct D3D11_VIEWPORT
+{
+    FLOAT TopLeftX;
+    FLOAT TopLeftY;
+    FLOAT Width;
+    FLOAT Height;
+    FLOAT MinDepth;
+    FLOAT MaxDepth;
+};
+
+struct D3D11_TEXTURE2D_DESC
+{
+    UINT Width;
+    UINT Height;
+    UINT MipLevels;
+    UINT ArraySize;
+    DXGI_FORMAT Format;
+    DXGI_SAMPLE_DESC SampleDesc;
+    D3D11_USAGE Usage;
+    UINT BindFlags;
+    UINT CPUAccessFlags;
+    UINT MiscFlags;
+};
+
+struct D3D11_RASTERIZER_DESC
+{
+    D3D11_FILL_MODE FillMode;
+    D3D11_CULL_MODE CullMode;
+    BOOL FrontCounterClockwise;
+    INT DepthBias;
+    FLOAT DepthBiasClamp;
+    FLOAT SlopeScaledDepthBias;
+    BOOL DepthClipEnable;
+    BOOL ScissorEnable;
+    BOOL MultisampleEnable;
+    BOOL AntialiasedLineEnable;
+};
+
+struct D3D11_DEPTH_STENCILOP_DESC
+{
+    D3D11_STENCIL_OP StencilFailOp;
+    D3D11_STENCIL_OP StencilDepthFailOp;
+    D3D11_STENCIL_OP StencilPassOp;
+    D3D11_COMPARISON_FUNC StencilFunc;
+};
+
+struct D3D11_DEPTH_STENCIL_DESC
+{
+    BOOL DepthEnable;
+    D3D11_DEPTH_WRITE_MASK DepthWriteMask;
+    D3D11_COMPARISON_FUNC DepthFunc;
+    BOOL StencilEnable;
+    BYTE StencilReadMask;
+    BYTE StencilWriteMask;
+    D3D11_DEPTH_STENCILOP_DESC FrontFace;
+    D3D11_DEPTH_STENCILOP_DESC BackFace;
+};
+
+struct D3D11_RENDER_TARGET_BLEND_DESC
+{
+    BOOL BlendEnable;
+    D3D11_BLEND SrcBlend;
+    D3D11_BLEND DestBlend;
+    D3D11_BLEND_OP BlendOp;
+    D3D11_BLEND SrcBlendAlpha;
+    D3D11_BLEND DestBlendAlpha;
+    D3D11_BLEND_OP BlendOpAlpha;
+    BYTE RenderTargetWriteMask;
+};
+
+struct D3D11_BLEND_DESC
+{
+    BOOL AlphaToCoverageEnable;
+    BOOL IndependentBlendEnable;
+    D3D11_RENDER_TARGET_BLEND_DESC RenderTarget[8];
+};
+
+struct D3D11_SAMPLER_DESC
+{
+    D3D11_FILTER Filter;
+    D3D11_TEXTURE_ADDRESS_MODE AddressU;
+    D3D11_TEXTURE_ADDRESS_MODE AddressV;
+    D3D11_TEXTURE_ADDRESS_MODE AddressW;
+    FLOAT MipLODBias;
+    UINT MaxAnisotropy;
+    D3D11_COMPARISON_FUNC ComparisonFunc;
+    FLOAT BorderColor[4];
+    FLOAT MinLOD;
+    FLOAT MaxLOD;
+};
+
+struct D3D11_INPUT_ELEMENT_DESC
+{
+    LPCSTR SemanticName;
+    UINT SemanticIndex;
+    DXGI_FORMAT Format;
+    UINT InputSlot;
+    UINT AlignedByteOffset;
+    D3D11_INPUT_CLASSIFICATION InputSlotClass;
+    UINT InstanceDataStepRate;
+};
+
+struct D3D11_TEX2D_RTV { UINT MipSlice; };
+struct D3D11_TEX2D_DSV { UINT MipSlice; };
+struct D3D11_TEX2D_SRV { UINT MostDetailedMip; UINT MipLevels; };
+
+struct D3D11_RENDER_TARGET_VIEW_DESC
+{
+    DXGI_FORMAT Format;
+    D3D11_RTV_DIMENSION ViewDimension;
+    union
+    {
+        D3D11_TEX2D_RTV Texture2D;
+    };
+};
+
+struct D3D11_DEPTH_STENCIL_VIEW_DESC
+{
+    DXGI_FORMAT Format;
+    D3D11_DSV_DIMENSION ViewDimension;
+    UINT Flags;
+    union
+    {
+        D3D11_TEX2D_DSV Texture2D;
+    };
+};
+
+struct D3D11_SHADER_RESOURCE_VIEW_DESC
+{
+    DXGI_FORMAT Format;
+    D3D11_SRV_DIMENSION ViewDimension;
+    union
+    {
+        D3D11_TEX2D_SRV Texture2D;
+    };
+};
+//~ Structs
+
+
+//~ Interfaces
+struct ID3D11DeviceChild : IUnknown {};
+
+struct ID3D11Resource : ID3D11DeviceChild {};
+struct ID3D11Buffer : ID3D11Resource { D3D_STUB_METHOD(GetDesc) };
+struct ID3D11Texture2D : ID3D11Resource { D3D_STUB_METHOD(GetDesc) };
+
+struct ID3D11View : ID3D11DeviceChild {};
+struct ID3D11RenderTargetView : ID3D11View {};
+struct ID3D11DepthStencilView : ID3D11View {};
+struct ID3D11ShaderResourceView : ID3D11View {};
+
+struct ID3D11VertexShader : ID3D11DeviceChild {};
+struct ID3D11PixelShader : ID3D11DeviceChild {};
+struct ID3D11InputLayout : ID3D11DeviceChild {};
+struct ID3D11SamplerState : ID3D11DeviceChild {};
+struct ID3D11RasterizerState : ID3D11DeviceChild {};
+struct ID3D11BlendState : ID3D11DeviceChild {};
+struct ID3D11DepthStencilState : ID3D11DeviceChild {};
+
+struct ID3D11Device : IUnknown
+{
+    D3D_STUB_METHOD(CreateBuffer)
+    D3D_STUB_METHOD(CreateTexture2D)
+    D3D_STUB_METHOD(CreateRenderTargetView)
+    D3D_STUB_METHOD(CreateDepthStencilView)
+    D3D_STUB_METHOD(CreateShaderResourceView)
+    D3D_STUB_METHOD(CreateVertexShader)
+    D3D_STUB_METHOD(CreatePixelShader)
+    D3D_STUB_METHOD(CreateInputLayout)
+    D3D_STUB_METHOD(CreateSamplerState)
+    D3D_STUB_METHOD(CreateRasterizerState)
+    D3D_STUB_METHOD(CreateBlendState)
+    D3D_STUB_METHOD(CreateDepthStencilState)
+};
+
+struct ID3D11DeviceContext : IUnknown
+{
+    D3D_STUB_METHOD(IASetVertexBuffers)
+    D3D_STUB_METHOD(IASetIndexBuffer)
+    D3D_STUB_METHOD(IASetInputLayout)
+    D3D_STUB_METHOD(IASetPrimitiveTopology)
+    D3D_STUB_METHOD(VSSetShader)
+    D3D_STUB_METHOD(VSSetConstantBuffers)
+    D3D_STUB_METHOD(VSSetShaderResources)
+    D3D_STUB_METHOD(VSSetSamplers)
+    D3D_STUB_METHOD(PSSetShader)
+    D3D_STUB_METHOD(PSSetConstantBuffers)
+    D3D_STUB_METHOD(PSSetShaderResources)
+    D3D_STUB_METHOD(PSSetSamplers)
+    D3D_STUB_METHOD(GSSetConstantBuffers)
+    D3D_STUB_METHOD(GSSetShaderResources)
+    D3D_STUB_METHOD(GSSetSamplers)
+    D3D_STUB_METHOD(CSSetConstantBuffers)
+    D3D_STUB_METHOD(CSSetShaderResources)
+    D3D_STUB_METHOD(CSSetSamplers)
+    D3D_STUB_METHOD(RSSetState)
+    D3D_STUB_METHOD(RSSetViewports)
+    D3D_STUB_METHOD(OMSetRenderTargets)
+    D3D_STUB_METHOD(OMSetBlendState)
+    D3D_STUB_METHOD(OMSetDepthStencilState)
+    D3D_STUB_METHOD(ClearRenderTargetView)
+    D3D_STUB_METHOD(ClearDepthStencilView)
+    D3D_STUB_METHOD(Map)
+    D3D_STUB_METHOD(Unmap)
+    D3D_STUB_METHOD(CopyResource)
+    D3D_STUB_METHOD(CopySubresourceRegion)
+    D3D_STUB_METHOD(Draw)
+    D3D_STUB_METHOD(DrawIndexed)
+    D3D_STUB_METHOD(Flush)
+};
+
+struct ID3D11Debug : IUnknown
+{
+    D3D_STUB_METHOD(ReportLiveDeviceObjects)
+};
+//~ Interfaces
+
+
+template <typename... ArgTypes>
+HRESULT D3D11CreateDeviceAndSwapChain(ArgTypes&&...) { return E_NOTIMPL; }
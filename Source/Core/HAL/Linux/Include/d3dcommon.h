@@ -0,0 +1,81 @@
+#pragma once
+#include "Core/HAL/PlatformType.h"
+
+
+/**
+ * Headless 빌드용 d3dcommon.h 대체품
+ *
+ * 엔진 코드가 컴파일되도록 타입만 선언합니다. 모든 메서드는 E_NOTIMPL을 반환하는 빈 구현이며,
+ * Headless 모드에서는 Device를 만들지 않으므로 실제로 호출되지 않습니다.
+ */
+
+#define __uuidof(Type) 0
+#define IID_PPV_ARGS(ppType) __uuidof(**(ppType)), reinterpret_cast<void**>(ppType)
+
+// 인자와 상관없이 E_NOTIMPL을 반환하는 메서드
+#define D3D_STUB_METHOD(Name) \
+    template <typename... ArgTypes> \
+    HRESULT Name(ArgTypes&&...) { return E_NOTIMPL; }
+
+struct IUnknown
+{
+    virtual ~IUnknown() = default;
+
+    ULONG AddRef() { return ++RefCount; }
+    ULONG Release()
+    {
+        const ULONG Remain = --RefCount;
+        if (Remain == 0)
+        {
+            delete this;
+        }
+        return Remain;
+    }
+    D3D_STUB_METHOD(QueryInterface)
+
+private:
+    ULONG RefCount = 1;
+};
+
+struct ID3D10Blob : IUnknown
+{
+    LPVOID GetBufferPointer() { return nullptr; }
+    SIZE_T GetBufferSize() { return 0; }
+};
+typedef ID3D10Blob ID3DBlob;
+
+enum D3D_DRIVER_TYPE
+{
+    D3D_DRIVER_TYPE_UNKNOWN = 0,
+    D3D_DRIVER_TYPE_HARDWARE,
+    D3D_DRIVER_TYPE_REFERENCE,
+    D3D_DRIVER_TYPE_NULL,
+    D3D_DRIVER_TYPE_SOFTWARE,
+    D3D_DRIVER_TYPE_WARP,
+};
+
+enum D3D_FEATURE_LEVEL
+{
+    D3D_FEATURE_LEVEL_10_0 = 0xa000,
+    D3D_FEATURE_LEVEL_10_1 = 0xa100,
+    D3D_FEATURE_LEVEL_11_0 = 0xb000,
+    D3D_FEATURE_LEVEL_11_1 = 0xb100,
+};
+
+enum D3D_PRIMITIVE_TOPOLOGY
+{
+    D3D_PRIMITIVE_TOPOLOGY_UNDEFINED = 0,
+    D3D_PRIMITIVE_TOPOLOGY_POINTLIST = 1,
+    D3D_PRIMITIVE_TOPOLOGY_LINELIST = 2,
+    D3D_PRIMITIVE_TOPOLOGY_LINESTRIP = 3,
+    D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST = 4,
+    D3D_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP = 5,
+
+    D3D11_PRIMITIVE_TOPOLOGY_UNDEFINED = D3D_PRIMITIVE_TOPOLOGY_UNDEFINED,
+    D3D11_PRIMITIVE_TOPOLOGY_POINTLIST = D3D_PRIMITIVE_TOPOLOGY_POINTLIST,
+    D3D11_PRIMITIVE_TOPOLOGY_LINELIST = D3D_PRIMITIVE_TOPOLOGY_LINELIST,
+    D3D11_PRIMITIVE_TOPOLOGY_LINESTRIP = D3D_PRIMITIVE_TOPOLOGY_LINESTRIP,
+    D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST = D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST,
+    D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP = D3D_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP,
+};
+typedef D3D_PRIMITIVE_TOPOLOGY D3D11_PRIMITIVE_TOPOLOGY;
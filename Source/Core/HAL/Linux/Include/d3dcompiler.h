@@ -0,0 +1,12 @@
+#pragma once
+#include "d3d11.h"
+
+
+/** Headless 빌드용 d3dcompiler.h 대체품, Shader를 컴파일하지 않습니다. */
+
+#define D3DCOMPILE_DEBUG (1 << 0)
+#define D3DCOMPILE_SKIP_OPTIMIZATION (1 << 2)
+#define D3DCOMPILE_ENABLE_STRICTNESS (1 << 11)
+
+template <typename... ArgTypes>
+HRESULT D3DCompileFromFile(ArgTypes&&...) { return E_NOTIMPL; }
@@ -0,0 +1,53 @@
+#pragma once
+#include <cstddef>
+
+
+/** Headless 빌드용 wrl.h 대체품 (Microsoft::WRL::ComPtr만 제공) */
+namespace Microsoft::WRL
+{
+template <typename T>
+class ComPtr
+{
+public:
+    ComPtr() = default;
+    ComPtr(std::nullptr_t) {}
+    ComPtr(T* InPtr) : Ptr(InPtr) { InternalAddRef(); }
+    ComPtr(const ComPtr& Other) : Ptr(Other.Ptr) { InternalAddRef(); }
+    ComPtr(ComPtr&& Other) noexcept : Ptr(Other.Ptr) { Other.Ptr = nullptr; }
+    ~ComPtr() { InternalRelease(); }
+
+    ComPtr& operator=(ComPtr Other) noexcept
+    {
+        T* Temp = Ptr;
+        Ptr = Other.Ptr;
+        Other.Ptr = Temp;
+        return *this;
+    }
+
+    T* Get() const { return Ptr; }
+    T* operator->() const { return Ptr; }
+    explicit operator bool() const { return Ptr != nullptr; }
+
+    T** GetAddressOf() { return &Ptr; }
+    T** ReleaseAndGetAddressOf()
+    {
+        InternalRelease();
+        return &Ptr;
+    }
+    void Reset() { InternalRelease(); }
+
+private:
+    void InternalAddRef() { if (Ptr) Ptr->AddRef(); }
+    void InternalRelease()
+    {
+        if (Ptr)
+        {
+            Ptr->Release();
+            Ptr = nullptr;
+        }
+    }
+
+private:
+    T* Ptr = nullptr;
+};
+}
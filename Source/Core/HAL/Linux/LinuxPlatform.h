@@ -0,0 +1,217 @@
+#pragma once
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <cwchar>
+#include <string>
+#include <unistd.h>
+
+
+/**
+ * Windows.h 대신 사용하는 Win32 타입/함수의 대체품
+ *
+ * Headless 빌드(Linux)에서 엔진 코드가 수정 없이 컴파일되도록 필요한 만큼만 선언합니다.
+ * Window와 입력 장치가 없으므로, 커서/키보드 조회는 항상 "입력 없음"을 반환합니다.
+ */
+
+//~ 기본 타입
+typedef int BOOL;
+typedef unsigned char BYTE;
+typedef unsigned short WORD;
+typedef std::uint32_t DWORD;
+typedef unsigned int UINT;
+typedef int INT;
+typedef std::int32_t LONG;
+typedef std::uint32_t ULONG;
+typedef std::int32_t HRESULT;
+typedef float FLOAT;
+typedef std::size_t SIZE_T;
+typedef std::intptr_t LONG_PTR;
+typedef std::uintptr_t UINT_PTR;
+typedef LONG_PTR LPARAM;
+typedef LONG_PTR LRESULT;
+typedef UINT_PTR WPARAM;
+typedef wchar_t WCHAR;
+typedef const wchar_t* LPCWSTR;
+typedef wchar_t* LPWSTR;
+typedef const char* LPCSTR;
+typedef char* LPSTR;
+typedef void* LPVOID;
+typedef const void* LPCVOID;
+typedef void* HANDLE;
+
+struct HWND__;
+typedef HWND__* HWND;
+struct HINSTANCE__;
+typedef HINSTANCE__* HINSTANCE;
+typedef HINSTANCE HMODULE;
+
+struct POINT
+{
+    LONG x;
+    LONG y;
+};
+
+struct RECT
+{
+    LONG left;
+    LONG top;
+    LONG right;
+    LONG bottom;
+};
+
+//~ 기본 타입
+
+
+//~ 매크로
+#define TRUE 1
+#define FALSE 0
+
+#define WINAPI
+#define CALLBACK
+#define APIENTRY
+
+#define S_OK ((HRESULT)0L)
+#define S_FALSE ((HRESULT)1L)
+#define E_NOTIMPL ((HRESULT)0x80004001L)
+#define E_FAIL ((HRESULT)0x80004005L)
+#define E_INVALIDARG ((HRESULT)0x80070057L)
+#define SUCCEEDED(hr) (((HRESULT)(hr)) >= 0)
+#define FAILED(hr) (((HRESULT)(hr)) < 0)
+
+#define MB_OK 0x00000000L
+#define MB_ICONERROR 0x00000010L
+#define CP_UTF8 65001
+
+#define LOWORD(l) ((WORD)(((UINT_PTR)(l)) & 0xffff))
+#define HIWORD(l) ((WORD)((((UINT_PTR)(l)) >> 16) & 0xffff))
+
+// SAL 주석
+#define IN
+#define OUT
+
+#define ARRAYSIZE(A) (sizeof(A) / sizeof((A)[0]))
+#define ZeroMemory(Destination, Length) std::memset((Destination), 0, (Length))
+#define UNREFERENCED_PARAMETER(P) (void)(P)
+//~ 매크로
+
+
+//~ 함수
+inline int MessageBoxA(HWND, LPCSTR Text, LPCSTR Caption, UINT)
+{
+    std::fprintf(stderr, "[%s] %s\n", Caption ? Caption : "", Text ? Text : "");
+    return 1; // IDOK
+}
+
+inline BOOL IsDebuggerPresent() { return FALSE; }
+
+inline void Sleep(DWORD Milliseconds) { usleep(static_cast<useconds_t>(Milliseconds) * 1000); }
+
+inline HWND GetFocus() { return nullptr; }
+inline HWND GetActiveWindow() { return nullptr; }
+inline short GetAsyncKeyState(int) { return 0; }
+
+inline BOOL GetCursorPos(POINT* Point)
+{
+    *Point = {};
+    return FALSE;
+}
+
+inline BOOL ScreenToClient(HWND, POINT*) { return FALSE; }
+
+inline BOOL GetClientRect(HWND, RECT* Rect)
+{
+    *Rect = {};
+    return FALSE;
+}
+
+inline int strcpy_s(char* Dest, std::size_t DestSize, const char* Src)
+{
+    if (Dest == nullptr || DestSize == 0)
+    {
+        return 22; // EINVAL
+    }
+    std::strncpy(Dest, Src ? Src : "", DestSize - 1);
+    Dest[DestSize - 1] = '\0';
+    return 0;
+}
+
+/** UTF-16 대신 UTF-32 wchar_t를 사용하는 것 외에는 Win32와 같은 규칙 (cchWideChar = -1이면 널 문자 포함) */
+inline int WideCharToMultiByte(UINT, DWORD, const wchar_t* Src, int SrcLen, char* Dest, int DestSize, LPCSTR, BOOL*)
+{
+    const std::size_t Len = SrcLen < 0 ? std::wcslen(Src) + 1 : static_cast<std::size_t>(SrcLen);
+
+    std::string Utf8;
+    Utf8.reserve(Len);
+    for (std::size_t Index = 0; Index < Len; ++Index)
+    {
+        const std::uint32_t Code = static_cast<std::uint32_t>(Src[Index]);
+        if (Code < 0x80)
+        {
+            Utf8 += static_cast<char>(Code);
+        }
+        else if (Code < 0x800)
+        {
+            Utf8 += static_cast<char>(0xC0 | (Code >> 6));
+            Utf8 += static_cast<char>(0x80 | (Code & 0x3F));
+        }
+        else if (Code < 0x10000)
+        {
+            Utf8 += static_cast<char>(0xE0 | (Code >> 12));
+            Utf8 += static_cast<char>(0x80 | ((Code >> 6) & 0x3F));
+            Utf8 += static_cast<char>(0x80 | (Code & 0x3F));
+        }
+        else
+        {
+            Utf8 += static_cast<char>(0xF0 | (Code >> 18));
+            Utf8 += static_cast<char>(0x80 | ((Code >> 12) & 0x3F));
+            Utf8 += static_cast<char>(0x80 | ((Code >> 6) & 0x3F));
+            Utf8 += static_cast<char>(0x80 | (Code & 0x3F));
+        }
+    }
+
+    const int Needed = static_cast<int>(Utf8.size());
+    if (DestSize == 0)
+    {
+        return Needed;
+    }
+    if (DestSize < Needed)
+    {
+        return 0;
+    }
+    std::memcpy(Dest, Utf8.data(), Utf8.size());
+    return Needed;
+}
+
+inline int MultiByteToWideChar(UINT, DWORD, const char* Src, int SrcLen, wchar_t* Dest, int DestSize)
+{
+    const std::size_t Len = SrcLen < 0 ? std::strlen(Src) + 1 : static_cast<std::size_t>(SrcLen);
+
+    std::wstring Wide;
+    Wide.reserve(Len);
+    for (std::size_t Index = 0; Index < Len;)
+    {
+        const unsigned char Lead = static_cast<unsigned char>(Src[Index]);
+        const int Extra = Lead < 0x80 ? 0 : Lead < 0xE0 ? 1 : Lead < 0xF0 ? 2 : 3;
+        std::uint32_t Code = Extra == 0 ? Lead : Lead & (0x3F >> Extra);
+        for (int Cont = 1; Cont <= Extra && Index + Cont < Len; ++Cont)
+        {
+            Code = (Code << 6) | (static_cast<unsigned char>(Src[Index + Cont]) & 0x3F);
+        }
+        Wide += static_cast<wchar_t>(Code);
+        Index += Extra + 1;
+    }
+
+    const int Needed = static_cast<int>(Wide.size());
+    if (DestSize == 0)
+    {
+        return Needed;
+    }
+    if (DestSize < Needed)
+    {
+        return 0;
+    }
+    std::wmemcpy(Dest, Wide.data(), Wide.size());
+    return Needed;
+}
+//~ 함수
@@ -1,5 +1,6 @@
 ﻿#pragma once
 #include <atomic>
+#include <cstdlib>
 #include <iostream>
 
 #include "Core/HAL/PlatformType.h"
@@ -68,7 +69,7 @@ void FPlatformMemory::IncrementStats(size_t Size)
     }
     else
     {
-        static_assert(false, "Unknown allocation type");
+        static_assert(TAlwaysFalseValue<AllocType>, "Unknown allocation type");
     }
 }
 
@@ -91,7 +92,7 @@ void FPlatformMemory::DecrementStats(size_t Size)
     }
     else
     {
-        static_assert(false, "Unknown allocation type");
+        static_assert(TAlwaysFalseValue<AllocType>, "Unknown allocation type");
     }
 }
 
@@ -109,7 +110,12 @@ void* FPlatformMemory::Malloc(size_t Size)
 template <EAllocationType AllocType>
 void* FPlatformMemory::AlignedMalloc(size_t Size, size_t Alignment)
 {
+#if PLATFORM_WINDOWS
     void* Ptr = _aligned_malloc(Size, Alignment);
+#else
+    // aligned_alloc은 Size가 Alignment의 배수여야 합니다.
+    void* Ptr = std::aligned_alloc(Alignment, (Size + Alignment - 1) / Alignment * Alignment);
+#endif
     if (Ptr)
     {
         IncrementStats<AllocType>(Size);
@@ -133,7 +139,11 @@ void FPlatformMemory::AlignedFree(void* Address, size_t Size)
     if (Address)
     {
         DecrementStats<AllocType>(Size);
+#if PLATFORM_WINDOWS
         _aligned_free(Address);
+#else
+        std::free(Address);
+#endif
     }
 }
 
@@ -150,7 +160,7 @@ uint64 FPlatformMemory::GetAllocationBytes()
     }
     else
     {
-        static_assert(false, "Unknown AllocationType");
+        static_assert(TAlwaysFalseValue<AllocType>, "Unknown AllocationType");
         return -1;
     }
 }
@@ -168,7 +178,7 @@ uint64 FPlatformMemory::GetAllocationCount()
     }
     else
     {
-        static_assert(false, "Unknown AllocationType");
+        static_assert(TAlwaysFalseValue<AllocType>, "Unknown AllocationType");
         return -1;
     }
 }
@@ -0,0 +1,247 @@
+#include "PlatformSocket.h"
+
+#include <algorithm>
+#include <utility>
+
+#if PLATFORM_WINDOWS
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#pragma comment(lib, "ws2_32")
+#else
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+
+namespace
+{
+#if PLATFORM_WINDOWS
+using FNativeSocket = SOCKET;
+constexpr int SendFlags = 0;
+
+void CloseNative(FNativeSocket Socket) { closesocket(Socket); }
+#else
+using FNativeSocket = int;
+
+// 끊긴 연결에 보내도 SIGPIPE로 종료되지 않게
+constexpr int SendFlags = MSG_NOSIGNAL;
+
+void CloseNative(FNativeSocket Socket) { close(Socket); }
+#endif
+
+sockaddr_in MakeLoopbackAddress(uint16 Port)
+{
+	sockaddr_in Address = {};
+	Address.sin_family = AF_INET;
+	Address.sin_port = htons(Port);
+	Address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	return Address;
+}
+
+void SetNoDelay(FNativeSocket Socket)
+{
+	int Enable = 1;
+	setsockopt(Socket, IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<const char*>(&Enable), sizeof(Enable));
+}
+}
+
+
+FPlatformSocket::FPlatformSocket(FPlatformSocket&& Other) noexcept
+	: Handle(std::exchange(Other.Handle, InvalidHandle))
+{
+}
+
+FPlatformSocket& FPlatformSocket::operator=(FPlatformSocket&& Other) noexcept
+{
+	if (this != &Other)
+	{
+		Close();
+		Handle = std::exchange(Other.Handle, InvalidHandle);
+	}
+	return *this;
+}
+
+bool FPlatformSocket::Startup()
+{
+#if PLATFORM_WINDOWS
+	static const bool bStarted = []
+	{
+		WSADATA Data;
+		return WSAStartup(MAKEWORD(2, 2), &Data) == 0;
+	}();
+	return bStarted;
+#else
+	return true;
+#endif
+}
+
+bool FPlatformSocket::Listen(uint16 Port)
+{
+	Close();
+	if (!Startup())
+	{
+		return false;
+	}
+
+	const FNativeSocket Socket = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+	if (Socket == static_cast<FNativeSocket>(InvalidHandle))
+	{
+		return false;
+	}
+
+	// 재시작할 때 이전 연결의 TIME_WAIT 때문에 Bind가 실패하지 않게
+	int Enable = 1;
+	setsockopt(Socket, SOL_SOCKET, SO_REUSEADDR, reinterpret_cast<const char*>(&Enable), sizeof(Enable));
+
+	const sockaddr_in Address = MakeLoopbackAddress(Port);
+	if (bind(Socket, reinterpret_cast<const sockaddr*>(&Address), sizeof(Address)) != 0 || listen(Socket, 1) != 0)
+	{
+		CloseNative(Socket);
+		return false;
+	}
+
+	Handle = static_cast<uint64>(Socket);
+	return true;
+}
+
+bool FPlatformSocket::Accept(FPlatformSocket& OutClient, int32 TimeoutMs)
+{
+	if (!IsValid() || !WaitFor(false, TimeoutMs))
+	{
+		return false;
+	}
+
+	const FNativeSocket Client = accept(static_cast<FNativeSocket>(Handle), nullptr, nullptr);
+	if (Client == static_cast<FNativeSocket>(InvalidHandle))
+	{
+		return false;
+	}
+
+	SetNoDelay(Client);
+	OutClient.Close();
+	OutClient.Handle = static_cast<uint64>(Client);
+	return true;
+}
+
+bool FPlatformSocket::Connect(uint16 Port)
+{
+	Close();
+	if (!Startup())
+	{
+		return false;
+	}
+
+	const FNativeSocket Socket = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+	if (Socket == static_cast<FNativeSocket>(InvalidHandle))
+	{
+		return false;
+	}
+
+	const sockaddr_in Address = MakeLoopbackAddress(Port);
+	if (connect(Socket, reinterpret_cast<const sockaddr*>(&Address), sizeof(Address)) != 0)
+	{
+		CloseNative(Socket);
+		return false;
+	}
+
+	SetNoDelay(Socket);
+	Handle = static_cast<uint64>(Socket);
+	return true;
+}
+
+bool FPlatformSocket::SendAll(const void* Data, size_t Size, const std::atomic<bool>* bAbort)
+{
+	const char* Cursor = static_cast<const char*>(Data);
+	while (Size > 0)
+	{
+		if (bAbort && bAbort->load(std::memory_order_relaxed))
+		{
+			return false;
+		}
+
+		// 받는 쪽 Buffer가 차 있으면 조금씩 기다리면서 종료 요청을 확인
+		if (!WaitFor(true, 100))
+		{
+			if (!IsValid())
+			{
+				return false;
+			}
+			continue;
+		}
+
+		const int Chunk = static_cast<int>(std::min<size_t>(Size, 1 << 20));
+		const auto Sent = send(static_cast<FNativeSocket>(Handle), Cursor, Chunk, SendFlags);
+		if (Sent <= 0)
+		{
+			return false;
+		}
+		Cursor += Sent;
+		Size -= static_cast<size_t>(Sent);
+	}
+	return true;
+}
+
+int32 FPlatformSocket::Receive(void* Data, size_t Size, int32 TimeoutMs)
+{
+	if (!IsValid())
+	{
+		return -1;
+	}
+	if (!WaitFor(false, TimeoutMs))
+	{
+		return 0;
+	}
+
+	const int Chunk = static_cast<int>(std::min<size_t>(Size, 1 << 20));
+	const auto Received = recv(static_cast<FNativeSocket>(Handle), static_cast<char*>(Data), Chunk, 0);
+	return Received > 0 ? static_cast<int32>(Received) : -1;
+}
+
+bool FPlatformSocket::ReceiveAll(void* Data, size_t Size)
+{
+	char* Cursor = static_cast<char*>(Data);
+	while (Size > 0)
+	{
+		const int32 Received = Receive(Cursor, Size, 1000);
+		if (Received < 0)
+		{
+			return false;
+		}
+		Cursor += Received;
+		Size -= static_cast<size_t>(Received);
+	}
+	return true;
+}
+
+void FPlatformSocket::Close()
+{
+	if (IsValid())
+	{
+		CloseNative(static_cast<FNativeSocket>(Handle));
+		Handle = InvalidHandle;
+	}
+}
+
+bool FPlatformSocket::WaitFor(bool bWrite, int32 TimeoutMs) const
+{
+	if (!IsValid())
+	{
+		return false;
+	}
+
+#if PLATFORM_WINDOWS
+	WSAPOLLFD PollDesc = {};
+	PollDesc.fd = static_cast<SOCKET>(Handle);
+	PollDesc.events = bWrite ? POLLWRNORM : POLLRDNORM;
+	return WSAPoll(&PollDesc, 1, TimeoutMs) > 0;
+#else
+	pollfd PollDesc = {};
+	PollDesc.fd = static_cast<int>(Handle);
+	PollDesc.events = bWrite ? POLLOUT : POLLIN;
+	return poll(&PollDesc, 1, TimeoutMs) > 0;
+#endif
+}
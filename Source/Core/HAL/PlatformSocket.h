@@ -0,0 +1,60 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+
+#include "Core/HAL/PlatformType.h"
+
+
+/**
+ * Loopback TCP Socket (Winsock / POSIX)
+ *
+ * Profiler Stream처럼 같은 PC 안에서만 쓰므로 127.0.0.1에만 Bind / Connect합니다.
+ * 모든 대기는 Timeout을 받아서, 호출한 Thread가 종료 요청을 주기적으로 확인할 수 있습니다.
+ */
+class FPlatformSocket
+{
+public:
+	FPlatformSocket() = default;
+	~FPlatformSocket() { Close(); }
+
+	FPlatformSocket(const FPlatformSocket&) = delete;
+	FPlatformSocket& operator=(const FPlatformSocket&) = delete;
+	FPlatformSocket(FPlatformSocket&& Other) noexcept;
+	FPlatformSocket& operator=(FPlatformSocket&& Other) noexcept;
+
+	bool IsValid() const { return Handle != InvalidHandle; }
+
+	bool Listen(uint16 Port);
+
+	/** @return TimeoutMs 안에 연결이 들어오면 true */
+	bool Accept(FPlatformSocket& OutClient, int32 TimeoutMs);
+
+	bool Connect(uint16 Port);
+
+	/**
+	 * Size만큼 모두 보냅니다. 받는 쪽이 느리면 여기서 기다리고, bAbort가 켜지면 중간에 포기합니다.
+	 * @return 모두 보냈으면 true, 연결이 끊겼거나 포기했으면 false
+	 */
+	bool SendAll(const void* Data, size_t Size, const std::atomic<bool>* bAbort = nullptr);
+
+	/**
+	 * 받은 만큼만 채웁니다.
+	 * @return 받은 바이트 수, Timeout이면 0, 연결이 끊겼으면 -1
+	 */
+	int32 Receive(void* Data, size_t Size, int32 TimeoutMs);
+
+	/** Size만큼 모두 받을 때까지 기다림, 연결이 끊기면 false */
+	bool ReceiveAll(void* Data, size_t Size);
+
+	void Close();
+
+private:
+	/** TimeoutMs 안에 읽기 (bWrite면 쓰기)가 가능해지면 true */
+	bool WaitFor(bool bWrite, int32 TimeoutMs) const;
+
+	static bool Startup();
+
+private:
+	static constexpr uint64 InvalidHandle = ~0ull;
+	uint64 Handle = InvalidHandle;
+};
@@ -0,0 +1,63 @@
+#include "PlatformTime.h"
+
+#if PLATFORM_LINUX
+#include <ctime>
+#endif
+
+
+#if PLATFORM_WINDOWS
+namespace
+{
+double QuerySecondsPerCycle()
+{
+	LARGE_INTEGER Frequency;
+	QueryPerformanceFrequency(&Frequency);
+	return 1.0 / static_cast<double>(Frequency.QuadPart);
+}
+}
+
+uint64 FPlatformTime::Cycles64()
+{
+	LARGE_INTEGER Counter;
+	QueryPerformanceCounter(&Counter);
+	return static_cast<uint64>(Counter.QuadPart);
+}
+
+double FPlatformTime::GetSecondsPerCycle()
+{
+	static const double SecondsPerCycle = QuerySecondsPerCycle();
+	return SecondsPerCycle;
+}
+
+double FPlatformTime::ThreadCPUSeconds()
+{
+	FILETIME CreationTime, ExitTime, KernelTime, UserTime;
+	if (!GetThreadTimes(GetCurrentThread(), &CreationTime, &ExitTime, &KernelTime, &UserTime))
+	{
+		return 0.0;
+	}
+
+	// FILETIME은 100ns 단위
+	auto ToUInt64 = [](const FILETIME& Time) { return (static_cast<uint64>(Time.dwHighDateTime) << 32) | Time.dwLowDateTime; };
+	return static_cast<double>(ToUInt64(KernelTime) + ToUInt64(UserTime)) * 1e-7;
+}
+#else
+uint64 FPlatformTime::Cycles64()
+{
+	timespec Time;
+	clock_gettime(CLOCK_MONOTONIC, &Time);
+	return static_cast<uint64>(Time.tv_sec) * 1'000'000'000ull + static_cast<uint64>(Time.tv_nsec);
+}
+
+double FPlatformTime::GetSecondsPerCycle()
+{
+	return 1e-9;
+}
+
+double FPlatformTime::ThreadCPUSeconds()
+{
+	timespec Time;
+	clock_gettime(CLOCK_THREAD_CPUTIME_ID, &Time);
+	return static_cast<double>(Time.tv_sec) + static_cast<double>(Time.tv_nsec) * 1e-9;
+}
+#endif
@@ -0,0 +1,27 @@
+#pragma once
+#include "Core/HAL/PlatformType.h"
+
+
+/**
+ * 고해상도 시계
+ *
+ * Windows는 QueryPerformanceCounter, Linux는 CLOCK_MONOTONIC을 사용합니다.
+ * Cycles는 플랫폼마다 단위가 다르므로 ToSeconds / SecondsToCycles로만 변환합니다.
+ */
+struct FPlatformTime
+{
+	/** 단조 증가하는 시각 (플랫폼 단위) */
+	static uint64 Cycles64();
+
+	/** Cycles64 한 단위의 초 */
+	static double GetSecondsPerCycle();
+
+	static double ToSeconds(uint64 Cycles) { return static_cast<double>(Cycles) * GetSecondsPerCycle(); }
+	static double ToMilliseconds(uint64 Cycles) { return ToSeconds(Cycles) * 1000.0; }
+	static uint64 SecondsToCycles(double Seconds) { return static_cast<uint64>(Seconds / GetSecondsPerCycle()); }
+
+	static double Seconds() { return ToSeconds(Cycles64()); }
+
+	/** 호출한 Thread가 CPU를 사용한 시간 (초), 대기 중 CPU 사용량 측정용 */
+	static double ThreadCPUSeconds();
+};
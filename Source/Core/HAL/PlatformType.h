@@ -1,7 +1,16 @@
 ﻿#pragma once
 #include <cstdint>
 
+#if defined(_WIN32)
+    #define PLATFORM_WINDOWS 1
+    #define PLATFORM_LINUX 0
+#else
+    #define PLATFORM_WINDOWS 0
+    #define PLATFORM_LINUX 1
+#endif
+
 //~ Windows.h
+#if PLATFORM_WINDOWS
 #define _TCHAR_DEFINED  // TCHAR 재정의 에러 때문
 #define WIN32_LEAN_AND_MEAN
 #include <Windows.h>
@@ -12,14 +21,48 @@
 #ifdef TEXT             // Windows.h의 TEXT를 삭제
     #undef TEXT
 #endif
+#else
+// Windows.h 대신 엔진이 사용하는 Win32 타입/함수의 대체품 (Headless 빌드 전용)
+#include "Core/HAL/Linux/LinuxPlatform.h"
+#endif
 //~ Windows.h
 
 
-// inline을 강제하는 매크로
-#define FORCEINLINE __forceinline
+#if PLATFORM_WINDOWS
+    // inline을 강제하는 매크로
+    #define FORCEINLINE __forceinline
+
+    // inline을 하지않는 매크로
+    #define FORCENOINLINE __declspec(noinline)
+#else
+    #define FORCEINLINE inline __attribute__((always_inline))
+    #define FORCENOINLINE __attribute__((noinline))
+#endif
+
+// SSE2 Intrinsic 사용 가능 여부 (x64는 항상 지원)
+#if defined(_M_X64) || defined(__SSE2__)
+    #define PLATFORM_ENABLE_VECTORINTRINSICS 1
+#else
+    #define PLATFORM_ENABLE_VECTORINTRINSICS 0
+#endif
+
+// NEON Intrinsic 사용 가능 여부 (ARM64, SSE2가 없을 때만 사용)
+#if !PLATFORM_ENABLE_VECTORINTRINSICS && (defined(_M_ARM64) || defined(__ARM_NEON))
+    #define PLATFORM_ENABLE_VECTORINTRINSICS_NEON 1
+#else
+    #define PLATFORM_ENABLE_VECTORINTRINSICS_NEON 0
+#endif
+
+
+/**
+ * if constexpr의 else 분기에서 사용하는 항상 false인 값
+ * @note static_assert(false)는 GCC/Clang에서 템플릿이 인스턴스화되지 않아도 에러가 발생합니다.
+ */
+template <typename...>
+inline constexpr bool TAlwaysFalse = false;
 
-// inline을 하지않는 매크로
-#define FORCENOINLINE __declspec(noinline)
+template <auto...>
+inline constexpr bool TAlwaysFalseValue = false;
 
 
 #define USE_WIDECHAR 0
@@ -0,0 +1,202 @@
+#include "HeadlessScript.h"
+
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+#include "Core/Engine.h"
+#include "Debug/DebugConsole.h"
+#include "Object/World/World.h"
+
+
+bool FHeadlessScript::Load(const FString& Path)
+{
+	std::ifstream File(*Path);
+	if (!File.is_open())
+	{
+		UE_LOG("[Headless] Script not found: %s", *Path);
+		return false;
+	}
+
+	Lines.Empty();
+	NextLine = 0;
+	WaitFrames = 0;
+	bQuitRequested = false;
+	NumFailures = 0;
+
+	std::string Line;
+	while (std::getline(File, Line))
+	{
+		// 앞뒤 공백, CR 제거
+		const size_t Begin = Line.find_first_not_of(" \t\r");
+		if (Begin == std::string::npos || Line[Begin] == '#')
+		{
+			continue;
+		}
+		const size_t End = Line.find_last_not_of(" \t\r");
+		Lines.Add(Line.substr(Begin, End - Begin + 1));
+	}
+
+	UE_LOG("[Headless] Script loaded: %s (%d commands)", *Path, Lines.Num());
+	return true;
+}
+
+bool FHeadlessScript::Tick(UWorld& World)
+{
+	// wait N은 N 프레임 뒤에 다음 명령을 실행
+	if (WaitFrames > 0 && --WaitFrames > 0)
+	{
+		return true;
+	}
+
+	while (NextLine < Lines.Num() && WaitFrames == 0 && !bQuitRequested)
+	{
+		ExecuteLine(World, Lines[NextLine++]);
+	}
+
+	return !bQuitRequested && (WaitFrames > 0 || NextLine < Lines.Num());
+}
+
+void FHeadlessScript::ExecuteLine(UWorld& World, const std::string& Line)
+{
+	std::istringstream Stream(Line);
+	std::string Command;
+	Stream >> Command;
+
+	if (Command == "wait")
+	{
+		Stream >> WaitFrames;
+		WaitFrames = std::max(WaitFrames, 0);
+	}
+	else if (Command == "spawn")
+	{
+		std::string TypeName;
+		int32 Count = 1;
+		Stream >> TypeName >> Count;
+		for (int32 Index = 0; Index < Count; ++Index)
+		{
+			if (World.SpawnActorByTypeName(TypeName) == nullptr)
+			{
+				break;
+			}
+		}
+	}
+	else if (Command == "load")
+	{
+		std::string SceneName;
+		Stream >> SceneName;
+		World.LoadWorld(SceneName.c_str());
+	}
+	else if (Command == "save")
+	{
+		World.SaveWorld();
+	}
+	else if (Command == "clear")
+	{
+		World.ClearWorld();
+	}
+	else if (Command == "log")
+	{
+		std::string Text;
+		std::getline(Stream >> std::ws, Text);
+		UE_LOG("%s", Text.c_str());
+	}
+	else if (Command == "capture")
+	{
+		std::string Path;
+		std::string Target;
+		Stream >> Path >> Target;
+
+		RenderWorld(World);
+		const FSoftwareImage Image = ResolveTarget(Target);
+		if (Image.SaveTGA(Path))
+		{
+			const FViewCullingStats& Culling = World.GetCullingStats();
+			UE_LOG(
+				"[Headless] Captured %ux%u: %s (%d visible, %d culled, %d occluded)",
+				Image.Width, Image.Height, Path.c_str(), Culling.NumVisible, Culling.NumCulled, Culling.NumOccluded
+			);
+		}
+		else
+		{
+			UE_LOG("[Headless] Capture failed: %s", Path.c_str());
+			++NumFailures;
+		}
+	}
+	else if (Command == "compare")
+	{
+		std::string Path;
+		Stream >> Path;
+
+		// Target은 생략할 수 있으므로 (compare Path 2) 숫자가 아니면 Target으로 읽음
+		std::string Target = "color";
+		uint32 Tolerance = 0;
+		Stream >> std::ws;
+		if (Stream.peek() != std::char_traits<char>::eof() && !std::isdigit(static_cast<unsigned char>(Stream.peek())))
+		{
+			Stream >> Target;
+		}
+		Stream >> Tolerance;
+
+		FSoftwareImage Golden;
+		if (!Golden.LoadTGA(Path))
+		{
+			UE_LOG("[Headless] Golden image not found: %s", Path.c_str());
+			++NumFailures;
+			return;
+		}
+
+		RenderWorld(World);
+		const FSoftwareImage::FDiff Diff = FSoftwareImage::Compare(Golden, ResolveTarget(Target), Tolerance);
+		if (Diff.bSizeMismatch)
+		{
+			UE_LOG("[Headless] Compare FAILED: %s (size %ux%u, expected %ux%u)",
+				Path.c_str(), Rasterizer.GetWidth(), Rasterizer.GetHeight(), Golden.Width, Golden.Height);
+			++NumFailures;
+		}
+		else if (Diff.NumDifferentPixels > 0)
+		{
+			UE_LOG("[Headless] Compare FAILED: %s (%s, %u pixels differ, max delta %u)", Path.c_str(), Target.c_str(), Diff.NumDifferentPixels, Diff.MaxChannelDelta);
+			++NumFailures;
+		}
+		else
+		{
+			UE_LOG("[Headless] Compare OK: %s (%s, max delta %u)", Path.c_str(), Target.c_str(), Diff.MaxChannelDelta);
+		}
+	}
+	else if (Command == "quit")
+	{
+		bQuitRequested = true;
+	}
+	else
+	{
+		std::vector<FString> Output;
+		Debug::ProcessCommand(FString(Line), Output);
+		for (const FString& Message : Output)
+		{
+			UE_LOG("%s", *Message);
+		}
+	}
+}
+
+void FHeadlessScript::RenderWorld(UWorld& World)
+{
+	const UEngine& Engine = UEngine::Get();
+	const uint32 Width = static_cast<uint32>(Engine.GetScreenWidth());
+	const uint32 Height = static_cast<uint32>(Engine.GetScreenHeight());
+	if (Rasterizer.GetWidth() != Width || Rasterizer.GetHeight() != Height)
+	{
+		Rasterizer.Resize(Width, Height);
+	}
+
+	// FDevice::ClearColor와 같은 배경
+	Rasterizer.Clear(FVector4(0.025f, 0.025f, 0.025f, 1.0f));
+	World.RenderSoftware(Rasterizer);
+}
+
+FSoftwareImage FHeadlessScript::ResolveTarget(const std::string& Target) const
+{
+	return Target == "uuid" ? Rasterizer.ResolveUUID() : Rasterizer.ResolveColor();
+}
@@ -0,0 +1,60 @@
+#pragma once
+#include <string>
+
+#include "Core/Container/Array.h"
+#include "Core/Container/String.h"
+#include "Core/HAL/PlatformType.h"
+#include "Core/Rendering/Software/SoftwareRasterizer.h"
+
+class UWorld;
+
+
+/**
+ * Headless 모드에서 프레임마다 실행하는 명령 파일
+ *
+ * 한 줄에 명령 하나, '#'으로 시작하는 줄은 주석입니다.
+ * - wait N          : N 프레임 뒤에 다음 명령 실행
+ * - spawn Type [N]  : Type Actor를 N개 생성 (Cube, Sphere, Cylinder, Cone, Arrow, Actor)
+ * - load Scene      : Scene 불러오기
+ * - save            : 현재 Scene 저장
+ * - clear           : Gizmo를 제외한 Actor 제거
+ * - log Text        : Text 출력
+ * - capture Path [uuid]         : 현재 화면을 Software Rasterizer로 그려서 TGA로 저장 (uuid면 UUID Target)
+ * - compare Path [uuid] [Tolerance] : 현재 화면을 Golden Image(TGA)와 비교, 다르면 실패로 기록 (uuid면 UUID Target)
+ * - quit            : 종료
+ * 그 외는 Console 명령으로 실행합니다. (예: bench rhi)
+ *
+ * 마지막 명령까지 실행하면 quit과 같이 종료합니다.
+ * compare가 하나라도 실패하면 JungleEngineHeadless는 1을 반환합니다.
+ */
+class FHeadlessScript
+{
+public:
+	bool Load(const FString& Path);
+
+	/** 이번 프레임에 실행할 명령을 처리합니다. 종료해야 하면 false를 반환합니다. */
+	bool Tick(UWorld& World);
+
+	bool IsLoaded() const { return Lines.Num() > 0; }
+
+	/** 실패한 compare 명령 수 */
+	int32 GetNumFailures() const { return NumFailures; }
+
+private:
+	void ExecuteLine(UWorld& World, const std::string& Line);
+
+	/** 현재 World를 엔진 화면 크기로 Software Rasterize 합니다. */
+	void RenderWorld(UWorld& World);
+
+	/** capture / compare의 Target 인자, "uuid"면 UUID Target이고 그 외 (color)는 Color Target */
+	FSoftwareImage ResolveTarget(const std::string& Target) const;
+
+private:
+	TArray<std::string> Lines;
+	int32 NextLine = 0;
+	int32 WaitFrames = 0;
+	bool bQuitRequested = false;
+	int32 NumFailures = 0;
+
+	FSoftwareRasterizer Rasterizer;
+};
@@ -0,0 +1,85 @@
+#include "HeadlessSettings.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <string_view>
+
+
+namespace
+{
+/** "-Key=Value" 형태면 Value를 반환합니다. */
+bool ParseValue(std::string_view Arg, std::string_view Key, std::string_view& OutValue)
+{
+	if (Arg.size() <= Key.size() + 1 || !Arg.starts_with(Key) || Arg[Key.size()] != '=')
+	{
+		return false;
+	}
+	OutValue = Arg.substr(Key.size() + 1);
+	return true;
+}
+}
+
+
+FHeadlessSettings FHeadlessSettings::ParseCommandLine(const TArray<FString>& Args)
+{
+	FHeadlessSettings Settings;
+	for (const FString& Arg : Args)
+	{
+		const std::string_view ArgView = *Arg;
+		std::string_view Value;
+
+		if (ArgView == "-headless")
+		{
+			Settings.bEnabled = true;
+		}
+		else if (ParseValue(ArgView, "-frames", Value))
+		{
+			Settings.MaxFrames = std::max(0, std::atoi(Value.data()));
+		}
+		else if (ParseValue(ArgView, "-fps", Value))
+		{
+			Settings.TargetFPS = std::max(0, std::atoi(Value.data()));
+		}
+		else if (ParseValue(ArgView, "-fixeddt", Value))
+		{
+			Settings.FixedDeltaTime = std::max(0.0f, static_cast<float>(std::atof(Value.data())));
+		}
+		else if (ParseValue(ArgView, "-fixedrate", Value))
+		{
+			Settings.FixedTickRate = std::max(0, std::atoi(Value.data()));
+		}
+		else if (ParseValue(ArgView, "-maxsteps", Value))
+		{
+			Settings.MaxFixedStepsPerFrame = std::max(1, std::atoi(Value.data()));
+		}
+		else if (ParseValue(ArgView, "-scene", Value))
+		{
+			Settings.SceneName = std::string(Value);
+		}
+		else if (ParseValue(ArgView, "-script", Value))
+		{
+			Settings.ScriptPath = std::string(Value);
+		}
+		else if (ParseValue(ArgView, "-profileport", Value))
+		{
+			Settings.ProfilerPort = std::clamp(std::atoi(Value.data()), 0, 65535);
+		}
+		else if (ParseValue(ArgView, "-hitchms", Value))
+		{
+			Settings.HitchThresholdMs = std::max(0.0, std::atof(Value.data()));
+		}
+		else if (ParseValue(ArgView, "-hitchcapture", Value))
+		{
+			Settings.HitchCaptureDirectory = std::string(Value);
+		}
+		else if (ParseValue(ArgView, "-renderthread", Value))
+		{
+			Settings.bRenderThread = std::atoi(Value.data()) != 0;
+		}
+		else if (ParseValue(ArgView, "-framelag", Value))
+		{
+			Settings.MaxFrameLag = std::max(0, std::atoi(Value.data()));
+		}
+	}
+	return Settings;
+}
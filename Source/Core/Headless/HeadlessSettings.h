@@ -0,0 +1,43 @@
+#pragma once
+#include "Core/Container/Array.h"
+#include "Core/Container/String.h"
+#include "Core/HAL/PlatformType.h"
+
+
+/**
+ * Headless 모드 설정, Window / Device / UI 없이 World의 Tick만 실행합니다.
+ *
+ * 명령줄 인자
+ * - -headless    : Headless 모드로 실행 (JungleEngineHeadless는 항상 Headless)
+ * - -frames=N    : N 프레임 후 종료 (0 = 무제한)
+ * - -fps=N       : 초당 N 프레임으로 제한 (0 = 제한 없음)
+ * - -fixeddt=X   : DeltaTime을 X초로 고정 (0 = 실제 경과 시간, Fixed Step이 켜져 있으면 Step 간격)
+ * - -fixedrate=N : 초당 N번 UWorld::TickFixed 실행 (0 = 끔)
+ * - -maxsteps=N  : 한 프레임에 따라잡을 최대 Fixed Step 수
+ * - -scene=Name  : 시작할 때 불러올 Scene
+ * - -script=Path : 프레임마다 실행할 명령 파일 (FHeadlessScript 참고)
+ * - -profileport=N : 127.0.0.1:N으로 Live Profiler 전송 (0 = 끔, JungleProfilerClient로 확인)
+ * - -hitchms=X   : X ms를 넘는 프레임을 Hitch로 기록 (0 = 끔, FFrameStats 참고)
+ * - -hitchcapture=Dir : Hitch마다 Profiler의 마지막 몇 프레임을 Dir에 Chrome Trace로 저장
+ * - -renderthread=0 : Render Command를 Game Thread에서 바로 실행 (기본은 Null RHI 앞에 Render Thread 사용)
+ * - -framelag=N  : Game Thread가 Render Thread보다 앞설 수 있는 최대 프레임 수
+ */
+struct FHeadlessSettings
+{
+	bool bEnabled = false;
+	int32 MaxFrames = 0;
+	int32 TargetFPS = 0;
+	float FixedDeltaTime = 0.0f;
+	int32 FixedTickRate = 0;
+	int32 MaxFixedStepsPerFrame = 8;
+	FString SceneName;
+	FString ScriptPath;
+	int32 ProfilerPort = 0;
+	double HitchThresholdMs = 50.0;
+	FString HitchCaptureDirectory;
+	bool bRenderThread = true;
+	int32 MaxFrameLag = 1;
+
+	/** 실행 파일 이름을 제외한 인자를 받습니다. 모르는 인자는 무시합니다. */
+	static FHeadlessSettings ParseCommandLine(const TArray<FString>& Args);
+};
@@ -0,0 +1,273 @@
+#include "BatchTransform.h"
+
+#include <cfloat>
+
+#include "Core/Async/ParallelAlgorithms.h"
+#include "Core/Math/VectorRegister.h"
+
+
+namespace
+{
+/** Matrix의 각 원소를 4 Lane에 복제해 둔 것 (4개의 점을 SoA로 변환할 때 사용) */
+struct FReplicatedMatrix
+{
+	VectorRegister4Float M[4][3];
+
+	explicit FReplicatedMatrix(const FMatrix& Matrix)
+	{
+		for (int32 Row = 0; Row < 4; ++Row)
+		{
+			for (int32 Column = 0; Column < 3; ++Column)
+			{
+				M[Row][Column] = VectorSetFloat1(Matrix.M[Row][Column]);
+			}
+		}
+	}
+
+	/** X * M[0][c] + Y * M[1][c] + Z * M[2][c] + M[3][c], 스칼라 코드와 같은 순서 */
+	FORCEINLINE VectorRegister4Float TransformColumn(
+		const VectorRegister4Float& X, const VectorRegister4Float& Y, const VectorRegister4Float& Z, int32 Column
+	) const
+	{
+		VectorRegister4Float Result = VectorMultiply(X, M[0][Column]);
+		Result = VectorMultiplyAdd(Y, M[1][Column], Result);
+		Result = VectorMultiplyAdd(Z, M[2][Column], Result);
+		return VectorAdd(Result, M[3][Column]);
+	}
+};
+
+FORCEINLINE const float* GetPosition(const uint8* Positions, int32 Stride, int32 Index)
+{
+	return reinterpret_cast<const float*>(Positions + static_cast<int64>(Stride) * Index);
+}
+
+/** 점 하나 (묶음 끝의 나머지) */
+FORCEINLINE void TransformPosition(const FMatrix& Matrix, const float* In, FVector& Out)
+{
+	VectorStoreFloat3(VectorMatrix::TransformPosition(VectorLoadFloat3(In, 1.0f), Matrix.M), &Out.X);
+}
+
+/** 연속된 FVector [Begin, End) */
+void TransformPositionsRange(const FMatrix& Matrix, const FVector* In, FVector* Out, int32 Begin, int32 End)
+{
+	const FReplicatedMatrix Replicated(Matrix);
+
+	int32 Index = Begin;
+	for (; Index + 4 <= End; Index += 4)
+	{
+		// (x0 y0 z0 x1) (y1 z1 x2 y2) (z2 x3 y3 z3)를 X, Y, Z 묶음으로
+		const float* Src = &In[Index].X;
+		const VectorRegister4Float A = VectorLoad(Src);
+		const VectorRegister4Float B = VectorLoad(Src + 4);
+		const VectorRegister4Float C = VectorLoad(Src + 8);
+
+		const VectorRegister4Float X = VectorShuffle<0, 3, 0, 2>(A, VectorShuffle<2, 2, 1, 1>(B, C));
+		const VectorRegister4Float Y = VectorShuffle<0, 2, 0, 2>(VectorShuffle<1, 1, 0, 0>(A, B), VectorShuffle<3, 3, 2, 2>(B, C));
+		const VectorRegister4Float Z = VectorShuffle<0, 2, 0, 2>(VectorShuffle<2, 2, 1, 1>(A, B), VectorShuffle<0, 0, 3, 3>(C, C));
+
+		const VectorRegister4Float OutX = Replicated.TransformColumn(X, Y, Z, 0);
+		const VectorRegister4Float OutY = Replicated.TransformColumn(X, Y, Z, 1);
+		const VectorRegister4Float OutZ = Replicated.TransformColumn(X, Y, Z, 2);
+
+		// 다시 (x0 y0 z0 x1) (y1 z1 x2 y2) (z2 x3 y3 z3)로
+		float* Dest = &Out[Index].X;
+		VectorStore(VectorShuffle<0, 2, 0, 2>(VectorShuffle<0, 0, 0, 0>(OutX, OutY), VectorShuffle<0, 0, 1, 1>(OutZ, OutX)), Dest);
+		VectorStore(VectorShuffle<0, 2, 0, 2>(VectorShuffle<1, 1, 1, 1>(OutY, OutZ), VectorShuffle<2, 2, 2, 2>(OutX, OutY)), Dest + 4);
+		VectorStore(VectorShuffle<0, 2, 0, 2>(VectorShuffle<2, 2, 3, 3>(OutZ, OutX), VectorShuffle<3, 3, 3, 3>(OutY, OutZ)), Dest + 8);
+	}
+	for (; Index < End; ++Index)
+	{
+		TransformPosition(Matrix, &In[Index].X, Out[Index]);
+	}
+}
+
+/** Stride 간격의 정점 [Begin, End), Stride가 16바이트 이상이라 정점마다 float 4개를 읽어도 됨 */
+void TransformStridedRange(const FMatrix& Matrix, const uint8* Positions, int32 Stride, FVector* Out, int32 Begin, int32 End)
+{
+	const FReplicatedMatrix Replicated(Matrix);
+
+	int32 Index = Begin;
+	for (; Index + 4 <= End; Index += 4)
+	{
+		// 정점 4개의 (x y z ?)를 전치해서 X, Y, Z 묶음으로
+		const VectorRegister4Float P0 = VectorLoad(GetPosition(Positions, Stride, Index));
+		const VectorRegister4Float P1 = VectorLoad(GetPosition(Positions, Stride, Index + 1));
+		const VectorRegister4Float P2 = VectorLoad(GetPosition(Positions, Stride, Index + 2));
+		const VectorRegister4Float P3 = VectorLoad(GetPosition(Positions, Stride, Index + 3));
+
+		const VectorRegister4Float XY01 = VectorShuffle<0, 1, 0, 1>(P0, P1);
+		const VectorRegister4Float XY23 = VectorShuffle<0, 1, 0, 1>(P2, P3);
+		const VectorRegister4Float Z01 = VectorShuffle<2, 2, 2, 2>(P0, P1);
+		const VectorRegister4Float Z23 = VectorShuffle<2, 2, 2, 2>(P2, P3);
+
+		const VectorRegister4Float X = VectorShuffle<0, 2, 0, 2>(XY01, XY23);
+		const VectorRegister4Float Y = VectorShuffle<1, 3, 1, 3>(XY01, XY23);
+		const VectorRegister4Float Z = VectorShuffle<0, 2, 0, 2>(Z01, Z23);
+
+		const VectorRegister4Float OutX = Replicated.TransformColumn(X, Y, Z, 0);
+		const VectorRegister4Float OutY = Replicated.TransformColumn(X, Y, Z, 1);
+		const VectorRegister4Float OutZ = Replicated.TransformColumn(X, Y, Z, 2);
+
+		float* Dest = &Out[Index].X;
+		VectorStore(VectorShuffle<0, 2, 0, 2>(VectorShuffle<0, 0, 0, 0>(OutX, OutY), VectorShuffle<0, 0, 1, 1>(OutZ, OutX)), Dest);
+		VectorStore(VectorShuffle<0, 2, 0, 2>(VectorShuffle<1, 1, 1, 1>(OutY, OutZ), VectorShuffle<2, 2, 2, 2>(OutX, OutY)), Dest + 4);
+		VectorStore(VectorShuffle<0, 2, 0, 2>(VectorShuffle<2, 2, 3, 3>(OutZ, OutX), VectorShuffle<3, 3, 3, 3>(OutY, OutZ)), Dest + 8);
+	}
+	for (; Index < End; ++Index)
+	{
+		TransformPosition(Matrix, GetPosition(Positions, Stride, Index), Out[Index]);
+	}
+}
+
+/** Stride 간격의 점 [Begin, End)의 AABB */
+FBox ComputeBoundsRange(const uint8* Positions, int32 Stride, int32 Num, int32 Begin, int32 End)
+{
+	VectorRegister4Float Min0 = VectorSetFloat1(FLT_MAX);
+	VectorRegister4Float Max0 = VectorSetFloat1(-FLT_MAX);
+	VectorRegister4Float Min1 = Min0;
+	VectorRegister4Float Max1 = Max0;
+
+	// 마지막 점은 float 4개를 읽으면 배열 끝을 넘을 수 있음
+	const int32 SafeEnd = End < Num ? End : Num - 1;
+
+	int32 Index = Begin;
+	for (; Index + 2 <= SafeEnd; Index += 2)
+	{
+		const VectorRegister4Float P0 = VectorLoad(GetPosition(Positions, Stride, Index));
+		const VectorRegister4Float P1 = VectorLoad(GetPosition(Positions, Stride, Index + 1));
+		Min0 = VectorMin(Min0, P0);
+		Max0 = VectorMax(Max0, P0);
+		Min1 = VectorMin(Min1, P1);
+		Max1 = VectorMax(Max1, P1);
+	}
+	for (; Index < End; ++Index)
+	{
+		const VectorRegister4Float P = VectorLoadFloat3(GetPosition(Positions, Stride, Index), 0.0f);
+		Min0 = VectorMin(Min0, P);
+		Max0 = VectorMax(Max0, P);
+	}
+
+	// Lane 3은 정점의 다음 값이라 버림
+	FBox Result;
+	VectorStoreFloat3(VectorMin(Min0, Min1), &Result.Min.X);
+	VectorStoreFloat3(VectorMax(Max0, Max1), &Result.Max.X);
+	return Result;
+}
+}
+
+
+void BatchTransform::TransformPositions(const FMatrix& Matrix, std::span<const FVector> In, std::span<FVector> Out)
+{
+	const FVector* InData = In.data();
+	FVector* OutData = Out.data();
+	ParallelAlgo::ParallelForChunked(static_cast<int32>(In.size()), [&Matrix, InData, OutData](int32 Begin, int32 End)
+	{
+		TransformPositionsRange(Matrix, InData, OutData, Begin, End);
+	}, Threshold::Positions);
+}
+
+void BatchTransform::TransformPositions(const FMatrix& Matrix, const void* Positions, int32 Stride, int32 Num, std::span<FVector> Out)
+{
+	// 빽빽한 float 3개는 FVector 배열과 같음
+	if (Stride == static_cast<int32>(sizeof(FVector)))
+	{
+		TransformPositions(Matrix, std::span<const FVector>(static_cast<const FVector*>(Positions), Num), Out);
+		return;
+	}
+
+	const uint8* PositionData = static_cast<const uint8*>(Positions);
+	FVector* OutData = Out.data();
+	ParallelAlgo::ParallelForChunked(Num, [&Matrix, PositionData, Stride, OutData](int32 Begin, int32 End)
+	{
+		TransformStridedRange(Matrix, PositionData, Stride, OutData, Begin, End);
+	}, Threshold::Positions);
+}
+
+void BatchTransform::TransformBoxes(std::span<const FBox> LocalBoxes, std::span<const FMatrix> Matrices, std::span<FBox> OutBoxes)
+{
+	const FBox* BoxData = LocalBoxes.data();
+	const FMatrix* MatrixData = Matrices.data();
+	FBox* OutData = OutBoxes.data();
+	ParallelAlgo::ParallelForChunked(static_cast<int32>(LocalBoxes.size()), [BoxData, MatrixData, OutData](int32 Begin, int32 End)
+	{
+		const VectorRegister4Float Half = VectorSetFloat1(0.5f);
+		for (int32 Index = Begin; Index < End; ++Index)
+		{
+			const FBox& Box = BoxData[Index];
+			const auto& M = MatrixData[Index].M;
+
+			const VectorRegister4Float Min = VectorLoadFloat3(&Box.Min.X, 0.0f);
+			const VectorRegister4Float Max = VectorLoadFloat3(&Box.Max.X, 0.0f);
+			const VectorRegister4Float Center = VectorMultiply(VectorAdd(Min, Max), Half);
+			const VectorRegister4Float Extent = VectorMultiply(VectorSubtract(Max, Min), Half);
+
+			// FBox::TransformBy: 중심은 옮기고, 반지름은 행렬 성분의 절댓값으로
+			const VectorRegister4Float WorldCenter = VectorMatrix::TransformPosition(Center, M);
+			VectorRegister4Float WorldExtent = VectorMultiply(VectorReplicate<0>(Extent), VectorAbs(VectorLoadAligned(M[0])));
+			WorldExtent = VectorMultiplyAdd(VectorReplicate<1>(Extent), VectorAbs(VectorLoadAligned(M[1])), WorldExtent);
+			WorldExtent = VectorMultiplyAdd(VectorReplicate<2>(Extent), VectorAbs(VectorLoadAligned(M[2])), WorldExtent);
+
+			VectorStoreFloat3(VectorSubtract(WorldCenter, WorldExtent), &OutData[Index].Min.X);
+			VectorStoreFloat3(VectorAdd(WorldCenter, WorldExtent), &OutData[Index].Max.X);
+		}
+	}, Threshold::Boxes);
+}
+
+void BatchTransform::MultiplyMatrices(std::span<const FMatrix> A, std::span<const FMatrix> B, std::span<FMatrix> Out)
+{
+	const FMatrix* AData = A.data();
+	const FMatrix* BData = B.data();
+	FMatrix* OutData = Out.data();
+	ParallelAlgo::ParallelForChunked(static_cast<int32>(A.size()), [AData, BData, OutData](int32 Begin, int32 End)
+	{
+		for (int32 Index = Begin; Index < End; ++Index)
+		{
+			VectorMatrix::Multiply(OutData[Index].M, AData[Index].M, BData[Index].M);
+		}
+	}, Threshold::Matrices);
+}
+
+void BatchTransform::MultiplyMatrices(std::span<const FMatrix> A, const FMatrix& B, std::span<FMatrix> Out)
+{
+	const FMatrix* AData = A.data();
+	FMatrix* OutData = Out.data();
+	ParallelAlgo::ParallelForChunked(static_cast<int32>(A.size()), [AData, &B, OutData](int32 Begin, int32 End)
+	{
+		for (int32 Index = Begin; Index < End; ++Index)
+		{
+			VectorMatrix::Multiply(OutData[Index].M, AData[Index].M, B.M);
+		}
+	}, Threshold::Matrices);
+}
+
+FBox BatchTransform::ComputeBounds(const void* Positions, int32 Stride, int32 Num)
+{
+	if (Num <= 0)
+	{
+		return FBox(FVector(FLT_MAX), FVector(-FLT_MAX));
+	}
+
+	const uint8* PositionData = static_cast<const uint8*>(Positions);
+	const int32 NumChunks = ParallelAlgo::GetNumChunks(Num, Threshold::Bounds);
+	if (NumChunks <= 1)
+	{
+		return ComputeBoundsRange(PositionData, Stride, Num, 0, Num);
+	}
+
+	TArray<FBox> Partials;
+	Partials.SetNum(NumChunks);
+	FBox* PartialData = Partials.GetData();
+	FJobSystem::Get().ParallelFor(NumChunks, [&](int32 ChunkIndex)
+	{
+		int32 Begin, End;
+		ParallelAlgo::GetChunkRange(Num, NumChunks, ChunkIndex, Begin, End);
+		PartialData[ChunkIndex] = ComputeBoundsRange(PositionData, Stride, Num, Begin, End);
+	});
+
+	FBox Result = Partials[0];
+	for (int32 ChunkIndex = 1; ChunkIndex < NumChunks; ++ChunkIndex)
+	{
+		Result += Partials[ChunkIndex];
+	}
+	return Result;
+}
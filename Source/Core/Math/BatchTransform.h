@@ -0,0 +1,71 @@
+#pragma once
+#include <span>
+
+#include "Core/HAL/PlatformType.h"
+#include "Core/Math/BoxSphereBounds.h"
+#include "Core/Math/Matrix.h"
+#include "Core/Math/Vector.h"
+
+
+/**
+ * 연속된 배열을 한 번에 처리하는 변환 Kernel
+ *
+ * 원소 하나씩 FMatrix 멤버 함수를 부르는 대신 VectorRegister로 4개씩 처리하고,
+ * 원소 수가 임계값을 넘으면 FJobSystem으로 나눠서 병렬로 실행합니다.
+ * 계산 순서는 FMatrix::TransformPosition, FBox::TransformBy, FMatrix::operator*와 같아서 결과가 비트 단위로 같습니다.
+ */
+namespace BatchTransform
+{
+	/** 병렬 실행 임계값 (Job 하나에 맡길 최소 원소 수) */
+	namespace Threshold
+	{
+		constexpr int32 Positions = 16384;
+		constexpr int32 Boxes = 4096;
+		constexpr int32 Matrices = 4096;
+		constexpr int32 Bounds = 65536;
+	}
+
+	/** Out[i] = (In[i], 1) * Matrix, In과 Out은 같은 배열이어도 됨 */
+	void TransformPositions(const FMatrix& Matrix, std::span<const FVector> In, std::span<FVector> Out);
+
+	/**
+	 * Stride 간격으로 놓인 정점의 앞 float 3개(X, Y, Z)를 변환합니다.
+	 * @param Positions 첫 정점의 X 주소
+	 * @param Stride 정점 하나의 바이트 크기, sizeof(FVector)이거나 16 이상 (정점마다 float 4개를 한 번에 읽음)
+	 */
+	void TransformPositions(const FMatrix& Matrix, const void* Positions, int32 Stride, int32 Num, std::span<FVector> Out);
+
+	template <typename VertexType>
+	void TransformVertexPositions(const FMatrix& Matrix, std::span<const VertexType> Vertices, std::span<FVector> Out)
+	{
+		const void* Positions = Vertices.empty() ? nullptr : &Vertices[0].X;
+		TransformPositions(Matrix, Positions, static_cast<int32>(sizeof(VertexType)), static_cast<int32>(Vertices.size()), Out);
+	}
+
+	/** OutBoxes[i] = LocalBoxes[i].TransformBy(Matrices[i]) */
+	void TransformBoxes(std::span<const FBox> LocalBoxes, std::span<const FMatrix> Matrices, std::span<FBox> OutBoxes);
+
+	/** Out[i] = A[i] * B[i] */
+	void MultiplyMatrices(std::span<const FMatrix> A, std::span<const FMatrix> B, std::span<FMatrix> Out);
+
+	/** Out[i] = A[i] * B (Model * ViewProjection처럼 오른쪽이 공통일 때) */
+	void MultiplyMatrices(std::span<const FMatrix> A, const FMatrix& B, std::span<FMatrix> Out);
+
+	/**
+	 * Stride 간격으로 놓인 점들의 AABB (SIMD Min/Max Reduction)
+	 * 점이 없으면 Min = FLT_MAX, Max = -FLT_MAX인 빈 Box
+	 */
+	FBox ComputeBounds(const void* Positions, int32 Stride, int32 Num);
+
+	inline FBox ComputeBounds(std::span<const FVector> Positions)
+	{
+		return ComputeBounds(Positions.data(), static_cast<int32>(sizeof(FVector)), static_cast<int32>(Positions.size()));
+	}
+
+	template <typename VertexType>
+	FBox ComputeVertexBounds(std::span<const VertexType> Vertices)
+	{
+		const void* Positions = Vertices.empty() ? nullptr : &Vertices[0].X;
+		return ComputeBounds(Positions, static_cast<int32>(sizeof(VertexType)), static_cast<int32>(Vertices.size()));
+	}
+}
@@ -2,6 +2,25 @@
 #include "Core/Math/Matrix.h"
 #include "Core/Math/Transform.h"
 
+FBox FBox::TransformBy(const FMatrix& InMatrix) const
+{
+	// 중심은 그대로 옮기고, 반지름은 각 축에 행렬 성분의 절댓값을 곱해 더함
+	const FVector Center = GetCenter();
+	const FVector Extent = GetExtent();
+
+	float NewCenter[3];
+	float NewExtent[3];
+	for (int32 Column = 0; Column < 3; ++Column)
+	{
+		NewCenter[Column] = Center.X * InMatrix.M[0][Column] + Center.Y * InMatrix.M[1][Column] + Center.Z * InMatrix.M[2][Column] + InMatrix.M[3][Column];
+		NewExtent[Column] = Extent.X * FMath::Abs(InMatrix.M[0][Column]) + Extent.Y * FMath::Abs(InMatrix.M[1][Column]) + Extent.Z * FMath::Abs(InMatrix.M[2][Column]);
+	}
+
+	const FVector WorldCenter(NewCenter[0], NewCenter[1], NewCenter[2]);
+	const FVector WorldExtent(NewExtent[0], NewExtent[1], NewExtent[2]);
+	return FBox(WorldCenter - WorldExtent, WorldCenter + WorldExtent);
+}
+
 FBoxSphereBounds FBoxSphereBounds::TransformBy(const FMatrix& InMatrix) const
 {
 	FBoxSphereBounds NewBounds;
@@ -144,6 +144,38 @@ public:
 	{
 		return  GetSize().X * GetSize().Y * GetSize().Z;
 	}
+
+	float GetSurfaceArea() const
+	{
+		const FVector Size = GetSize();
+		return 2.0f * (Size.X * Size.Y + Size.Y * Size.Z + Size.Z * Size.X);
+	}
+
+	/** 두 Box가 겹치는지 (면이 닿아도 겹침) */
+	bool Intersect(const FBox& Other) const
+	{
+		return Min.X <= Other.Max.X && Max.X >= Other.Min.X
+			&& Min.Y <= Other.Max.Y && Max.Y >= Other.Min.Y
+			&& Min.Z <= Other.Max.Z && Max.Z >= Other.Min.Z;
+	}
+
+	/** 이 Box가 Other 안에 완전히 들어가는지 */
+	bool IsInside(const FBox& Other) const
+	{
+		return Min.X >= Other.Min.X && Max.X <= Other.Max.X
+			&& Min.Y >= Other.Min.Y && Max.Y <= Other.Max.Y
+			&& Min.Z >= Other.Min.Z && Max.Z <= Other.Max.Z;
+	}
+
+	bool IsInside(const FVector& Point) const
+	{
+		return Point.X >= Min.X && Point.X <= Max.X
+			&& Point.Y >= Min.Y && Point.Y <= Max.Y
+			&& Point.Z >= Min.Z && Point.Z <= Max.Z;
+	}
+
+	/** 행 벡터 규약의 Matrix로 옮긴 뒤 다시 감싼 AABB */
+	FBox TransformBy(const FMatrix& InMatrix) const;
 };
 
 struct FSphere
@@ -0,0 +1,412 @@
+#include "DynamicAABBTree.h"
+
+#include <algorithm>
+
+
+int32 FDynamicAABBTree::CreateProxy(const FBox& Box, void* UserData)
+{
+	const int32 ProxyId = AllocateNode();
+
+	FNode& Node = Nodes[ProxyId];
+	Node.Box = Box.ExpandBy(FatMargin);
+	Node.UserData = UserData;
+	Node.Height = 0;
+
+	InsertLeaf(ProxyId);
+	++NumProxies;
+	return ProxyId;
+}
+
+void FDynamicAABBTree::DestroyProxy(int32 ProxyId)
+{
+	RemoveLeaf(ProxyId);
+	FreeNode(ProxyId);
+	--NumProxies;
+}
+
+bool FDynamicAABBTree::MoveProxy(int32 ProxyId, const FBox& Box, const FVector& Displacement)
+{
+	if (Box.IsInside(Nodes[ProxyId].Box))
+	{
+		return false;
+	}
+
+	RemoveLeaf(ProxyId);
+
+	// 움직이는 방향으로 더 넓혀서, 같은 방향으로 계속 움직여도 한동안 다시 넣지 않도록
+	FBox FatBox = Box.ExpandBy(FatMargin);
+	const FVector Predicted = Displacement * DisplacementMultiplier;
+	FatBox.Min = FVector::Min(FatBox.Min, FatBox.Min + Predicted);
+	FatBox.Max = FVector::Max(FatBox.Max, FatBox.Max + Predicted);
+	Nodes[ProxyId].Box = FatBox;
+
+	InsertLeaf(ProxyId);
+	return true;
+}
+
+void FDynamicAABBTree::Clear()
+{
+	Nodes.Empty();
+	Root = INDEX_NONE;
+	FreeList = INDEX_NONE;
+	NumProxies = 0;
+}
+
+float FDynamicAABBTree::GetAreaRatio() const
+{
+	if (Root == INDEX_NONE)
+	{
+		return 0.0f;
+	}
+
+	const float RootArea = Nodes[Root].Box.GetSurfaceArea();
+	float TotalArea = 0.0f;
+	for (const FNode& Node : Nodes)
+	{
+		if (Node.Height >= 0)
+		{
+			TotalArea += Node.Box.GetSurfaceArea();
+		}
+	}
+	return RootArea > 0.0f ? TotalArea / RootArea : 0.0f;
+}
+
+bool FDynamicAABBTree::Validate() const
+{
+	int32 NumLeaves = 0;
+	if (Root != INDEX_NONE && ValidateNode(Root, INDEX_NONE, NumLeaves) < 0)
+	{
+		return false;
+	}
+	return NumLeaves == NumProxies;
+}
+
+int32 FDynamicAABBTree::ValidateNode(int32 NodeId, int32 ParentId, int32& OutNumLeaves) const
+{
+	const FNode& Node = Nodes[NodeId];
+	if (Node.ParentOrNext != ParentId)
+	{
+		return -1;
+	}
+
+	if (Node.IsLeaf())
+	{
+		++OutNumLeaves;
+		return Node.Height == 0 ? 0 : -1;
+	}
+
+	const int32 Height1 = ValidateNode(Node.Child1, NodeId, OutNumLeaves);
+	const int32 Height2 = ValidateNode(Node.Child2, NodeId, OutNumLeaves);
+	if (Height1 < 0 || Height2 < 0 || Node.Height != 1 + std::max(Height1, Height2))
+	{
+		return -1;
+	}
+
+	// 부모 Box는 자식 Box를 모두 감싸야 함
+	if (!Nodes[Node.Child1].Box.IsInside(Node.Box) || !Nodes[Node.Child2].Box.IsInside(Node.Box))
+	{
+		return -1;
+	}
+	return Node.Height;
+}
+
+bool FDynamicAABBTree::IntersectRayBox(const FVector& Origin, const FVector& InvDirection, const FBox& Box, float MaxDistance, float& OutDistance)
+{
+	// Slab 방식, 축에 평행한 Ray는 InvDirection이 무한대라 자연스럽게 처리됨
+	float T1 = (Box.Min.X - Origin.X) * InvDirection.X;
+	float T2 = (Box.Max.X - Origin.X) * InvDirection.X;
+	float Enter = std::min(T1, T2);
+	float Exit = std::max(T1, T2);
+
+	T1 = (Box.Min.Y - Origin.Y) * InvDirection.Y;
+	T2 = (Box.Max.Y - Origin.Y) * InvDirection.Y;
+	Enter = std::max(Enter, std::min(T1, T2));
+	Exit = std::min(Exit, std::max(T1, T2));
+
+	T1 = (Box.Min.Z - Origin.Z) * InvDirection.Z;
+	T2 = (Box.Max.Z - Origin.Z) * InvDirection.Z;
+	Enter = std::max(Enter, std::min(T1, T2));
+	Exit = std::min(Exit, std::max(T1, T2));
+
+	Enter = std::max(Enter, 0.0f);
+	if (Enter > Exit || Enter > MaxDistance)
+	{
+		return false;
+	}
+
+	OutDistance = Enter;
+	return true;
+}
+
+int32 FDynamicAABBTree::AllocateNode()
+{
+	if (FreeList == INDEX_NONE)
+	{
+		const int32 NodeId = Nodes.Add(FNode());
+		return NodeId;
+	}
+
+	const int32 NodeId = FreeList;
+	FreeList = Nodes[NodeId].ParentOrNext;
+	Nodes[NodeId] = FNode();
+	return NodeId;
+}
+
+void FDynamicAABBTree::FreeNode(int32 NodeId)
+{
+	FNode& Node = Nodes[NodeId];
+	Node.ParentOrNext = FreeList;
+	Node.UserData = nullptr;
+	Node.Height = -1;
+	FreeList = NodeId;
+}
+
+void FDynamicAABBTree::InsertLeaf(int32 Leaf)
+{
+	if (Root == INDEX_NONE)
+	{
+		Root = Leaf;
+		Nodes[Root].ParentOrNext = INDEX_NONE;
+		return;
+	}
+
+	// 넣었을 때 늘어나는 표면적이 가장 작은 형제를 찾아 내려감
+	const FBox LeafBox = Nodes[Leaf].Box;
+	int32 Index = Root;
+	while (!Nodes[Index].IsLeaf())
+	{
+		const FNode& Node = Nodes[Index];
+		const float Area = Node.Box.GetSurfaceArea();
+		const float CombinedArea = (Node.Box + LeafBox).GetSurfaceArea();
+
+		// 여기서 새 부모를 만드는 비용과, 그보다 아래로 내려갈 때 조상들이 늘어나는 비용
+		const float Cost = 2.0f * CombinedArea;
+		const float InheritanceCost = 2.0f * (CombinedArea - Area);
+
+		auto ChildCost = [this, &LeafBox, InheritanceCost](int32 Child)
+		{
+			const FNode& ChildNode = Nodes[Child];
+			const float NewArea = (LeafBox + ChildNode.Box).GetSurfaceArea();
+			return ChildNode.IsLeaf()
+				? NewArea + InheritanceCost
+				: NewArea - ChildNode.Box.GetSurfaceArea() + InheritanceCost;
+		};
+
+		const float Cost1 = ChildCost(Node.Child1);
+		const float Cost2 = ChildCost(Node.Child2);
+		if (Cost < Cost1 && Cost < Cost2)
+		{
+			break;
+		}
+		Index = Cost1 < Cost2 ? Node.Child1 : Node.Child2;
+	}
+	const int32 Sibling = Index;
+
+	// Sibling 자리에 새 부모를 만들고 그 아래에 Sibling과 Leaf
+	const int32 OldParent = Nodes[Sibling].ParentOrNext;
+	const int32 NewParent = AllocateNode();
+	{
+		FNode& ParentNode = Nodes[NewParent];
+		ParentNode.ParentOrNext = OldParent;
+		ParentNode.Box = LeafBox + Nodes[Sibling].Box;
+		ParentNode.Height = Nodes[Sibling].Height + 1;
+		ParentNode.Child1 = Sibling;
+		ParentNode.Child2 = Leaf;
+	}
+
+	if (OldParent != INDEX_NONE)
+	{
+		FNode& OldParentNode = Nodes[OldParent];
+		if (OldParentNode.Child1 == Sibling)
+		{
+			OldParentNode.Child1 = NewParent;
+		}
+		else
+		{
+			OldParentNode.Child2 = NewParent;
+		}
+	}
+	else
+	{
+		Root = NewParent;
+	}
+	Nodes[Sibling].ParentOrNext = NewParent;
+	Nodes[Leaf].ParentOrNext = NewParent;
+
+	// 올라가면서 비용이 줄어드는 Rotation을 하고 Box, 높이 갱신 (Refit)
+	Index = Nodes[Leaf].ParentOrNext;
+	while (Index != INDEX_NONE)
+	{
+		Rotate(Index);
+		Refit(Index);
+		Index = Nodes[Index].ParentOrNext;
+	}
+}
+
+void FDynamicAABBTree::RemoveLeaf(int32 Leaf)
+{
+	if (Leaf == Root)
+	{
+		Root = INDEX_NONE;
+		return;
+	}
+
+	const int32 Parent = Nodes[Leaf].ParentOrNext;
+	const int32 GrandParent = Nodes[Parent].ParentOrNext;
+	const int32 Sibling = Nodes[Parent].Child1 == Leaf ? Nodes[Parent].Child2 : Nodes[Parent].Child1;
+
+	// Parent를 없애고 그 자리에 Sibling
+	if (GrandParent != INDEX_NONE)
+	{
+		FNode& GrandParentNode = Nodes[GrandParent];
+		if (GrandParentNode.Child1 == Parent)
+		{
+			GrandParentNode.Child1 = Sibling;
+		}
+		else
+		{
+			GrandParentNode.Child2 = Sibling;
+		}
+		Nodes[Sibling].ParentOrNext = GrandParent;
+		FreeNode(Parent);
+
+		int32 Index = GrandParent;
+		while (Index != INDEX_NONE)
+		{
+			Rotate(Index);
+			Refit(Index);
+			Index = Nodes[Index].ParentOrNext;
+		}
+	}
+	else
+	{
+		Root = Sibling;
+		Nodes[Sibling].ParentOrNext = INDEX_NONE;
+		FreeNode(Parent);
+	}
+}
+
+void FDynamicAABBTree::SwapSubtrees(int32 IndexX, int32 IndexY)
+{
+	const int32 ParentX = Nodes[IndexX].ParentOrNext;
+	const int32 ParentY = Nodes[IndexY].ParentOrNext;
+
+	FNode& ParentNodeX = Nodes[ParentX];
+	(ParentNodeX.Child1 == IndexX ? ParentNodeX.Child1 : ParentNodeX.Child2) = IndexY;
+	FNode& ParentNodeY = Nodes[ParentY];
+	(ParentNodeY.Child1 == IndexY ? ParentNodeY.Child1 : ParentNodeY.Child2) = IndexX;
+
+	Nodes[IndexX].ParentOrNext = ParentY;
+	Nodes[IndexY].ParentOrNext = ParentX;
+}
+
+void FDynamicAABBTree::Refit(int32 NodeId)
+{
+	FNode& Node = Nodes[NodeId];
+	Node.Box = Nodes[Node.Child1].Box + Nodes[Node.Child2].Box;
+	Node.Height = 1 + std::max(Nodes[Node.Child1].Height, Nodes[Node.Child2].Height);
+}
+
+void FDynamicAABBTree::Rotate(int32 IndexA)
+{
+	// A(B(D, E), C(F, G))
+	// A의 자식과 손자를 바꿨을 때 B, C의 표면적 합이 줄어들면 바꿉니다. (높이가 아니라 SAH 비용 기준)
+	const FNode& A = Nodes[IndexA];
+	if (A.IsLeaf())
+	{
+		return;
+	}
+
+	const int32 IndexB = A.Child1;
+	const int32 IndexC = A.Child2;
+	const FNode& B = Nodes[IndexB];
+	const FNode& C = Nodes[IndexC];
+	if (B.IsLeaf() && C.IsLeaf())
+	{
+		return;
+	}
+
+	// 한쪽만 Leaf면 Leaf를 다른 쪽의 자식 하나와 바꿔 봄
+	if (B.IsLeaf() || C.IsLeaf())
+	{
+		const int32 IndexLeaf = B.IsLeaf() ? IndexB : IndexC;
+		const int32 IndexInner = B.IsLeaf() ? IndexC : IndexB;
+		const FNode& Leaf = Nodes[IndexLeaf];
+		const FNode& Inner = Nodes[IndexInner];
+
+		const float BaseCost = Inner.Box.GetSurfaceArea();
+		const float Cost1 = (Leaf.Box + Nodes[Inner.Child2].Box).GetSurfaceArea(); // Leaf <-> Child1
+		const float Cost2 = (Leaf.Box + Nodes[Inner.Child1].Box).GetSurfaceArea(); // Leaf <-> Child2
+		if (BaseCost <= Cost1 && BaseCost <= Cost2)
+		{
+			return;
+		}
+
+		SwapSubtrees(IndexLeaf, Cost1 < Cost2 ? Inner.Child1 : Inner.Child2);
+		Refit(IndexInner);
+		return;
+	}
+
+	const int32 IndexD = B.Child1;
+	const int32 IndexE = B.Child2;
+	const int32 IndexF = C.Child1;
+	const int32 IndexG = C.Child2;
+	const FBox& BoxD = Nodes[IndexD].Box;
+	const FBox& BoxE = Nodes[IndexE].Box;
+	const FBox& BoxF = Nodes[IndexF].Box;
+	const FBox& BoxG = Nodes[IndexG].Box;
+
+	const float AreaB = B.Box.GetSurfaceArea();
+	const float AreaC = C.Box.GetSurfaceArea();
+
+	enum class ERotation : uint8 { None, BF, BG, CD, CE, DF, DG };
+	ERotation Best = ERotation::None;
+	float BestCost = AreaB + AreaC;
+
+	auto Consider = [&Best, &BestCost](ERotation Rotation, float Cost)
+	{
+		if (Cost < BestCost)
+		{
+			Best = Rotation;
+			BestCost = Cost;
+		}
+	};
+	Consider(ERotation::BF, AreaB + (B.Box + BoxG).GetSurfaceArea());
+	Consider(ERotation::BG, AreaB + (B.Box + BoxF).GetSurfaceArea());
+	Consider(ERotation::CD, AreaC + (C.Box + BoxE).GetSurfaceArea());
+	Consider(ERotation::CE, AreaC + (C.Box + BoxD).GetSurfaceArea());
+	Consider(ERotation::DF, (BoxF + BoxE).GetSurfaceArea() + (BoxD + BoxG).GetSurfaceArea());
+	Consider(ERotation::DG, (BoxG + BoxE).GetSurfaceArea() + (BoxF + BoxD).GetSurfaceArea());
+
+	switch (Best)
+	{
+	case ERotation::None:
+		return;
+	case ERotation::BF:
+		SwapSubtrees(IndexB, IndexF);
+		Refit(IndexC);
+		break;
+	case ERotation::BG:
+		SwapSubtrees(IndexB, IndexG);
+		Refit(IndexC);
+		break;
+	case ERotation::CD:
+		SwapSubtrees(IndexC, IndexD);
+		Refit(IndexB);
+		break;
+	case ERotation::CE:
+		SwapSubtrees(IndexC, IndexE);
+		Refit(IndexB);
+		break;
+	case ERotation::DF:
+		SwapSubtrees(IndexD, IndexF);
+		Refit(IndexB);
+		Refit(IndexC);
+		break;
+	case ERotation::DG:
+		SwapSubtrees(IndexD, IndexG);
+		Refit(IndexB);
+		Refit(IndexC);
+		break;
+	}
+}
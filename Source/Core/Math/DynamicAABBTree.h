@@ -0,0 +1,358 @@
+#pragma once
+#include <utility>
+#include <vector>
+
+#include "BoxSphereBounds.h"
+#include "Frustum.h"
+#include "Ray.h"
+#include "Core/Container/Array.h"
+#include "Core/Container/String.h"
+#include "Core/HAL/PlatformType.h"
+
+
+/**
+ * 움직이는 물체를 위한 AABB Tree (Dynamic BVH)
+ *
+ * - Leaf 하나가 Proxy 하나이고, Proxy의 Box는 Margin만큼 넓힌 Fat AABB로 저장합니다.
+ *   물체가 Fat AABB 안에서 움직이면 Tree를 고치지 않고, 벗어날 때만 뺐다가 다시 넣습니다.
+ * - 삽입 위치는 표면적(SAH) 비용이 가장 적게 늘어나는 곳을 고르고, 올라오면서 표면적이 줄어드는 Rotation을 합니다.
+ *   높이만 맞추는 AVL Rotation은 큰 Box를 위로 올려 Query가 오히려 느려지므로 쓰지 않습니다.
+ * - Query 중에 Tree를 수정하면 안 됩니다. Query끼리는 여러 스레드에서 동시에 해도 됩니다.
+ */
+class FDynamicAABBTree
+{
+public:
+	/** Fat AABB를 넓히는 양 (World 단위) */
+	static constexpr float FatMargin = 0.1f;
+
+	/** MoveProxy에서 이동 방향으로 Fat AABB를 더 늘리는 배율 */
+	static constexpr float DisplacementMultiplier = 2.0f;
+
+	FDynamicAABBTree() = default;
+
+	/** @return Proxy Id, Destroy 전까지 바뀌지 않습니다. */
+	int32 CreateProxy(const FBox& Box, void* UserData);
+	void DestroyProxy(int32 ProxyId);
+
+	/**
+	 * Proxy의 Box를 갱신합니다.
+	 * @param Displacement 이번 이동량, 같은 방향으로 계속 움직일 것으로 보고 Fat AABB를 늘립니다.
+	 * @return Tree를 다시 구성했으면 true, Fat AABB 안이라 그대로면 false
+	 */
+	bool MoveProxy(int32 ProxyId, const FBox& Box, const FVector& Displacement = FVector::ZeroVector);
+
+	void* GetUserData(int32 ProxyId) const { return Nodes[ProxyId].UserData; }
+	const FBox& GetFatBox(int32 ProxyId) const { return Nodes[ProxyId].Box; }
+
+	void Clear();
+
+	int32 GetNumProxies() const { return NumProxies; }
+	int32 GetHeight() const { return Root == INDEX_NONE ? 0 : Nodes[Root].Height; }
+
+	/** 모든 Node의 표면적 합 / Root의 표면적 (작을수록 좋은 Tree) */
+	float GetAreaRatio() const;
+
+	/** 구조가 올바른지 검사합니다. (Debug용, 틀리면 false) */
+	bool Validate() const;
+
+	/**
+	 * Box와 Fat AABB가 겹치는 Proxy를 찾습니다.
+	 * @param Callback bool(int32 ProxyId), false를 반환하면 중단
+	 */
+	template <typename CallbackType>
+	void QueryBox(const FBox& Box, CallbackType&& Callback) const;
+
+	/**
+	 * Frustum과 겹치는 Proxy를 찾습니다. 완전히 안에 있는 Node 아래는 평면 검사 없이 모두 보고합니다.
+	 * @param Callback bool(int32 ProxyId), false를 반환하면 중단
+	 */
+	template <typename CallbackType>
+	void QueryFrustum(const FFrustum& Frustum, CallbackType&& Callback) const;
+
+	/**
+	 * Ray가 지나는 Fat AABB를 가까운 Node부터 방문합니다.
+	 * @param Callback float(int32 ProxyId, float MaxDistance)
+	 *                 맞았으면 그 거리를 반환해 이후 탐색 범위를 줄이고, 아니면 MaxDistance를 그대로 반환합니다. 0 이하면 중단
+	 */
+	template <typename CallbackType>
+	void RayCast(const FRay& Ray, float MaxDistance, CallbackType&& Callback) const;
+
+	/** Start에서 End까지의 선분으로 RayCast (Callback은 RayCast와 같고, 거리는 Start부터) */
+	template <typename CallbackType>
+	void SegmentCast(const FVector& Start, const FVector& End, CallbackType&& Callback) const;
+
+	/** Ray와 Box의 진입 거리, Ray가 Box 안에서 시작하면 0 */
+	static bool IntersectRayBox(const FVector& Origin, const FVector& InvDirection, const FBox& Box, float MaxDistance, float& OutDistance);
+
+private:
+	struct FNode
+	{
+		FBox Box;
+		void* UserData = nullptr;
+
+		/** Tree 안이면 부모, Free List 안이면 다음 빈 Node */
+		int32 ParentOrNext = INDEX_NONE;
+
+		int32 Child1 = INDEX_NONE;
+		int32 Child2 = INDEX_NONE;
+
+		/** Leaf는 0, 빈 Node는 -1 */
+		int32 Height = -1;
+
+		bool IsLeaf() const { return Child1 == INDEX_NONE; }
+	};
+
+	/** Query용 Stack, 얕은 Tree는 힙 할당 없이 처리합니다. */
+	template <typename ElementType>
+	class TNodeStack
+	{
+	public:
+		void Push(const ElementType& Element)
+		{
+			if (Count < InlineSize)
+			{
+				Inline[Count++] = Element;
+			}
+			else
+			{
+				Overflow.push_back(Element);
+			}
+		}
+
+		ElementType Pop()
+		{
+			if (!Overflow.empty())
+			{
+				const ElementType Element = Overflow.back();
+				Overflow.pop_back();
+				return Element;
+			}
+			return Inline[--Count];
+		}
+
+		bool IsEmpty() const { return Count == 0 && Overflow.empty(); }
+
+	private:
+		static constexpr int32 InlineSize = 128;
+		ElementType Inline[InlineSize];
+		int32 Count = 0;
+		std::vector<ElementType> Overflow;
+	};
+
+	/** Ray Query에서 쓰는 (NodeId, 진입 거리) */
+	struct FRayStackEntry
+	{
+		int32 NodeId;
+		float Distance;
+	};
+
+	int32 AllocateNode();
+	void FreeNode(int32 NodeId);
+
+	void InsertLeaf(int32 Leaf);
+	void RemoveLeaf(int32 Leaf);
+
+	/** 부모가 다른 두 Subtree의 자리를 바꿉니다. (Box, 높이는 호출한 쪽에서 Refit) */
+	void SwapSubtrees(int32 IndexX, int32 IndexY);
+
+	/** 자식으로 Box와 높이를 다시 계산합니다. */
+	void Refit(int32 NodeId);
+
+	/** NodeId의 자식과 손자를 바꿨을 때 표면적이 줄어들면 바꿉니다. NodeId의 Box는 그대로입니다. */
+	void Rotate(int32 NodeId);
+
+	int32 ValidateNode(int32 NodeId, int32 ParentId, int32& OutNumLeaves) const;
+
+	/** NodeId 아래의 모든 Leaf를 보고합니다. Callback이 false를 반환하면 false */
+	template <typename CallbackType>
+	bool ReportSubtree(int32 NodeId, CallbackType& Callback) const;
+
+private:
+	TArray<FNode> Nodes;
+	int32 Root = INDEX_NONE;
+	int32 FreeList = INDEX_NONE;
+	int32 NumProxies = 0;
+};
+
+
+template <typename CallbackType>
+void FDynamicAABBTree::QueryBox(const FBox& Box, CallbackType&& Callback) const
+{
+	if (Root == INDEX_NONE)
+	{
+		return;
+	}
+
+	TNodeStack<int32> Stack;
+	Stack.Push(Root);
+	while (!Stack.IsEmpty())
+	{
+		const int32 NodeId = Stack.Pop();
+		const FNode& Node = Nodes[NodeId];
+		if (!Node.Box.Intersect(Box))
+		{
+			continue;
+		}
+
+		if (Node.IsLeaf())
+		{
+			if (!Callback(NodeId))
+			{
+				return;
+			}
+		}
+		else
+		{
+			Stack.Push(Node.Child1);
+			Stack.Push(Node.Child2);
+		}
+	}
+}
+
+template <typename CallbackType>
+bool FDynamicAABBTree::ReportSubtree(int32 NodeId, CallbackType& Callback) const
+{
+	TNodeStack<int32> Stack;
+	Stack.Push(NodeId);
+	while (!Stack.IsEmpty())
+	{
+		const int32 CurrentId = Stack.Pop();
+		const FNode& Node = Nodes[CurrentId];
+		if (Node.IsLeaf())
+		{
+			if (!Callback(CurrentId))
+			{
+				return false;
+			}
+		}
+		else
+		{
+			Stack.Push(Node.Child1);
+			Stack.Push(Node.Child2);
+		}
+	}
+	return true;
+}
+
+template <typename CallbackType>
+void FDynamicAABBTree::QueryFrustum(const FFrustum& Frustum, CallbackType&& Callback) const
+{
+	if (Root == INDEX_NONE)
+	{
+		return;
+	}
+
+	TNodeStack<int32> Stack;
+	Stack.Push(Root);
+	while (!Stack.IsEmpty())
+	{
+		const int32 NodeId = Stack.Pop();
+		const FNode& Node = Nodes[NodeId];
+		if (!Frustum.IntersectBox(Node.Box))
+		{
+			continue;
+		}
+
+		if (Node.IsLeaf())
+		{
+			if (!Callback(NodeId))
+			{
+				return;
+			}
+		}
+		else if (Frustum.ContainsBox(Node.Box))
+		{
+			if (!ReportSubtree(NodeId, Callback))
+			{
+				return;
+			}
+		}
+		else
+		{
+			Stack.Push(Node.Child1);
+			Stack.Push(Node.Child2);
+		}
+	}
+}
+
+template <typename CallbackType>
+void FDynamicAABBTree::RayCast(const FRay& Ray, float MaxDistance, CallbackType&& Callback) const
+{
+	if (Root == INDEX_NONE)
+	{
+		return;
+	}
+
+	const FVector& Origin = Ray.GetOrigin();
+	const FVector& Direction = Ray.GetDirection();
+	const FVector InvDirection(1.0f / Direction.X, 1.0f / Direction.Y, 1.0f / Direction.Z);
+
+	float RootDistance;
+	if (!IntersectRayBox(Origin, InvDirection, Nodes[Root].Box, MaxDistance, RootDistance))
+	{
+		return;
+	}
+
+	// 가까운 자식을 나중에 넣어서 먼저 꺼냄
+	TNodeStack<FRayStackEntry> Stack;
+	Stack.Push({Root, RootDistance});
+	while (!Stack.IsEmpty())
+	{
+		const FRayStackEntry Entry = Stack.Pop();
+
+		// 넣은 뒤에 더 가까운 교차를 찾았으면 건너뜀
+		if (Entry.Distance > MaxDistance)
+		{
+			continue;
+		}
+
+		const FNode& Node = Nodes[Entry.NodeId];
+		if (Node.IsLeaf())
+		{
+			const float NewMaxDistance = Callback(Entry.NodeId, MaxDistance);
+			if (NewMaxDistance <= 0.0f)
+			{
+				return;
+			}
+			MaxDistance = FMath::Min(MaxDistance, NewMaxDistance);
+			continue;
+		}
+
+		float Distance1, Distance2;
+		const bool bHit1 = IntersectRayBox(Origin, InvDirection, Nodes[Node.Child1].Box, MaxDistance, Distance1);
+		const bool bHit2 = IntersectRayBox(Origin, InvDirection, Nodes[Node.Child2].Box, MaxDistance, Distance2);
+		if (bHit1 && bHit2)
+		{
+			if (Distance1 <= Distance2)
+			{
+				Stack.Push({Node.Child2, Distance2});
+				Stack.Push({Node.Child1, Distance1});
+			}
+			else
+			{
+				Stack.Push({Node.Child1, Distance1});
+				Stack.Push({Node.Child2, Distance2});
+			}
+		}
+		else if (bHit1)
+		{
+			Stack.Push({Node.Child1, Distance1});
+		}
+		else if (bHit2)
+		{
+			Stack.Push({Node.Child2, Distance2});
+		}
+	}
+}
+
+template <typename CallbackType>
+void FDynamicAABBTree::SegmentCast(const FVector& Start, const FVector& End, CallbackType&& Callback) const
+{
+	const FVector Delta = End - Start;
+	const float Length = Delta.Length();
+	if (Length <= 0.0f)
+	{
+		return;
+	}
+	RayCast(FRay(Start, Delta / Length), Length, std::forward<CallbackType>(Callback));
+}
@@ -0,0 +1,37 @@
+#include "Frustum.h"
+
+#include "Matrix.h"
+
+
+FFrustum FFrustum::FromViewProjection(const FMatrix& ViewProjection)
+{
+	// Clip = P * M 이므로 Clip의 각 성분은 M의 열과의 내적 (Gribb-Hartmann)
+	const auto& M = ViewProjection.M;
+	auto Column = [&M](int32 Index)
+	{
+		return FVector4(M[0][Index], M[1][Index], M[2][Index], M[3][Index]);
+	};
+
+	const FVector4 X = Column(0);
+	const FVector4 Y = Column(1);
+	const FVector4 Z = Column(2);
+	const FVector4 W = Column(3);
+
+	FFrustum Frustum;
+	Frustum.Planes[Left] = FVector4(W.X + X.X, W.Y + X.Y, W.Z + X.Z, W.W + X.W);
+	Frustum.Planes[Right] = FVector4(W.X - X.X, W.Y - X.Y, W.Z - X.Z, W.W - X.W);
+	Frustum.Planes[Bottom] = FVector4(W.X + Y.X, W.Y + Y.Y, W.Z + Y.Z, W.W + Y.W);
+	Frustum.Planes[Top] = FVector4(W.X - Y.X, W.Y - Y.Y, W.Z - Y.Z, W.W - Y.W);
+	Frustum.Planes[Near] = Z;
+	Frustum.Planes[Far] = FVector4(W.X - Z.X, W.Y - Z.Y, W.Z - Z.Z, W.W - Z.W);
+
+	for (FVector4& Plane : Frustum.Planes)
+	{
+		const float Length = FVector(Plane.X, Plane.Y, Plane.Z).Length();
+		if (Length > 0.0f)
+		{
+			Plane = FVector4(Plane.X / Length, Plane.Y / Length, Plane.Z / Length, Plane.W / Length);
+		}
+	}
+	return Frustum;
+}
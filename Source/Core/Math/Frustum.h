@@ -0,0 +1,64 @@
+#pragma once
+#include "BoxSphereBounds.h"
+#include "Vector.h"
+
+struct FMatrix;
+
+
+/**
+ * 6개의 평면으로 이루어진 절두체
+ *
+ * 평면은 (Normal, W) 형태로 저장하고, Dot(Normal, P) + W >= 0 인 쪽이 안쪽입니다.
+ */
+struct FFrustum
+{
+	enum EPlane : uint8
+	{
+		Left,
+		Right,
+		Bottom,
+		Top,
+		Near,
+		Far,
+		NumPlanes
+	};
+
+	FVector4 Planes[NumPlanes];
+
+	/** 행 벡터 규약의 View * Projection 행렬에서 평면을 뽑습니다. (D3D, Clip Z는 0 ~ W) */
+	static FFrustum FromViewProjection(const FMatrix& ViewProjection);
+
+	/** Box가 절두체 밖에 완전히 있으면 false */
+	bool IntersectBox(const FBox& Box) const
+	{
+		const FVector Center = Box.GetCenter();
+		const FVector Extent = Box.GetExtent();
+		for (const FVector4& Plane : Planes)
+		{
+			const float Distance = Plane.X * Center.X + Plane.Y * Center.Y + Plane.Z * Center.Z + Plane.W;
+			const float Radius = FMath::Abs(Plane.X) * Extent.X + FMath::Abs(Plane.Y) * Extent.Y + FMath::Abs(Plane.Z) * Extent.Z;
+			if (Distance + Radius < 0.0f)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/** Box 전체가 절두체 안에 있으면 true */
+	bool ContainsBox(const FBox& Box) const
+	{
+		const FVector Center = Box.GetCenter();
+		const FVector Extent = Box.GetExtent();
+		for (const FVector4& Plane : Planes)
+		{
+			const float Distance = Plane.X * Center.X + Plane.Y * Center.Y + Plane.Z * Center.Z + Plane.W;
+			const float Radius = FMath::Abs(Plane.X) * Extent.X + FMath::Abs(Plane.Y) * Extent.Y + FMath::Abs(Plane.Z) * Extent.Z;
+			if (Distance - Radius < 0.0f)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+};
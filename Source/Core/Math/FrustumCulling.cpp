@@ -0,0 +1,181 @@
+#include "FrustumCulling.h"
+
+#include <bit>
+
+#if PLATFORM_ENABLE_VECTORINTRINSICS
+#include <immintrin.h>
+#endif
+
+
+namespace
+{
+/** 평면을 축마다 나눠 둔 것, |Normal|은 Box의 투영 반지름 계산용 */
+struct FCullingPlanes
+{
+	float X[FFrustum::NumPlanes];
+	float Y[FFrustum::NumPlanes];
+	float Z[FFrustum::NumPlanes];
+	float W[FFrustum::NumPlanes];
+	float AbsX[FFrustum::NumPlanes];
+	float AbsY[FFrustum::NumPlanes];
+	float AbsZ[FFrustum::NumPlanes];
+
+	explicit FCullingPlanes(const FFrustum& Frustum)
+	{
+		for (int32 Index = 0; Index < FFrustum::NumPlanes; ++Index)
+		{
+			const FVector4& Plane = Frustum.Planes[Index];
+			X[Index] = Plane.X;
+			Y[Index] = Plane.Y;
+			Z[Index] = Plane.Z;
+			W[Index] = Plane.W;
+			AbsX[Index] = FMath::Abs(Plane.X);
+			AbsY[Index] = FMath::Abs(Plane.Y);
+			AbsZ[Index] = FMath::Abs(Plane.Z);
+		}
+	}
+};
+
+/** FFrustum::IntersectBox와 같은 순서로 계산 (SIMD 경로와 결과가 같도록) */
+FORCEINLINE bool IsBoxVisible(const FCullingPlanes& Planes, const FCullingBounds& Bounds, int32 Index)
+{
+	for (int32 Plane = 0; Plane < FFrustum::NumPlanes; ++Plane)
+	{
+		const float Distance = Planes.X[Plane] * Bounds.CenterX[Index] + Planes.Y[Plane] * Bounds.CenterY[Index] + Planes.Z[Plane] * Bounds.CenterZ[Index] + Planes.W[Plane];
+		const float Radius = Planes.AbsX[Plane] * Bounds.ExtentX[Index] + Planes.AbsY[Plane] * Bounds.ExtentY[Index] + Planes.AbsZ[Plane] * Bounds.ExtentZ[Index];
+		if (Distance + Radius < 0.0f)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+#if PLATFORM_ENABLE_VECTORINTRINSICS
+/** Mask에서 켜진 Lane의 Index를 차례로 씁니다. */
+FORCEINLINE int32 WriteVisibleLanes(uint32 VisibleMask, int32 Base, int32* Out, int32 Count)
+{
+	while (VisibleMask != 0)
+	{
+		Out[Count++] = Base + std::countr_zero(VisibleMask);
+		VisibleMask &= VisibleMask - 1;
+	}
+	return Count;
+}
+
+// AVX로 빌드하면 8개, 아니면 SSE로 4개씩
+#if defined(__AVX__)
+constexpr int32 BatchWidth = 8;
+
+/** Box 8개 중 보이는 Lane의 Bit Mask */
+FORCEINLINE uint32 CullBatch(const FCullingPlanes& Planes, const FCullingBounds& Bounds, int32 Base)
+{
+	const __m256 CenterX = _mm256_loadu_ps(Bounds.CenterX.GetData() + Base);
+	const __m256 CenterY = _mm256_loadu_ps(Bounds.CenterY.GetData() + Base);
+	const __m256 CenterZ = _mm256_loadu_ps(Bounds.CenterZ.GetData() + Base);
+	const __m256 ExtentX = _mm256_loadu_ps(Bounds.ExtentX.GetData() + Base);
+	const __m256 ExtentY = _mm256_loadu_ps(Bounds.ExtentY.GetData() + Base);
+	const __m256 ExtentZ = _mm256_loadu_ps(Bounds.ExtentZ.GetData() + Base);
+	const __m256 Zero = _mm256_setzero_ps();
+
+	__m256 Outside = Zero;
+	for (int32 Plane = 0; Plane < FFrustum::NumPlanes; ++Plane)
+	{
+		__m256 Distance = _mm256_mul_ps(_mm256_set1_ps(Planes.X[Plane]), CenterX);
+		Distance = _mm256_add_ps(Distance, _mm256_mul_ps(_mm256_set1_ps(Planes.Y[Plane]), CenterY));
+		Distance = _mm256_add_ps(Distance, _mm256_mul_ps(_mm256_set1_ps(Planes.Z[Plane]), CenterZ));
+		Distance = _mm256_add_ps(Distance, _mm256_set1_ps(Planes.W[Plane]));
+
+		__m256 Radius = _mm256_mul_ps(_mm256_set1_ps(Planes.AbsX[Plane]), ExtentX);
+		Radius = _mm256_add_ps(Radius, _mm256_mul_ps(_mm256_set1_ps(Planes.AbsY[Plane]), ExtentY));
+		Radius = _mm256_add_ps(Radius, _mm256_mul_ps(_mm256_set1_ps(Planes.AbsZ[Plane]), ExtentZ));
+
+		Outside = _mm256_or_ps(Outside, _mm256_cmp_ps(_mm256_add_ps(Distance, Radius), Zero, _CMP_LT_OQ));
+	}
+	return ~static_cast<uint32>(_mm256_movemask_ps(Outside)) & 0xFFu;
+}
+#else
+constexpr int32 BatchWidth = 4;
+
+/** Box 4개 중 보이는 Lane의 Bit Mask */
+FORCEINLINE uint32 CullBatch(const FCullingPlanes& Planes, const FCullingBounds& Bounds, int32 Base)
+{
+	const __m128 CenterX = _mm_loadu_ps(Bounds.CenterX.GetData() + Base);
+	const __m128 CenterY = _mm_loadu_ps(Bounds.CenterY.GetData() + Base);
+	const __m128 CenterZ = _mm_loadu_ps(Bounds.CenterZ.GetData() + Base);
+	const __m128 ExtentX = _mm_loadu_ps(Bounds.ExtentX.GetData() + Base);
+	const __m128 ExtentY = _mm_loadu_ps(Bounds.ExtentY.GetData() + Base);
+	const __m128 ExtentZ = _mm_loadu_ps(Bounds.ExtentZ.GetData() + Base);
+	const __m128 Zero = _mm_setzero_ps();
+
+	__m128 Outside = Zero;
+	for (int32 Plane = 0; Plane < FFrustum::NumPlanes; ++Plane)
+	{
+		__m128 Distance = _mm_mul_ps(_mm_set1_ps(Planes.X[Plane]), CenterX);
+		Distance = _mm_add_ps(Distance, _mm_mul_ps(_mm_set1_ps(Planes.Y[Plane]), CenterY));
+		Distance = _mm_add_ps(Distance, _mm_mul_ps(_mm_set1_ps(Planes.Z[Plane]), CenterZ));
+		Distance = _mm_add_ps(Distance, _mm_set1_ps(Planes.W[Plane]));
+
+		__m128 Radius = _mm_mul_ps(_mm_set1_ps(Planes.AbsX[Plane]), ExtentX);
+		Radius = _mm_add_ps(Radius, _mm_mul_ps(_mm_set1_ps(Planes.AbsY[Plane]), ExtentY));
+		Radius = _mm_add_ps(Radius, _mm_mul_ps(_mm_set1_ps(Planes.AbsZ[Plane]), ExtentZ));
+
+		Outside = _mm_or_ps(Outside, _mm_cmplt_ps(_mm_add_ps(Distance, Radius), Zero));
+	}
+	return ~static_cast<uint32>(_mm_movemask_ps(Outside)) & 0xFu;
+}
+#endif
+#else
+constexpr int32 BatchWidth = 1;
+#endif
+}
+
+int32 FrustumCulling::CullBoxes(const FFrustum& Frustum, const FCullingBounds& Bounds, TArray<int32>& OutVisibleIndices)
+{
+	const int32 NumBoxes = Bounds.Num();
+	const FCullingPlanes Planes(Frustum);
+
+	OutVisibleIndices.SetNum(NumBoxes);
+	int32* Out = OutVisibleIndices.GetData();
+	int32 Count = 0;
+	int32 Index = 0;
+
+#if PLATFORM_ENABLE_VECTORINTRINSICS
+	for (; Index + BatchWidth <= NumBoxes; Index += BatchWidth)
+	{
+		Count = WriteVisibleLanes(CullBatch(Planes, Bounds, Index), Index, Out, Count);
+	}
+#endif
+
+	// Batch에 못 채운 나머지
+	for (; Index < NumBoxes; ++Index)
+	{
+		if (IsBoxVisible(Planes, Bounds, Index))
+		{
+			Out[Count++] = Index;
+		}
+	}
+
+	OutVisibleIndices.SetNum(Count);
+	return Count;
+}
+
+int32 FrustumCulling::CullBoxesScalar(const FFrustum& Frustum, const FCullingBounds& Bounds, TArray<int32>& OutVisibleIndices)
+{
+	const FCullingPlanes Planes(Frustum);
+
+	OutVisibleIndices.Empty();
+	for (int32 Index = 0; Index < Bounds.Num(); ++Index)
+	{
+		if (IsBoxVisible(Planes, Bounds, Index))
+		{
+			OutVisibleIndices.Add(Index);
+		}
+	}
+	return OutVisibleIndices.Num();
+}
+
+int32 FrustumCulling::GetBatchWidth()
+{
+	return BatchWidth;
+}
@@ -0,0 +1,61 @@
+#pragma once
+#include "BoxSphereBounds.h"
+#include "Frustum.h"
+#include "Core/Container/Array.h"
+#include "Core/HAL/PlatformType.h"
+
+
+/**
+ * Frustum Culling용 Box 목록 (SoA)
+ *
+ * 축마다 배열을 따로 두어서 SIMD Lane 하나에 Box 하나씩, 4개(SSE) / 8개(AVX)를 한 번에 검사합니다.
+ */
+struct FCullingBounds
+{
+	TArray<float> CenterX;
+	TArray<float> CenterY;
+	TArray<float> CenterZ;
+	TArray<float> ExtentX;
+	TArray<float> ExtentY;
+	TArray<float> ExtentZ;
+
+	void Reset(int32 Capacity)
+	{
+		for (TArray<float>* Array : {&CenterX, &CenterY, &CenterZ, &ExtentX, &ExtentY, &ExtentZ})
+		{
+			Array->Empty();
+			Array->Reserve(Capacity);
+		}
+	}
+
+	void Add(const FVector& Center, const FVector& Extent)
+	{
+		CenterX.Add(Center.X);
+		CenterY.Add(Center.Y);
+		CenterZ.Add(Center.Z);
+		ExtentX.Add(Extent.X);
+		ExtentY.Add(Extent.Y);
+		ExtentZ.Add(Extent.Z);
+	}
+
+	void Add(const FBoxSphereBounds& Bounds) { Add(Bounds.Origin, Bounds.BoxExtent); }
+	void Add(const FBox& Box) { Add(Box.GetCenter(), Box.GetExtent()); }
+
+	int32 Num() const { return CenterX.Num(); }
+};
+
+namespace FrustumCulling
+{
+	/**
+	 * Frustum과 겹치는 Box의 Index를 순서대로 OutVisibleIndices에 씁니다. (배열은 비우고 채움)
+	 * 판정은 FFrustum::IntersectBox와 같은 계산이라 결과도 같습니다.
+	 * @return 보이는 Box 수
+	 */
+	int32 CullBoxes(const FFrustum& Frustum, const FCullingBounds& Bounds, TArray<int32>& OutVisibleIndices);
+
+	/** CullBoxes와 같은 결과를 Box 하나씩 계산합니다. (비교용) */
+	int32 CullBoxesScalar(const FFrustum& Frustum, const FCullingBounds& Bounds, TArray<int32>& OutVisibleIndices);
+
+	/** CullBoxes가 한 번에 검사하는 Box 수 (SIMD 폭) */
+	int32 GetBatchWidth();
+}
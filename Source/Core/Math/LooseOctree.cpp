@@ -0,0 +1,348 @@
+#include "LooseOctree.h"
+
+
+namespace
+{
+/** Traversal Stack은 깊이마다 형제 7개까지 남으므로 이 크기면 넘치지 않음 */
+constexpr int32 MaxSupportedDepth = 16;
+constexpr int32 StackSize = 8 * (MaxSupportedDepth + 1);
+
+struct FNearestStackEntry
+{
+	int32 NodeId;
+	float DistanceSquared;
+};
+}
+
+FLooseOctree::FLooseOctree(const FVector& InCenter, float InHalfSize, int32 InMaxDepth)
+	: RootCenter(InCenter)
+	, RootHalfSize(InHalfSize)
+	, MaxDepth(FMath::Clamp(InMaxDepth, 0, MaxSupportedDepth))
+{
+	Clear();
+}
+
+int32 FLooseOctree::Add(const FBox& Box, void* UserData)
+{
+	const int32 Id = AllocateElement(Box, UserData);
+	LinkElement(Id, FindOrCreateNode(Box));
+	return Id;
+}
+
+void FLooseOctree::Update(int32 Id, const FBox& Box)
+{
+	FElement& Element = Elements[Id];
+	Element.Box = Box;
+
+	// 대부분은 같은 Cell 안에서 움직이므로 Box만 바꾸고 끝
+	if (FitsNode(Element.Slot, Box))
+	{
+		return;
+	}
+
+	UnlinkElement(Id);
+	LinkElement(Id, FindOrCreateNode(Box));
+}
+
+void FLooseOctree::Remove(int32 Id)
+{
+	UnlinkElement(Id);
+	FreeElement(Id);
+}
+
+void FLooseOctree::Clear()
+{
+	ClearElements();
+	Nodes.Empty();
+
+	FNode Root;
+	Root.Center = RootCenter;
+	Root.HalfSize = RootHalfSize;
+	Nodes.Add(std::move(Root));
+}
+
+int32 FLooseOctree::FindOrCreateNode(const FBox& Box)
+{
+	const FVector Center = Box.GetCenter();
+	const float MaxExtent = MaxComponent(Box.GetExtent());
+
+	int32 NodeId = 0;
+	if (!FBox(RootCenter - FVector(RootHalfSize), RootCenter + FVector(RootHalfSize)).IsInside(Center))
+	{
+		return NodeId;
+	}
+
+	while (Nodes[NodeId].Depth < MaxDepth)
+	{
+		const FNode& Node = Nodes[NodeId];
+		const float ChildHalfSize = Node.HalfSize * 0.5f;
+		if (MaxExtent > ChildHalfSize)
+		{
+			break;
+		}
+
+		const int32 Octant = (Center.X >= Node.Center.X ? 1 : 0) | (Center.Y >= Node.Center.Y ? 2 : 0) | (Center.Z >= Node.Center.Z ? 4 : 0);
+		int32 ChildId = Node.Children[Octant];
+		if (ChildId == INDEX_NONE)
+		{
+			FNode Child;
+			Child.Center = FVector(
+				Node.Center.X + ((Octant & 1) ? ChildHalfSize : -ChildHalfSize),
+				Node.Center.Y + ((Octant & 2) ? ChildHalfSize : -ChildHalfSize),
+				Node.Center.Z + ((Octant & 4) ? ChildHalfSize : -ChildHalfSize)
+			);
+			Child.HalfSize = ChildHalfSize;
+			Child.Parent = NodeId;
+			Child.Depth = Node.Depth + 1;
+
+			// Add로 Nodes가 재할당될 수 있으므로 Node 참조는 여기서 더 쓰지 않음
+			ChildId = Nodes.Add(std::move(Child));
+			Nodes[NodeId].Children[Octant] = ChildId;
+		}
+		NodeId = ChildId;
+	}
+	return NodeId;
+}
+
+bool FLooseOctree::FitsNode(int32 NodeId, const FBox& Box) const
+{
+	const FNode& Node = Nodes[NodeId];
+	const FVector Center = Box.GetCenter();
+	const float MaxExtent = MaxComponent(Box.GetExtent());
+	const FBox Cell(Node.Center - FVector(Node.HalfSize), Node.Center + FVector(Node.HalfSize));
+
+	if (NodeId == 0)
+	{
+		// Root 밖이면 계속 Root, 안이면 더 내려갈 수 있는지 봐야 함
+		return !Cell.IsInside(Center) || Node.Depth == MaxDepth || MaxExtent > Node.HalfSize * 0.5f;
+	}
+
+	return Cell.IsInside(Center)
+		&& MaxExtent <= Node.HalfSize
+		&& (Node.Depth == MaxDepth || MaxExtent > Node.HalfSize * 0.5f);
+}
+
+void FLooseOctree::LinkElement(int32 Id, int32 NodeId)
+{
+	FElement& Element = Elements[Id];
+	Element.Slot = NodeId;
+	Element.IndexInSlot = Nodes[NodeId].Elements.Add(Id);
+
+	for (int32 CurrentId = NodeId; CurrentId != INDEX_NONE; CurrentId = Nodes[CurrentId].Parent)
+	{
+		++Nodes[CurrentId].NumInSubtree;
+	}
+}
+
+void FLooseOctree::UnlinkElement(int32 Id)
+{
+	const FElement& Element = Elements[Id];
+	FNode& Node = Nodes[Element.Slot];
+
+	// 마지막 원소를 빈 자리로 옮김
+	const int32 LastId = Node.Elements[Node.Elements.Num() - 1];
+	Node.Elements[Element.IndexInSlot] = LastId;
+	Elements[LastId].IndexInSlot = Element.IndexInSlot;
+	Node.Elements.SetNum(Node.Elements.Num() - 1);
+
+	for (int32 CurrentId = Element.Slot; CurrentId != INDEX_NONE; CurrentId = Nodes[CurrentId].Parent)
+	{
+		--Nodes[CurrentId].NumInSubtree;
+	}
+}
+
+void FLooseOctree::ReportSubtree(int32 NodeId, TArray<int32>& OutIds) const
+{
+	int32 Stack[StackSize];
+	int32 StackCount = 0;
+	Stack[StackCount++] = NodeId;
+	while (StackCount > 0)
+	{
+		const FNode& Node = Nodes[Stack[--StackCount]];
+		for (const int32 Id : Node.Elements)
+		{
+			OutIds.Add(Id);
+		}
+		for (const int32 ChildId : Node.Children)
+		{
+			if (ChildId != INDEX_NONE && Nodes[ChildId].NumInSubtree > 0)
+			{
+				Stack[StackCount++] = ChildId;
+			}
+		}
+	}
+}
+
+void FLooseOctree::QueryBox(const FBox& Box, TArray<int32>& OutIds) const
+{
+	OutIds.Empty();
+
+	int32 Stack[StackSize];
+	int32 StackCount = 0;
+	Stack[StackCount++] = 0;
+	while (StackCount > 0)
+	{
+		const int32 NodeId = Stack[--StackCount];
+		const FNode& Node = Nodes[NodeId];
+		if (Node.NumInSubtree == 0 || (NodeId != 0 && !Node.GetLooseBox().Intersect(Box)))
+		{
+			continue;
+		}
+
+		for (const int32 Id : Node.Elements)
+		{
+			if (Elements[Id].Box.Intersect(Box))
+			{
+				OutIds.Add(Id);
+			}
+		}
+		for (const int32 ChildId : Node.Children)
+		{
+			if (ChildId != INDEX_NONE)
+			{
+				Stack[StackCount++] = ChildId;
+			}
+		}
+	}
+}
+
+void FLooseOctree::QuerySphere(const FVector& Center, float Radius, TArray<int32>& OutIds) const
+{
+	OutIds.Empty();
+
+	const float RadiusSquared = Radius * Radius;
+	int32 Stack[StackSize];
+	int32 StackCount = 0;
+	Stack[StackCount++] = 0;
+	while (StackCount > 0)
+	{
+		const int32 NodeId = Stack[--StackCount];
+		const FNode& Node = Nodes[NodeId];
+		if (Node.NumInSubtree == 0 || (NodeId != 0 && DistanceSquared(Node.GetLooseBox(), Center) > RadiusSquared))
+		{
+			continue;
+		}
+
+		for (const int32 Id : Node.Elements)
+		{
+			if (DistanceSquared(Elements[Id].Box, Center) <= RadiusSquared)
+			{
+				OutIds.Add(Id);
+			}
+		}
+		for (const int32 ChildId : Node.Children)
+		{
+			if (ChildId != INDEX_NONE)
+			{
+				Stack[StackCount++] = ChildId;
+			}
+		}
+	}
+}
+
+void FLooseOctree::QueryFrustum(const FFrustum& Frustum, TArray<int32>& OutIds) const
+{
+	OutIds.Empty();
+
+	int32 Stack[StackSize];
+	int32 StackCount = 0;
+	Stack[StackCount++] = 0;
+	while (StackCount > 0)
+	{
+		const int32 NodeId = Stack[--StackCount];
+		const FNode& Node = Nodes[NodeId];
+		if (Node.NumInSubtree == 0)
+		{
+			continue;
+		}
+
+		if (NodeId != 0)
+		{
+			const FBox LooseBox = Node.GetLooseBox();
+			if (!Frustum.IntersectBox(LooseBox))
+			{
+				continue;
+			}
+
+			// 원소는 모두 Loose Box 안에 있으므로 더 검사할 필요 없음
+			if (Frustum.ContainsBox(LooseBox))
+			{
+				ReportSubtree(NodeId, OutIds);
+				continue;
+			}
+		}
+
+		for (const int32 Id : Node.Elements)
+		{
+			if (Frustum.IntersectBox(Elements[Id].Box))
+			{
+				OutIds.Add(Id);
+			}
+		}
+		for (const int32 ChildId : Node.Children)
+		{
+			if (ChildId != INDEX_NONE)
+			{
+				Stack[StackCount++] = ChildId;
+			}
+		}
+	}
+}
+
+void FLooseOctree::QueryNearest(const FVector& Point, int32 Count, TArray<int32>& OutIds, float MaxDistance) const
+{
+	FNearestCandidates Candidates(Count, MaxDistance);
+
+	// 가까운 자식부터 내려가서 후보를 빨리 채우고, 후보보다 먼 Node는 꺼낼 때 건너뜀
+	FNearestStackEntry Stack[StackSize];
+	int32 StackCount = 0;
+	Stack[StackCount++] = {0, 0.0f};
+	while (StackCount > 0)
+	{
+		const FNearestStackEntry Entry = Stack[--StackCount];
+		if (Entry.DistanceSquared > Candidates.GetMaxDistanceSquared())
+		{
+			continue;
+		}
+
+		const FNode& Node = Nodes[Entry.NodeId];
+		for (const int32 Id : Node.Elements)
+		{
+			Candidates.Consider(Id, DistanceSquared(Elements[Id].Box, Point));
+		}
+
+		FNearestStackEntry Children[8];
+		int32 NumChildren = 0;
+		for (const int32 ChildId : Node.Children)
+		{
+			if (ChildId == INDEX_NONE || Nodes[ChildId].NumInSubtree == 0)
+			{
+				continue;
+			}
+
+			const float ChildDistanceSquared = DistanceSquared(Nodes[ChildId].GetLooseBox(), Point);
+			if (ChildDistanceSquared <= Candidates.GetMaxDistanceSquared())
+			{
+				Children[NumChildren++] = {ChildId, ChildDistanceSquared};
+			}
+		}
+
+		// 먼 것부터 넣어서 가까운 것을 먼저 꺼냄 (자식이 8개 이하라 삽입 정렬)
+		for (int32 Index = 1; Index < NumChildren; ++Index)
+		{
+			const FNearestStackEntry Child = Children[Index];
+			int32 Position = Index;
+			for (; Position > 0 && Children[Position - 1].DistanceSquared < Child.DistanceSquared; --Position)
+			{
+				Children[Position] = Children[Position - 1];
+			}
+			Children[Position] = Child;
+		}
+		for (int32 Index = 0; Index < NumChildren; ++Index)
+		{
+			Stack[StackCount++] = Children[Index];
+		}
+	}
+
+	Candidates.Write(OutIds);
+}
@@ -0,0 +1,73 @@
+#pragma once
+#include "SpatialIndex.h"
+
+
+/**
+ * Loose Octree (Looseness 2)
+ *
+ * - Node의 Loose Box는 원래 Cell의 2배라서, 중심이 Cell 안에 있고 Extent가 Cell 반 크기 이하인 원소는
+ *   위치와 관계없이 그 깊이의 Node 하나에만 들어갑니다. 경계에 걸친 작은 원소가 Root까지 올라가지 않습니다.
+ * - 원소가 들어갈 깊이는 크기로 정해지므로, 조금 움직여서 같은 Cell에 있으면 Box만 바꿉니다.
+ * - Root 밖에 중심이 있거나 Root보다 큰 원소는 Root에 둡니다. (Root는 Query에서 Box 검사를 하지 않음)
+ * - 비게 된 Node는 지우지 않고, Subtree의 원소 수가 0이면 Query에서 건너뜁니다.
+ */
+class FLooseOctree : public FSpatialIndex
+{
+public:
+	static constexpr float DefaultHalfSize = 2048.0f;
+	static constexpr int32 DefaultMaxDepth = 10;
+
+	explicit FLooseOctree(const FVector& InCenter = FVector::ZeroVector, float InHalfSize = DefaultHalfSize, int32 InMaxDepth = DefaultMaxDepth);
+
+	virtual ESpatialIndexType GetType() const override { return ESpatialIndexType::LooseOctree; }
+	virtual const char* GetName() const override { return "LooseOctree"; }
+
+	virtual int32 Add(const FBox& Box, void* UserData) override;
+	virtual void Update(int32 Id, const FBox& Box) override;
+	virtual void Remove(int32 Id) override;
+	virtual void Clear() override;
+
+	virtual void QueryBox(const FBox& Box, TArray<int32>& OutIds) const override;
+	virtual void QuerySphere(const FVector& Center, float Radius, TArray<int32>& OutIds) const override;
+	virtual void QueryFrustum(const FFrustum& Frustum, TArray<int32>& OutIds) const override;
+	virtual void QueryNearest(const FVector& Point, int32 Count, TArray<int32>& OutIds, float MaxDistance = FLT_MAX) const override;
+
+	int32 GetNumNodes() const { return Nodes.Num(); }
+
+private:
+	struct FNode
+	{
+		/** 원래 Cell의 중심과 반 크기, Loose Box는 Center ± 2 * HalfSize */
+		FVector Center;
+		float HalfSize = 0.0f;
+
+		int32 Parent = INDEX_NONE;
+		int32 Depth = 0;
+		int32 Children[8] = {INDEX_NONE, INDEX_NONE, INDEX_NONE, INDEX_NONE, INDEX_NONE, INDEX_NONE, INDEX_NONE, INDEX_NONE};
+
+		/** 이 Node 아래(자신 포함) 원소 수 */
+		int32 NumInSubtree = 0;
+
+		TArray<int32> Elements;
+
+		FBox GetLooseBox() const { return FBox(Center - FVector(HalfSize * 2.0f), Center + FVector(HalfSize * 2.0f)); }
+	};
+
+	/** Box가 들어갈 Node, 필요하면 만듭니다. */
+	int32 FindOrCreateNode(const FBox& Box);
+
+	/** Box를 지금 넣으면 NodeId에 그대로 들어가는지 */
+	bool FitsNode(int32 NodeId, const FBox& Box) const;
+
+	void LinkElement(int32 Id, int32 NodeId);
+	void UnlinkElement(int32 Id);
+
+	/** NodeId 아래 모든 원소를 검사 없이 넣습니다. */
+	void ReportSubtree(int32 NodeId, TArray<int32>& OutIds) const;
+
+private:
+	TArray<FNode> Nodes;
+	FVector RootCenter;
+	float RootHalfSize;
+	int32 MaxDepth;
+};
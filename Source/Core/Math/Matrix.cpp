@@ -3,6 +3,7 @@
 #include <iostream>
 
 #include "Vector.h"
+#include "VectorRegister.h"
 #include "Quat.h"
 #include "Transform.h"
 #include "Rotator.h"
@@ -73,16 +74,7 @@ FMatrix FMatrix::operator-=(const FMatrix& Other)
 FMatrix FMatrix::operator*(const FMatrix& Other) const
 {
 	FMatrix Result;
-	for (int i = 0; i < 4; i++)
-	{
-		for (int j = 0; j < 4; j++)
-		{
-			Result.M[i][j] = M[i][0] * Other.M[0][j] +
-				M[i][1] * Other.M[1][j] +
-				M[i][2] * Other.M[2][j] +
-				M[i][3] * Other.M[3][j];
-		}
-	}
+	VectorMatrix::Multiply(Result.M, M, Other.M);
 	return Result;
 }
 FMatrix FMatrix::operator*=(const FMatrix& Other)
@@ -132,13 +124,7 @@ bool FMatrix::operator!=(const FMatrix& Other) const
 FMatrix FMatrix::GetTransposed() const
 {
 	FMatrix Result;
-	for (int i = 0; i < 4; i++)
-	{
-		for (int j = 0; j < 4; j++)
-		{
-			Result.M[i][j] = M[j][i];
-		}
-	}
+	VectorMatrix::Transpose(Result.M, M);
 	return Result;
 }
 
@@ -188,49 +174,20 @@ FMatrix FMatrix::InverseGaussJordan(FMatrix& mat)
 
 FMatrix FMatrix::Inverse() const
 {
-	const float Det = Determinant();
+	// 2x2 Block 역행렬, 행렬식이 너무 작으면 단위 행렬
+	FMatrix Result;
+	const float Det = VectorMatrix::Inverse(Result.M, M, 1.0e-6f);
 	if (FMath::Abs(Det) < 1.0e-6f)
 	{
 		return {};
 	}
-
-	FMatrix Result;
-	const float* m = &M[0][0];
-	const float InvDet = 1.0f / Det;
-
-	Result.M[0][0] = InvDet * (m[5] * (m[10] * m[15] - m[11] * m[14]) - m[6] * (m[9] * m[15] - m[11] * m[13]) + m[7] * (m[9] * m[14] - m[10] * m[13]));
-	Result.M[0][1] = -InvDet * (m[1] * (m[10] * m[15] - m[11] * m[14]) - m[2] * (m[9] * m[15] - m[11] * m[13]) + m[3] * (m[9] * m[14] - m[10] * m[13]));
-	Result.M[0][2] = InvDet * (m[1] * (m[6] * m[15] - m[7] * m[14]) - m[2] * (m[5] * m[15] - m[7] * m[13]) + m[3] * (m[5] * m[14] - m[6] * m[13]));
-	Result.M[0][3] = -InvDet * (m[1] * (m[6] * m[11] - m[7] * m[10]) - m[2] * (m[5] * m[11] - m[7] * m[9]) + m[3] * (m[5] * m[10] - m[6] * m[9]));
-
-	Result.M[1][0] = -InvDet * (m[4] * (m[10] * m[15] - m[11] * m[14]) - m[6] * (m[8] * m[15] - m[11] * m[12]) + m[7] * (m[8] * m[14] - m[10] * m[12]));
-	Result.M[1][1] = InvDet * (m[0] * (m[10] * m[15] - m[11] * m[14]) - m[2] * (m[8] * m[15] - m[11] * m[12]) + m[3] * (m[8] * m[14] - m[10] * m[12]));
-	Result.M[1][2] = -InvDet * (m[0] * (m[6] * m[15] - m[7] * m[14]) - m[2] * (m[4] * m[15] - m[7] * m[12]) + m[3] * (m[4] * m[14] - m[6] * m[12]));
-	Result.M[1][3] = InvDet * (m[0] * (m[6] * m[11] - m[7] * m[10]) - m[2] * (m[4] * m[11] - m[7] * m[8]) + m[3] * (m[4] * m[10] - m[6] * m[8]));
-
-	Result.M[2][0] = InvDet * (m[4] * (m[9] * m[15] - m[11] * m[13]) - m[5] * (m[8] * m[15] - m[11] * m[12]) + m[7] * (m[8] * m[13] - m[9] * m[12]));
-	Result.M[2][1] = -InvDet * (m[0] * (m[9] * m[15] - m[11] * m[13]) - m[1] * (m[8] * m[15] - m[11] * m[12]) + m[3] * (m[8] * m[13] - m[9] * m[12]));
-	Result.M[2][2] = InvDet * (m[0] * (m[5] * m[15] - m[7] * m[13]) - m[1] * (m[4] * m[15] - m[7] * m[12]) + m[3] * (m[4] * m[13] - m[5] * m[12]));
-	Result.M[2][3] = -InvDet * (m[0] * (m[5] * m[11] - m[7] * m[9]) - m[1] * (m[4] * m[11] - m[7] * m[8]) + m[3] * (m[4] * m[9] - m[5] * m[8]));
-
-	Result.M[3][0] = -InvDet * (m[4] * (m[9] * m[14] - m[10] * m[13]) - m[5] * (m[8] * m[14] - m[10] * m[12]) + m[6] * (m[8] * m[13] - m[9] * m[12]));
-	Result.M[3][1] = InvDet * (m[0] * (m[9] * m[14] - m[10] * m[13]) - m[1] * (m[8] * m[14] - m[10] * m[12]) + m[2] * (m[8] * m[13] - m[9] * m[12]));
-	Result.M[3][2] = -InvDet * (m[0] * (m[5] * m[14] - m[6] * m[13]) - m[1] * (m[4] * m[14] - m[6] * m[12]) + m[2] * (m[4] * m[13] - m[5] * m[12]));
-	Result.M[3][3] = InvDet * (m[0] * (m[5] * m[10] - m[6] * m[9]) - m[1] * (m[4] * m[10] - m[6] * m[8]) + m[2] * (m[4] * m[9] - m[5] * m[8]));
-
 	return Result;
 }
 
 FMatrix FMatrix::Transpose(const FMatrix& Matrix)
 {
 	FMatrix Result;
-	for (int i = 0; i < 4; ++i)
-	{
-		for (int j = 0; j < 4; ++j)
-		{
-			Result.M[i][j] = Matrix.M[j][i]; // ��� ���� �ٲ� ��ġ
-		}
-	}
+	VectorMatrix::Transpose(Result.M, Matrix.M);
 	return Result;
 }
 
@@ -407,31 +364,28 @@ FVector FMatrix::GetRotation() const
 
 FVector FMatrix::TransformVector(const FVector& Vector) const
 {
-	return {
-			Vector.X * M[0][0] + Vector.Y * M[1][0] + Vector.Z * M[2][0],
-			Vector.X * M[0][1] + Vector.Y * M[1][1] + Vector.Z * M[2][1],
-			Vector.X * M[0][2] + Vector.Y * M[1][2] + Vector.Z * M[2][2]
-	};
+	FVector Result;
+	VectorStoreFloat3(VectorMatrix::TransformDirection(VectorLoadFloat3(&Vector.X, 0.0f), M), &Result.X);
+	return Result;
+}
+
+FVector FMatrix::TransformPosition(const FVector& Position) const
+{
+	FVector Result;
+	VectorStoreFloat3(VectorMatrix::TransformPosition(VectorLoadFloat3(&Position.X, 1.0f), M), &Result.X);
+	return Result;
 }
 
 FVector4 FMatrix::TransformVector(const FVector4& Vector) const
 {
-	return {
-		Vector.X * M[0][0] + Vector.Y * M[1][0] + Vector.Z * M[2][0] + Vector.W * M[3][0],
-		Vector.X * M[0][1] + Vector.Y * M[1][1] + Vector.Z * M[2][1] + Vector.W * M[3][1],
-		Vector.X * M[0][2] + Vector.Y * M[1][2] + Vector.Z * M[2][2] + Vector.W * M[3][2],
-		Vector.X * M[0][3] + Vector.Y * M[1][3] + Vector.Z * M[2][3] + Vector.W * M[3][3],
-	};
+	return TransformVector4(Vector);
 }
 
 FVector4 FMatrix::TransformVector4(const FVector4& Vector) const
 {
-	return {
-			Vector.X * M[0][0] + Vector.Y * M[1][0] + Vector.Z * M[2][0] + Vector.W * M[3][0],
-			Vector.X * M[0][1] + Vector.Y * M[1][1] + Vector.Z * M[2][1] + Vector.W * M[3][1],
-			Vector.X * M[0][2] + Vector.Y * M[1][2] + Vector.Z * M[2][2] + Vector.W * M[3][2],
-			Vector.X * M[0][3] + Vector.Y * M[1][3] + Vector.Z * M[2][3] + Vector.W * M[3][3]
-	};
+	FVectorLanes Lanes;
+	VectorStoreAligned(VectorMatrix::TransformVector4(VectorSet(Vector.X, Vector.Y, Vector.Z, Vector.W), M), Lanes.V);
+	return {Lanes.V[0], Lanes.V[1], Lanes.V[2], Lanes.V[3]};
 }
 
 FTransform FMatrix::GetTransform() const
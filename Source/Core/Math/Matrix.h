@@ -9,19 +9,9 @@ struct FTransform;
 
 struct alignas(16) FMatrix
 {
-	union {
-
-		float M[4][4];
-		//FVector4[4];
-
-		struct
-		{
-			FVector4 X;
-			FVector4 Y;
-			FVector4 Z;
-			FVector4 W;
-		};
-	};
+	// row major, 행 단위로 채울 때는 FMatrix(X, Y, Z, W) 생성자를 사용합니다.
+	// (생성자가 있는 FVector4를 익명 union에 두는 것은 MSVC 확장이라 GCC/Clang에서 컴파일되지 않습니다.)
+	float M[4][4];
 
 	FMatrix();
 	FMatrix(const FVector4& InX, const FVector4& InY, const FVector4& InZ, const FVector4& InW);
@@ -70,8 +60,12 @@ struct alignas(16) FMatrix
 	FVector GetScale() const;
 	FVector GetRotation() const;
 
+	/** 방향 벡터 변환 (W = 0, 이동 없음) */
 	FVector TransformVector(const FVector& Vector) const;
 	FVector4 TransformVector(const FVector4& Vector) const;
+
+	/** 위치 변환 (W = 1, 이동 포함) */
+	FVector TransformPosition(const FVector& Position) const;
 	FVector4 TransformVector4(const FVector4& Vector) const;
 
 	FTransform GetTransform() const;
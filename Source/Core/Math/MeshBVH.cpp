@@ -0,0 +1,390 @@
+#include "MeshBVH.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <vector>
+
+#if PLATFORM_ENABLE_VECTORINTRINSICS
+#include <xmmintrin.h>
+#endif
+
+
+namespace
+{
+const FBox EmptyBox(FVector(FLT_MAX), FVector(-FLT_MAX));
+
+/** Node Box를 넓히는 비율 */
+constexpr float BoxPadding = 1e-5f;
+
+/** Slab Test에 쓰는 Ray, Lane 3은 0 */
+struct FSlabRay
+{
+#if PLATFORM_ENABLE_VECTORINTRINSICS
+	__m128 Origin;
+	__m128 InvDirection;
+#else
+	float Origin[3];
+	float InvDirection[3];
+#endif
+
+	explicit FSlabRay(const FRay& Ray)
+	{
+		const FVector& RayOrigin = Ray.GetOrigin();
+		const FVector& Direction = Ray.GetDirection();
+#if PLATFORM_ENABLE_VECTORINTRINSICS
+		Origin = _mm_setr_ps(RayOrigin.X, RayOrigin.Y, RayOrigin.Z, 0.0f);
+		InvDirection = _mm_setr_ps(1.0f / Direction.X, 1.0f / Direction.Y, 1.0f / Direction.Z, 0.0f);
+#else
+		Origin[0] = RayOrigin.X;
+		Origin[1] = RayOrigin.Y;
+		Origin[2] = RayOrigin.Z;
+		InvDirection[0] = 1.0f / Direction.X;
+		InvDirection[1] = 1.0f / Direction.Y;
+		InvDirection[2] = 1.0f / Direction.Z;
+#endif
+	}
+};
+
+/** Box의 진입 거리, Ray가 Box 안에서 시작하면 0 */
+FORCEINLINE bool IntersectSlab(const float* BoxMin, const float* BoxMax, const FSlabRay& Ray, float MaxDistance, float& OutEnter)
+{
+#if PLATFORM_ENABLE_VECTORINTRINSICS
+	// X, Y, Z Slab을 한 번에 계산하고 가장 늦은 진입과 가장 빠른 탈출만 남김
+	const __m128 T1 = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(BoxMin), Ray.Origin), Ray.InvDirection);
+	const __m128 T2 = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(BoxMax), Ray.Origin), Ray.InvDirection);
+	const __m128 Near = _mm_min_ps(T1, T2);
+	const __m128 Far = _mm_max_ps(T1, T2);
+
+	const __m128 Enter = _mm_max_ss(
+		_mm_max_ss(Near, _mm_shuffle_ps(Near, Near, _MM_SHUFFLE(1, 1, 1, 1))),
+		_mm_max_ss(_mm_shuffle_ps(Near, Near, _MM_SHUFFLE(2, 2, 2, 2)), _mm_setzero_ps())
+	);
+	const __m128 Exit = _mm_min_ss(
+		_mm_min_ss(Far, _mm_shuffle_ps(Far, Far, _MM_SHUFFLE(1, 1, 1, 1))),
+		_mm_min_ss(_mm_shuffle_ps(Far, Far, _MM_SHUFFLE(2, 2, 2, 2)), _mm_set_ss(MaxDistance))
+	);
+	OutEnter = _mm_cvtss_f32(Enter);
+	return OutEnter <= _mm_cvtss_f32(Exit);
+#else
+	float Enter = 0.0f;
+	float Exit = MaxDistance;
+	for (int32 Axis = 0; Axis < 3; ++Axis)
+	{
+		const float T1 = (BoxMin[Axis] - Ray.Origin[Axis]) * Ray.InvDirection[Axis];
+		const float T2 = (BoxMax[Axis] - Ray.Origin[Axis]) * Ray.InvDirection[Axis];
+		Enter = std::max(Enter, std::min(T1, T2));
+		Exit = std::min(Exit, std::max(T1, T2));
+	}
+	OutEnter = Enter;
+	return Enter <= Exit;
+#endif
+}
+
+/** FRayCast::IntersectRayTriangle과 같은 순서로 계산 (Edge1, Edge2를 바꾸면 감기는 방향이 뒤집힘) */
+FORCEINLINE bool IntersectTriangle(const FRay& Ray, const FVector& V0, const FVector& Edge1, const FVector& Edge2, bool bCullBackFace, float& OutT)
+{
+	const FVector P = FVector::CrossProduct(Ray.GetDirection(), Edge2);
+	const float Det = Edge1.Dot(P);
+	if (bCullBackFace ? Det <= 0.0f : fabs(Det) < SMALL_NUMBER * SMALL_NUMBER)
+	{
+		return false;
+	}
+
+	const float InvDet = 1.0f / Det;
+	const FVector S = Ray.GetOrigin() - V0;
+	const float U = S.Dot(P) * InvDet;
+	if (U < 0.0f || U > 1.0f)
+	{
+		return false;
+	}
+
+	const FVector Q = FVector::CrossProduct(S, Edge1);
+	const float V = Ray.GetDirection().Dot(Q) * InvDet;
+	if (V < 0.0f || U + V > 1.0f)
+	{
+		return false;
+	}
+
+	const float T = Edge2.Dot(Q) * InvDet;
+	if (T < 0.0f)
+	{
+		return false;
+	}
+
+	OutT = T;
+	return true;
+}
+
+float GetAxis(const FVector& Vector, int32 Axis)
+{
+	return Axis == 0 ? Vector.X : (Axis == 1 ? Vector.Y : Vector.Z);
+}
+}
+
+
+void FMeshBVH::Build(std::span<const FVector> Positions, std::span<const uint32> Indices)
+{
+	Nodes.Empty();
+	Triangles.Empty();
+	Depth = 0;
+
+	TArray<FTriangle> SourceTriangles;
+	TArray<FBox> TriangleBoxes;
+	TArray<FVector> Centroids;
+	for (size_t Index = 0; Index + 2 < Indices.size(); Index += 3)
+	{
+		const uint32 I0 = Indices[Index];
+		const uint32 I1 = Indices[Index + 1];
+		const uint32 I2 = Indices[Index + 2];
+		if (I0 >= Positions.size() || I1 >= Positions.size() || I2 >= Positions.size())
+		{
+			continue;
+		}
+
+		const FTriangle Triangle = {Positions[I0], Positions[I1] - Positions[I0], Positions[I2] - Positions[I0]};
+		const FBox Box = EmptyBox + Positions[I0] + Positions[I1] + Positions[I2];
+		SourceTriangles.Add(Triangle);
+		TriangleBoxes.Add(Box);
+		Centroids.Add(Box.GetCenter());
+	}
+
+	const int32 NumTriangles = SourceTriangles.Num();
+	if (NumTriangles == 0)
+	{
+		return;
+	}
+
+	TArray<int32> Order;
+	Order.SetNum(NumTriangles);
+	for (int32 Index = 0; Index < NumTriangles; ++Index)
+	{
+		Order[Index] = Index;
+	}
+
+	struct FBuildTask
+	{
+		int32 NodeIndex;
+		int32 First;
+		int32 Count;
+		int32 Depth;
+	};
+
+	struct FBin
+	{
+		FBox Box = EmptyBox;
+		int32 Count = 0;
+	};
+
+	Nodes.Reserve(NumTriangles * 2);
+	Nodes.Add(FNode());
+
+	std::vector<FBuildTask> Tasks;
+	Tasks.push_back({0, 0, NumTriangles, 1});
+	while (!Tasks.empty())
+	{
+		const FBuildTask Task = Tasks.back();
+		Tasks.pop_back();
+		Depth = std::max(Depth, Task.Depth);
+
+		FBox NodeBox = EmptyBox;
+		FBox CentroidBox = EmptyBox;
+		for (int32 Index = Task.First; Index < Task.First + Task.Count; ++Index)
+		{
+			NodeBox += TriangleBoxes[Order[Index]];
+			CentroidBox += Centroids[Order[Index]];
+		}
+
+		// 면이 Box 경계에 딱 붙어 있으면 (Cube) Slab 진입 거리가 삼각형 거리보다 반올림만큼 커서 잘못 건너뛸 수 있으므로 조금 넓힘
+		NodeBox = NodeBox.ExpandBy((NodeBox.GetExtent().Length() + 1.0f) * BoxPadding);
+
+		FNode& Node = Nodes[Task.NodeIndex];
+		Node.Min[0] = NodeBox.Min.X;
+		Node.Min[1] = NodeBox.Min.Y;
+		Node.Min[2] = NodeBox.Min.Z;
+		Node.Max[0] = NodeBox.Max.X;
+		Node.Max[1] = NodeBox.Max.Y;
+		Node.Max[2] = NodeBox.Max.Z;
+		Node.LeftOrFirst = Task.First;
+		Node.Count = Task.Count;
+
+		if (Task.Count <= MaxLeafTriangles || Task.Depth >= MaxDepth)
+		{
+			continue;
+		}
+
+		// Centroid 범위를 NumBins개로 나누고, 경계마다 양쪽 표면적 * 삼각형 수가 가장 작은 곳을 고름
+		int32 BestAxis = -1;
+		int32 BestSplit = 0;
+		float BestCost = FLT_MAX;
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			const float AxisMin = GetAxis(CentroidBox.Min, Axis);
+			const float AxisExtent = GetAxis(CentroidBox.Max, Axis) - AxisMin;
+			if (AxisExtent <= 0.0f)
+			{
+				continue;
+			}
+
+			FBin Bins[NumBins];
+			const float Scale = NumBins / AxisExtent;
+			for (int32 Index = Task.First; Index < Task.First + Task.Count; ++Index)
+			{
+				const int32 Triangle = Order[Index];
+				const int32 Bin = std::min(NumBins - 1, static_cast<int32>((GetAxis(Centroids[Triangle], Axis) - AxisMin) * Scale));
+				Bins[Bin].Box += TriangleBoxes[Triangle];
+				++Bins[Bin].Count;
+			}
+
+			float RightCost[NumBins];
+			FBox RightBox = EmptyBox;
+			int32 RightCount = 0;
+			for (int32 Bin = NumBins - 1; Bin > 0; --Bin)
+			{
+				RightBox += Bins[Bin].Box;
+				RightCount += Bins[Bin].Count;
+				RightCost[Bin] = RightCount > 0 ? RightBox.GetSurfaceArea() * RightCount : 0.0f;
+			}
+
+			FBox LeftBox = EmptyBox;
+			int32 LeftCount = 0;
+			for (int32 Bin = 0; Bin < NumBins - 1; ++Bin)
+			{
+				LeftBox += Bins[Bin].Box;
+				LeftCount += Bins[Bin].Count;
+				if (LeftCount == 0 || LeftCount == Task.Count)
+				{
+					continue;
+				}
+
+				const float Cost = LeftBox.GetSurfaceArea() * LeftCount + RightCost[Bin + 1];
+				if (Cost < BestCost)
+				{
+					BestCost = Cost;
+					BestAxis = Axis;
+					BestSplit = Bin + 1;
+				}
+			}
+		}
+
+		// 모든 Centroid가 한 점이면 나눌 수 없음
+		if (BestAxis < 0)
+		{
+			continue;
+		}
+
+		const float AxisMin = GetAxis(CentroidBox.Min, BestAxis);
+		const float Scale = NumBins / (GetAxis(CentroidBox.Max, BestAxis) - AxisMin);
+		int32* const Begin = &Order[Task.First];
+		int32* const Middle = std::partition(Begin, Begin + Task.Count, [&](int32 Triangle)
+		{
+			return std::min(NumBins - 1, static_cast<int32>((GetAxis(Centroids[Triangle], BestAxis) - AxisMin) * Scale)) < BestSplit;
+		});
+		const int32 LeftCount = static_cast<int32>(Middle - Begin);
+
+		const int32 LeftIndex = Nodes.Num();
+		Nodes.Add(FNode());
+		Nodes.Add(FNode());
+		Nodes[Task.NodeIndex].LeftOrFirst = LeftIndex;
+		Nodes[Task.NodeIndex].Count = 0;
+
+		Tasks.push_back({LeftIndex, Task.First, LeftCount, Task.Depth + 1});
+		Tasks.push_back({LeftIndex + 1, Task.First + LeftCount, Task.Count - LeftCount, Task.Depth + 1});
+	}
+
+	// Leaf가 가리키는 순서대로 삼각형을 모아둠
+	Triangles.SetNum(NumTriangles);
+	for (int32 Index = 0; Index < NumTriangles; ++Index)
+	{
+		Triangles[Index] = SourceTriangles[Order[Index]];
+	}
+}
+
+bool FMeshBVH::RayCast(const FRay& Ray, float MaxDistance, bool bCullBackFace, bool bFlipWinding, float& OutDistance) const
+{
+	if (Nodes.Num() == 0)
+	{
+		return false;
+	}
+
+	const FSlabRay SlabRay(Ray);
+	float RootEnter;
+	if (!IntersectSlab(Nodes[0].Min, Nodes[0].Max, SlabRay, MaxDistance, RootEnter))
+	{
+		return false;
+	}
+
+	// 먼 자식만 Stack에 넣고 가까운 자식으로 바로 내려감
+	uint32 StackNodes[MaxDepth];
+	float StackEnters[MaxDepth];
+	int32 StackSize = 0;
+
+	bool bHit = false;
+	float Closest = MaxDistance;
+	uint32 NodeIndex = 0;
+	while (true)
+	{
+		const FNode& Node = Nodes[NodeIndex];
+		if (Node.IsLeaf())
+		{
+			for (uint32 Index = Node.LeftOrFirst; Index < Node.LeftOrFirst + Node.Count; ++Index)
+			{
+				const FTriangle& Triangle = Triangles[Index];
+				float Distance;
+				const bool bTriangleHit = bFlipWinding
+					? IntersectTriangle(Ray, Triangle.V0, Triangle.Edge2, Triangle.Edge1, bCullBackFace, Distance)
+					: IntersectTriangle(Ray, Triangle.V0, Triangle.Edge1, Triangle.Edge2, bCullBackFace, Distance);
+				if (bTriangleHit && Distance <= Closest)
+				{
+					Closest = Distance;
+					bHit = true;
+				}
+			}
+		}
+		else
+		{
+			const FNode& Left = Nodes[Node.LeftOrFirst];
+			const FNode& Right = Nodes[Node.LeftOrFirst + 1];
+			float LeftEnter, RightEnter;
+			const bool bLeft = IntersectSlab(Left.Min, Left.Max, SlabRay, Closest, LeftEnter);
+			const bool bRight = IntersectSlab(Right.Min, Right.Max, SlabRay, Closest, RightEnter);
+			if (bLeft && bRight)
+			{
+				const bool bLeftFirst = LeftEnter <= RightEnter;
+				StackNodes[StackSize] = bLeftFirst ? Node.LeftOrFirst + 1 : Node.LeftOrFirst;
+				StackEnters[StackSize] = bLeftFirst ? RightEnter : LeftEnter;
+				++StackSize;
+				NodeIndex = bLeftFirst ? Node.LeftOrFirst : Node.LeftOrFirst + 1;
+				continue;
+			}
+			if (bLeft || bRight)
+			{
+				NodeIndex = bLeft ? Node.LeftOrFirst : Node.LeftOrFirst + 1;
+				continue;
+			}
+		}
+
+		// 넣은 뒤에 더 가까운 교차를 찾았으면 건너뜀
+		do
+		{
+			if (StackSize == 0)
+			{
+				OutDistance = Closest;
+				return bHit;
+			}
+			--StackSize;
+		}
+		while (StackEnters[StackSize] > Closest);
+		NodeIndex = StackNodes[StackSize];
+	}
+}
+
+FBox FMeshBVH::GetBounds() const
+{
+	if (Nodes.Num() == 0)
+	{
+		return FBox();
+	}
+	const FNode& Root = Nodes[0];
+	return FBox(FVector(Root.Min[0], Root.Min[1], Root.Min[2]), FVector(Root.Max[0], Root.Max[1], Root.Max[2]));
+}
@@ -0,0 +1,74 @@
+#pragma once
+#include <span>
+
+#include "BoxSphereBounds.h"
+#include "Ray.h"
+#include "Core/Container/Array.h"
+#include "Core/HAL/PlatformType.h"
+
+
+/**
+ * Mesh 하나의 삼각형 BVH (Local 공간)
+ *
+ * - 한 번 만들고 나면 바뀌지 않으므로, 같은 Mesh를 쓰는 모든 Primitive가 공유합니다. (FMesh::GetBVH)
+ * - Binned SAH로 나누고, 자식 두 개는 Nodes에 연속으로 둡니다.
+ * - Ray 검사는 SSE Slab Test로 자식 Box를 보고, Leaf에서 Möller–Trumbore로 삼각형을 검사합니다.
+ *   삼각형 검사는 FRayCast::IntersectRayTriangle과 같은 계산이라 결과도 같습니다.
+ */
+class FMeshBVH
+{
+public:
+	/** Leaf 하나에 넣는 최대 삼각형 수 */
+	static constexpr int32 MaxLeafTriangles = 4;
+
+	/** SAH 분할 후보를 찾는 구간 수 */
+	static constexpr int32 NumBins = 12;
+
+	/** Traversal Stack 크기, 이보다 깊어지면 Leaf로 끝냅니다. */
+	static constexpr int32 MaxDepth = 64;
+
+	/** Triangle List의 Index로 만듭니다. 범위를 벗어난 Index가 있는 삼각형은 뺍니다. */
+	void Build(std::span<const FVector> Positions, std::span<const uint32> Indices);
+
+	/**
+	 * Ray와 가장 가까운 삼각형의 거리
+	 * @param Ray Mesh Local 공간의 Ray, 방향이 정규화되어 있지 않아도 되고 거리는 방향의 배수로 나옵니다.
+	 * @param bCullBackFace 뒷면(Ray에서 반시계 방향)을 무시할지
+	 * @param bFlipWinding 음수 Scale처럼 감기는 방향이 뒤집힌 Instance면 true
+	 */
+	bool RayCast(const FRay& Ray, float MaxDistance, bool bCullBackFace, bool bFlipWinding, float& OutDistance) const;
+
+	bool IsEmpty() const { return Nodes.Num() == 0; }
+	int32 GetNumTriangles() const { return Triangles.Num(); }
+	int32 GetNumNodes() const { return Nodes.Num(); }
+	int32 GetDepth() const { return Depth; }
+
+	FBox GetBounds() const;
+
+private:
+	struct FNode
+	{
+		/** Min, Max 뒤에 int를 하나씩 붙여서 SSE로 16 byte씩 읽습니다. (4번째 Lane은 검사에 쓰지 않음) */
+		float Min[3];
+		/** Leaf면 첫 삼각형, 아니면 왼쪽 자식 (오른쪽은 +1) */
+		uint32 LeftOrFirst;
+		float Max[3];
+		/** Leaf의 삼각형 수, 0이면 내부 Node */
+		uint32 Count;
+
+		bool IsLeaf() const { return Count > 0; }
+	};
+
+	/** Möller–Trumbore에 바로 쓰도록 변을 미리 계산해 둔 삼각형 */
+	struct FTriangle
+	{
+		FVector V0;
+		FVector Edge1; // V1 - V0
+		FVector Edge2; // V2 - V0
+	};
+
+private:
+	TArray<FNode> Nodes;
+	TArray<FTriangle> Triangles;
+	int32 Depth = 0;
+};
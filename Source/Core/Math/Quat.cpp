@@ -247,4 +247,32 @@ FQuat FQuat::Normalized() const
 	return FQuat(0.0f, 0.0f, 0.0f, 1.0f);
 }
 
+FQuat FQuat::Slerp(const FQuat& A, const FQuat& B, float Alpha)
+{
+	// q와 -q는 같은 회전이므로, 내적이 음수면 B를 뒤집어서 짧은 쪽으로 보간
+	float CosTheta = A.X * B.X + A.Y * B.Y + A.Z * B.Z + A.W * B.W;
+	const float Sign = CosTheta < 0.0f ? -1.0f : 1.0f;
+	CosTheta *= Sign;
+
+	float ScaleA = 1.0f - Alpha;
+	float ScaleB = Alpha;
+
+	// 두 회전이 거의 같으면 sin이 0에 가까우므로 선형 보간 후 정규화
+	if (CosTheta < 0.9999f)
+	{
+		const float Theta = acosf(CosTheta);
+		const float InvSinTheta = 1.0f / sinf(Theta);
+		ScaleA = sinf(ScaleA * Theta) * InvSinTheta;
+		ScaleB = sinf(ScaleB * Theta) * InvSinTheta;
+	}
+	ScaleB *= Sign;
+
+	return FQuat(
+		ScaleA * A.X + ScaleB * B.X,
+		ScaleA * A.Y + ScaleB * B.Y,
+		ScaleA * A.Z + ScaleB * B.Z,
+		ScaleA * A.W + ScaleB * B.W
+	).Normalized();
+}
+
 const FQuat FQuat::Identity = FQuat(0.0f, 0.0f, 0.0f, 1.0f);
@@ -29,6 +29,9 @@ struct alignas(16) FQuat : public FVector4{
 
     static FQuat MakeFromRotationMatrix(const FMatrix& M);
 
+	/** A에서 B로 짧은 쪽 호를 따라 구면 선형 보간, Alpha가 0이면 A, 1이면 B */
+	static FQuat Slerp(const FQuat& A, const FQuat& B, float Alpha);
+
 	FQuat GetInverse() const { return FQuat (-X, -Y, -Z, W); }
 	FVector RotateVector(const FVector& V) const;
 
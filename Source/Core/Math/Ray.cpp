@@ -1,7 +1,6 @@
 #include "Ray.h"
 
 #include "Core/Math/Matrix.h"
-#include "DirectXTK/DirectXHelpers.h"
 #include "Static/FLineBatchManager.h"
 
 
@@ -201,6 +200,44 @@ bool FRayCast::IntersectRayTrianglePlane(const FRay& Ray, const FVector& V0, con
 	return true;
 }
 
+bool FRayCast::IntersectRayTriangle(const FRay& Ray, const FVector& V0, const FVector& V1, const FVector& V2, bool bCullBackFace, OUT float& OutT)
+{
+	const FVector Edge1 = V1 - V0;
+	const FVector Edge2 = V2 - V0;
+
+	// Det = -Dot(Direction, Cross(Edge1, Edge2)), 양수면 Ray가 앞면을 봄
+	const FVector P = FVector::CrossProduct(Ray.GetDirection(), Edge2);
+	const float Det = Edge1.Dot(P);
+	if (bCullBackFace ? Det <= 0.0f : fabs(Det) < SMALL_NUMBER * SMALL_NUMBER)
+	{
+		return false;
+	}
+
+	const float InvDet = 1.0f / Det;
+	const FVector S = Ray.GetOrigin() - V0;
+	const float U = S.Dot(P) * InvDet;
+	if (U < 0.0f || U > 1.0f)
+	{
+		return false;
+	}
+
+	const FVector Q = FVector::CrossProduct(S, Edge1);
+	const float V = Ray.GetDirection().Dot(Q) * InvDet;
+	if (V < 0.0f || U + V > 1.0f)
+	{
+		return false;
+	}
+
+	const float T = Edge2.Dot(Q) * InvDet;
+	if (T < 0.0f)
+	{
+		return false;
+	}
+
+	OutT = T;
+	return true;
+}
+
 bool FRayCast::IntersectRayPlane(const FRay& Ray, const FVector& PlanePoint, const FVector& PlaneNormal, OUT float& OutT)
 {
 	// Ray 방향과 평면 법선의 내적 계산
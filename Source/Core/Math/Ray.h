@@ -103,6 +103,15 @@ public:
 	/// <returns>교차가 있고 삼각형 내부에 있으면 true, 아니면 false</returns>
 	static bool IntersectRayTrianglePlane(const FRay& Ray, const FVector& V0, const FVector& V1, const FVector& V2, OUT float& OutT);
 
+	/// <summary>
+	/// <para>Ray와 삼각형의 교차를 Möller–Trumbore 방식으로 검사 (변 위의 점도 교차로 판단)</para>
+	/// DefaultRasterizer와 같이 Ray 방향에서 볼 때 시계 방향(v0 → v1 → v2)인 면을 앞면으로 봅니다.
+	/// </summary>
+	/// <param name="bCullBackFace">true면 뒷면과의 교차는 무시</param>
+	/// <param name="outT">교차 시 Ray 상의 t 값 (0 이상)</param>
+	/// <returns>교차가 있으면 true, 없으면 false</returns>
+	static bool IntersectRayTriangle(const FRay& Ray, const FVector& V0, const FVector& V1, const FVector& V2, bool bCullBackFace, OUT float& OutT);
+
 	/// <summary>
 	/// <para>주어진 Ray와 평면(planePoint와 planeNormal으로 정의)과의 단순 교차를 검사</para>
 	/// 평면 방정식을 이용해 교차 파라미터 t를 이용해 교차 검사
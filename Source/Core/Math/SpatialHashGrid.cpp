@@ -0,0 +1,347 @@
+#include "SpatialHashGrid.h"
+
+#include <cmath>
+
+
+FSpatialHashGrid::FSpatialHashGrid(float InCellSize)
+	: CellSize(InCellSize)
+	, InvCellSize(1.0f / InCellSize)
+{
+	Clear();
+}
+
+int32 FSpatialHashGrid::Add(const FBox& Box, void* UserData)
+{
+	const int32 Id = AllocateElement(Box, UserData);
+
+	FCellCoord Coord;
+	if (GetElementCell(Box, Coord))
+	{
+		LinkElement(Id, Coord);
+	}
+	else
+	{
+		LinkLargeElement(Id);
+	}
+	return Id;
+}
+
+void FSpatialHashGrid::Update(int32 Id, const FBox& Box)
+{
+	FElement& Element = Elements[Id];
+	Element.Box = Box;
+
+	FCellCoord Coord;
+	const bool bInGrid = GetElementCell(Box, Coord);
+
+	// 중심이 같은 Cell에 있으면 Box만 바꾸고 끝
+	if (bInGrid ? (Element.Slot == GridSlot && ElementCellKeys[Id] == ToKey(Coord)) : Element.Slot == LargeSlot)
+	{
+		return;
+	}
+
+	UnlinkElement(Id);
+	if (bInGrid)
+	{
+		LinkElement(Id, Coord);
+	}
+	else
+	{
+		LinkLargeElement(Id);
+	}
+}
+
+void FSpatialHashGrid::Remove(int32 Id)
+{
+	UnlinkElement(Id);
+	FreeElement(Id);
+}
+
+void FSpatialHashGrid::Clear()
+{
+	ClearElements();
+	Cells.Empty();
+	ElementCellKeys.Empty();
+	LargeElements.Empty();
+	OccupiedMin = {INT32_MAX, INT32_MAX, INT32_MAX};
+	OccupiedMax = {INT32_MIN, INT32_MIN, INT32_MIN};
+}
+
+FSpatialHashGrid::FCellCoord FSpatialHashGrid::ToCell(const FVector& Position) const
+{
+	// 범위 밖은 MaxCellCoordinate보다 한 칸 바깥으로 모아서 int 넘침을 막음
+	constexpr float Limit = static_cast<float>(MaxCellCoordinate + 1);
+	return {
+		static_cast<int32>(FMath::Clamp(std::floor(Position.X * InvCellSize), -Limit, Limit)),
+		static_cast<int32>(FMath::Clamp(std::floor(Position.Y * InvCellSize), -Limit, Limit)),
+		static_cast<int32>(FMath::Clamp(std::floor(Position.Z * InvCellSize), -Limit, Limit))
+	};
+}
+
+uint64 FSpatialHashGrid::ToKey(const FCellCoord& Coord)
+{
+	constexpr uint64 Mask = (1ull << 21) - 1;
+	return ((static_cast<uint64>(Coord.X) & Mask) << 42) | ((static_cast<uint64>(Coord.Y) & Mask) << 21) | (static_cast<uint64>(Coord.Z) & Mask);
+}
+
+FBox FSpatialHashGrid::GetLooseCellBox(const FCellCoord& Coord) const
+{
+	const FVector Min(static_cast<float>(Coord.X) * CellSize, static_cast<float>(Coord.Y) * CellSize, static_cast<float>(Coord.Z) * CellSize);
+	return FBox(Min - FVector(CellSize), Min + FVector(CellSize * 2.0f));
+}
+
+bool FSpatialHashGrid::GetElementCell(const FBox& Box, FCellCoord& OutCoord) const
+{
+	if (MaxComponent(Box.GetExtent()) > CellSize)
+	{
+		return false;
+	}
+
+	OutCoord = ToCell(Box.GetCenter());
+	return FMath::Abs(OutCoord.X) <= MaxCellCoordinate
+		&& FMath::Abs(OutCoord.Y) <= MaxCellCoordinate
+		&& FMath::Abs(OutCoord.Z) <= MaxCellCoordinate;
+}
+
+void FSpatialHashGrid::LinkElement(int32 Id, const FCellCoord& Coord)
+{
+	const uint64 Key = ToKey(Coord);
+	FCell* Cell = Cells.Find(Key);
+	if (Cell == nullptr)
+	{
+		Cell = &Cells[Key];
+		Cell->Coord = Coord;
+
+		OccupiedMin = {FMath::Min(OccupiedMin.X, Coord.X), FMath::Min(OccupiedMin.Y, Coord.Y), FMath::Min(OccupiedMin.Z, Coord.Z)};
+		OccupiedMax = {FMath::Max(OccupiedMax.X, Coord.X), FMath::Max(OccupiedMax.Y, Coord.Y), FMath::Max(OccupiedMax.Z, Coord.Z)};
+	}
+
+	if (ElementCellKeys.Num() < Elements.Num())
+	{
+		ElementCellKeys.SetNum(Elements.Num());
+	}
+
+	FElement& Element = Elements[Id];
+	Element.Slot = GridSlot;
+	Element.IndexInSlot = Cell->Elements.Add(Id);
+	ElementCellKeys[Id] = Key;
+}
+
+void FSpatialHashGrid::LinkLargeElement(int32 Id)
+{
+	FElement& Element = Elements[Id];
+	Element.Slot = LargeSlot;
+	Element.IndexInSlot = LargeElements.Add(Id);
+}
+
+void FSpatialHashGrid::UnlinkElement(int32 Id)
+{
+	const FElement& Element = Elements[Id];
+	FCell* Cell = Element.Slot == GridSlot ? Cells.Find(ElementCellKeys[Id]) : nullptr;
+	TArray<int32>& List = Cell ? Cell->Elements : LargeElements;
+
+	// 마지막 원소를 빈 자리로 옮김
+	const int32 LastId = List[List.Num() - 1];
+	List[Element.IndexInSlot] = LastId;
+	Elements[LastId].IndexInSlot = Element.IndexInSlot;
+	List.SetNum(List.Num() - 1);
+
+	// 빈 Cell은 지워서 Frustum Query가 순회하는 Cell 수를 줄임
+	if (Cell && List.Num() == 0)
+	{
+		Cells.Remove(ElementCellKeys[Id]);
+	}
+}
+
+void FSpatialHashGrid::QueryBox(const FBox& Box, TArray<int32>& OutIds) const
+{
+	OutIds.Empty();
+
+	for (const int32 Id : LargeElements)
+	{
+		if (Elements[Id].Box.Intersect(Box))
+		{
+			OutIds.Add(Id);
+		}
+	}
+
+	ForEachCellNear(Box, [this, &Box, &OutIds](const FCell& Cell)
+	{
+		for (const int32 Id : Cell.Elements)
+		{
+			if (Elements[Id].Box.Intersect(Box))
+			{
+				OutIds.Add(Id);
+			}
+		}
+	});
+}
+
+void FSpatialHashGrid::QuerySphere(const FVector& Center, float Radius, TArray<int32>& OutIds) const
+{
+	OutIds.Empty();
+
+	const float RadiusSquared = Radius * Radius;
+	for (const int32 Id : LargeElements)
+	{
+		if (DistanceSquared(Elements[Id].Box, Center) <= RadiusSquared)
+		{
+			OutIds.Add(Id);
+		}
+	}
+
+	ForEachCellNear(FBox(Center - FVector(Radius), Center + FVector(Radius)), [this, &Center, RadiusSquared, &OutIds](const FCell& Cell)
+	{
+		for (const int32 Id : Cell.Elements)
+		{
+			if (DistanceSquared(Elements[Id].Box, Center) <= RadiusSquared)
+			{
+				OutIds.Add(Id);
+			}
+		}
+	});
+}
+
+void FSpatialHashGrid::QueryFrustum(const FFrustum& Frustum, TArray<int32>& OutIds) const
+{
+	OutIds.Empty();
+
+	for (const int32 Id : LargeElements)
+	{
+		if (Frustum.IntersectBox(Elements[Id].Box))
+		{
+			OutIds.Add(Id);
+		}
+	}
+
+	// Frustum은 범위가 커서 있는 Cell만 순회
+	for (const auto& Pair : Cells)
+	{
+		const FCell& Cell = Pair.Value;
+		const FBox LooseBox = GetLooseCellBox(Cell.Coord);
+		if (!Frustum.IntersectBox(LooseBox))
+		{
+			continue;
+		}
+
+		if (Frustum.ContainsBox(LooseBox))
+		{
+			for (const int32 Id : Cell.Elements)
+			{
+				OutIds.Add(Id);
+			}
+			continue;
+		}
+
+		for (const int32 Id : Cell.Elements)
+		{
+			if (Frustum.IntersectBox(Elements[Id].Box))
+			{
+				OutIds.Add(Id);
+			}
+		}
+	}
+}
+
+void FSpatialHashGrid::QueryNearest(const FVector& Point, int32 Count, TArray<int32>& OutIds, float MaxDistance) const
+{
+	FNearestCandidates Candidates(Count, MaxDistance);
+
+	for (const int32 Id : LargeElements)
+	{
+		Candidates.Consider(Id, DistanceSquared(Elements[Id].Box, Point));
+	}
+
+	const auto ConsiderCell = [this, &Point, &Candidates](const FCell& Cell)
+	{
+		for (const int32 Id : Cell.Elements)
+		{
+			Candidates.Consider(Id, DistanceSquared(Elements[Id].Box, Point));
+		}
+	};
+
+	const FCellCoord Center = ToCell(Point);
+	if (Cells.IsEmpty())
+	{
+		Candidates.Write(OutIds);
+		return;
+	}
+
+	// Cell 좌표 범위 밖의 점은 Ring 거리 계산이 맞지 않으므로 모두 검사
+	if (FMath::Abs(Center.X) > MaxCellCoordinate || FMath::Abs(Center.Y) > MaxCellCoordinate || FMath::Abs(Center.Z) > MaxCellCoordinate)
+	{
+		for (const auto& Pair : Cells)
+		{
+			ConsiderCell(Pair.Value);
+		}
+		Candidates.Write(OutIds);
+		return;
+	}
+
+	const auto RingDistance = [](int32 Value, int32 Min, int32 Max)
+	{
+		return Value < Min ? Min - Value : (Value > Max ? Value - Max : 0);
+	};
+	const int32 FirstRing = FMath::Max(RingDistance(Center.X, OccupiedMin.X, OccupiedMax.X), FMath::Max(RingDistance(Center.Y, OccupiedMin.Y, OccupiedMax.Y), RingDistance(Center.Z, OccupiedMin.Z, OccupiedMax.Z)));
+	const int32 LastRing = FMath::Max(
+		FMath::Max(FMath::Abs(Center.X - OccupiedMin.X), FMath::Abs(OccupiedMax.X - Center.X)),
+		FMath::Max(
+			FMath::Max(FMath::Abs(Center.Y - OccupiedMin.Y), FMath::Abs(OccupiedMax.Y - Center.Y)),
+			FMath::Max(FMath::Abs(Center.Z - OccupiedMin.Z), FMath::Abs(OccupiedMax.Z - Center.Z))
+		)
+	);
+
+	// Point를 둘러싼 Cell을 Chebyshev 거리(Ring) 순서로 봅니다.
+	// Ring R의 Cell은 Point에서 (R - 1) * CellSize 이상 떨어져 있고, 원소는 Cell에서 CellSize까지 나오므로
+	// (R - 2) * CellSize가 후보의 최대 거리보다 멀면 더 볼 필요가 없습니다.
+	for (int32 Ring = FirstRing; Ring <= LastRing; ++Ring)
+	{
+		const float MinDistance = static_cast<float>(FMath::Max(Ring - 2, 0)) * CellSize;
+		if (MinDistance * MinDistance > Candidates.GetMaxDistanceSquared())
+		{
+			break;
+		}
+
+		const int32 BeginZ = FMath::Max(Center.Z - Ring, OccupiedMin.Z);
+		const int32 EndZ = FMath::Min(Center.Z + Ring, OccupiedMax.Z);
+		const int32 BeginY = FMath::Max(Center.Y - Ring, OccupiedMin.Y);
+		const int32 EndY = FMath::Min(Center.Y + Ring, OccupiedMax.Y);
+		const int32 BeginX = FMath::Max(Center.X - Ring, OccupiedMin.X);
+		const int32 EndX = FMath::Min(Center.X + Ring, OccupiedMax.X);
+
+		for (int32 Z = BeginZ; Z <= EndZ; ++Z)
+		{
+			for (int32 Y = BeginY; Y <= EndY; ++Y)
+			{
+				const bool bOnShell = FMath::Abs(Z - Center.Z) == Ring || FMath::Abs(Y - Center.Y) == Ring;
+				if (bOnShell)
+				{
+					for (int32 X = BeginX; X <= EndX; ++X)
+					{
+						if (const FCell* Cell = Cells.Find(ToKey({X, Y, Z})))
+						{
+							ConsiderCell(*Cell);
+						}
+					}
+					continue;
+				}
+
+				// 안쪽 줄은 양 끝 두 Cell만 Ring에 속함
+				const int32 Xs[2] = {Center.X - Ring, Center.X + Ring};
+				for (int32 Index = 0; Index < (Ring == 0 ? 1 : 2); ++Index)
+				{
+					if (Xs[Index] < BeginX || Xs[Index] > EndX)
+					{
+						continue;
+					}
+					if (const FCell* Cell = Cells.Find(ToKey({Xs[Index], Y, Z})))
+					{
+						ConsiderCell(*Cell);
+					}
+				}
+			}
+		}
+	}
+
+	Candidates.Write(OutIds);
+}
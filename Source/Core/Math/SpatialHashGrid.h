@@ -0,0 +1,139 @@
+#pragma once
+#include "SpatialIndex.h"
+#include "Core/Container/Map.h"
+
+
+/**
+ * Hash로 찾는 균일 Grid (Loose)
+ *
+ * - 원소는 Box 중심이 있는 Cell 하나에만 넣고, Cell 목록은 원소가 있는 Cell만 Hash Map에 둡니다.
+ * - Extent가 CellSize 이하인 원소만 Grid에 넣으므로, Query는 범위를 CellSize만큼 넓혀서 Cell을 찾으면 됩니다.
+ *   더 큰 원소나 Cell 좌표 범위를 벗어난 원소는 Large 목록에 두고 매번 모두 검사합니다.
+ * - 원소가 고르게 퍼져 있고 크기가 비슷할 때 Octree보다 갱신과 Query가 가볍습니다.
+ */
+class FSpatialHashGrid : public FSpatialIndex
+{
+public:
+	static constexpr float DefaultCellSize = 4.0f;
+
+	explicit FSpatialHashGrid(float InCellSize = DefaultCellSize);
+
+	virtual ESpatialIndexType GetType() const override { return ESpatialIndexType::HashGrid; }
+	virtual const char* GetName() const override { return "HashGrid"; }
+
+	virtual int32 Add(const FBox& Box, void* UserData) override;
+	virtual void Update(int32 Id, const FBox& Box) override;
+	virtual void Remove(int32 Id) override;
+	virtual void Clear() override;
+
+	virtual void QueryBox(const FBox& Box, TArray<int32>& OutIds) const override;
+	virtual void QuerySphere(const FVector& Center, float Radius, TArray<int32>& OutIds) const override;
+	virtual void QueryFrustum(const FFrustum& Frustum, TArray<int32>& OutIds) const override;
+	virtual void QueryNearest(const FVector& Point, int32 Count, TArray<int32>& OutIds, float MaxDistance = FLT_MAX) const override;
+
+	int32 GetNumCells() const { return static_cast<int32>(Cells.Num()); }
+	int32 GetNumLargeElements() const { return LargeElements.Num(); }
+
+private:
+	/** Key에 축마다 21 bit씩 넣으므로 이 범위를 벗어나는 Cell 좌표는 Large로 보냄 */
+	static constexpr int32 MaxCellCoordinate = (1 << 20) - 1;
+
+	/** Elements의 Slot 값, Grid의 Cell(ElementCellKeys) 또는 Large 목록에 있음 */
+	static constexpr int32 GridSlot = 0;
+	static constexpr int32 LargeSlot = 1;
+
+	struct FCellCoord
+	{
+		int32 X;
+		int32 Y;
+		int32 Z;
+	};
+
+	struct FCell
+	{
+		FCellCoord Coord;
+		TArray<int32> Elements;
+	};
+
+	FCellCoord ToCell(const FVector& Position) const;
+	static uint64 ToKey(const FCellCoord& Coord);
+
+	/** 이 Cell에 중심이 있는 원소가 들어갈 수 있는 범위 (Cell을 CellSize만큼 넓힌 Box) */
+	FBox GetLooseCellBox(const FCellCoord& Coord) const;
+
+	/** Grid에 넣을 수 있으면 true와 Cell 좌표 */
+	bool GetElementCell(const FBox& Box, FCellCoord& OutCoord) const;
+
+	void LinkElement(int32 Id, const FCellCoord& Coord);
+	void LinkLargeElement(int32 Id);
+	void UnlinkElement(int32 Id);
+
+	/**
+	 * Box와 겹칠 수 있는 Cell마다 Callback(const FCell&)을 부릅니다.
+	 * 범위의 Cell 수가 있는 Cell 수보다 많으면 Hash Map을 순회합니다.
+	 */
+	template <typename CallbackType>
+	void ForEachCellNear(const FBox& Box, CallbackType&& Callback) const;
+
+private:
+	float CellSize;
+	float InvCellSize;
+
+	TMap<uint64, FCell> Cells;
+
+	/** Id마다 들어 있는 Cell의 Key */
+	TArray<uint64> ElementCellKeys;
+	TArray<int32> LargeElements;
+
+	/** 원소가 들어간 적 있는 Cell 좌표의 범위 (K Nearest가 더 찾을 곳이 없는지 판단) */
+	FCellCoord OccupiedMin;
+	FCellCoord OccupiedMax;
+};
+
+
+template <typename CallbackType>
+void FSpatialHashGrid::ForEachCellNear(const FBox& Box, CallbackType&& Callback) const
+{
+	if (Cells.IsEmpty())
+	{
+		return;
+	}
+
+	// 원소는 중심 Cell에서 CellSize까지 삐져나올 수 있음
+	const FCellCoord Min = ToCell(Box.Min - FVector(CellSize));
+	const FCellCoord Max = ToCell(Box.Max + FVector(CellSize));
+	const FCellCoord Begin = {FMath::Max(Min.X, OccupiedMin.X), FMath::Max(Min.Y, OccupiedMin.Y), FMath::Max(Min.Z, OccupiedMin.Z)};
+	const FCellCoord End = {FMath::Min(Max.X, OccupiedMax.X), FMath::Min(Max.Y, OccupiedMax.Y), FMath::Min(Max.Z, OccupiedMax.Z)};
+	if (Begin.X > End.X || Begin.Y > End.Y || Begin.Z > End.Z)
+	{
+		return;
+	}
+
+	const int64 NumCellsInRange = static_cast<int64>(End.X - Begin.X + 1) * (End.Y - Begin.Y + 1) * (End.Z - Begin.Z + 1);
+	if (NumCellsInRange > static_cast<int64>(Cells.Num()))
+	{
+		for (const auto& Pair : Cells)
+		{
+			const FCellCoord& Coord = Pair.Value.Coord;
+			if (Coord.X >= Begin.X && Coord.X <= End.X && Coord.Y >= Begin.Y && Coord.Y <= End.Y && Coord.Z >= Begin.Z && Coord.Z <= End.Z)
+			{
+				Callback(Pair.Value);
+			}
+		}
+		return;
+	}
+
+	for (int32 Z = Begin.Z; Z <= End.Z; ++Z)
+	{
+		for (int32 Y = Begin.Y; Y <= End.Y; ++Y)
+		{
+			for (int32 X = Begin.X; X <= End.X; ++X)
+			{
+				if (const FCell* Cell = Cells.Find(ToKey({X, Y, Z})))
+				{
+					Callback(*Cell);
+				}
+			}
+		}
+	}
+}
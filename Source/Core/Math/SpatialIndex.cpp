@@ -0,0 +1,107 @@
+#include "SpatialIndex.h"
+
+#include <algorithm>
+
+#include "LooseOctree.h"
+#include "SpatialHashGrid.h"
+
+
+std::unique_ptr<FSpatialIndex> FSpatialIndex::Create(ESpatialIndexType Type)
+{
+	switch (Type)
+	{
+	case ESpatialIndexType::HashGrid:
+		return std::make_unique<FSpatialHashGrid>();
+	case ESpatialIndexType::LooseOctree:
+	default:
+		return std::make_unique<FLooseOctree>();
+	}
+}
+
+int32 FSpatialIndex::AllocateElement(const FBox& Box, void* UserData)
+{
+	int32 Id;
+	if (FreeList != INDEX_NONE)
+	{
+		Id = FreeList;
+		FreeList = Elements[Id].Slot;
+	}
+	else
+	{
+		Id = Elements.Add(FElement());
+	}
+
+	FElement& Element = Elements[Id];
+	Element.Box = Box;
+	Element.UserData = UserData;
+	Element.Slot = INDEX_NONE;
+	Element.IndexInSlot = INDEX_NONE;
+	++NumElements;
+	return Id;
+}
+
+void FSpatialIndex::FreeElement(int32 Id)
+{
+	FElement& Element = Elements[Id];
+	Element.UserData = nullptr;
+	Element.Slot = FreeList;
+	Element.IndexInSlot = INDEX_NONE;
+	FreeList = Id;
+	--NumElements;
+}
+
+void FSpatialIndex::ClearElements()
+{
+	Elements.Empty();
+	FreeList = INDEX_NONE;
+	NumElements = 0;
+}
+
+FSpatialIndex::FNearestCandidates::FNearestCandidates(int32 InCount, float MaxDistance)
+	: Count(InCount)
+	, MaxDistanceSquared(MaxDistance == FLT_MAX ? FLT_MAX : MaxDistance * MaxDistance)
+{
+	Heap.Reserve(Count);
+}
+
+void FSpatialIndex::FNearestCandidates::Consider(int32 Id, float DistanceSquared)
+{
+	if (Count <= 0 || DistanceSquared > MaxDistanceSquared)
+	{
+		return;
+	}
+
+	const FCandidate Candidate{DistanceSquared, Id};
+	if (Heap.Num() < Count)
+	{
+		Heap.Add(Candidate);
+		std::push_heap(Heap.GetData(), Heap.GetData() + Heap.Num());
+	}
+	else if (Candidate < Heap[0])
+	{
+		std::pop_heap(Heap.GetData(), Heap.GetData() + Heap.Num());
+		Heap[Heap.Num() - 1] = Candidate;
+		std::push_heap(Heap.GetData(), Heap.GetData() + Heap.Num());
+	}
+	else
+	{
+		return;
+	}
+
+	// 다 찼으면 가장 먼 후보보다 멀리 있는 것은 볼 필요 없음
+	if (Heap.Num() == Count)
+	{
+		MaxDistanceSquared = Heap[0].DistanceSquared;
+	}
+}
+
+void FSpatialIndex::FNearestCandidates::Write(TArray<int32>& OutIds)
+{
+	std::sort_heap(Heap.GetData(), Heap.GetData() + Heap.Num());
+
+	OutIds.SetNum(Heap.Num());
+	for (int32 Index = 0; Index < Heap.Num(); ++Index)
+	{
+		OutIds[Index] = Heap[Index].Id;
+	}
+}
@@ -0,0 +1,116 @@
+#pragma once
+#include <cfloat>
+#include <memory>
+
+#include "BoxSphereBounds.h"
+#include "Frustum.h"
+#include "Core/Container/Array.h"
+#include "Core/Container/String.h"
+#include "Core/HAL/PlatformType.h"
+
+
+enum class ESpatialIndexType : uint8
+{
+	LooseOctree,
+	HashGrid,
+};
+
+/**
+ * World의 범위 Query용 공간 Index (Sphere / Box / Frustum Overlap, K Nearest)
+ *
+ * - 원소는 Box와 UserData로 넣고, Add가 돌려준 Id로 갱신 / 제거합니다. Id는 Remove 전까지 바뀌지 않습니다.
+ * - Query 결과는 호출한 쪽의 배열을 비우고 Id로 채웁니다. 배열을 재사용하면 매번 할당하지 않습니다.
+ * - Box 판정은 FDynamicAABBTree와 같은 Box 그대로라서, 전부 검사한 결과와 같은 원소가 나옵니다. (순서는 다름)
+ * - Query 중에 Index를 수정하면 안 됩니다. Query끼리는 여러 스레드에서 동시에 해도 됩니다.
+ */
+class FSpatialIndex
+{
+public:
+	virtual ~FSpatialIndex() = default;
+
+	static std::unique_ptr<FSpatialIndex> Create(ESpatialIndexType Type);
+
+	virtual ESpatialIndexType GetType() const = 0;
+	virtual const char* GetName() const = 0;
+
+	virtual int32 Add(const FBox& Box, void* UserData) = 0;
+	virtual void Update(int32 Id, const FBox& Box) = 0;
+	virtual void Remove(int32 Id) = 0;
+	virtual void Clear() = 0;
+
+	/** Box와 겹치는 원소 */
+	virtual void QueryBox(const FBox& Box, TArray<int32>& OutIds) const = 0;
+
+	/** 구와 겹치는 원소 (원소 Box까지의 거리 <= Radius) */
+	virtual void QuerySphere(const FVector& Center, float Radius, TArray<int32>& OutIds) const = 0;
+
+	/** Frustum과 겹치는 원소 (FFrustum::IntersectBox 기준) */
+	virtual void QueryFrustum(const FFrustum& Frustum, TArray<int32>& OutIds) const = 0;
+
+	/**
+	 * Point에서 Box까지 가까운 순서로 최대 Count개, 가까운 것이 앞에 옵니다.
+	 * 거리가 같으면 Id가 작은 것이 먼저라서 구조와 관계없이 결과가 같습니다.
+	 */
+	virtual void QueryNearest(const FVector& Point, int32 Count, TArray<int32>& OutIds, float MaxDistance = FLT_MAX) const = 0;
+
+	void* GetUserData(int32 Id) const { return Elements[Id].UserData; }
+	const FBox& GetBox(int32 Id) const { return Elements[Id].Box; }
+	int32 Num() const { return NumElements; }
+
+protected:
+	struct FElement
+	{
+		FBox Box;
+		void* UserData = nullptr;
+
+		/** 들어 있는 Node / Cell, Free List 안이면 다음 빈 원소 */
+		int32 Slot = INDEX_NONE;
+
+		/** Slot의 원소 목록 안에서의 위치 */
+		int32 IndexInSlot = INDEX_NONE;
+	};
+
+	/** K Nearest의 후보, 가장 먼 것을 Heap 위에 둡니다. */
+	class FNearestCandidates
+	{
+	public:
+		FNearestCandidates(int32 InCount, float MaxDistance);
+
+		/** 지금 후보에 들어갈 수 있는 최대 거리 제곱 */
+		float GetMaxDistanceSquared() const { return MaxDistanceSquared; }
+
+		void Consider(int32 Id, float DistanceSquared);
+
+		/** 가까운 순서로 OutIds에 씁니다. */
+		void Write(TArray<int32>& OutIds);
+
+	private:
+		struct FCandidate
+		{
+			float DistanceSquared;
+			int32 Id;
+
+			bool operator<(const FCandidate& Other) const
+			{
+				return DistanceSquared < Other.DistanceSquared || (DistanceSquared == Other.DistanceSquared && Id < Other.Id);
+			}
+		};
+
+		TArray<FCandidate> Heap;
+		int32 Count;
+		float MaxDistanceSquared;
+	};
+
+	int32 AllocateElement(const FBox& Box, void* UserData);
+	void FreeElement(int32 Id);
+	void ClearElements();
+
+	static float DistanceSquared(const FBox& Box, const FVector& Point) { return Box.ComputeSquaredDIstanceToPoint(Point); }
+
+	static float MaxComponent(const FVector& Vector) { return FMath::Max(Vector.X, FMath::Max(Vector.Y, Vector.Z)); }
+
+protected:
+	TArray<FElement> Elements;
+	int32 FreeList = INDEX_NONE;
+	int32 NumElements = 0;
+};
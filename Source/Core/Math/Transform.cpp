@@ -1,5 +1,41 @@
 #include "Transform.h"
 
+FMatrix FTransform::GetMatrix() const
+{
+	// S * R * T에서 S는 대각, T는 마지막 행만 있으므로
+	// i행 = R의 i행 * Scale[i], 3행 = (Position, 1)
+	FMatrix Result = FMatrix::GetRotateMatrix(Rotation);
+	const float ScaleXYZ[3] = { Scale.X, Scale.Y, Scale.Z };
+	for (int i = 0; i < 3; ++i)
+	{
+		Result.M[i][0] *= ScaleXYZ[i];
+		Result.M[i][1] *= ScaleXYZ[i];
+		Result.M[i][2] *= ScaleXYZ[i];
+	}
+	Result.M[3][0] = Position.X;
+	Result.M[3][1] = Position.Y;
+	Result.M[3][2] = Position.Z;
+	return Result;
+}
+
+FTransform FTransform::Blend(const FTransform& A, const FTransform& B, float Alpha)
+{
+	return FTransform(
+		FMath::Lerp(A.Position, B.Position, Alpha),
+		FQuat::Slerp(A.Rotation, B.Rotation, Alpha),
+		FMath::Lerp(A.Scale, B.Scale, Alpha)
+	);
+}
+
+FMatrix FTransform::GetLocalMatrixWithOutScale() const
+{
+	FMatrix Result = FMatrix::GetRotateMatrix(Rotation);
+	Result.M[3][0] = Position.X;
+	Result.M[3][1] = Position.Y;
+	Result.M[3][2] = Position.Z;
+	return Result;
+}
+
 FTransform FTransform::ConstructTransformFromMatrixWithDesiredScale(const FMatrix& InMatrix, const FVector& DesiredScale) const
 {
 	// 1. Translation 추출  
@@ -123,19 +123,11 @@ public:
 
 	// 전체 변환 행렬을 반환하는 함수
 	// 구성 순서: Scale 행렬 * Rotation 행렬 * Translation 행렬
-	FMatrix GetMatrix() const
-	{
-		return FMatrix::GetScaleMatrix(Scale.X, Scale.Y, Scale.Z)
-			* FMatrix::GetRotateMatrix(Rotation)
-			* FMatrix::GetTranslateMatrix(Position.X, Position.Y, Position.Z);
-	}
+	// 행렬 곱 없이 쿼터니언으로 만든 회전 행렬의 각 행에 Scale을 곱하고, 마지막 행에 Translation을 바로 채움
+	FMatrix GetMatrix() const;
 
 	// 스케일을 제외한 로컬 변환 행렬(회전 및 이동만 적용된 행렬)을 반환하는 함수
-	FMatrix GetLocalMatrixWithOutScale() const
-	{
-		return FMatrix::GetRotateMatrix(Rotation)
-			* FMatrix::GetTranslateMatrix(Position.X, Position.Y, Position.Z);
-	}
+	FMatrix GetLocalMatrixWithOutScale() const;
 
 	// 객체가 바라보는 전방 벡터를 반환하는 함수
 	// 쿼터니언을 회전 행렬로 변환한 후, 회전 행렬의 첫 번째 열(Forward 벡터)을 추출
@@ -290,6 +282,10 @@ public:
 		return Result;
 	}
 
+	// 두 변환 사이를 보간하는 함수 (위치, 스케일은 선형, 회전은 Slerp)
+	// Alpha가 0이면 A, 1이면 B
+	static FTransform Blend(const FTransform& A, const FTransform& B, float Alpha);
+
 	// 4D 벡터를 이 변환으로 변환하는 함수.
 	// 입력 벡터의 W 값이 1이면 점(위치), 0이면 방향으로 취급한다.
 	// 변환 공식: V' = Q.Rotate(S * V) + T, 단 x,y,z에만 적용되고, Translation은 W에 따라 적용됨.
@@ -0,0 +1,415 @@
+#include "TransformHierarchy.h"
+
+#include "Core/Async/ParallelAlgorithms.h"
+
+
+int32 FTransformHierarchy::Add(const FTransform& LocalTransform, int32 ParentHandle, void* InUserData)
+{
+	int32 Handle;
+	if (FreeHandles.Num() > 0)
+	{
+		Handle = FreeHandles[FreeHandles.Num() - 1];
+		FreeHandles.RemoveAt(FreeHandles.Num() - 1);
+	}
+	else
+	{
+		Handle = HandleToIndex.Add(INDEX_NONE);
+		ParentHandles.Add(INDEX_NONE);
+	}
+
+	// 일단 끝에 붙이고, 순서는 다음 Update의 RebuildOrder에서 맞춤
+	const int32 Index = LocalTransforms.Add(LocalTransform);
+	WorldTransforms.Add(LocalTransform);
+	PreviousWorldTransforms.Add(LocalTransform);
+	WorldMatrices.Add(FMatrix::Identity());
+	ParentIndices.Add(INDEX_NONE);
+	SubtreeEnds.Add(Index + 1);
+	RootOfIndex.Add(Index);
+	DirtyFlags.Add(1);
+	InterpolationStates.Add(EInterpolationState::Added);
+	UserData.Add(InUserData);
+	IndexToHandle.Add(Handle);
+
+	HandleToIndex[Handle] = Index;
+	ParentHandles[Handle] = ParentHandle;
+	bOrderDirty = true;
+	return Handle;
+}
+
+void FTransformHierarchy::Remove(int32 Handle)
+{
+	const int32 Index = HandleToIndex[Handle];
+	IndexToHandle[Index] = INDEX_NONE;
+	UserData[Index] = nullptr;
+
+	HandleToIndex[Handle] = INDEX_NONE;
+	ParentHandles[Handle] = INDEX_NONE;
+	PendingFreeHandles.Add(Handle);
+	bOrderDirty = true;
+}
+
+void FTransformHierarchy::SetParent(int32 Handle, int32 ParentHandle)
+{
+	if (ParentHandles[Handle] == ParentHandle)
+	{
+		return;
+	}
+
+	ParentHandles[Handle] = ParentHandle;
+	MarkDirty(HandleToIndex[Handle]);
+	bOrderDirty = true;
+}
+
+void FTransformHierarchy::SetLocalTransform(int32 Handle, const FTransform& LocalTransform)
+{
+	const int32 Index = HandleToIndex[Handle];
+	LocalTransforms[Index] = LocalTransform;
+	MarkDirty(Index);
+}
+
+void FTransformHierarchy::MarkDirty(int32 Index)
+{
+	if (DirtyFlags[Index] != 0)
+	{
+		return;
+	}
+
+	DirtyFlags[Index] = 1;
+
+	// 순서가 바뀌는 중이면 RebuildOrder에서 Dirty Root를 다시 모음
+	if (!bOrderDirty)
+	{
+		const int32 Root = RootOfIndex[Index];
+		if (RootDirtyFlags[Root] == 0)
+		{
+			RootDirtyFlags[Root] = 1;
+			DirtyRoots.Add(Root);
+		}
+	}
+}
+
+void FTransformHierarchy::Update(bool bInterpolate)
+{
+	UpdatedIndices.Empty();
+	if (bOrderDirty)
+	{
+		RebuildOrder();
+	}
+
+	if (DirtyRoots.Num() == 0)
+	{
+		return;
+	}
+
+	// Root 구간끼리는 겹치지 않으므로 따로 계산해도 됨
+	ParallelAlgo::ParallelForChunked(DirtyRoots.Num(), [this](int32 Begin, int32 End)
+	{
+		for (int32 Index = Begin; Index < End; ++Index)
+		{
+			UpdateSubtree(DirtyRoots[Index]);
+		}
+	}, MinRootsPerJob);
+
+	for (const int32 Root : DirtyRoots)
+	{
+		RootDirtyFlags[Root] = 0;
+		for (int32 Index = Root; Index < SubtreeEnds[Root]; ++Index)
+		{
+			if (DirtyFlags[Index] != 0)
+			{
+				DirtyFlags[Index] = 0;
+				UpdatedIndices.Add(Index);
+			}
+		}
+	}
+	DirtyRoots.Empty();
+
+	// 보간 시작 값은 BeginFixedStep 때의 World Transform이므로, 한 Step에서 여러 번 바뀌어도 그대로 둠
+	for (const int32 Index : UpdatedIndices)
+	{
+		uint8& State = InterpolationStates[Index];
+		if (bInterpolate && State != EInterpolationState::Added)
+		{
+			if (State == EInterpolationState::Stable)
+			{
+				State = EInterpolationState::Moving;
+				InterpolatedIndices.Add(Index);
+			}
+		}
+		else
+		{
+			PreviousWorldTransforms[Index] = WorldTransforms[Index];
+			State = EInterpolationState::Stable;
+		}
+	}
+}
+
+void FTransformHierarchy::BeginFixedStep()
+{
+	for (const int32 Index : InterpolatedIndices)
+	{
+		PreviousWorldTransforms[Index] = WorldTransforms[Index];
+		if (InterpolationStates[Index] == EInterpolationState::Moving)
+		{
+			InterpolationStates[Index] = EInterpolationState::Stable;
+		}
+	}
+	InterpolatedIndices.Empty();
+}
+
+FTransform FTransformHierarchy::GetInterpolatedTransform(int32 Index, float Alpha) const
+{
+	if (InterpolationStates[Index] != EInterpolationState::Moving)
+	{
+		return WorldTransforms[Index];
+	}
+	return FTransform::Blend(PreviousWorldTransforms[Index], WorldTransforms[Index], Alpha);
+}
+
+void FTransformHierarchy::UpdateSubtree(int32 RootIndex)
+{
+	const int32 End = SubtreeEnds[RootIndex];
+	const FTransform* Locals = LocalTransforms.GetData();
+	const int32* Parents = ParentIndices.GetData();
+	FTransform* Worlds = WorldTransforms.GetData();
+	FMatrix* Matrices = WorldMatrices.GetData();
+	uint8* Dirty = DirtyFlags.GetData();
+
+	if (Dirty[RootIndex] != 0)
+	{
+		Worlds[RootIndex] = Locals[RootIndex];
+		Matrices[RootIndex] = Worlds[RootIndex].GetMatrix();
+	}
+
+	for (int32 Index = RootIndex + 1; Index < End; ++Index)
+	{
+		// 부모가 앞에 있으므로, 부모가 이번에 바뀌었으면 이미 Dirty가 켜져 있음
+		const int32 Parent = Parents[Index];
+		Dirty[Index] |= Dirty[Parent];
+		if (Dirty[Index] != 0)
+		{
+			Worlds[Index] = FTransform::MultiPly(Locals[Index], Worlds[Parent]);
+			Matrices[Index] = Worlds[Index].GetMatrix();
+		}
+	}
+}
+
+void FTransformHierarchy::RebuildOrder()
+{
+	bOrderDirty = false;
+
+	const int32 NumHandles = HandleToIndex.Num();
+	for (int32 Handle = 0; Handle < NumHandles; ++Handle)
+	{
+		// 지워진 부모에 붙어 있던 항목은 Root가 됨
+		const int32 ParentHandle = ParentHandles[Handle];
+		if (ParentHandle != INDEX_NONE && HandleToIndex[ParentHandle] == INDEX_NONE)
+		{
+			ParentHandles[Handle] = INDEX_NONE;
+		}
+	}
+
+	// 부모 Handle별 자식 목록 (Counting Sort), 지금 Index 순서를 유지해서 정렬이 크게 흔들리지 않게 함
+	ChildOffsets.Init(0, NumHandles + 1);
+	for (int32 Index = 0; Index < IndexToHandle.Num(); ++Index)
+	{
+		const int32 Handle = IndexToHandle[Index];
+		if (Handle != INDEX_NONE && ParentHandles[Handle] != INDEX_NONE)
+		{
+			++ChildOffsets[ParentHandles[Handle] + 1];
+		}
+	}
+	for (int32 Handle = 0; Handle < NumHandles; ++Handle)
+	{
+		ChildOffsets[Handle + 1] += ChildOffsets[Handle];
+	}
+	ChildHandles.SetNum(ChildOffsets[NumHandles]);
+	TraversalStack.Init(0, NumHandles);
+	for (int32 Index = 0; Index < IndexToHandle.Num(); ++Index)
+	{
+		const int32 Handle = IndexToHandle[Index];
+		if (Handle != INDEX_NONE && ParentHandles[Handle] != INDEX_NONE)
+		{
+			const int32 ParentHandle = ParentHandles[Handle];
+			ChildHandles[ChildOffsets[ParentHandle] + TraversalStack[ParentHandle]++] = Handle;
+		}
+	}
+
+	// Root마다 전위 순회, 부모 Handle이 순환하면 어느 Root에서도 닿지 않으므로 마지막에 Root로 붙임
+	NewOrder.Empty();
+	NewOrder.Reserve(IndexToHandle.Num());
+	auto VisitFrom = [this](int32 RootHandle)
+	{
+		TraversalStack.Empty();
+		TraversalStack.Add(RootHandle);
+		while (TraversalStack.Num() > 0)
+		{
+			const int32 Handle = TraversalStack[TraversalStack.Num() - 1];
+			TraversalStack.RemoveAt(TraversalStack.Num() - 1);
+			NewOrder.Add(Handle);
+
+			// 뒤에서부터 넣어야 꺼낼 때 원래 순서
+			for (int32 Child = ChildOffsets[Handle + 1] - 1; Child >= ChildOffsets[Handle]; --Child)
+			{
+				TraversalStack.Add(ChildHandles[Child]);
+			}
+		}
+	};
+	for (int32 Index = 0; Index < IndexToHandle.Num(); ++Index)
+	{
+		const int32 Handle = IndexToHandle[Index];
+		if (Handle != INDEX_NONE && ParentHandles[Handle] == INDEX_NONE)
+		{
+			VisitFrom(Handle);
+		}
+	}
+
+	int32 NumAlive = 0;
+	for (const int32 Handle : IndexToHandle)
+	{
+		NumAlive += Handle != INDEX_NONE ? 1 : 0;
+	}
+	if (NewOrder.Num() != NumAlive)
+	{
+		TArray<uint8> Visited;
+		Visited.Init(0, NumHandles);
+		for (const int32 Handle : NewOrder)
+		{
+			Visited[Handle] = 1;
+		}
+		for (const int32 Handle : IndexToHandle)
+		{
+			if (Handle != INDEX_NONE && Visited[Handle] == 0)
+			{
+				ParentHandles[Handle] = INDEX_NONE;
+				const int32 Begin = NewOrder.Num();
+				VisitFrom(Handle);
+				for (int32 Visit = Begin; Visit < NewOrder.Num(); ++Visit)
+				{
+					Visited[NewOrder[Visit]] = 1;
+				}
+			}
+		}
+	}
+
+	// 새 순서로 배열 재배치
+	const int32 NumNew = NewOrder.Num();
+	TArray<FTransform> NewLocals;
+	TArray<FTransform> NewWorlds;
+	TArray<FTransform> NewPreviousWorlds;
+	TArray<FMatrix> NewMatrices;
+	TArray<uint8> NewDirty;
+	TArray<uint8> NewInterpolationStates;
+	TArray<void*> NewUserData;
+	NewLocals.SetNum(NumNew);
+	NewWorlds.SetNum(NumNew);
+	NewPreviousWorlds.SetNum(NumNew);
+	NewMatrices.SetNum(NumNew);
+	NewDirty.SetNum(NumNew);
+	NewInterpolationStates.SetNum(NumNew);
+	NewUserData.SetNum(NumNew);
+	for (int32 NewIndex = 0; NewIndex < NumNew; ++NewIndex)
+	{
+		const int32 OldIndex = HandleToIndex[NewOrder[NewIndex]];
+		NewLocals[NewIndex] = LocalTransforms[OldIndex];
+		NewWorlds[NewIndex] = WorldTransforms[OldIndex];
+		NewPreviousWorlds[NewIndex] = PreviousWorldTransforms[OldIndex];
+		NewMatrices[NewIndex] = WorldMatrices[OldIndex];
+		NewDirty[NewIndex] = DirtyFlags[OldIndex];
+		NewInterpolationStates[NewIndex] = InterpolationStates[OldIndex];
+		NewUserData[NewIndex] = UserData[OldIndex];
+	}
+	LocalTransforms = std::move(NewLocals);
+	WorldTransforms = std::move(NewWorlds);
+	PreviousWorldTransforms = std::move(NewPreviousWorlds);
+	WorldMatrices = std::move(NewMatrices);
+	DirtyFlags = std::move(NewDirty);
+	InterpolationStates = std::move(NewInterpolationStates);
+	UserData = std::move(NewUserData);
+
+	IndexToHandle.SetNum(NumNew);
+	for (int32 NewIndex = 0; NewIndex < NumNew; ++NewIndex)
+	{
+		IndexToHandle[NewIndex] = NewOrder[NewIndex];
+		HandleToIndex[NewOrder[NewIndex]] = NewIndex;
+	}
+
+	// 부모 Index, Root, 구간 끝 (자식이 뒤에 있으므로 뒤에서부터 구간을 부모로 올림)
+	ParentIndices.SetNum(NumNew);
+	SubtreeEnds.SetNum(NumNew);
+	RootOfIndex.SetNum(NumNew);
+	RootIndices.Empty();
+	for (int32 Index = 0; Index < NumNew; ++Index)
+	{
+		const int32 ParentHandle = ParentHandles[IndexToHandle[Index]];
+		ParentIndices[Index] = ParentHandle == INDEX_NONE ? INDEX_NONE : HandleToIndex[ParentHandle];
+		SubtreeEnds[Index] = Index + 1;
+		if (ParentIndices[Index] == INDEX_NONE)
+		{
+			RootOfIndex[Index] = Index;
+			RootIndices.Add(Index);
+		}
+		else
+		{
+			RootOfIndex[Index] = RootOfIndex[ParentIndices[Index]];
+		}
+	}
+	for (int32 Index = NumNew - 1; Index >= 0; --Index)
+	{
+		const int32 Parent = ParentIndices[Index];
+		if (Parent != INDEX_NONE)
+		{
+			SubtreeEnds[Parent] = FMath::Max(SubtreeEnds[Parent], SubtreeEnds[Index]);
+		}
+	}
+
+	// Dirty Root와 보간 중인 항목을 새 Index로 다시 모음
+	RootDirtyFlags.Init(0, NumNew);
+	DirtyRoots.Empty();
+	InterpolatedIndices.Empty();
+	for (int32 Index = 0; Index < NumNew; ++Index)
+	{
+		if (InterpolationStates[Index] == EInterpolationState::Moving)
+		{
+			InterpolatedIndices.Add(Index);
+		}
+
+		const int32 Root = RootOfIndex[Index];
+		if (DirtyFlags[Index] != 0 && RootDirtyFlags[Root] == 0)
+		{
+			RootDirtyFlags[Root] = 1;
+			DirtyRoots.Add(Root);
+		}
+	}
+
+	for (const int32 Handle : PendingFreeHandles)
+	{
+		FreeHandles.Add(Handle);
+	}
+	PendingFreeHandles.Empty();
+}
+
+void FTransformHierarchy::Clear()
+{
+	LocalTransforms.Empty();
+	WorldTransforms.Empty();
+	PreviousWorldTransforms.Empty();
+	WorldMatrices.Empty();
+	ParentIndices.Empty();
+	SubtreeEnds.Empty();
+	RootOfIndex.Empty();
+	DirtyFlags.Empty();
+	InterpolationStates.Empty();
+	UserData.Empty();
+	IndexToHandle.Empty();
+	HandleToIndex.Empty();
+	ParentHandles.Empty();
+	FreeHandles.Empty();
+	PendingFreeHandles.Empty();
+	RootIndices.Empty();
+	DirtyRoots.Empty();
+	RootDirtyFlags.Empty();
+	UpdatedIndices.Empty();
+	InterpolatedIndices.Empty();
+	bOrderDirty = false;
+}
@@ -0,0 +1,118 @@
+#pragma once
+#include "Matrix.h"
+#include "Transform.h"
+#include "Core/Container/Array.h"
+#include "Core/Container/String.h"
+#include "Core/HAL/PlatformType.h"
+
+
+/**
+ * 부모-자식 Transform을 연속된 배열(SoA)로 들고 World Transform을 한 번에 갱신하는 저장소
+ *
+ * - 항목 하나가 Scene Component 하나이고, 밖에서는 바뀌지 않는 Handle로 가리킵니다.
+ * - Local Transform, World Transform, World Matrix, 부모 Index, Dirty를 각각 배열로 두고
+ *   Root마다 자손이 바로 뒤에 이어지는 전위 순서로 정렬합니다. (부모가 항상 자식보다 앞)
+ * - 갱신은 Dirty가 있는 Root의 구간만 앞에서부터 한 번 훑고, Root 구간끼리는 FJobSystem으로 나눠서 실행합니다.
+ * - World = FTransform::MultiPly(Local, ParentWorld)로 USceneComponent와 같은 계산이라 결과가 비트 단위로 같습니다.
+ * - Fixed Step 사이 렌더링 보간을 위해, 마지막 Fixed Step에서 움직인 항목은 그 Step 전의 World Transform을 같이 들고 있습니다.
+ */
+class FTransformHierarchy
+{
+public:
+	/** 한 Job에 맡길 최소 Root 구간 수 */
+	static constexpr int32 MinRootsPerJob = 16;
+
+	FTransformHierarchy() = default;
+
+	/** @return Handle, Remove 전까지 바뀌지 않습니다. 다음 Update에서 World가 계산됩니다. */
+	int32 Add(const FTransform& LocalTransform, int32 ParentHandle, void* UserData);
+	void Remove(int32 Handle);
+
+	/** ParentHandle이 INDEX_NONE이면 Root */
+	void SetParent(int32 Handle, int32 ParentHandle);
+	void SetLocalTransform(int32 Handle, const FTransform& LocalTransform);
+
+	/**
+	 * 구조가 바뀌었으면 다시 정렬하고, Dirty인 항목과 그 자손의 World Transform / Matrix를 계산합니다.
+	 * 바뀐 항목의 Index는 GetUpdatedIndices로 얻고, 다음 Update나 구조 변경 전까지 유효합니다.
+	 * @param bInterpolate true면 Fixed Step의 갱신, 바뀐 항목은 이전 World Transform에서 보간됨, false면 보간 없이 바로 옮겨짐
+	 */
+	void Update(bool bInterpolate = false);
+
+	const TArray<int32>& GetUpdatedIndices() const { return UpdatedIndices; }
+
+	/** 다음 Fixed Step을 시작하기 전에 호출, 지금 World Transform을 보간의 시작 값으로 삼음 */
+	void BeginFixedStep();
+
+	/** 마지막 Fixed Step에서 움직여서 보간이 필요한 항목, 중복이나 이미 보간이 끝난 항목이 섞여 있을 수 있으므로 IsInterpolated로 확인 */
+	const TArray<int32>& GetInterpolatedIndices() const { return InterpolatedIndices; }
+	bool IsInterpolated(int32 Index) const { return InterpolationStates[Index] == EInterpolationState::Moving; }
+
+	/** 마지막 Fixed Step 전과 후의 World Transform 사이, Alpha가 0이면 이전, 1이면 지금 */
+	FTransform GetInterpolatedTransform(int32 Index, float Alpha) const;
+
+	int32 Num() const { return LocalTransforms.Num(); }
+	int32 GetNumRoots() const { return RootIndices.Num(); }
+	bool HasPendingUpdates() const { return bOrderDirty || DirtyRoots.Num() > 0; }
+
+	int32 GetIndex(int32 Handle) const { return HandleToIndex[Handle]; }
+	void* GetUserData(int32 Index) const { return UserData[Index]; }
+	int32 GetParentIndex(int32 Index) const { return ParentIndices[Index]; }
+	int32 GetRootIndex(int32 Index) const { return RootOfIndex[Index]; }
+	const FTransform& GetLocalTransform(int32 Index) const { return LocalTransforms[Index]; }
+	const FTransform& GetWorldTransform(int32 Index) const { return WorldTransforms[Index]; }
+	const FMatrix& GetWorldMatrix(int32 Index) const { return WorldMatrices[Index]; }
+
+	void Clear();
+
+private:
+	enum EInterpolationState : uint8
+	{
+		Stable,  // PreviousWorldTransform == WorldTransform
+		Moving,  // 마지막 Fixed Step에서 움직임
+		Added,   // 아직 World가 계산되지 않음, 첫 Update에서 보간 없이 자리 잡음
+	};
+
+	void MarkDirty(int32 Index);
+
+	/** 살아 있는 항목을 Root별 전위 순서로 다시 배치하고, 부모 Index / 구간 / Dirty Root를 다시 계산 */
+	void RebuildOrder();
+
+	/** Root 구간 [Root, SubtreeEnd) 안의 Dirty를 자식으로 퍼뜨리면서 World를 계산 */
+	void UpdateSubtree(int32 RootIndex);
+
+private:
+	//~ Index별 (전위 순서)
+	TArray<FTransform> LocalTransforms;
+	TArray<FTransform> WorldTransforms;
+	TArray<FTransform> PreviousWorldTransforms;
+	TArray<FMatrix> WorldMatrices;
+	TArray<int32> ParentIndices;
+	TArray<int32> SubtreeEnds;
+	TArray<int32> RootOfIndex;
+	TArray<uint8> DirtyFlags;
+	TArray<uint8> InterpolationStates;
+	TArray<void*> UserData;
+	TArray<int32> IndexToHandle; // 지워진 항목은 INDEX_NONE (다음 RebuildOrder에서 빠짐)
+
+	//~ Handle별
+	TArray<int32> HandleToIndex;
+	TArray<int32> ParentHandles;
+	TArray<int32> FreeHandles;
+	TArray<int32> PendingFreeHandles; // RebuildOrder 전에 재사용하면 옛 자식이 새 항목에 붙으므로 미뤄 둠
+
+	TArray<int32> RootIndices;
+	TArray<int32> DirtyRoots;
+	TArray<uint8> RootDirtyFlags;
+	TArray<int32> UpdatedIndices;
+	TArray<int32> InterpolatedIndices;
+
+	/** 항목 추가 / 제거 / 부모 변경 뒤 RebuildOrder 필요 */
+	bool bOrderDirty = false;
+
+	//~ RebuildOrder에서 재사용하는 임시 배열
+	TArray<int32> ChildOffsets;
+	TArray<int32> ChildHandles;
+	TArray<int32> NewOrder;
+	TArray<int32> TraversalStack;
+};
@@ -0,0 +1,371 @@
+#pragma once
+#include <cmath>
+#include <cstring>
+
+#include "Core/HAL/PlatformType.h"
+
+#if PLATFORM_ENABLE_VECTORINTRINSICS
+#include <immintrin.h>
+#elif PLATFORM_ENABLE_VECTORINTRINSICS_NEON
+#include <arm_neon.h>
+#endif
+
+
+/**
+ * float 4개짜리 SIMD Register 추상화
+ *
+ * SSE2(x64 기본), NEON(ARM64), 둘 다 없으면 float[4] 스칼라로 같은 연산을 합니다.
+ * 곱셈과 덧셈은 FMA로 합치지 않고 따로 하므로, 같은 순서로 계산하는 스칼라 코드와 결과가 비트 단위로 같습니다.
+ */
+#if PLATFORM_ENABLE_VECTORINTRINSICS
+using VectorRegister4Float = __m128;
+#elif PLATFORM_ENABLE_VECTORINTRINSICS_NEON
+using VectorRegister4Float = float32x4_t;
+#else
+struct alignas(16) VectorRegister4Float
+{
+	float V[4];
+};
+#endif
+
+
+/** Lane 값을 배열로 꺼냄 (NEON과 스칼라 경로의 Shuffle 구현용) */
+struct alignas(16) FVectorLanes
+{
+	float V[4];
+};
+
+
+#if PLATFORM_ENABLE_VECTORINTRINSICS
+//~ SSE2
+FORCEINLINE VectorRegister4Float VectorZero() { return _mm_setzero_ps(); }
+FORCEINLINE VectorRegister4Float VectorSetFloat1(float Value) { return _mm_set1_ps(Value); }
+FORCEINLINE VectorRegister4Float VectorSet(float X, float Y, float Z, float W) { return _mm_setr_ps(X, Y, Z, W); }
+FORCEINLINE VectorRegister4Float VectorLoad(const float* Src) { return _mm_loadu_ps(Src); }
+FORCEINLINE VectorRegister4Float VectorLoadAligned(const float* Src) { return _mm_load_ps(Src); }
+FORCEINLINE void VectorStore(const VectorRegister4Float& Value, float* Dest) { _mm_storeu_ps(Dest, Value); }
+FORCEINLINE void VectorStoreAligned(const VectorRegister4Float& Value, float* Dest) { _mm_store_ps(Dest, Value); }
+
+FORCEINLINE VectorRegister4Float VectorAdd(const VectorRegister4Float& A, const VectorRegister4Float& B) { return _mm_add_ps(A, B); }
+FORCEINLINE VectorRegister4Float VectorSubtract(const VectorRegister4Float& A, const VectorRegister4Float& B) { return _mm_sub_ps(A, B); }
+FORCEINLINE VectorRegister4Float VectorMultiply(const VectorRegister4Float& A, const VectorRegister4Float& B) { return _mm_mul_ps(A, B); }
+FORCEINLINE VectorRegister4Float VectorDivide(const VectorRegister4Float& A, const VectorRegister4Float& B) { return _mm_div_ps(A, B); }
+FORCEINLINE VectorRegister4Float VectorMin(const VectorRegister4Float& A, const VectorRegister4Float& B) { return _mm_min_ps(A, B); }
+FORCEINLINE VectorRegister4Float VectorMax(const VectorRegister4Float& A, const VectorRegister4Float& B) { return _mm_max_ps(A, B); }
+FORCEINLINE VectorRegister4Float VectorAbs(const VectorRegister4Float& A) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), A); }
+FORCEINLINE float VectorGetComponent0(const VectorRegister4Float& Value) { return _mm_cvtss_f32(Value); }
+
+/** (A[X], A[Y], A[Z], A[W]) */
+template <int X, int Y, int Z, int W>
+FORCEINLINE VectorRegister4Float VectorSwizzle(const VectorRegister4Float& A)
+{
+	return _mm_shuffle_ps(A, A, _MM_SHUFFLE(W, Z, Y, X));
+}
+
+/** (A[X], A[Y], B[Z], B[W]) */
+template <int X, int Y, int Z, int W>
+FORCEINLINE VectorRegister4Float VectorShuffle(const VectorRegister4Float& A, const VectorRegister4Float& B)
+{
+	return _mm_shuffle_ps(A, B, _MM_SHUFFLE(W, Z, Y, X));
+}
+//~ SSE2
+#elif PLATFORM_ENABLE_VECTORINTRINSICS_NEON
+//~ NEON
+FORCEINLINE VectorRegister4Float VectorZero() { return vdupq_n_f32(0.0f); }
+FORCEINLINE VectorRegister4Float VectorSetFloat1(float Value) { return vdupq_n_f32(Value); }
+FORCEINLINE VectorRegister4Float VectorSet(float X, float Y, float Z, float W)
+{
+	const float Values[4] = {X, Y, Z, W};
+	return vld1q_f32(Values);
+}
+FORCEINLINE VectorRegister4Float VectorLoad(const float* Src) { return vld1q_f32(Src); }
+FORCEINLINE VectorRegister4Float VectorLoadAligned(const float* Src) { return vld1q_f32(Src); }
+FORCEINLINE void VectorStore(const VectorRegister4Float& Value, float* Dest) { vst1q_f32(Dest, Value); }
+FORCEINLINE void VectorStoreAligned(const VectorRegister4Float& Value, float* Dest) { vst1q_f32(Dest, Value); }
+
+FORCEINLINE VectorRegister4Float VectorAdd(const VectorRegister4Float& A, const VectorRegister4Float& B) { return vaddq_f32(A, B); }
+FORCEINLINE VectorRegister4Float VectorSubtract(const VectorRegister4Float& A, const VectorRegister4Float& B) { return vsubq_f32(A, B); }
+FORCEINLINE VectorRegister4Float VectorMultiply(const VectorRegister4Float& A, const VectorRegister4Float& B) { return vmulq_f32(A, B); }
+FORCEINLINE VectorRegister4Float VectorDivide(const VectorRegister4Float& A, const VectorRegister4Float& B) { return vdivq_f32(A, B); }
+FORCEINLINE VectorRegister4Float VectorMin(const VectorRegister4Float& A, const VectorRegister4Float& B) { return vminq_f32(A, B); }
+FORCEINLINE VectorRegister4Float VectorMax(const VectorRegister4Float& A, const VectorRegister4Float& B) { return vmaxq_f32(A, B); }
+FORCEINLINE VectorRegister4Float VectorAbs(const VectorRegister4Float& A) { return vabsq_f32(A); }
+FORCEINLINE float VectorGetComponent0(const VectorRegister4Float& Value) { return vgetq_lane_f32(Value, 0); }
+
+template <int X, int Y, int Z, int W>
+FORCEINLINE VectorRegister4Float VectorSwizzle(const VectorRegister4Float& A)
+{
+	FVectorLanes Lanes;
+	vst1q_f32(Lanes.V, A);
+	return VectorSet(Lanes.V[X], Lanes.V[Y], Lanes.V[Z], Lanes.V[W]);
+}
+
+template <int X, int Y, int Z, int W>
+FORCEINLINE VectorRegister4Float VectorShuffle(const VectorRegister4Float& A, const VectorRegister4Float& B)
+{
+	FVectorLanes LanesA, LanesB;
+	vst1q_f32(LanesA.V, A);
+	vst1q_f32(LanesB.V, B);
+	return VectorSet(LanesA.V[X], LanesA.V[Y], LanesB.V[Z], LanesB.V[W]);
+}
+//~ NEON
+#else
+//~ 스칼라
+FORCEINLINE VectorRegister4Float VectorZero() { return {{0.0f, 0.0f, 0.0f, 0.0f}}; }
+FORCEINLINE VectorRegister4Float VectorSetFloat1(float Value) { return {{Value, Value, Value, Value}}; }
+FORCEINLINE VectorRegister4Float VectorSet(float X, float Y, float Z, float W) { return {{X, Y, Z, W}}; }
+FORCEINLINE VectorRegister4Float VectorLoad(const float* Src) { return {{Src[0], Src[1], Src[2], Src[3]}}; }
+FORCEINLINE VectorRegister4Float VectorLoadAligned(const float* Src) { return VectorLoad(Src); }
+FORCEINLINE void VectorStore(const VectorRegister4Float& Value, float* Dest) { std::memcpy(Dest, Value.V, sizeof(Value.V)); }
+FORCEINLINE void VectorStoreAligned(const VectorRegister4Float& Value, float* Dest) { VectorStore(Value, Dest); }
+
+FORCEINLINE VectorRegister4Float VectorAdd(const VectorRegister4Float& A, const VectorRegister4Float& B) { return {{A.V[0] + B.V[0], A.V[1] + B.V[1], A.V[2] + B.V[2], A.V[3] + B.V[3]}}; }
+FORCEINLINE VectorRegister4Float VectorSubtract(const VectorRegister4Float& A, const VectorRegister4Float& B) { return {{A.V[0] - B.V[0], A.V[1] - B.V[1], A.V[2] - B.V[2], A.V[3] - B.V[3]}}; }
+FORCEINLINE VectorRegister4Float VectorMultiply(const VectorRegister4Float& A, const VectorRegister4Float& B) { return {{A.V[0] * B.V[0], A.V[1] * B.V[1], A.V[2] * B.V[2], A.V[3] * B.V[3]}}; }
+FORCEINLINE VectorRegister4Float VectorDivide(const VectorRegister4Float& A, const VectorRegister4Float& B) { return {{A.V[0] / B.V[0], A.V[1] / B.V[1], A.V[2] / B.V[2], A.V[3] / B.V[3]}}; }
+FORCEINLINE VectorRegister4Float VectorMin(const VectorRegister4Float& A, const VectorRegister4Float& B)
+{
+	return {{A.V[0] < B.V[0] ? A.V[0] : B.V[0], A.V[1] < B.V[1] ? A.V[1] : B.V[1], A.V[2] < B.V[2] ? A.V[2] : B.V[2], A.V[3] < B.V[3] ? A.V[3] : B.V[3]}};
+}
+FORCEINLINE VectorRegister4Float VectorMax(const VectorRegister4Float& A, const VectorRegister4Float& B)
+{
+	return {{A.V[0] > B.V[0] ? A.V[0] : B.V[0], A.V[1] > B.V[1] ? A.V[1] : B.V[1], A.V[2] > B.V[2] ? A.V[2] : B.V[2], A.V[3] > B.V[3] ? A.V[3] : B.V[3]}};
+}
+FORCEINLINE VectorRegister4Float VectorAbs(const VectorRegister4Float& A) { return {{std::fabs(A.V[0]), std::fabs(A.V[1]), std::fabs(A.V[2]), std::fabs(A.V[3])}}; }
+FORCEINLINE float VectorGetComponent0(const VectorRegister4Float& Value) { return Value.V[0]; }
+
+template <int X, int Y, int Z, int W>
+FORCEINLINE VectorRegister4Float VectorSwizzle(const VectorRegister4Float& A)
+{
+	return {{A.V[X], A.V[Y], A.V[Z], A.V[W]}};
+}
+
+template <int X, int Y, int Z, int W>
+FORCEINLINE VectorRegister4Float VectorShuffle(const VectorRegister4Float& A, const VectorRegister4Float& B)
+{
+	return {{A.V[X], A.V[Y], B.V[Z], B.V[W]}};
+}
+//~ 스칼라
+#endif
+
+
+/** A * B + C (곱셈 결과를 반올림한 뒤 더함, FMA 아님) */
+FORCEINLINE VectorRegister4Float VectorMultiplyAdd(const VectorRegister4Float& A, const VectorRegister4Float& B, const VectorRegister4Float& C)
+{
+	return VectorAdd(VectorMultiply(A, B), C);
+}
+
+/** 모든 Lane을 A[Index]로 */
+template <int Index>
+FORCEINLINE VectorRegister4Float VectorReplicate(const VectorRegister4Float& A)
+{
+	return VectorSwizzle<Index, Index, Index, Index>(A);
+}
+
+/** (X, Y, Z, W) float 3개 + W */
+FORCEINLINE VectorRegister4Float VectorLoadFloat3(const float* Src, float W)
+{
+	return VectorSet(Src[0], Src[1], Src[2], W);
+}
+
+FORCEINLINE void VectorStoreFloat3(const VectorRegister4Float& Value, float* Dest)
+{
+	FVectorLanes Lanes;
+	VectorStoreAligned(Value, Lanes.V);
+	std::memcpy(Dest, Lanes.V, sizeof(float) * 3);
+}
+
+
+/**
+ * 4x4 행렬 연산 (행 우선, 행 벡터 규약 v * M)
+ * 16바이트 정렬된 float[4][4]를 받습니다. (FMatrix는 alignas(16))
+ */
+namespace VectorMatrix
+{
+	/**
+	 * Result = A * B, Result는 A나 B와 같아도 됨
+	 * 원소마다 A[i][0] * B[0][j] + A[i][1] * B[1][j] + A[i][2] * B[2][j] + A[i][3] * B[3][j] 순서로 더하므로 스칼라 삼중 루프와 결과가 같습니다.
+	 */
+	FORCEINLINE void Multiply(float (&Result)[4][4], const float (&A)[4][4], const float (&B)[4][4])
+	{
+#if PLATFORM_ENABLE_VECTORINTRINSICS && defined(__AVX__)
+		// 결과 두 행을 한 번에: [A[i] | A[i + 1]]의 각 128비트 절반에서 Lane을 Broadcast
+		const __m256 B0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(B[0]));
+		const __m256 B1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(B[1]));
+		const __m256 B2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(B[2]));
+		const __m256 B3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(B[3]));
+
+		const __m256 A01 = _mm256_loadu_ps(A[0]);
+		const __m256 A23 = _mm256_loadu_ps(A[2]);
+
+		__m256 R01 = _mm256_mul_ps(_mm256_shuffle_ps(A01, A01, 0x00), B0);
+		R01 = _mm256_add_ps(R01, _mm256_mul_ps(_mm256_shuffle_ps(A01, A01, 0x55), B1));
+		R01 = _mm256_add_ps(R01, _mm256_mul_ps(_mm256_shuffle_ps(A01, A01, 0xAA), B2));
+		R01 = _mm256_add_ps(R01, _mm256_mul_ps(_mm256_shuffle_ps(A01, A01, 0xFF), B3));
+
+		__m256 R23 = _mm256_mul_ps(_mm256_shuffle_ps(A23, A23, 0x00), B0);
+		R23 = _mm256_add_ps(R23, _mm256_mul_ps(_mm256_shuffle_ps(A23, A23, 0x55), B1));
+		R23 = _mm256_add_ps(R23, _mm256_mul_ps(_mm256_shuffle_ps(A23, A23, 0xAA), B2));
+		R23 = _mm256_add_ps(R23, _mm256_mul_ps(_mm256_shuffle_ps(A23, A23, 0xFF), B3));
+
+		_mm256_storeu_ps(Result[0], R01);
+		_mm256_storeu_ps(Result[2], R23);
+#else
+		const VectorRegister4Float B0 = VectorLoadAligned(B[0]);
+		const VectorRegister4Float B1 = VectorLoadAligned(B[1]);
+		const VectorRegister4Float B2 = VectorLoadAligned(B[2]);
+		const VectorRegister4Float B3 = VectorLoadAligned(B[3]);
+
+		VectorRegister4Float Rows[4];
+		for (int32 Row = 0; Row < 4; ++Row)
+		{
+			const VectorRegister4Float ARow = VectorLoadAligned(A[Row]);
+			VectorRegister4Float R = VectorMultiply(VectorReplicate<0>(ARow), B0);
+			R = VectorMultiplyAdd(VectorReplicate<1>(ARow), B1, R);
+			R = VectorMultiplyAdd(VectorReplicate<2>(ARow), B2, R);
+			R = VectorMultiplyAdd(VectorReplicate<3>(ARow), B3, R);
+			Rows[Row] = R;
+		}
+		for (int32 Row = 0; Row < 4; ++Row)
+		{
+			VectorStoreAligned(Rows[Row], Result[Row]);
+		}
+#endif
+	}
+
+	/** Result = Transpose(A), Result는 A와 같아도 됨 */
+	FORCEINLINE void Transpose(float (&Result)[4][4], const float (&A)[4][4])
+	{
+		const VectorRegister4Float Row0 = VectorLoadAligned(A[0]);
+		const VectorRegister4Float Row1 = VectorLoadAligned(A[1]);
+		const VectorRegister4Float Row2 = VectorLoadAligned(A[2]);
+		const VectorRegister4Float Row3 = VectorLoadAligned(A[3]);
+
+		// (00 01 10 11), (02 03 12 13), (20 21 30 31), (22 23 32 33)
+		const VectorRegister4Float T0 = VectorShuffle<0, 1, 0, 1>(Row0, Row1);
+		const VectorRegister4Float T1 = VectorShuffle<2, 3, 2, 3>(Row0, Row1);
+		const VectorRegister4Float T2 = VectorShuffle<0, 1, 0, 1>(Row2, Row3);
+		const VectorRegister4Float T3 = VectorShuffle<2, 3, 2, 3>(Row2, Row3);
+
+		VectorStoreAligned(VectorShuffle<0, 2, 0, 2>(T0, T2), Result[0]);
+		VectorStoreAligned(VectorShuffle<1, 3, 1, 3>(T0, T2), Result[1]);
+		VectorStoreAligned(VectorShuffle<0, 2, 0, 2>(T1, T3), Result[2]);
+		VectorStoreAligned(VectorShuffle<1, 3, 1, 3>(T1, T3), Result[3]);
+	}
+
+	/** 2x2 행렬 (a b c d) 곱 A * B */
+	FORCEINLINE VectorRegister4Float Mat2Multiply(const VectorRegister4Float& A, const VectorRegister4Float& B)
+	{
+		return VectorAdd(
+			VectorMultiply(A, VectorSwizzle<0, 3, 0, 3>(B)),
+			VectorMultiply(VectorSwizzle<1, 0, 3, 2>(A), VectorSwizzle<2, 1, 2, 1>(B))
+		);
+	}
+
+	/** 2x2 Adjugate(A) * B */
+	FORCEINLINE VectorRegister4Float Mat2AdjointMultiply(const VectorRegister4Float& A, const VectorRegister4Float& B)
+	{
+		return VectorSubtract(
+			VectorMultiply(VectorSwizzle<3, 3, 0, 0>(A), B),
+			VectorMultiply(VectorSwizzle<1, 1, 2, 2>(A), VectorSwizzle<2, 3, 0, 1>(B))
+		);
+	}
+
+	/** 2x2 A * Adjugate(B) */
+	FORCEINLINE VectorRegister4Float Mat2MultiplyAdjoint(const VectorRegister4Float& A, const VectorRegister4Float& B)
+	{
+		return VectorSubtract(
+			VectorMultiply(A, VectorSwizzle<3, 0, 3, 0>(B)),
+			VectorMultiply(VectorSwizzle<1, 0, 3, 2>(A), VectorSwizzle<2, 1, 2, 1>(B))
+		);
+	}
+
+	/**
+	 * 2x2 Block으로 나눈 역행렬 (M = [A B; C D])
+	 * 스칼라 여인수 전개와 계산 순서가 달라 마지막 자리 정도의 차이가 날 수 있습니다.
+	 * @return 행렬식, 절댓값이 SingularThreshold보다 작으면 Result를 쓰지 않습니다.
+	 */
+	FORCEINLINE float Inverse(float (&Result)[4][4], const float (&M)[4][4], float SingularThreshold)
+	{
+		const VectorRegister4Float Row0 = VectorLoadAligned(M[0]);
+		const VectorRegister4Float Row1 = VectorLoadAligned(M[1]);
+		const VectorRegister4Float Row2 = VectorLoadAligned(M[2]);
+		const VectorRegister4Float Row3 = VectorLoadAligned(M[3]);
+
+		const VectorRegister4Float A = VectorShuffle<0, 1, 0, 1>(Row0, Row1);
+		const VectorRegister4Float B = VectorShuffle<2, 3, 2, 3>(Row0, Row1);
+		const VectorRegister4Float C = VectorShuffle<0, 1, 0, 1>(Row2, Row3);
+		const VectorRegister4Float D = VectorShuffle<2, 3, 2, 3>(Row2, Row3);
+
+		// (|A|, |B|, |C|, |D|)
+		const VectorRegister4Float SubDeterminants = VectorSubtract(
+			VectorMultiply(VectorShuffle<0, 2, 0, 2>(Row0, Row2), VectorShuffle<1, 3, 1, 3>(Row1, Row3)),
+			VectorMultiply(VectorShuffle<1, 3, 1, 3>(Row0, Row2), VectorShuffle<0, 2, 0, 2>(Row1, Row3))
+		);
+		const VectorRegister4Float DetA = VectorReplicate<0>(SubDeterminants);
+		const VectorRegister4Float DetB = VectorReplicate<1>(SubDeterminants);
+		const VectorRegister4Float DetC = VectorReplicate<2>(SubDeterminants);
+		const VectorRegister4Float DetD = VectorReplicate<3>(SubDeterminants);
+
+		const VectorRegister4Float AdjDC = Mat2AdjointMultiply(D, C);
+		const VectorRegister4Float AdjAB = Mat2AdjointMultiply(A, B);
+
+		VectorRegister4Float X = VectorSubtract(VectorMultiply(DetD, A), Mat2Multiply(B, AdjDC));
+		VectorRegister4Float W = VectorSubtract(VectorMultiply(DetA, D), Mat2Multiply(C, AdjAB));
+		VectorRegister4Float Y = VectorSubtract(VectorMultiply(DetB, C), Mat2MultiplyAdjoint(D, AdjAB));
+		VectorRegister4Float Z = VectorSubtract(VectorMultiply(DetC, B), Mat2MultiplyAdjoint(A, AdjDC));
+
+		// |M| = |A||D| + |B||C| - tr((A#B)(D#C))
+		VectorRegister4Float Trace = VectorMultiply(AdjAB, VectorSwizzle<0, 2, 1, 3>(AdjDC));
+		Trace = VectorAdd(Trace, VectorSwizzle<2, 3, 0, 1>(Trace));
+		Trace = VectorAdd(Trace, VectorSwizzle<1, 0, 3, 2>(Trace));
+		const VectorRegister4Float Determinant = VectorSubtract(VectorAdd(VectorMultiply(DetA, DetD), VectorMultiply(DetB, DetC)), Trace);
+
+		const float DeterminantValue = VectorGetComponent0(Determinant);
+		if (!(DeterminantValue >= SingularThreshold || DeterminantValue <= -SingularThreshold))
+		{
+			return DeterminantValue;
+		}
+
+		const VectorRegister4Float InvDeterminant = VectorDivide(VectorSet(1.0f, -1.0f, -1.0f, 1.0f), Determinant);
+		X = VectorMultiply(X, InvDeterminant);
+		Y = VectorMultiply(Y, InvDeterminant);
+		Z = VectorMultiply(Z, InvDeterminant);
+		W = VectorMultiply(W, InvDeterminant);
+
+		// Adjugate를 취하면서 Block을 행으로 되돌림
+		VectorStoreAligned(VectorShuffle<3, 1, 3, 1>(X, Y), Result[0]);
+		VectorStoreAligned(VectorShuffle<2, 0, 2, 0>(X, Y), Result[1]);
+		VectorStoreAligned(VectorShuffle<3, 1, 3, 1>(Z, W), Result[2]);
+		VectorStoreAligned(VectorShuffle<2, 0, 2, 0>(Z, W), Result[3]);
+		return DeterminantValue;
+	}
+
+	/** (X, Y, Z, W) * M */
+	FORCEINLINE VectorRegister4Float TransformVector4(const VectorRegister4Float& V, const float (&M)[4][4])
+	{
+		VectorRegister4Float R = VectorMultiply(VectorReplicate<0>(V), VectorLoadAligned(M[0]));
+		R = VectorMultiplyAdd(VectorReplicate<1>(V), VectorLoadAligned(M[1]), R);
+		R = VectorMultiplyAdd(VectorReplicate<2>(V), VectorLoadAligned(M[2]), R);
+		R = VectorMultiplyAdd(VectorReplicate<3>(V), VectorLoadAligned(M[3]), R);
+		return R;
+	}
+
+	/** (X, Y, Z, 1) * M, 이동까지 적용 */
+	FORCEINLINE VectorRegister4Float TransformPosition(const VectorRegister4Float& V, const float (&M)[4][4])
+	{
+		VectorRegister4Float R = VectorMultiply(VectorReplicate<0>(V), VectorLoadAligned(M[0]));
+		R = VectorMultiplyAdd(VectorReplicate<1>(V), VectorLoadAligned(M[1]), R);
+		R = VectorMultiplyAdd(VectorReplicate<2>(V), VectorLoadAligned(M[2]), R);
+		return VectorAdd(R, VectorLoadAligned(M[3]));
+	}
+
+	/** (X, Y, Z, 0) * M, 방향 벡터 (이동 없음) */
+	FORCEINLINE VectorRegister4Float TransformDirection(const VectorRegister4Float& V, const float (&M)[4][4])
+	{
+		VectorRegister4Float R = VectorMultiply(VectorReplicate<0>(V), VectorLoadAligned(M[0]));
+		R = VectorMultiplyAdd(VectorReplicate<1>(V), VectorLoadAligned(M[1]), R);
+		R = VectorMultiplyAdd(VectorReplicate<2>(V), VectorLoadAligned(M[2]), R);
+		return R;
+	}
+}
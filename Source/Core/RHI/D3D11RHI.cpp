@@ -0,0 +1,220 @@
+#include "D3D11RHI.h"
+
+#include <cstring>
+
+#include "Debug/DebugConsole.h"
+
+using namespace D3D11RHI;
+
+
+ERHIPrimitiveTopology D3D11RHI::ToRHITopology(D3D11_PRIMITIVE_TOPOLOGY Topology)
+{
+	switch (Topology)
+	{
+	case D3D11_PRIMITIVE_TOPOLOGY_POINTLIST:     return ERHIPrimitiveTopology::PointList;
+	case D3D11_PRIMITIVE_TOPOLOGY_LINELIST:      return ERHIPrimitiveTopology::LineList;
+	case D3D11_PRIMITIVE_TOPOLOGY_LINESTRIP:     return ERHIPrimitiveTopology::LineStrip;
+	case D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP: return ERHIPrimitiveTopology::TriangleStrip;
+	default:                                     return ERHIPrimitiveTopology::TriangleList;
+	}
+}
+
+ERHIIndexFormat D3D11RHI::ToRHIIndexFormat(DXGI_FORMAT Format)
+{
+	return Format == DXGI_FORMAT_R16_UINT ? ERHIIndexFormat::UInt16 : ERHIIndexFormat::UInt32;
+}
+
+namespace
+{
+D3D11_PRIMITIVE_TOPOLOGY ToD3DTopology(ERHIPrimitiveTopology Topology)
+{
+	switch (Topology)
+	{
+	case ERHIPrimitiveTopology::PointList:     return D3D11_PRIMITIVE_TOPOLOGY_POINTLIST;
+	case ERHIPrimitiveTopology::LineList:      return D3D11_PRIMITIVE_TOPOLOGY_LINELIST;
+	case ERHIPrimitiveTopology::LineStrip:     return D3D11_PRIMITIVE_TOPOLOGY_LINESTRIP;
+	case ERHIPrimitiveTopology::TriangleStrip: return D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP;
+	default:                                   return D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
+	}
+}
+
+UINT ToD3DBindFlags(ERHIBufferUsage Usage)
+{
+	switch (Usage)
+	{
+	case ERHIBufferUsage::Vertex: return D3D11_BIND_VERTEX_BUFFER;
+	case ERHIBufferUsage::Index:  return D3D11_BIND_INDEX_BUFFER;
+	default:                      return D3D11_BIND_CONSTANT_BUFFER;
+	}
+}
+}
+
+
+FD3D11RHI::FD3D11RHI(ID3D11Device* InDevice, ID3D11DeviceContext* InDeviceContext)
+	: Device(InDevice)
+	, DeviceContext(InDeviceContext)
+{
+}
+
+FRHIBuffer* FD3D11RHI::CreateBuffer(ERHIBufferUsage Usage, uint32 Size, bool bDynamic, const void* InitialData)
+{
+	D3D11_BUFFER_DESC BufferInfo = {};
+	BufferInfo.BindFlags = ToD3DBindFlags(Usage);
+	BufferInfo.ByteWidth = Size;
+	BufferInfo.CPUAccessFlags = bDynamic ? D3D11_CPU_ACCESS_WRITE : 0;
+	BufferInfo.Usage = bDynamic ? D3D11_USAGE_DYNAMIC : D3D11_USAGE_DEFAULT;
+
+	D3D11_SUBRESOURCE_DATA Data = {};
+	Data.pSysMem = InitialData;
+
+	ID3D11Buffer* Buffer = nullptr;
+	if (S_OK != Device->CreateBuffer(&BufferInfo, InitialData ? &Data : nullptr, &Buffer))
+	{
+		MsgBoxAssert("Error: RHI CreateBuffer Failed");
+		return nullptr;
+	}
+	return ToRHI(Buffer);
+}
+
+void FD3D11RHI::ReleaseBuffer(FRHIBuffer* Buffer)
+{
+	if (Buffer)
+	{
+		ToD3D(Buffer)->Release();
+	}
+}
+
+void FD3D11RHI::UpdateBuffer(FRHIBuffer* Buffer, const void* Data, uint32 Size)
+{
+	D3D11_MAPPED_SUBRESOURCE Mapped = {};
+	if (S_OK != DeviceContext->Map(ToD3D(Buffer), 0, D3D11_MAP_WRITE_DISCARD, 0, &Mapped) || Mapped.pData == nullptr)
+	{
+		MsgBoxAssert("Error: not able to obtain the permission to modify the buffer");
+		return;
+	}
+
+	std::memcpy(Mapped.pData, Data, Size);
+	DeviceContext->Unmap(ToD3D(Buffer), 0);
+}
+
+bool FD3D11RHI::MapTexture(FRHITexture* Texture, ERHIMapMode Mode, FRHIMappedData& OutMapped)
+{
+	D3D11_MAPPED_SUBRESOURCE Mapped = {};
+	const D3D11_MAP MapType = Mode == ERHIMapMode::WriteDiscard ? D3D11_MAP_WRITE_DISCARD : D3D11_MAP_READ;
+	const UINT MapFlags = Mode == ERHIMapMode::ReadNoWait ? D3D11_MAP_FLAG_DO_NOT_WAIT : 0;
+	if (S_OK != DeviceContext->Map(ToD3D(Texture), 0, MapType, MapFlags, &Mapped))
+	{
+		return false;
+	}
+
+	OutMapped.Data = Mapped.pData;
+	OutMapped.RowPitch = Mapped.RowPitch;
+	return true;
+}
+
+void FD3D11RHI::UnmapTexture(FRHITexture* Texture)
+{
+	DeviceContext->Unmap(ToD3D(Texture), 0);
+}
+
+void FD3D11RHI::CopyTextureRegion(FRHITexture* Dest, uint32 DestX, uint32 DestY, FRHITexture* Source, const FRHIBox& SourceBox)
+{
+	const D3D11_BOX Box = {SourceBox.Left, SourceBox.Top, 0, SourceBox.Right, SourceBox.Bottom, 1};
+	DeviceContext->CopySubresourceRegion(ToD3D(Dest), 0, DestX, DestY, 0, ToD3D(Source), 0, &Box);
+}
+
+void FD3D11RHI::SetVertexBuffer(FRHIBuffer* Buffer, uint32 Stride, uint32 Offset)
+{
+	ID3D11Buffer* D3DBuffer = ToD3D(Buffer);
+	DeviceContext->IASetVertexBuffers(0, 1, &D3DBuffer, &Stride, &Offset);
+}
+
+void FD3D11RHI::SetIndexBuffer(FRHIBuffer* Buffer, ERHIIndexFormat Format, uint32 Offset)
+{
+	const DXGI_FORMAT D3DFormat = Format == ERHIIndexFormat::UInt16 ? DXGI_FORMAT_R16_UINT : DXGI_FORMAT_R32_UINT;
+	DeviceContext->IASetIndexBuffer(ToD3D(Buffer), D3DFormat, Offset);
+}
+
+void FD3D11RHI::SetPrimitiveTopology(ERHIPrimitiveTopology Topology)
+{
+	DeviceContext->IASetPrimitiveTopology(ToD3DTopology(Topology));
+}
+
+void FD3D11RHI::SetInputLayout(FRHIInputLayout* InputLayout)
+{
+	DeviceContext->IASetInputLayout(ToD3D(InputLayout));
+}
+
+void FD3D11RHI::SetVertexShader(FRHIVertexShader* Shader)
+{
+	DeviceContext->VSSetShader(ToD3D(Shader), nullptr, 0);
+}
+
+void FD3D11RHI::SetPixelShader(FRHIPixelShader* Shader)
+{
+	DeviceContext->PSSetShader(ToD3D(Shader), nullptr, 0);
+}
+
+void FD3D11RHI::SetConstantBuffer(ERHIShaderStage Stage, uint32 Slot, FRHIBuffer* Buffer)
+{
+	ID3D11Buffer* D3DBuffer = ToD3D(Buffer);
+	switch (Stage)
+	{
+	case ERHIShaderStage::Vertex:   DeviceContext->VSSetConstantBuffers(Slot, 1, &D3DBuffer); break;
+	case ERHIShaderStage::Pixel:    DeviceContext->PSSetConstantBuffers(Slot, 1, &D3DBuffer); break;
+	case ERHIShaderStage::Geometry: DeviceContext->GSSetConstantBuffers(Slot, 1, &D3DBuffer); break;
+	case ERHIShaderStage::Compute:  DeviceContext->CSSetConstantBuffers(Slot, 1, &D3DBuffer); break;
+	default: break;
+	}
+}
+
+void FD3D11RHI::SetShaderResource(ERHIShaderStage Stage, uint32 Slot, FRHIShaderResourceView* View)
+{
+	ID3D11ShaderResourceView* D3DView = ToD3D(View);
+	switch (Stage)
+	{
+	case ERHIShaderStage::Vertex:   DeviceContext->VSSetShaderResources(Slot, 1, &D3DView); break;
+	case ERHIShaderStage::Pixel:    DeviceContext->PSSetShaderResources(Slot, 1, &D3DView); break;
+	case ERHIShaderStage::Geometry: DeviceContext->GSSetShaderResources(Slot, 1, &D3DView); break;
+	case ERHIShaderStage::Compute:  DeviceContext->CSSetShaderResources(Slot, 1, &D3DView); break;
+	default: break;
+	}
+}
+
+void FD3D11RHI::SetSampler(ERHIShaderStage Stage, uint32 Slot, FRHISamplerState* Sampler)
+{
+	ID3D11SamplerState* D3DSampler = ToD3D(Sampler);
+	switch (Stage)
+	{
+	case ERHIShaderStage::Vertex:   DeviceContext->VSSetSamplers(Slot, 1, &D3DSampler); break;
+	case ERHIShaderStage::Pixel:    DeviceContext->PSSetSamplers(Slot, 1, &D3DSampler); break;
+	case ERHIShaderStage::Geometry: DeviceContext->GSSetSamplers(Slot, 1, &D3DSampler); break;
+	case ERHIShaderStage::Compute:  DeviceContext->CSSetSamplers(Slot, 1, &D3DSampler); break;
+	default: break;
+	}
+}
+
+void FD3D11RHI::SetRasterizerState(FRHIRasterizerState* State)
+{
+	DeviceContext->RSSetState(ToD3D(State));
+}
+
+void FD3D11RHI::SetBlendState(FRHIBlendState* State, const float* BlendFactor, uint32 SampleMask)
+{
+	DeviceContext->OMSetBlendState(ToD3D(State), BlendFactor, SampleMask);
+}
+
+void FD3D11RHI::SetDepthStencilState(FRHIDepthStencilState* State, uint32 StencilRef)
+{
+	DeviceContext->OMSetDepthStencilState(ToD3D(State), StencilRef);
+}
+
+void FD3D11RHI::Draw(uint32 VertexCount, uint32 StartVertex)
+{
+	DeviceContext->Draw(VertexCount, StartVertex);
+}
+
+void FD3D11RHI::DrawIndexed(uint32 IndexCount, uint32 StartIndex, int32 BaseVertex)
+{
+	DeviceContext->DrawIndexed(IndexCount, StartIndex, BaseVertex);
+}
@@ -0,0 +1,76 @@
+#pragma once
+#define _TCHAR_DEFINED  // TCHAR 재정의 에러 때문
+#include <d3d11.h>
+
+#include "RHI.h"
+
+
+/** D3D11 객체 <-> RHI 핸들 변환, D3D11 백엔드에서는 핸들이 곧 D3D11 객체 포인터입니다. */
+namespace D3D11RHI
+{
+inline FRHIBuffer* ToRHI(ID3D11Buffer* Buffer) { return reinterpret_cast<FRHIBuffer*>(Buffer); }
+inline FRHITexture* ToRHI(ID3D11Texture2D* Texture) { return reinterpret_cast<FRHITexture*>(Texture); }
+inline FRHIShaderResourceView* ToRHI(ID3D11ShaderResourceView* View) { return reinterpret_cast<FRHIShaderResourceView*>(View); }
+inline FRHIVertexShader* ToRHI(ID3D11VertexShader* Shader) { return reinterpret_cast<FRHIVertexShader*>(Shader); }
+inline FRHIPixelShader* ToRHI(ID3D11PixelShader* Shader) { return reinterpret_cast<FRHIPixelShader*>(Shader); }
+inline FRHIInputLayout* ToRHI(ID3D11InputLayout* InputLayout) { return reinterpret_cast<FRHIInputLayout*>(InputLayout); }
+inline FRHISamplerState* ToRHI(ID3D11SamplerState* Sampler) { return reinterpret_cast<FRHISamplerState*>(Sampler); }
+inline FRHIRasterizerState* ToRHI(ID3D11RasterizerState* State) { return reinterpret_cast<FRHIRasterizerState*>(State); }
+inline FRHIBlendState* ToRHI(ID3D11BlendState* State) { return reinterpret_cast<FRHIBlendState*>(State); }
+inline FRHIDepthStencilState* ToRHI(ID3D11DepthStencilState* State) { return reinterpret_cast<FRHIDepthStencilState*>(State); }
+
+inline ID3D11Buffer* ToD3D(FRHIBuffer* Buffer) { return reinterpret_cast<ID3D11Buffer*>(Buffer); }
+inline ID3D11Texture2D* ToD3D(FRHITexture* Texture) { return reinterpret_cast<ID3D11Texture2D*>(Texture); }
+inline ID3D11ShaderResourceView* ToD3D(FRHIShaderResourceView* View) { return reinterpret_cast<ID3D11ShaderResourceView*>(View); }
+inline ID3D11VertexShader* ToD3D(FRHIVertexShader* Shader) { return reinterpret_cast<ID3D11VertexShader*>(Shader); }
+inline ID3D11PixelShader* ToD3D(FRHIPixelShader* Shader) { return reinterpret_cast<ID3D11PixelShader*>(Shader); }
+inline ID3D11InputLayout* ToD3D(FRHIInputLayout* InputLayout) { return reinterpret_cast<ID3D11InputLayout*>(InputLayout); }
+inline ID3D11SamplerState* ToD3D(FRHISamplerState* Sampler) { return reinterpret_cast<ID3D11SamplerState*>(Sampler); }
+inline ID3D11RasterizerState* ToD3D(FRHIRasterizerState* State) { return reinterpret_cast<ID3D11RasterizerState*>(State); }
+inline ID3D11BlendState* ToD3D(FRHIBlendState* State) { return reinterpret_cast<ID3D11BlendState*>(State); }
+inline ID3D11DepthStencilState* ToD3D(FRHIDepthStencilState* State) { return reinterpret_cast<ID3D11DepthStencilState*>(State); }
+
+ERHIPrimitiveTopology ToRHITopology(D3D11_PRIMITIVE_TOPOLOGY Topology);
+ERHIIndexFormat ToRHIIndexFormat(DXGI_FORMAT Format);
+}
+
+
+/** Immediate Context로 바로 전달하는 D3D11 백엔드 */
+class FD3D11RHI : public FRHICommandContext
+{
+public:
+	FD3D11RHI(ID3D11Device* InDevice, ID3D11DeviceContext* InDeviceContext);
+
+public:
+	virtual const char* GetName() const override { return "D3D11"; }
+
+	virtual FRHIBuffer* CreateBuffer(ERHIBufferUsage Usage, uint32 Size, bool bDynamic, const void* InitialData) override;
+	virtual void ReleaseBuffer(FRHIBuffer* Buffer) override;
+	virtual void UpdateBuffer(FRHIBuffer* Buffer, const void* Data, uint32 Size) override;
+
+	virtual bool MapTexture(FRHITexture* Texture, ERHIMapMode Mode, FRHIMappedData& OutMapped) override;
+	virtual void UnmapTexture(FRHITexture* Texture) override;
+	virtual void CopyTextureRegion(FRHITexture* Dest, uint32 DestX, uint32 DestY, FRHITexture* Source, const FRHIBox& SourceBox) override;
+
+	virtual void SetVertexBuffer(FRHIBuffer* Buffer, uint32 Stride, uint32 Offset) override;
+	virtual void SetIndexBuffer(FRHIBuffer* Buffer, ERHIIndexFormat Format, uint32 Offset) override;
+	virtual void SetPrimitiveTopology(ERHIPrimitiveTopology Topology) override;
+	virtual void SetInputLayout(FRHIInputLayout* InputLayout) override;
+
+	virtual void SetVertexShader(FRHIVertexShader* Shader) override;
+	virtual void SetPixelShader(FRHIPixelShader* Shader) override;
+	virtual void SetConstantBuffer(ERHIShaderStage Stage, uint32 Slot, FRHIBuffer* Buffer) override;
+	virtual void SetShaderResource(ERHIShaderStage Stage, uint32 Slot, FRHIShaderResourceView* View) override;
+	virtual void SetSampler(ERHIShaderStage Stage, uint32 Slot, FRHISamplerState* Sampler) override;
+
+	virtual void SetRasterizerState(FRHIRasterizerState* State) override;
+	virtual void SetBlendState(FRHIBlendState* State, const float* BlendFactor, uint32 SampleMask) override;
+	virtual void SetDepthStencilState(FRHIDepthStencilState* State, uint32 StencilRef) override;
+
+	virtual void Draw(uint32 VertexCount, uint32 StartVertex) override;
+	virtual void DrawIndexed(uint32 IndexCount, uint32 StartIndex, int32 BaseVertex) override;
+
+private:
+	ID3D11Device* Device;
+	ID3D11DeviceContext* DeviceContext;
+};
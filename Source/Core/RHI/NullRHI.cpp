@@ -0,0 +1,286 @@
+#include "NullRHI.h"
+
+#include <cstring>
+
+#include "Debug/DebugConsole.h"
+
+
+FNullRHI::FNullRHI(bool bInValidate)
+	: bValidate(bInValidate)
+{
+}
+
+FNullRHI::~FNullRHI()
+{
+	for (FNullBuffer* Buffer : LiveBuffers)
+	{
+		delete Buffer;
+	}
+	LiveBuffers.clear();
+}
+
+FRHIBuffer* FNullRHI::CreateBuffer(ERHIBufferUsage Usage, uint32 Size, bool bDynamic, const void* InitialData)
+{
+	FNullBuffer* Buffer = new FNullBuffer{Usage, bDynamic, {}};
+	Buffer->Memory.SetNum(static_cast<int32>(Size));
+	if (InitialData && Size > 0)
+	{
+		std::memcpy(Buffer->Memory.GetData(), InitialData, Size);
+	}
+
+	LiveBuffers.insert(Buffer);
+	return reinterpret_cast<FRHIBuffer*>(Buffer);
+}
+
+void FNullRHI::ReleaseBuffer(FRHIBuffer* Buffer)
+{
+	FNullBuffer* NullBuffer = FindBuffer(Buffer);
+	if (NullBuffer == nullptr)
+	{
+		ReportError("ReleaseBuffer: unknown buffer");
+		return;
+	}
+
+	if (BoundVertexBuffer == Buffer)
+	{
+		BoundVertexBuffer = nullptr;
+	}
+	if (BoundIndexBuffer == Buffer)
+	{
+		BoundIndexBuffer = nullptr;
+	}
+
+	LiveBuffers.erase(NullBuffer);
+	delete NullBuffer;
+}
+
+void FNullRHI::UpdateBuffer(FRHIBuffer* Buffer, const void* Data, uint32 Size)
+{
+	++Stats.NumBufferUpdates;
+	Stats.UploadedBytes += Size;
+
+	if (Buffer == nullptr || Data == nullptr)
+	{
+		ReportError("UpdateBuffer: null buffer or data");
+		return;
+	}
+
+	FNullBuffer* NullBuffer = FindBuffer(Buffer);
+	if (NullBuffer == nullptr)
+	{
+		// 다른 백엔드에서 만든 핸들 (검증 불가) 이거나 해제된 버퍼
+		if (bValidate)
+		{
+			ReportError("UpdateBuffer: unknown buffer");
+		}
+		return;
+	}
+
+	if (bValidate && !NullBuffer->bDynamic)
+	{
+		ReportError("UpdateBuffer: buffer is not dynamic");
+	}
+	if (Size > static_cast<uint32>(NullBuffer->Memory.Num()))
+	{
+		ReportError("UpdateBuffer: size exceeds buffer");
+		return;
+	}
+
+	std::memcpy(NullBuffer->Memory.GetData(), Data, Size);
+}
+
+bool FNullRHI::MapTexture(FRHITexture* Texture, ERHIMapMode, FRHIMappedData& OutMapped)
+{
+	if (Texture == nullptr)
+	{
+		ReportError("MapTexture: null texture");
+		return false;
+	}
+
+	++NumMappedTextures;
+	std::memset(ReadbackScratch, 0, sizeof(ReadbackScratch));
+	OutMapped.Data = ReadbackScratch;
+	OutMapped.RowPitch = sizeof(ReadbackScratch);
+	return true;
+}
+
+void FNullRHI::UnmapTexture(FRHITexture*)
+{
+	if (NumMappedTextures <= 0)
+	{
+		ReportError("UnmapTexture: texture is not mapped");
+		return;
+	}
+	--NumMappedTextures;
+}
+
+void FNullRHI::CopyTextureRegion(FRHITexture* Dest, uint32, uint32, FRHITexture* Source, const FRHIBox& SourceBox)
+{
+	if (Dest == nullptr || Source == nullptr)
+	{
+		ReportError("CopyTextureRegion: null texture");
+	}
+	if (SourceBox.Right <= SourceBox.Left || SourceBox.Bottom <= SourceBox.Top)
+	{
+		ReportError("CopyTextureRegion: empty box");
+	}
+}
+
+void FNullRHI::SetVertexBuffer(FRHIBuffer* Buffer, uint32 Stride, uint32)
+{
+	++Stats.NumStateChanges;
+	BoundVertexBuffer = Buffer;
+
+	if (bValidate && Stride == 0)
+	{
+		ReportError("SetVertexBuffer: zero stride");
+	}
+}
+
+void FNullRHI::SetIndexBuffer(FRHIBuffer* Buffer, ERHIIndexFormat Format, uint32)
+{
+	++Stats.NumStateChanges;
+	BoundIndexBuffer = Buffer;
+	BoundIndexFormat = Format;
+}
+
+void FNullRHI::SetPrimitiveTopology(ERHIPrimitiveTopology)
+{
+	++Stats.NumStateChanges;
+	bTopologySet = true;
+}
+
+void FNullRHI::SetInputLayout(FRHIInputLayout* InputLayout)
+{
+	++Stats.NumStateChanges;
+	BoundInputLayout = InputLayout;
+}
+
+void FNullRHI::SetVertexShader(FRHIVertexShader* Shader)
+{
+	++Stats.NumStateChanges;
+	BoundVertexShader = Shader;
+}
+
+void FNullRHI::SetPixelShader(FRHIPixelShader* Shader)
+{
+	++Stats.NumStateChanges;
+	BoundPixelShader = Shader;
+}
+
+void FNullRHI::SetConstantBuffer(ERHIShaderStage, uint32 Slot, FRHIBuffer* Buffer)
+{
+	++Stats.NumStateChanges;
+
+	if (!bValidate)
+	{
+		return;
+	}
+	if (Slot >= 14) // D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT
+	{
+		ReportError("SetConstantBuffer: slot out of range");
+	}
+	if (const FNullBuffer* NullBuffer = FindBuffer(Buffer))
+	{
+		if (NullBuffer->Usage != ERHIBufferUsage::Constant)
+		{
+			ReportError("SetConstantBuffer: buffer is not a constant buffer");
+		}
+	}
+}
+
+void FNullRHI::SetShaderResource(ERHIShaderStage, uint32, FRHIShaderResourceView*)
+{
+	++Stats.NumStateChanges;
+}
+
+void FNullRHI::SetSampler(ERHIShaderStage, uint32, FRHISamplerState*)
+{
+	++Stats.NumStateChanges;
+}
+
+void FNullRHI::SetRasterizerState(FRHIRasterizerState*)
+{
+	++Stats.NumStateChanges;
+}
+
+void FNullRHI::SetBlendState(FRHIBlendState*, const float*, uint32)
+{
+	++Stats.NumStateChanges;
+}
+
+void FNullRHI::SetDepthStencilState(FRHIDepthStencilState*, uint32)
+{
+	++Stats.NumStateChanges;
+}
+
+void FNullRHI::Draw(uint32, uint32)
+{
+	++Stats.NumDrawCalls;
+	ValidateDraw(false);
+}
+
+void FNullRHI::DrawIndexed(uint32 IndexCount, uint32 StartIndex, int32)
+{
+	++Stats.NumDrawCalls;
+	Stats.NumIndices += IndexCount;
+
+	if (ValidateDraw(true))
+	{
+		// 이 백엔드에서 만든 인덱스 버퍼라면 범위도 확인
+		if (const FNullBuffer* IndexBuffer = FindBuffer(BoundIndexBuffer))
+		{
+			const uint32 IndexSize = BoundIndexFormat == ERHIIndexFormat::UInt16 ? sizeof(uint16) : sizeof(uint32);
+			if ((StartIndex + IndexCount) * IndexSize > static_cast<uint32>(IndexBuffer->Memory.Num()))
+			{
+				ReportError("DrawIndexed: index range exceeds index buffer");
+			}
+		}
+	}
+}
+
+FNullRHI::FNullBuffer* FNullRHI::FindBuffer(FRHIBuffer* Buffer) const
+{
+	FNullBuffer* NullBuffer = reinterpret_cast<FNullBuffer*>(Buffer);
+	return LiveBuffers.contains(NullBuffer) ? NullBuffer : nullptr;
+}
+
+void FNullRHI::ReportError(const char* Message)
+{
+	++Stats.NumErrors;
+	if (Stats.NumErrors <= MaxLoggedErrors)
+	{
+		UE_LOG("[NullRHI] %s", Message);
+	}
+}
+
+bool FNullRHI::ValidateDraw(bool bIndexed)
+{
+	if (!bValidate)
+	{
+		return false;
+	}
+
+	const uint64 ErrorsBefore = Stats.NumErrors;
+	if (BoundVertexBuffer == nullptr)
+	{
+		ReportError("Draw: no vertex buffer bound");
+	}
+	if (bIndexed && BoundIndexBuffer == nullptr)
+	{
+		ReportError("Draw: no index buffer bound");
+	}
+	if (BoundInputLayout == nullptr)
+	{
+		ReportError("Draw: no input layout bound");
+	}
+	if (BoundVertexShader == nullptr || BoundPixelShader == nullptr)
+	{
+		ReportError("Draw: shader not bound");
+	}
+	if (!bTopologySet)
+	{
+		ReportError("Draw: primitive topology not set");
+	}
+	return Stats.NumErrors == ErrorsBefore;
+}
@@ -0,0 +1,99 @@
+#pragma once
+#include <unordered_set>
+
+#include "RHI.h"
+#include "Core/Container/Array.h"
+
+
+/**
+ * GPU 없이 동작하는 RHI 백엔드
+ *
+ * - 버퍼 갱신은 CPU 메모리로 복사해서, 실제 업로드와 비슷한 CPU 비용을 냅니다.
+ * - bValidate가 true면 바인딩 상태와 핸들을 검사하고 잘못된 호출을 NumErrors로 셉니다.
+ * - Headless 실행, 렌더링 CPU 비용 측정에 사용합니다. 명령 기록은 FRHIRecordingContext로 감싸서 합니다.
+ */
+class FNullRHI : public FRHICommandContext
+{
+	struct FNullBuffer
+	{
+		ERHIBufferUsage Usage;
+		bool bDynamic;
+		TArray<uint8> Memory;
+	};
+
+public:
+	struct FStats
+	{
+		uint64 NumDrawCalls = 0;
+		uint64 NumIndices = 0;
+		uint64 NumStateChanges = 0;
+		uint64 NumBufferUpdates = 0;
+		uint64 UploadedBytes = 0;
+		uint64 NumErrors = 0;
+	};
+
+	explicit FNullRHI(bool bInValidate = true);
+	virtual ~FNullRHI() override;
+
+	const FStats& GetStats() const { return Stats; }
+	void ResetStats() { Stats = {}; }
+
+	bool IsValidating() const { return bValidate; }
+
+public:
+	virtual const char* GetName() const override { return "Null"; }
+
+	virtual FRHIBuffer* CreateBuffer(ERHIBufferUsage Usage, uint32 Size, bool bDynamic, const void* InitialData) override;
+	virtual void ReleaseBuffer(FRHIBuffer* Buffer) override;
+	virtual void UpdateBuffer(FRHIBuffer* Buffer, const void* Data, uint32 Size) override;
+
+	virtual bool MapTexture(FRHITexture* Texture, ERHIMapMode Mode, FRHIMappedData& OutMapped) override;
+	virtual void UnmapTexture(FRHITexture* Texture) override;
+	virtual void CopyTextureRegion(FRHITexture* Dest, uint32 DestX, uint32 DestY, FRHITexture* Source, const FRHIBox& SourceBox) override;
+
+	virtual void SetVertexBuffer(FRHIBuffer* Buffer, uint32 Stride, uint32 Offset) override;
+	virtual void SetIndexBuffer(FRHIBuffer* Buffer, ERHIIndexFormat Format, uint32 Offset) override;
+	virtual void SetPrimitiveTopology(ERHIPrimitiveTopology Topology) override;
+	virtual void SetInputLayout(FRHIInputLayout* InputLayout) override;
+
+	virtual void SetVertexShader(FRHIVertexShader* Shader) override;
+	virtual void SetPixelShader(FRHIPixelShader* Shader) override;
+	virtual void SetConstantBuffer(ERHIShaderStage Stage, uint32 Slot, FRHIBuffer* Buffer) override;
+	virtual void SetShaderResource(ERHIShaderStage Stage, uint32 Slot, FRHIShaderResourceView* View) override;
+	virtual void SetSampler(ERHIShaderStage Stage, uint32 Slot, FRHISamplerState* Sampler) override;
+
+	virtual void SetRasterizerState(FRHIRasterizerState* State) override;
+	virtual void SetBlendState(FRHIBlendState* State, const float* BlendFactor, uint32 SampleMask) override;
+	virtual void SetDepthStencilState(FRHIDepthStencilState* State, uint32 StencilRef) override;
+
+	virtual void Draw(uint32 VertexCount, uint32 StartVertex) override;
+	virtual void DrawIndexed(uint32 IndexCount, uint32 StartIndex, int32 BaseVertex) override;
+
+private:
+	/** 이 백엔드에서 만든 버퍼라면 반환, 아니면 nullptr */
+	FNullBuffer* FindBuffer(FRHIBuffer* Buffer) const;
+
+	void ReportError(const char* Message);
+	bool ValidateDraw(bool bIndexed);
+
+private:
+	bool bValidate;
+	FStats Stats;
+
+	std::unordered_set<FNullBuffer*> LiveBuffers;
+
+	// 검증용 바인딩 상태
+	FRHIBuffer* BoundVertexBuffer = nullptr;
+	FRHIBuffer* BoundIndexBuffer = nullptr;
+	ERHIIndexFormat BoundIndexFormat = ERHIIndexFormat::UInt32;
+	FRHIInputLayout* BoundInputLayout = nullptr;
+	FRHIVertexShader* BoundVertexShader = nullptr;
+	FRHIPixelShader* BoundPixelShader = nullptr;
+	bool bTopologySet = false;
+
+	int32 NumMappedTextures = 0;
+	uint8 ReadbackScratch[256] = {};
+
+	// 같은 오류가 매 프레임 로그를 채우지 않도록 앞쪽 몇 개만 출력
+	static constexpr uint64 MaxLoggedErrors = 16;
+};
@@ -0,0 +1,33 @@
+#include "RHI.h"
+
+#include "NullRHI.h"
+#include "RHIPipelineState.h"
+
+
+std::unique_ptr<FRHICommandContext> FRHI::Storage = std::make_unique<FNullRHI>();
+FRHICommandContext* FRHI::Context = FRHI::Storage.get();
+
+std::unique_ptr<FRHICommandContext> FRHI::SetContext(std::unique_ptr<FRHICommandContext> InContext)
+{
+	if (InContext == nullptr)
+	{
+		InContext = std::make_unique<FNullRHI>();
+	}
+
+	std::unique_ptr<FRHICommandContext> Previous = std::move(Storage);
+	Storage = std::move(InContext);
+	Context = Storage.get();
+	return Previous;
+}
+
+void FRHICommandContext::SetPipelineState(const FRHIPipelineState& State)
+{
+	const FRHIPipelineStateDesc& Desc = State.GetDesc();
+	SetPrimitiveTopology(Desc.Topology);
+	SetInputLayout(Desc.InputLayout);
+	SetVertexShader(Desc.VertexShader);
+	SetRasterizerState(Desc.RasterizerState);
+	SetPixelShader(Desc.PixelShader);
+	SetBlendState(Desc.BlendState, Desc.BlendFactor, Desc.SampleMask);
+	SetDepthStencilState(Desc.DepthStencilState, Desc.StencilRef);
+}
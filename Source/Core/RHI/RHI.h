@@ -0,0 +1,160 @@
+#pragma once
+#include <memory>
+
+#include "Core/HAL/PlatformType.h"
+
+
+/**
+ * RHI (Render Hardware Interface)
+ *
+ * 렌더링 코드가 ID3D11DeviceContext를 직접 부르지 않도록 하는 얇은 추상화 계층입니다.
+ * 리소스는 백엔드가 해석하는 불투명한 핸들로만 주고받습니다.
+ */
+
+// 불투명 핸들 (백엔드마다 실제 타입이 다름, 정의하지 않음)
+struct FRHIBuffer;
+struct FRHITexture;
+struct FRHIShaderResourceView;
+struct FRHIVertexShader;
+struct FRHIPixelShader;
+struct FRHIInputLayout;
+struct FRHISamplerState;
+struct FRHIRasterizerState;
+struct FRHIBlendState;
+struct FRHIDepthStencilState;
+
+class FRHIPipelineState;
+
+
+enum class ERHIShaderStage : uint8
+{
+	Vertex,
+	Pixel,
+	Geometry,
+	Compute,
+
+	Num
+};
+
+enum class ERHIPrimitiveTopology : uint8
+{
+	PointList,
+	LineList,
+	LineStrip,
+	TriangleList,
+	TriangleStrip,
+};
+
+enum class ERHIIndexFormat : uint8
+{
+	UInt16,
+	UInt32,
+};
+
+enum class ERHIBufferUsage : uint8
+{
+	Vertex,
+	Index,
+	Constant,
+};
+
+enum class ERHIMapMode : uint8
+{
+	Read,
+	ReadNoWait,     // GPU가 아직 쓰는 중이면 기다리지 않고 실패 (비동기 Readback)
+	WriteDiscard,
+};
+
+
+struct FRHIMappedData
+{
+	void* Data = nullptr;
+	uint32 RowPitch = 0;
+};
+
+/** 텍스처 복사 영역, [Left, Right) x [Top, Bottom) */
+struct FRHIBox
+{
+	uint32 Left = 0;
+	uint32 Top = 0;
+	uint32 Right = 0;
+	uint32 Bottom = 0;
+};
+
+
+/**
+ * 렌더링 명령을 받는 인터페이스
+ *
+ * D3D11 백엔드는 Immediate Context로 바로 전달하고, Null 백엔드는 검증/기록만 합니다.
+ * Render Thread(또는 Inline 모드의 Game Thread)에서만 호출해야 합니다.
+ */
+class FRHICommandContext
+{
+public:
+	virtual ~FRHICommandContext() = default;
+
+	virtual const char* GetName() const = 0;
+
+	/* Resource */
+	virtual FRHIBuffer* CreateBuffer(ERHIBufferUsage Usage, uint32 Size, bool bDynamic, const void* InitialData) = 0;
+	virtual void ReleaseBuffer(FRHIBuffer* Buffer) = 0;
+
+	/** WriteDiscard로 Map → memcpy → Unmap */
+	virtual void UpdateBuffer(FRHIBuffer* Buffer, const void* Data, uint32 Size) = 0;
+
+	virtual bool MapTexture(FRHITexture* Texture, ERHIMapMode Mode, FRHIMappedData& OutMapped) = 0;
+	virtual void UnmapTexture(FRHITexture* Texture) = 0;
+	virtual void CopyTextureRegion(FRHITexture* Dest, uint32 DestX, uint32 DestY, FRHITexture* Source, const FRHIBox& SourceBox) = 0;
+
+	/* Input Assembler */
+	virtual void SetVertexBuffer(FRHIBuffer* Buffer, uint32 Stride, uint32 Offset) = 0;
+	virtual void SetIndexBuffer(FRHIBuffer* Buffer, ERHIIndexFormat Format, uint32 Offset) = 0;
+	virtual void SetPrimitiveTopology(ERHIPrimitiveTopology Topology) = 0;
+	virtual void SetInputLayout(FRHIInputLayout* InputLayout) = 0;
+
+	/* Shader */
+	virtual void SetVertexShader(FRHIVertexShader* Shader) = 0;
+	virtual void SetPixelShader(FRHIPixelShader* Shader) = 0;
+	virtual void SetConstantBuffer(ERHIShaderStage Stage, uint32 Slot, FRHIBuffer* Buffer) = 0;
+	virtual void SetShaderResource(ERHIShaderStage Stage, uint32 Slot, FRHIShaderResourceView* View) = 0;
+	virtual void SetSampler(ERHIShaderStage Stage, uint32 Slot, FRHISamplerState* Sampler) = 0;
+
+	/* State */
+	virtual void SetRasterizerState(FRHIRasterizerState* State) = 0;
+	virtual void SetBlendState(FRHIBlendState* State, const float* BlendFactor, uint32 SampleMask) = 0;
+	virtual void SetDepthStencilState(FRHIDepthStencilState* State, uint32 StencilRef) = 0;
+
+	/**
+	 * Shader, Input Layout, Topology, Rasterizer / Blend / Depth Stencil State를 한 번에 바인딩
+	 * 기본 구현은 위의 Set*으로 나눠서 부르므로, PSO를 따로 다루지 않는 백엔드 / Decorator는 override하지 않아도 됩니다.
+	 */
+	virtual void SetPipelineState(const FRHIPipelineState& State);
+
+	/* Draw */
+	virtual void Draw(uint32 VertexCount, uint32 StartVertex) = 0;
+	virtual void DrawIndexed(uint32 IndexCount, uint32 StartIndex, int32 BaseVertex) = 0;
+
+	/** 한 프레임의 명령이 끝남 (SwapBuffer 다음), 프레임 단위 상태를 가진 Decorator가 사용 */
+	virtual void EndFrame() {}
+
+	/** RHI를 거치지 않고 Device Context의 바인딩을 바꿨음 (ImGui 등), 기억하고 있는 바인딩을 버려야 하는 Decorator가 사용 */
+	virtual void InvalidateState() {}
+};
+
+
+/** 현재 사용 중인 RHI 백엔드 */
+class FRHI
+{
+public:
+	/**
+	 * 백엔드를 교체하고 이전 백엔드를 반환합니다.
+	 * @param InContext 새 백엔드, nullptr이면 Null 백엔드를 사용합니다.
+	 */
+	static std::unique_ptr<FRHICommandContext> SetContext(std::unique_ptr<FRHICommandContext> InContext);
+
+	static FRHICommandContext& Get() { return *Context; }
+
+private:
+	static std::unique_ptr<FRHICommandContext> Storage;
+	static FRHICommandContext* Context;
+};
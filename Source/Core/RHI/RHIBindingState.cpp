@@ -0,0 +1,141 @@
+#include "RHIBindingState.h"
+
+#include <algorithm>
+
+
+template <typename T>
+bool FRHIBindingState::Track(TTracked<T>& Tracked, const T& Value)
+{
+	if (Tracked.bValid && Tracked.Value == Value)
+	{
+		return false;
+	}
+	Tracked.Value = Value;
+	Tracked.bValid = true;
+	return true;
+}
+
+template <typename T>
+bool FRHIBindingState::TrackSlot(TTracked<T>* Slots, uint32 Slot, const T& Value)
+{
+	if (Slot >= MaxTrackedSlots)
+	{
+		return true;
+	}
+	return Track(Slots[Slot], Value);
+}
+
+bool FRHIBindingState::SetVertexBuffer(FRHIBuffer* Buffer, uint32 Stride, uint32 Offset)
+{
+	return Track(VertexBuffer, { Buffer, Stride, Offset });
+}
+
+bool FRHIBindingState::SetIndexBuffer(FRHIBuffer* Buffer, ERHIIndexFormat Format, uint32 Offset)
+{
+	return Track(IndexBuffer, { Buffer, Format, Offset });
+}
+
+bool FRHIBindingState::SetPrimitiveTopology(ERHIPrimitiveTopology InTopology)
+{
+	return Track(Topology, InTopology);
+}
+
+bool FRHIBindingState::SetInputLayout(FRHIInputLayout* InInputLayout)
+{
+	return Track(InputLayout, InInputLayout);
+}
+
+bool FRHIBindingState::SetVertexShader(FRHIVertexShader* Shader)
+{
+	return Track(VertexShader, Shader);
+}
+
+bool FRHIBindingState::SetPixelShader(FRHIPixelShader* Shader)
+{
+	return Track(PixelShader, Shader);
+}
+
+bool FRHIBindingState::SetConstantBuffer(ERHIShaderStage Stage, uint32 Slot, FRHIBuffer* Buffer)
+{
+	return TrackSlot(ConstantBuffers[static_cast<int32>(Stage)], Slot, Buffer);
+}
+
+bool FRHIBindingState::SetShaderResource(ERHIShaderStage Stage, uint32 Slot, FRHIShaderResourceView* View)
+{
+	return TrackSlot(ShaderResources[static_cast<int32>(Stage)], Slot, View);
+}
+
+bool FRHIBindingState::SetSampler(ERHIShaderStage Stage, uint32 Slot, FRHISamplerState* Sampler)
+{
+	return TrackSlot(Samplers[static_cast<int32>(Stage)], Slot, Sampler);
+}
+
+bool FRHIBindingState::SetRasterizerState(FRHIRasterizerState* State)
+{
+	return Track(RasterizerState, State);
+}
+
+bool FRHIBindingState::SetBlendState(FRHIBlendState* State, const float* BlendFactor, uint32 SampleMask)
+{
+	// D3D11과 같이 BlendFactor가 nullptr이면 (1, 1, 1, 1)
+	FBlendBinding Binding = { State, { 1.0f, 1.0f, 1.0f, 1.0f }, SampleMask };
+	if (BlendFactor != nullptr)
+	{
+		std::copy_n(BlendFactor, 4, Binding.BlendFactor);
+	}
+	return Track(BlendState, Binding);
+}
+
+bool FRHIBindingState::SetDepthStencilState(FRHIDepthStencilState* State, uint32 StencilRef)
+{
+	return Track(DepthStencilState, { State, StencilRef });
+}
+
+void FRHIBindingState::Invalidate()
+{
+	VertexBuffer.bValid = false;
+	IndexBuffer.bValid = false;
+	Topology.bValid = false;
+	InputLayout.bValid = false;
+	VertexShader.bValid = false;
+	PixelShader.bValid = false;
+	for (int32 Stage = 0; Stage < NumStages; ++Stage)
+	{
+		for (uint32 Slot = 0; Slot < MaxTrackedSlots; ++Slot)
+		{
+			ConstantBuffers[Stage][Slot].bValid = false;
+			ShaderResources[Stage][Slot].bValid = false;
+			Samplers[Stage][Slot].bValid = false;
+		}
+	}
+	RasterizerState.bValid = false;
+	BlendState.bValid = false;
+	DepthStencilState.bValid = false;
+}
+
+void FRHIBindingState::ForgetBuffer(FRHIBuffer* Buffer)
+{
+	if (VertexBuffer.Value.Buffer == Buffer)
+	{
+		VertexBuffer.bValid = false;
+	}
+	if (IndexBuffer.Value.Buffer == Buffer)
+	{
+		IndexBuffer.bValid = false;
+	}
+	for (int32 Stage = 0; Stage < NumStages; ++Stage)
+	{
+		for (uint32 Slot = 0; Slot < MaxTrackedSlots; ++Slot)
+		{
+			if (ConstantBuffers[Stage][Slot].Value == Buffer)
+			{
+				ConstantBuffers[Stage][Slot].bValid = false;
+			}
+		}
+	}
+}
+
+ERHIPrimitiveTopology FRHIBindingState::GetTopology() const
+{
+	return Topology.bValid ? Topology.Value : ERHIPrimitiveTopology::TriangleList;
+}
@@ -0,0 +1,104 @@
+#pragma once
+
+#include "RHI.h"
+
+
+/**
+ * Device Context에 마지막으로 바인딩한 값의 사본 (Render Thread 전용)
+ *
+ * Set*은 기억한 값과 같으면 false (중복 바인딩), 다르면 기억하고 true를 반환합니다.
+ * FRHIStatsContext는 중복을 세는 데, FRHIStateTrackingContext는 중복을 걸러내는 데 사용합니다.
+ * 처음이나 Invalidate 직후에는 아무 값도 모르는 상태라서 모든 Set*이 true입니다.
+ */
+class FRHIBindingState
+{
+public:
+	/** 바인딩을 기억하는 Slot 수, 그 위의 Slot은 항상 바뀌는 것으로 봄 */
+	static constexpr uint32 MaxTrackedSlots = 16;
+
+	bool SetVertexBuffer(FRHIBuffer* Buffer, uint32 Stride, uint32 Offset);
+	bool SetIndexBuffer(FRHIBuffer* Buffer, ERHIIndexFormat Format, uint32 Offset);
+	bool SetPrimitiveTopology(ERHIPrimitiveTopology InTopology);
+	bool SetInputLayout(FRHIInputLayout* InInputLayout);
+
+	bool SetVertexShader(FRHIVertexShader* Shader);
+	bool SetPixelShader(FRHIPixelShader* Shader);
+	bool SetConstantBuffer(ERHIShaderStage Stage, uint32 Slot, FRHIBuffer* Buffer);
+	bool SetShaderResource(ERHIShaderStage Stage, uint32 Slot, FRHIShaderResourceView* View);
+	bool SetSampler(ERHIShaderStage Stage, uint32 Slot, FRHISamplerState* Sampler);
+
+	bool SetRasterizerState(FRHIRasterizerState* State);
+	bool SetBlendState(FRHIBlendState* State, const float* BlendFactor, uint32 SampleMask);
+	bool SetDepthStencilState(FRHIDepthStencilState* State, uint32 StencilRef);
+
+	/** 모르는 상태로 (프레임 시작, RHI 밖에서 바인딩을 바꿨을 때) */
+	void Invalidate();
+
+	/** 해제한 주소가 새 버퍼로 다시 쓰이면 중복으로 잘못 볼 수 있으므로 잊어버림 */
+	void ForgetBuffer(FRHIBuffer* Buffer);
+
+	/** 모르면 Triangle List */
+	ERHIPrimitiveTopology GetTopology() const;
+
+private:
+	/** 마지막 바인딩, bValid가 false면 모르는 상태 */
+	template <typename T>
+	struct TTracked
+	{
+		T Value{};
+		bool bValid = false;
+	};
+
+	struct FVertexBufferBinding
+	{
+		FRHIBuffer* Buffer;
+		uint32 Stride;
+		uint32 Offset;
+		bool operator==(const FVertexBufferBinding&) const = default;
+	};
+
+	struct FIndexBufferBinding
+	{
+		FRHIBuffer* Buffer;
+		ERHIIndexFormat Format;
+		uint32 Offset;
+		bool operator==(const FIndexBufferBinding&) const = default;
+	};
+
+	struct FBlendBinding
+	{
+		FRHIBlendState* State;
+		float BlendFactor[4];
+		uint32 SampleMask;
+		bool operator==(const FBlendBinding&) const = default;
+	};
+
+	struct FDepthStencilBinding
+	{
+		FRHIDepthStencilState* State;
+		uint32 StencilRef;
+		bool operator==(const FDepthStencilBinding&) const = default;
+	};
+
+	template <typename T>
+	static bool Track(TTracked<T>& Tracked, const T& Value);
+
+	template <typename T>
+	static bool TrackSlot(TTracked<T>* Slots, uint32 Slot, const T& Value);
+
+private:
+	static constexpr int32 NumStages = static_cast<int32>(ERHIShaderStage::Num);
+
+	TTracked<FVertexBufferBinding> VertexBuffer;
+	TTracked<FIndexBufferBinding> IndexBuffer;
+	TTracked<ERHIPrimitiveTopology> Topology;
+	TTracked<FRHIInputLayout*> InputLayout;
+	TTracked<FRHIVertexShader*> VertexShader;
+	TTracked<FRHIPixelShader*> PixelShader;
+	TTracked<FRHIBuffer*> ConstantBuffers[NumStages][MaxTrackedSlots];
+	TTracked<FRHIShaderResourceView*> ShaderResources[NumStages][MaxTrackedSlots];
+	TTracked<FRHISamplerState*> Samplers[NumStages][MaxTrackedSlots];
+	TTracked<FRHIRasterizerState*> RasterizerState;
+	TTracked<FBlendBinding> BlendState;
+	TTracked<FDepthStencilBinding> DepthStencilState;
+};
@@ -0,0 +1,299 @@
+#include "RHICommandLog.h"
+
+#include <cstring>
+#include <unordered_map>
+
+
+FRHICommandLog::FCommand& FRHICommandLog::Add(ERHICommandType Type, const void* InPayload, uint32 PayloadSize)
+{
+	FCommand Command{};
+	Command.Type = Type;
+
+	if (InPayload && PayloadSize > 0)
+	{
+		const int32 Offset = Payload.Num();
+		Payload.SetNum(Offset + static_cast<int32>(PayloadSize));
+		std::memcpy(Payload.GetData() + Offset, InPayload, PayloadSize);
+
+		Command.PayloadOffset = static_cast<uint32>(Offset);
+		Command.PayloadSize = PayloadSize;
+	}
+
+	Commands.Add(Command);
+	return Commands[Commands.Num() - 1];
+}
+
+const void* FRHICommandLog::GetPayload(const FCommand& Command) const
+{
+	return Command.PayloadSize > 0 ? Payload.GetData() + Command.PayloadOffset : nullptr;
+}
+
+void FRHICommandLog::Empty()
+{
+	Commands.Empty();
+	Payload.Empty();
+}
+
+size_t FRHICommandLog::GetMemorySize() const
+{
+	return Commands.Num() * sizeof(FCommand) + Payload.Num();
+}
+
+void FRHICommandLog::Replay(FRHICommandContext& Target) const
+{
+	// 기록 당시 버퍼 핸들 → Replay 대상에서 새로 만든 버퍼 핸들
+	std::unordered_map<void*, FRHIBuffer*> BufferRemap;
+	auto RemapBuffer = [&BufferRemap](void* Handle)
+	{
+		const auto It = BufferRemap.find(Handle);
+		return It != BufferRemap.end() ? It->second : static_cast<FRHIBuffer*>(Handle);
+	};
+
+	for (const FCommand& Command : Commands)
+	{
+		const uint32* Args = Command.Args;
+		switch (Command.Type)
+		{
+		case ERHICommandType::CreateBuffer:
+			BufferRemap[Command.Handles[0]] = Target.CreateBuffer(
+				static_cast<ERHIBufferUsage>(Args[0]), Args[1], Args[2] != 0, GetPayload(Command)
+			);
+			break;
+		case ERHICommandType::ReleaseBuffer:
+			Target.ReleaseBuffer(RemapBuffer(Command.Handles[0]));
+			BufferRemap.erase(Command.Handles[0]);
+			break;
+		case ERHICommandType::UpdateBuffer:
+			Target.UpdateBuffer(RemapBuffer(Command.Handles[0]), GetPayload(Command), Command.PayloadSize);
+			break;
+		case ERHICommandType::MapTexture:
+		{
+			FRHIMappedData Mapped;
+			Target.MapTexture(static_cast<FRHITexture*>(Command.Handles[0]), static_cast<ERHIMapMode>(Args[0]), Mapped);
+			break;
+		}
+		case ERHICommandType::UnmapTexture:
+			Target.UnmapTexture(static_cast<FRHITexture*>(Command.Handles[0]));
+			break;
+		case ERHICommandType::CopyTextureRegion:
+		{
+			FRHIBox Box;
+			std::memcpy(&Box, GetPayload(Command), sizeof(FRHIBox));
+			Target.CopyTextureRegion(
+				static_cast<FRHITexture*>(Command.Handles[0]), Args[0], Args[1],
+				static_cast<FRHITexture*>(Command.Handles[1]), Box
+			);
+			break;
+		}
+		case ERHICommandType::SetVertexBuffer:
+			Target.SetVertexBuffer(RemapBuffer(Command.Handles[0]), Args[0], Args[1]);
+			break;
+		case ERHICommandType::SetIndexBuffer:
+			Target.SetIndexBuffer(RemapBuffer(Command.Handles[0]), static_cast<ERHIIndexFormat>(Args[0]), Args[1]);
+			break;
+		case ERHICommandType::SetPrimitiveTopology:
+			Target.SetPrimitiveTopology(static_cast<ERHIPrimitiveTopology>(Args[0]));
+			break;
+		case ERHICommandType::SetInputLayout:
+			Target.SetInputLayout(static_cast<FRHIInputLayout*>(Command.Handles[0]));
+			break;
+		case ERHICommandType::SetVertexShader:
+			Target.SetVertexShader(static_cast<FRHIVertexShader*>(Command.Handles[0]));
+			break;
+		case ERHICommandType::SetPixelShader:
+			Target.SetPixelShader(static_cast<FRHIPixelShader*>(Command.Handles[0]));
+			break;
+		case ERHICommandType::SetConstantBuffer:
+			Target.SetConstantBuffer(Command.Stage, Args[0], RemapBuffer(Command.Handles[0]));
+			break;
+		case ERHICommandType::SetShaderResource:
+			Target.SetShaderResource(Command.Stage, Args[0], static_cast<FRHIShaderResourceView*>(Command.Handles[0]));
+			break;
+		case ERHICommandType::SetSampler:
+			Target.SetSampler(Command.Stage, Args[0], static_cast<FRHISamplerState*>(Command.Handles[0]));
+			break;
+		case ERHICommandType::SetRasterizerState:
+			Target.SetRasterizerState(static_cast<FRHIRasterizerState*>(Command.Handles[0]));
+			break;
+		case ERHICommandType::SetBlendState:
+			Target.SetBlendState(
+				static_cast<FRHIBlendState*>(Command.Handles[0]),
+				static_cast<const float*>(GetPayload(Command)),
+				Args[0]
+			);
+			break;
+		case ERHICommandType::SetDepthStencilState:
+			Target.SetDepthStencilState(static_cast<FRHIDepthStencilState*>(Command.Handles[0]), Args[0]);
+			break;
+		case ERHICommandType::Draw:
+			Target.Draw(Args[0], Args[1]);
+			break;
+		case ERHICommandType::DrawIndexed:
+			Target.DrawIndexed(Args[0], Args[1], static_cast<int32>(Args[2]));
+			break;
+		}
+	}
+}
+
+
+FRHIRecordingContext::FRHIRecordingContext(std::unique_ptr<FRHICommandContext> InInner, FRHICommandLog* InLog)
+	: Inner(std::move(InInner))
+	, Log(InLog)
+{
+}
+
+FRHIBuffer* FRHIRecordingContext::CreateBuffer(ERHIBufferUsage Usage, uint32 Size, bool bDynamic, const void* InitialData)
+{
+	FRHIBuffer* Buffer = Inner->CreateBuffer(Usage, Size, bDynamic, InitialData);
+
+	FRHICommandLog::FCommand& Command = Log->Add(ERHICommandType::CreateBuffer, InitialData, InitialData ? Size : 0);
+	Command.Args[0] = static_cast<uint32>(Usage);
+	Command.Args[1] = Size;
+	Command.Args[2] = bDynamic;
+	Command.Handles[0] = Buffer;
+	return Buffer;
+}
+
+void FRHIRecordingContext::ReleaseBuffer(FRHIBuffer* Buffer)
+{
+	Log->Add(ERHICommandType::ReleaseBuffer).Handles[0] = Buffer;
+	Inner->ReleaseBuffer(Buffer);
+}
+
+void FRHIRecordingContext::UpdateBuffer(FRHIBuffer* Buffer, const void* Data, uint32 Size)
+{
+	Log->Add(ERHICommandType::UpdateBuffer, Data, Size).Handles[0] = Buffer;
+	Inner->UpdateBuffer(Buffer, Data, Size);
+}
+
+bool FRHIRecordingContext::MapTexture(FRHITexture* Texture, ERHIMapMode Mode, FRHIMappedData& OutMapped)
+{
+	FRHICommandLog::FCommand& Command = Log->Add(ERHICommandType::MapTexture);
+	Command.Args[0] = static_cast<uint32>(Mode);
+	Command.Handles[0] = Texture;
+	return Inner->MapTexture(Texture, Mode, OutMapped);
+}
+
+void FRHIRecordingContext::UnmapTexture(FRHITexture* Texture)
+{
+	Log->Add(ERHICommandType::UnmapTexture).Handles[0] = Texture;
+	Inner->UnmapTexture(Texture);
+}
+
+void FRHIRecordingContext::CopyTextureRegion(FRHITexture* Dest, uint32 DestX, uint32 DestY, FRHITexture* Source, const FRHIBox& SourceBox)
+{
+	FRHICommandLog::FCommand& Command = Log->Add(ERHICommandType::CopyTextureRegion, &SourceBox, sizeof(FRHIBox));
+	Command.Args[0] = DestX;
+	Command.Args[1] = DestY;
+	Command.Handles[0] = Dest;
+	Command.Handles[1] = Source;
+	Inner->CopyTextureRegion(Dest, DestX, DestY, Source, SourceBox);
+}
+
+void FRHIRecordingContext::SetVertexBuffer(FRHIBuffer* Buffer, uint32 Stride, uint32 Offset)
+{
+	FRHICommandLog::FCommand& Command = Log->Add(ERHICommandType::SetVertexBuffer);
+	Command.Args[0] = Stride;
+	Command.Args[1] = Offset;
+	Command.Handles[0] = Buffer;
+	Inner->SetVertexBuffer(Buffer, Stride, Offset);
+}
+
+void FRHIRecordingContext::SetIndexBuffer(FRHIBuffer* Buffer, ERHIIndexFormat Format, uint32 Offset)
+{
+	FRHICommandLog::FCommand& Command = Log->Add(ERHICommandType::SetIndexBuffer);
+	Command.Args[0] = static_cast<uint32>(Format);
+	Command.Args[1] = Offset;
+	Command.Handles[0] = Buffer;
+	Inner->SetIndexBuffer(Buffer, Format, Offset);
+}
+
+void FRHIRecordingContext::SetPrimitiveTopology(ERHIPrimitiveTopology Topology)
+{
+	Log->Add(ERHICommandType::SetPrimitiveTopology).Args[0] = static_cast<uint32>(Topology);
+	Inner->SetPrimitiveTopology(Topology);
+}
+
+void FRHIRecordingContext::SetInputLayout(FRHIInputLayout* InputLayout)
+{
+	Log->Add(ERHICommandType::SetInputLayout).Handles[0] = InputLayout;
+	Inner->SetInputLayout(InputLayout);
+}
+
+void FRHIRecordingContext::SetVertexShader(FRHIVertexShader* Shader)
+{
+	Log->Add(ERHICommandType::SetVertexShader).Handles[0] = Shader;
+	Inner->SetVertexShader(Shader);
+}
+
+void FRHIRecordingContext::SetPixelShader(FRHIPixelShader* Shader)
+{
+	Log->Add(ERHICommandType::SetPixelShader).Handles[0] = Shader;
+	Inner->SetPixelShader(Shader);
+}
+
+void FRHIRecordingContext::SetConstantBuffer(ERHIShaderStage Stage, uint32 Slot, FRHIBuffer* Buffer)
+{
+	FRHICommandLog::FCommand& Command = Log->Add(ERHICommandType::SetConstantBuffer);
+	Command.Stage = Stage;
+	Command.Args[0] = Slot;
+	Command.Handles[0] = Buffer;
+	Inner->SetConstantBuffer(Stage, Slot, Buffer);
+}
+
+void FRHIRecordingContext::SetShaderResource(ERHIShaderStage Stage, uint32 Slot, FRHIShaderResourceView* View)
+{
+	FRHICommandLog::FCommand& Command = Log->Add(ERHICommandType::SetShaderResource);
+	Command.Stage = Stage;
+	Command.Args[0] = Slot;
+	Command.Handles[0] = View;
+	Inner->SetShaderResource(Stage, Slot, View);
+}
+
+void FRHIRecordingContext::SetSampler(ERHIShaderStage Stage, uint32 Slot, FRHISamplerState* Sampler)
+{
+	FRHICommandLog::FCommand& Command = Log->Add(ERHICommandType::SetSampler);
+	Command.Stage = Stage;
+	Command.Args[0] = Slot;
+	Command.Handles[0] = Sampler;
+	Inner->SetSampler(Stage, Slot, Sampler);
+}
+
+void FRHIRecordingContext::SetRasterizerState(FRHIRasterizerState* State)
+{
+	Log->Add(ERHICommandType::SetRasterizerState).Handles[0] = State;
+	Inner->SetRasterizerState(State);
+}
+
+void FRHIRecordingContext::SetBlendState(FRHIBlendState* State, const float* BlendFactor, uint32 SampleMask)
+{
+	FRHICommandLog::FCommand& Command = Log->Add(ERHICommandType::SetBlendState, BlendFactor, BlendFactor ? sizeof(float) * 4 : 0);
+	Command.Args[0] = SampleMask;
+	Command.Handles[0] = State;
+	Inner->SetBlendState(State, BlendFactor, SampleMask);
+}
+
+void FRHIRecordingContext::SetDepthStencilState(FRHIDepthStencilState* State, uint32 StencilRef)
+{
+	FRHICommandLog::FCommand& Command = Log->Add(ERHICommandType::SetDepthStencilState);
+	Command.Args[0] = StencilRef;
+	Command.Handles[0] = State;
+	Inner->SetDepthStencilState(State, StencilRef);
+}
+
+void FRHIRecordingContext::Draw(uint32 VertexCount, uint32 StartVertex)
+{
+	FRHICommandLog::FCommand& Command = Log->Add(ERHICommandType::Draw);
+	Command.Args[0] = VertexCount;
+	Command.Args[1] = StartVertex;
+	Inner->Draw(VertexCount, StartVertex);
+}
+
+void FRHIRecordingContext::DrawIndexed(uint32 IndexCount, uint32 StartIndex, int32 BaseVertex)
+{
+	FRHICommandLog::FCommand& Command = Log->Add(ERHICommandType::DrawIndexed);
+	Command.Args[0] = IndexCount;
+	Command.Args[1] = StartIndex;
+	Command.Args[2] = static_cast<uint32>(BaseVertex);
+	Inner->DrawIndexed(IndexCount, StartIndex, BaseVertex);
+}
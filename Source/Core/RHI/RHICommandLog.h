@@ -0,0 +1,121 @@
+#pragma once
+#include "RHI.h"
+#include "Core/Container/Array.h"
+
+
+enum class ERHICommandType : uint8
+{
+	CreateBuffer,
+	ReleaseBuffer,
+	UpdateBuffer,
+	MapTexture,
+	UnmapTexture,
+	CopyTextureRegion,
+	SetVertexBuffer,
+	SetIndexBuffer,
+	SetPrimitiveTopology,
+	SetInputLayout,
+	SetVertexShader,
+	SetPixelShader,
+	SetConstantBuffer,
+	SetShaderResource,
+	SetSampler,
+	SetRasterizerState,
+	SetBlendState,
+	SetDepthStencilState,
+	Draw,
+	DrawIndexed,
+};
+
+
+/**
+ * 다시 실행할 수 있는 RHI 명령 기록
+ *
+ * 버퍼 내용, Blend Factor 같은 가변 데이터는 Payload에 복사해 둡니다.
+ * Replay 시 CreateBuffer로 만든 버퍼는 새 핸들로 바꿔서 전달하고,
+ * 그 외 핸들(Shader, State, Texture 등)은 기록한 값을 그대로 전달하므로 Replay 대상에서도 유효해야 합니다.
+ */
+class FRHICommandLog
+{
+public:
+	struct FCommand
+	{
+		ERHICommandType Type;
+		ERHIShaderStage Stage;
+		uint32 Args[4];
+		void* Handles[2];
+		uint32 PayloadOffset;
+		uint32 PayloadSize;
+	};
+
+public:
+	/** 명령을 추가하고, Payload가 있으면 복사합니다. */
+	FCommand& Add(ERHICommandType Type, const void* Payload = nullptr, uint32 PayloadSize = 0);
+
+	/** 기록된 명령을 순서대로 Target에 실행합니다. Replay 중 만든 버퍼는 끝날 때 해제하지 않습니다. */
+	void Replay(FRHICommandContext& Target) const;
+
+	int32 Num() const { return Commands.Num(); }
+	const FCommand& operator[](int32 Index) const { return Commands[Index]; }
+	const void* GetPayload(const FCommand& Command) const;
+
+	void Empty();
+
+	/** 명령 + Payload가 차지하는 메모리 (Byte) */
+	size_t GetMemorySize() const;
+
+private:
+	TArray<FCommand> Commands;
+	TArray<uint8> Payload;
+};
+
+
+/**
+ * 다른 백엔드를 감싸서 모든 호출을 FRHICommandLog에 기록하고 그대로 전달하는 Decorator
+ *
+ * ex) FRHI::SetContext(std::make_unique<FRHIRecordingContext>(std::make_unique<FNullRHI>(), &Log));
+ */
+class FRHIRecordingContext : public FRHICommandContext
+{
+public:
+	FRHIRecordingContext(std::unique_ptr<FRHICommandContext> InInner, FRHICommandLog* InLog);
+
+	FRHICommandContext& GetInner() const { return *Inner; }
+	FRHICommandLog* GetLog() const { return Log; }
+
+public:
+	virtual const char* GetName() const override { return "Recording"; }
+
+	virtual FRHIBuffer* CreateBuffer(ERHIBufferUsage Usage, uint32 Size, bool bDynamic, const void* InitialData) override;
+	virtual void ReleaseBuffer(FRHIBuffer* Buffer) override;
+	virtual void UpdateBuffer(FRHIBuffer* Buffer, const void* Data, uint32 Size) override;
+
+	virtual bool MapTexture(FRHITexture* Texture, ERHIMapMode Mode, FRHIMappedData& OutMapped) override;
+	virtual void UnmapTexture(FRHITexture* Texture) override;
+	virtual void CopyTextureRegion(FRHITexture* Dest, uint32 DestX, uint32 DestY, FRHITexture* Source, const FRHIBox& SourceBox) override;
+
+	virtual void SetVertexBuffer(FRHIBuffer* Buffer, uint32 Stride, uint32 Offset) override;
+	virtual void SetIndexBuffer(FRHIBuffer* Buffer, ERHIIndexFormat Format, uint32 Offset) override;
+	virtual void SetPrimitiveTopology(ERHIPrimitiveTopology Topology) override;
+	virtual void SetInputLayout(FRHIInputLayout* InputLayout) override;
+
+	virtual void SetVertexShader(FRHIVertexShader* Shader) override;
+	virtual void SetPixelShader(FRHIPixelShader* Shader) override;
+	virtual void SetConstantBuffer(ERHIShaderStage Stage, uint32 Slot, FRHIBuffer* Buffer) override;
+	virtual void SetShaderResource(ERHIShaderStage Stage, uint32 Slot, FRHIShaderResourceView* View) override;
+	virtual void SetSampler(ERHIShaderStage Stage, uint32 Slot, FRHISamplerState* Sampler) override;
+
+	virtual void SetRasterizerState(FRHIRasterizerState* State) override;
+	virtual void SetBlendState(FRHIBlendState* State, const float* BlendFactor, uint32 SampleMask) override;
+	virtual void SetDepthStencilState(FRHIDepthStencilState* State, uint32 StencilRef) override;
+
+	virtual void Draw(uint32 VertexCount, uint32 StartVertex) override;
+	virtual void DrawIndexed(uint32 IndexCount, uint32 StartIndex, int32 BaseVertex) override;
+
+	virtual void EndFrame() override { Inner->EndFrame(); }
+	virtual void InvalidateState() override { Inner->InvalidateState(); }
+
+private:
+	std::unique_ptr<FRHICommandContext> Inner;
+	FRHICommandLog* Log;
+};
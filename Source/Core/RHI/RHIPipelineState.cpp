@@ -0,0 +1,53 @@
+#include "RHIPipelineState.h"
+
+#include <bit>
+
+
+namespace
+{
+void HashCombine(size_t& Seed, size_t Value)
+{
+	Seed ^= Value + 0x9e3779b97f4a7c15ull + (Seed << 6) + (Seed >> 2);
+}
+}
+
+
+size_t std::hash<FRHIPipelineStateDesc>::operator()(const FRHIPipelineStateDesc& Desc) const noexcept
+{
+	size_t Seed = 0;
+	HashCombine(Seed, std::hash<const void*>()(Desc.VertexShader));
+	HashCombine(Seed, std::hash<const void*>()(Desc.PixelShader));
+	HashCombine(Seed, std::hash<const void*>()(Desc.InputLayout));
+	HashCombine(Seed, static_cast<size_t>(Desc.Topology));
+	HashCombine(Seed, std::hash<const void*>()(Desc.RasterizerState));
+	HashCombine(Seed, std::hash<const void*>()(Desc.BlendState));
+	for (const float Factor : Desc.BlendFactor)
+	{
+		HashCombine(Seed, std::bit_cast<uint32>(Factor));
+	}
+	HashCombine(Seed, Desc.SampleMask);
+	HashCombine(Seed, std::hash<const void*>()(Desc.DepthStencilState));
+	HashCombine(Seed, Desc.StencilRef);
+	return Seed;
+}
+
+
+const FRHIPipelineState* FRHIPipelineStateCache::FindOrCreate(const FRHIPipelineStateDesc& Desc)
+{
+	std::lock_guard Lock(Mutex);
+	if (const std::unique_ptr<FRHIPipelineState>* Found = States.Find(Desc))
+	{
+		return Found->get();
+	}
+
+	const uint32 Id = static_cast<uint32>(States.Num()) + 1;
+	std::unique_ptr<FRHIPipelineState>& State = States[Desc];
+	State.reset(new FRHIPipelineState(Desc, Id));
+	return State.get();
+}
+
+int32 FRHIPipelineStateCache::Num() const
+{
+	std::lock_guard Lock(Mutex);
+	return static_cast<int32>(States.Num());
+}
@@ -0,0 +1,84 @@
+#pragma once
+#include <memory>
+#include <mutex>
+
+#include "RHI.h"
+#include "Core/AbstractClass/Singleton.h"
+#include "Core/Container/Map.h"
+
+
+/** Draw 하나에 필요한 Shader / Input Layout / Topology / 고정 기능 State 묶음, 값이 같으면 같은 PSO */
+struct FRHIPipelineStateDesc
+{
+	FRHIVertexShader* VertexShader = nullptr;
+	FRHIPixelShader* PixelShader = nullptr;
+	FRHIInputLayout* InputLayout = nullptr;
+	ERHIPrimitiveTopology Topology = ERHIPrimitiveTopology::TriangleList;
+
+	FRHIRasterizerState* RasterizerState = nullptr;
+
+	FRHIBlendState* BlendState = nullptr;
+	float BlendFactor[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+	uint32 SampleMask = 0xffffffff;
+
+	FRHIDepthStencilState* DepthStencilState = nullptr;
+	uint32 StencilRef = 0;
+
+	bool operator==(const FRHIPipelineStateDesc&) const = default;
+};
+
+template <>
+struct std::hash<FRHIPipelineStateDesc>
+{
+	size_t operator()(const FRHIPipelineStateDesc& Desc) const noexcept;
+};
+
+
+/**
+ * 만든 뒤 바뀌지 않는 Pipeline State Object, FRHIPipelineStateCache만 만들 수 있습니다.
+ *
+ * Cache가 프로그램이 끝날 때까지 들고 있으므로 주소가 곧 Desc의 Identity입니다.
+ * 같은 PSO를 연달아 바인딩하면 FRHIStateTrackingContext가 비교 한 번으로 전부 건너뜁니다.
+ */
+class FRHIPipelineState
+{
+public:
+	FRHIPipelineState(const FRHIPipelineState&) = delete;
+	FRHIPipelineState& operator=(const FRHIPipelineState&) = delete;
+
+	const FRHIPipelineStateDesc& GetDesc() const { return Desc; }
+
+	/** 만들어진 순서, 1부터 */
+	uint32 GetId() const { return Id; }
+
+private:
+	friend class FRHIPipelineStateCache;
+
+	FRHIPipelineState(const FRHIPipelineStateDesc& InDesc, uint32 InId)
+		: Desc(InDesc)
+		, Id(InId)
+	{
+	}
+
+	const FRHIPipelineStateDesc Desc;
+	const uint32 Id;
+};
+
+
+/**
+ * Desc Hash로 PSO를 찾고, 없으면 만들어서 보관합니다. (어느 스레드에서나 호출 가능)
+ *
+ * PSO가 가리키는 Shader / State 핸들은 해제하지 않는다고 가정합니다. (FResource가 끝날 때까지 보관)
+ * Material / Mesh를 바꿀 때만 찾고, Draw마다 찾지 않도록 FRenderResourceCollection이 결과를 들고 있습니다.
+ */
+class FRHIPipelineStateCache : public TSingleton<FRHIPipelineStateCache>
+{
+public:
+	const FRHIPipelineState* FindOrCreate(const FRHIPipelineStateDesc& Desc);
+
+	int32 Num() const;
+
+private:
+	mutable std::mutex Mutex;
+	TMap<FRHIPipelineStateDesc, std::unique_ptr<FRHIPipelineState>> States;
+};
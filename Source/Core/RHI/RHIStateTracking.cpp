@@ -0,0 +1,206 @@
+#include "RHIStateTracking.h"
+
+#include "RHIPipelineState.h"
+#include "Core/Stats/StatCounter.h"
+
+
+namespace
+{
+#if STATS
+DECLARE_STAT_COUNTER(STAT_FilteredBinds, "RHI", "Filtered Binds");
+#endif
+
+/** PSO 하나에 들어 있는 바인딩 수 (Topology, Input Layout, Shader 2, State 3) */
+constexpr uint64 NumPipelineStateBinds = 7;
+}
+
+
+FRHIStateTrackingContext::FRHIStateTrackingContext(std::unique_ptr<FRHICommandContext> InInner)
+	: Inner(std::move(InInner))
+{
+}
+
+bool FRHIStateTrackingContext::Filter(bool bChanged)
+{
+	if (!bChanged)
+	{
+		++CurrentFrameFilteredBinds;
+	}
+	return bChanged;
+}
+
+FRHIBuffer* FRHIStateTrackingContext::CreateBuffer(ERHIBufferUsage Usage, uint32 Size, bool bDynamic, const void* InitialData)
+{
+	return Inner->CreateBuffer(Usage, Size, bDynamic, InitialData);
+}
+
+void FRHIStateTrackingContext::ReleaseBuffer(FRHIBuffer* Buffer)
+{
+	Bindings.ForgetBuffer(Buffer);
+	Inner->ReleaseBuffer(Buffer);
+}
+
+void FRHIStateTrackingContext::UpdateBuffer(FRHIBuffer* Buffer, const void* Data, uint32 Size)
+{
+	Inner->UpdateBuffer(Buffer, Data, Size);
+}
+
+bool FRHIStateTrackingContext::MapTexture(FRHITexture* Texture, ERHIMapMode Mode, FRHIMappedData& OutMapped)
+{
+	return Inner->MapTexture(Texture, Mode, OutMapped);
+}
+
+void FRHIStateTrackingContext::UnmapTexture(FRHITexture* Texture)
+{
+	Inner->UnmapTexture(Texture);
+}
+
+void FRHIStateTrackingContext::CopyTextureRegion(FRHITexture* Dest, uint32 DestX, uint32 DestY, FRHITexture* Source, const FRHIBox& SourceBox)
+{
+	Inner->CopyTextureRegion(Dest, DestX, DestY, Source, SourceBox);
+}
+
+void FRHIStateTrackingContext::SetVertexBuffer(FRHIBuffer* Buffer, uint32 Stride, uint32 Offset)
+{
+	if (Filter(Bindings.SetVertexBuffer(Buffer, Stride, Offset)))
+	{
+		Inner->SetVertexBuffer(Buffer, Stride, Offset);
+	}
+}
+
+void FRHIStateTrackingContext::SetIndexBuffer(FRHIBuffer* Buffer, ERHIIndexFormat Format, uint32 Offset)
+{
+	if (Filter(Bindings.SetIndexBuffer(Buffer, Format, Offset)))
+	{
+		Inner->SetIndexBuffer(Buffer, Format, Offset);
+	}
+}
+
+void FRHIStateTrackingContext::SetPrimitiveTopology(ERHIPrimitiveTopology Topology)
+{
+	CurrentPipelineState = nullptr;
+	if (Filter(Bindings.SetPrimitiveTopology(Topology)))
+	{
+		Inner->SetPrimitiveTopology(Topology);
+	}
+}
+
+void FRHIStateTrackingContext::SetInputLayout(FRHIInputLayout* InputLayout)
+{
+	CurrentPipelineState = nullptr;
+	if (Filter(Bindings.SetInputLayout(InputLayout)))
+	{
+		Inner->SetInputLayout(InputLayout);
+	}
+}
+
+void FRHIStateTrackingContext::SetVertexShader(FRHIVertexShader* Shader)
+{
+	CurrentPipelineState = nullptr;
+	if (Filter(Bindings.SetVertexShader(Shader)))
+	{
+		Inner->SetVertexShader(Shader);
+	}
+}
+
+void FRHIStateTrackingContext::SetPixelShader(FRHIPixelShader* Shader)
+{
+	CurrentPipelineState = nullptr;
+	if (Filter(Bindings.SetPixelShader(Shader)))
+	{
+		Inner->SetPixelShader(Shader);
+	}
+}
+
+void FRHIStateTrackingContext::SetConstantBuffer(ERHIShaderStage Stage, uint32 Slot, FRHIBuffer* Buffer)
+{
+	if (Filter(Bindings.SetConstantBuffer(Stage, Slot, Buffer)))
+	{
+		Inner->SetConstantBuffer(Stage, Slot, Buffer);
+	}
+}
+
+void FRHIStateTrackingContext::SetShaderResource(ERHIShaderStage Stage, uint32 Slot, FRHIShaderResourceView* View)
+{
+	if (Filter(Bindings.SetShaderResource(Stage, Slot, View)))
+	{
+		Inner->SetShaderResource(Stage, Slot, View);
+	}
+}
+
+void FRHIStateTrackingContext::SetSampler(ERHIShaderStage Stage, uint32 Slot, FRHISamplerState* Sampler)
+{
+	if (Filter(Bindings.SetSampler(Stage, Slot, Sampler)))
+	{
+		Inner->SetSampler(Stage, Slot, Sampler);
+	}
+}
+
+void FRHIStateTrackingContext::SetRasterizerState(FRHIRasterizerState* State)
+{
+	CurrentPipelineState = nullptr;
+	if (Filter(Bindings.SetRasterizerState(State)))
+	{
+		Inner->SetRasterizerState(State);
+	}
+}
+
+void FRHIStateTrackingContext::SetBlendState(FRHIBlendState* State, const float* BlendFactor, uint32 SampleMask)
+{
+	CurrentPipelineState = nullptr;
+	if (Filter(Bindings.SetBlendState(State, BlendFactor, SampleMask)))
+	{
+		Inner->SetBlendState(State, BlendFactor, SampleMask);
+	}
+}
+
+void FRHIStateTrackingContext::SetDepthStencilState(FRHIDepthStencilState* State, uint32 StencilRef)
+{
+	CurrentPipelineState = nullptr;
+	if (Filter(Bindings.SetDepthStencilState(State, StencilRef)))
+	{
+		Inner->SetDepthStencilState(State, StencilRef);
+	}
+}
+
+void FRHIStateTrackingContext::SetPipelineState(const FRHIPipelineState& State)
+{
+	if (CurrentPipelineState == &State)
+	{
+		CurrentFrameFilteredBinds += NumPipelineStateBinds;
+		return;
+	}
+
+	// 개별 Set*으로 나누되, 그 안에서 CurrentPipelineState가 지워지므로 끝난 뒤에 기록
+	FRHICommandContext::SetPipelineState(State);
+	CurrentPipelineState = &State;
+}
+
+void FRHIStateTrackingContext::Draw(uint32 VertexCount, uint32 StartVertex)
+{
+	Inner->Draw(VertexCount, StartVertex);
+}
+
+void FRHIStateTrackingContext::DrawIndexed(uint32 IndexCount, uint32 StartIndex, int32 BaseVertex)
+{
+	Inner->DrawIndexed(IndexCount, StartIndex, BaseVertex);
+}
+
+void FRHIStateTrackingContext::EndFrame()
+{
+#if STATS
+	INC_STAT_COUNTER(STAT_FilteredBinds, CurrentFrameFilteredBinds);
+#endif
+	LastFrameFilteredBinds = CurrentFrameFilteredBinds;
+	CurrentFrameFilteredBinds = 0;
+	Bindings.Invalidate();
+	CurrentPipelineState = nullptr;
+	Inner->EndFrame();
+}
+
+void FRHIStateTrackingContext::InvalidateState()
+{
+	Bindings.Invalidate();
+	CurrentPipelineState = nullptr;
+	Inner->InvalidateState();
+}
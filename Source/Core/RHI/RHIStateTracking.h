@@ -0,0 +1,78 @@
+#pragma once
+#include <memory>
+
+#include "RHI.h"
+#include "RHIBindingState.h"
+
+
+/**
+ * 다른 백엔드를 감싸서 이미 같은 값이 바인딩되어 있는 Set* 호출을 걸러내는 Decorator
+ *
+ * - 바인딩마다 FRHIBindingState와 비교해서 바뀐 것만 안쪽 백엔드로 전달합니다.
+ * - 직전과 같은 PSO를 다시 바인딩하면 주소 비교 한 번으로 PSO 전체를 건너뜁니다.
+ * - RHI를 거치지 않고 Device Context를 직접 쓴 뒤에는 InvalidateState를 불러야 합니다. (ImGui 등)
+ *   안전하게 EndFrame마다도 비우므로 프레임의 첫 바인딩은 항상 전달됩니다.
+ *
+ * ex) FRHI::SetContext(std::make_unique<FRHIStateTrackingContext>(std::make_unique<FD3D11RHI>(Device, DeviceContext)));
+ */
+class FRHIStateTrackingContext : public FRHICommandContext
+{
+public:
+	explicit FRHIStateTrackingContext(std::unique_ptr<FRHICommandContext> InInner);
+
+	FRHICommandContext& GetInner() const { return *Inner; }
+
+	/** 지금 쌓고 있는 프레임 / 마지막으로 끝난 프레임에 걸러낸 바인딩 수 */
+	uint64 GetCurrentFrameFilteredBinds() const { return CurrentFrameFilteredBinds; }
+	uint64 GetLastFrameFilteredBinds() const { return LastFrameFilteredBinds; }
+
+public:
+	virtual const char* GetName() const override { return Inner->GetName(); }
+
+	virtual FRHIBuffer* CreateBuffer(ERHIBufferUsage Usage, uint32 Size, bool bDynamic, const void* InitialData) override;
+	virtual void ReleaseBuffer(FRHIBuffer* Buffer) override;
+	virtual void UpdateBuffer(FRHIBuffer* Buffer, const void* Data, uint32 Size) override;
+
+	virtual bool MapTexture(FRHITexture* Texture, ERHIMapMode Mode, FRHIMappedData& OutMapped) override;
+	virtual void UnmapTexture(FRHITexture* Texture) override;
+	virtual void CopyTextureRegion(FRHITexture* Dest, uint32 DestX, uint32 DestY, FRHITexture* Source, const FRHIBox& SourceBox) override;
+
+	virtual void SetVertexBuffer(FRHIBuffer* Buffer, uint32 Stride, uint32 Offset) override;
+	virtual void SetIndexBuffer(FRHIBuffer* Buffer, ERHIIndexFormat Format, uint32 Offset) override;
+	virtual void SetPrimitiveTopology(ERHIPrimitiveTopology Topology) override;
+	virtual void SetInputLayout(FRHIInputLayout* InputLayout) override;
+
+	virtual void SetVertexShader(FRHIVertexShader* Shader) override;
+	virtual void SetPixelShader(FRHIPixelShader* Shader) override;
+	virtual void SetConstantBuffer(ERHIShaderStage Stage, uint32 Slot, FRHIBuffer* Buffer) override;
+	virtual void SetShaderResource(ERHIShaderStage Stage, uint32 Slot, FRHIShaderResourceView* View) override;
+	virtual void SetSampler(ERHIShaderStage Stage, uint32 Slot, FRHISamplerState* Sampler) override;
+
+	virtual void SetRasterizerState(FRHIRasterizerState* State) override;
+	virtual void SetBlendState(FRHIBlendState* State, const float* BlendFactor, uint32 SampleMask) override;
+	virtual void SetDepthStencilState(FRHIDepthStencilState* State, uint32 StencilRef) override;
+
+	/** PSO를 나눠서 바뀐 State만 안쪽 백엔드로 전달 */
+	virtual void SetPipelineState(const FRHIPipelineState& State) override;
+
+	virtual void Draw(uint32 VertexCount, uint32 StartVertex) override;
+	virtual void DrawIndexed(uint32 IndexCount, uint32 StartIndex, int32 BaseVertex) override;
+
+	virtual void EndFrame() override;
+	virtual void InvalidateState() override;
+
+private:
+	/** bChanged가 false면 걸러낸 것으로 세고 false */
+	bool Filter(bool bChanged);
+
+private:
+	std::unique_ptr<FRHICommandContext> Inner;
+
+	FRHIBindingState Bindings;
+
+	/** 마지막으로 바인딩한 PSO, PSO에 속한 State를 따로 바인딩하면 nullptr */
+	const FRHIPipelineState* CurrentPipelineState = nullptr;
+
+	uint64 CurrentFrameFilteredBinds = 0;
+	uint64 LastFrameFilteredBinds = 0;
+};
@@ -0,0 +1,287 @@
+#include "RHIStatsContext.h"
+
+#include <iterator>
+
+#include "RHIPipelineState.h"
+#include "Core/Stats/StatCounter.h"
+
+
+namespace
+{
+#if STATS
+DECLARE_STAT_COUNTER(STAT_DrawCalls, "RHI", "Draw Calls");
+DECLARE_STAT_COUNTER(STAT_Primitives, "RHI", "Primitives");
+DECLARE_STAT_COUNTER(STAT_StateBinds, "RHI", "State Binds");
+DECLARE_STAT_COUNTER(STAT_RedundantBinds, "RHI", "Redundant Binds");
+DECLARE_STAT_COUNTER(STAT_BufferUpdates, "RHI", "Buffer Maps");
+DECLARE_STAT_COUNTER(STAT_UploadedBytes, "RHI", "Buffer Upload Bytes");
+DECLARE_STAT_COUNTER(STAT_TextureMaps, "RHI", "Texture Maps");
+
+// ERHIBindCategory 순서
+FStatCounter GBindCounters[] = {
+	{ "RHI Binds", "Vertex Buffer" },
+	{ "RHI Binds", "Index Buffer" },
+	{ "RHI Binds", "Primitive Topology" },
+	{ "RHI Binds", "Input Layout" },
+	{ "RHI Binds", "Vertex Shader" },
+	{ "RHI Binds", "Pixel Shader" },
+	{ "RHI Binds", "Constant Buffer" },
+	{ "RHI Binds", "Shader Resource" },
+	{ "RHI Binds", "Sampler" },
+	{ "RHI Binds", "Rasterizer State" },
+	{ "RHI Binds", "Blend State" },
+	{ "RHI Binds", "Depth Stencil State" },
+};
+
+FStatCounter GRedundantBindCounters[] = {
+	{ "RHI Redundant Binds", "Vertex Buffer" },
+	{ "RHI Redundant Binds", "Index Buffer" },
+	{ "RHI Redundant Binds", "Primitive Topology" },
+	{ "RHI Redundant Binds", "Input Layout" },
+	{ "RHI Redundant Binds", "Vertex Shader" },
+	{ "RHI Redundant Binds", "Pixel Shader" },
+	{ "RHI Redundant Binds", "Constant Buffer" },
+	{ "RHI Redundant Binds", "Shader Resource" },
+	{ "RHI Redundant Binds", "Sampler" },
+	{ "RHI Redundant Binds", "Rasterizer State" },
+	{ "RHI Redundant Binds", "Blend State" },
+	{ "RHI Redundant Binds", "Depth Stencil State" },
+};
+
+static_assert(std::size(GBindCounters) == static_cast<size_t>(ERHIBindCategory::Num));
+static_assert(std::size(GRedundantBindCounters) == static_cast<size_t>(ERHIBindCategory::Num));
+#endif
+
+uint64 CountPrimitives(ERHIPrimitiveTopology Topology, uint32 NumVertices)
+{
+	switch (Topology)
+	{
+	case ERHIPrimitiveTopology::PointList:     return NumVertices;
+	case ERHIPrimitiveTopology::LineList:      return NumVertices / 2;
+	case ERHIPrimitiveTopology::LineStrip:     return NumVertices > 0 ? NumVertices - 1 : 0;
+	case ERHIPrimitiveTopology::TriangleList:  return NumVertices / 3;
+	case ERHIPrimitiveTopology::TriangleStrip: return NumVertices > 2 ? NumVertices - 2 : 0;
+	}
+	return 0;
+}
+}
+
+
+const char* LexToString(ERHIBindCategory Category)
+{
+	switch (Category)
+	{
+	case ERHIBindCategory::VertexBuffer:      return "Vertex Buffer";
+	case ERHIBindCategory::IndexBuffer:       return "Index Buffer";
+	case ERHIBindCategory::PrimitiveTopology: return "Primitive Topology";
+	case ERHIBindCategory::InputLayout:       return "Input Layout";
+	case ERHIBindCategory::VertexShader:      return "Vertex Shader";
+	case ERHIBindCategory::PixelShader:       return "Pixel Shader";
+	case ERHIBindCategory::ConstantBuffer:    return "Constant Buffer";
+	case ERHIBindCategory::ShaderResource:    return "Shader Resource";
+	case ERHIBindCategory::Sampler:           return "Sampler";
+	case ERHIBindCategory::RasterizerState:   return "Rasterizer State";
+	case ERHIBindCategory::BlendState:        return "Blend State";
+	case ERHIBindCategory::DepthStencilState: return "Depth Stencil State";
+	case ERHIBindCategory::Num:               break;
+	}
+	return "Unknown";
+}
+
+uint64 FRHIFrameStats::GetTotalBinds() const
+{
+	uint64 Total = 0;
+	for (const uint64 Count : NumBinds)
+	{
+		Total += Count;
+	}
+	return Total;
+}
+
+uint64 FRHIFrameStats::GetTotalRedundantBinds() const
+{
+	uint64 Total = 0;
+	for (const uint64 Count : NumRedundantBinds)
+	{
+		Total += Count;
+	}
+	return Total;
+}
+
+
+FRHIStatsContext::FRHIStatsContext(std::unique_ptr<FRHICommandContext> InInner)
+	: Inner(std::move(InInner))
+{
+}
+
+void FRHIStatsContext::CountBind(ERHIBindCategory Category, bool bChanged)
+{
+	const int32 Index = static_cast<int32>(Category);
+	++CurrentFrame.NumBinds[Index];
+	if (!bChanged)
+	{
+		++CurrentFrame.NumRedundantBinds[Index];
+	}
+}
+
+FRHIBuffer* FRHIStatsContext::CreateBuffer(ERHIBufferUsage Usage, uint32 Size, bool bDynamic, const void* InitialData)
+{
+	return Inner->CreateBuffer(Usage, Size, bDynamic, InitialData);
+}
+
+void FRHIStatsContext::ReleaseBuffer(FRHIBuffer* Buffer)
+{
+	Bindings.ForgetBuffer(Buffer);
+	Inner->ReleaseBuffer(Buffer);
+}
+
+void FRHIStatsContext::UpdateBuffer(FRHIBuffer* Buffer, const void* Data, uint32 Size)
+{
+	++CurrentFrame.NumBufferUpdates;
+	CurrentFrame.UploadedBytes += Size;
+	Inner->UpdateBuffer(Buffer, Data, Size);
+}
+
+bool FRHIStatsContext::MapTexture(FRHITexture* Texture, ERHIMapMode Mode, FRHIMappedData& OutMapped)
+{
+	++CurrentFrame.NumTextureMaps;
+	return Inner->MapTexture(Texture, Mode, OutMapped);
+}
+
+void FRHIStatsContext::UnmapTexture(FRHITexture* Texture)
+{
+	Inner->UnmapTexture(Texture);
+}
+
+void FRHIStatsContext::CopyTextureRegion(FRHITexture* Dest, uint32 DestX, uint32 DestY, FRHITexture* Source, const FRHIBox& SourceBox)
+{
+	Inner->CopyTextureRegion(Dest, DestX, DestY, Source, SourceBox);
+}
+
+void FRHIStatsContext::SetVertexBuffer(FRHIBuffer* Buffer, uint32 Stride, uint32 Offset)
+{
+	CountBind(ERHIBindCategory::VertexBuffer, Bindings.SetVertexBuffer(Buffer, Stride, Offset));
+	Inner->SetVertexBuffer(Buffer, Stride, Offset);
+}
+
+void FRHIStatsContext::SetIndexBuffer(FRHIBuffer* Buffer, ERHIIndexFormat Format, uint32 Offset)
+{
+	CountBind(ERHIBindCategory::IndexBuffer, Bindings.SetIndexBuffer(Buffer, Format, Offset));
+	Inner->SetIndexBuffer(Buffer, Format, Offset);
+}
+
+void FRHIStatsContext::SetPrimitiveTopology(ERHIPrimitiveTopology Topology)
+{
+	CountBind(ERHIBindCategory::PrimitiveTopology, Bindings.SetPrimitiveTopology(Topology));
+	Inner->SetPrimitiveTopology(Topology);
+}
+
+void FRHIStatsContext::SetInputLayout(FRHIInputLayout* InputLayout)
+{
+	CountBind(ERHIBindCategory::InputLayout, Bindings.SetInputLayout(InputLayout));
+	Inner->SetInputLayout(InputLayout);
+}
+
+void FRHIStatsContext::SetVertexShader(FRHIVertexShader* Shader)
+{
+	CountBind(ERHIBindCategory::VertexShader, Bindings.SetVertexShader(Shader));
+	Inner->SetVertexShader(Shader);
+}
+
+void FRHIStatsContext::SetPixelShader(FRHIPixelShader* Shader)
+{
+	CountBind(ERHIBindCategory::PixelShader, Bindings.SetPixelShader(Shader));
+	Inner->SetPixelShader(Shader);
+}
+
+void FRHIStatsContext::SetConstantBuffer(ERHIShaderStage Stage, uint32 Slot, FRHIBuffer* Buffer)
+{
+	CountBind(ERHIBindCategory::ConstantBuffer, Bindings.SetConstantBuffer(Stage, Slot, Buffer));
+	Inner->SetConstantBuffer(Stage, Slot, Buffer);
+}
+
+void FRHIStatsContext::SetShaderResource(ERHIShaderStage Stage, uint32 Slot, FRHIShaderResourceView* View)
+{
+	CountBind(ERHIBindCategory::ShaderResource, Bindings.SetShaderResource(Stage, Slot, View));
+	Inner->SetShaderResource(Stage, Slot, View);
+}
+
+void FRHIStatsContext::SetSampler(ERHIShaderStage Stage, uint32 Slot, FRHISamplerState* Sampler)
+{
+	CountBind(ERHIBindCategory::Sampler, Bindings.SetSampler(Stage, Slot, Sampler));
+	Inner->SetSampler(Stage, Slot, Sampler);
+}
+
+void FRHIStatsContext::SetRasterizerState(FRHIRasterizerState* State)
+{
+	CountBind(ERHIBindCategory::RasterizerState, Bindings.SetRasterizerState(State));
+	Inner->SetRasterizerState(State);
+}
+
+void FRHIStatsContext::SetBlendState(FRHIBlendState* State, const float* BlendFactor, uint32 SampleMask)
+{
+	CountBind(ERHIBindCategory::BlendState, Bindings.SetBlendState(State, BlendFactor, SampleMask));
+	Inner->SetBlendState(State, BlendFactor, SampleMask);
+}
+
+void FRHIStatsContext::SetDepthStencilState(FRHIDepthStencilState* State, uint32 StencilRef)
+{
+	CountBind(ERHIBindCategory::DepthStencilState, Bindings.SetDepthStencilState(State, StencilRef));
+	Inner->SetDepthStencilState(State, StencilRef);
+}
+
+void FRHIStatsContext::SetPipelineState(const FRHIPipelineState& State)
+{
+	const FRHIPipelineStateDesc& Desc = State.GetDesc();
+	CountBind(ERHIBindCategory::PrimitiveTopology, Bindings.SetPrimitiveTopology(Desc.Topology));
+	CountBind(ERHIBindCategory::InputLayout, Bindings.SetInputLayout(Desc.InputLayout));
+	CountBind(ERHIBindCategory::VertexShader, Bindings.SetVertexShader(Desc.VertexShader));
+	CountBind(ERHIBindCategory::RasterizerState, Bindings.SetRasterizerState(Desc.RasterizerState));
+	CountBind(ERHIBindCategory::PixelShader, Bindings.SetPixelShader(Desc.PixelShader));
+	CountBind(ERHIBindCategory::BlendState, Bindings.SetBlendState(Desc.BlendState, Desc.BlendFactor, Desc.SampleMask));
+	CountBind(ERHIBindCategory::DepthStencilState, Bindings.SetDepthStencilState(Desc.DepthStencilState, Desc.StencilRef));
+	Inner->SetPipelineState(State);
+}
+
+void FRHIStatsContext::Draw(uint32 VertexCount, uint32 StartVertex)
+{
+	++CurrentFrame.NumDrawCalls;
+	CurrentFrame.NumPrimitives += CountPrimitives(Bindings.GetTopology(), VertexCount);
+	Inner->Draw(VertexCount, StartVertex);
+}
+
+void FRHIStatsContext::DrawIndexed(uint32 IndexCount, uint32 StartIndex, int32 BaseVertex)
+{
+	++CurrentFrame.NumDrawCalls;
+	CurrentFrame.NumPrimitives += CountPrimitives(Bindings.GetTopology(), IndexCount);
+	Inner->DrawIndexed(IndexCount, StartIndex, BaseVertex);
+}
+
+void FRHIStatsContext::EndFrame()
+{
+#if STATS
+	INC_STAT_COUNTER(STAT_DrawCalls, CurrentFrame.NumDrawCalls);
+	INC_STAT_COUNTER(STAT_Primitives, CurrentFrame.NumPrimitives);
+	INC_STAT_COUNTER(STAT_StateBinds, CurrentFrame.GetTotalBinds());
+	INC_STAT_COUNTER(STAT_RedundantBinds, CurrentFrame.GetTotalRedundantBinds());
+	INC_STAT_COUNTER(STAT_BufferUpdates, CurrentFrame.NumBufferUpdates);
+	INC_STAT_COUNTER(STAT_UploadedBytes, CurrentFrame.UploadedBytes);
+	INC_STAT_COUNTER(STAT_TextureMaps, CurrentFrame.NumTextureMaps);
+	for (int32 Index = 0; Index < static_cast<int32>(ERHIBindCategory::Num); ++Index)
+	{
+		INC_STAT_COUNTER(GBindCounters[Index], CurrentFrame.NumBinds[Index]);
+		INC_STAT_COUNTER(GRedundantBindCounters[Index], CurrentFrame.NumRedundantBinds[Index]);
+	}
+#endif
+
+	LastFrame = CurrentFrame;
+	CurrentFrame = {};
+	Bindings.Invalidate();
+	Inner->EndFrame();
+}
+
+void FRHIStatsContext::InvalidateState()
+{
+	Bindings.Invalidate();
+	Inner->InvalidateState();
+}
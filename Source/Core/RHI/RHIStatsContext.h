@@ -0,0 +1,117 @@
+#pragma once
+#include <memory>
+
+#include "RHI.h"
+#include "RHIBindingState.h"
+
+
+/** 바인딩 종류, 종류별로 호출 수와 이미 같은 값이 바인딩되어 있던 (중복) 호출 수를 셉니다. */
+enum class ERHIBindCategory : uint8
+{
+	VertexBuffer,
+	IndexBuffer,
+	PrimitiveTopology,
+	InputLayout,
+	VertexShader,
+	PixelShader,
+	ConstantBuffer,
+	ShaderResource,
+	Sampler,
+	RasterizerState,
+	BlendState,
+	DepthStencilState,
+
+	Num
+};
+
+const char* LexToString(ERHIBindCategory Category);
+
+
+/** FRHIStatsContext가 한 프레임 동안 센 값 */
+struct FRHIFrameStats
+{
+	uint64 NumDrawCalls = 0;
+
+	/** Topology 기준 삼각형 / 선 / 점 수 */
+	uint64 NumPrimitives = 0;
+
+	/** UpdateBuffer (Map / Unmap) 횟수와 Byte */
+	uint64 NumBufferUpdates = 0;
+	uint64 UploadedBytes = 0;
+	uint64 NumTextureMaps = 0;
+
+	uint64 NumBinds[static_cast<int32>(ERHIBindCategory::Num)] = {};
+	uint64 NumRedundantBinds[static_cast<int32>(ERHIBindCategory::Num)] = {};
+
+	uint64 GetTotalBinds() const;
+	uint64 GetTotalRedundantBinds() const;
+};
+
+
+/**
+ * 다른 백엔드를 감싸서 Draw Call, 상태 바인딩, 버퍼 업로드를 세고 그대로 전달하는 Decorator
+ *
+ * - 호출마다는 Render Thread 전용 멤버만 올리고, EndFrame에서 한 번에 FStatCounter ("RHI" Group 등)로 옮깁니다.
+ * - 마지막으로 바인딩한 값을 기억해서 (FRHIBindingState) 같은 값을 다시 바인딩한 호출을 중복으로 셉니다. (걸러내는 것은 FRHIStateTrackingContext)
+ * - ImGui처럼 RHI를 거치지 않고 Device Context를 직접 쓰는 코드가 있으므로, 기억한 바인딩은 EndFrame마다 비웁니다.
+ *
+ * ex) FRHI::SetContext(std::make_unique<FRHIStatsContext>(std::make_unique<FD3D11RHI>(Device, DeviceContext)));
+ */
+class FRHIStatsContext : public FRHICommandContext
+{
+public:
+	explicit FRHIStatsContext(std::unique_ptr<FRHICommandContext> InInner);
+
+	FRHICommandContext& GetInner() const { return *Inner; }
+
+	/** 지금 쌓고 있는 프레임 / 마지막으로 끝난 프레임 */
+	const FRHIFrameStats& GetCurrentFrameStats() const { return CurrentFrame; }
+	const FRHIFrameStats& GetLastFrameStats() const { return LastFrame; }
+
+public:
+	virtual const char* GetName() const override { return Inner->GetName(); }
+
+	virtual FRHIBuffer* CreateBuffer(ERHIBufferUsage Usage, uint32 Size, bool bDynamic, const void* InitialData) override;
+	virtual void ReleaseBuffer(FRHIBuffer* Buffer) override;
+	virtual void UpdateBuffer(FRHIBuffer* Buffer, const void* Data, uint32 Size) override;
+
+	virtual bool MapTexture(FRHITexture* Texture, ERHIMapMode Mode, FRHIMappedData& OutMapped) override;
+	virtual void UnmapTexture(FRHITexture* Texture) override;
+	virtual void CopyTextureRegion(FRHITexture* Dest, uint32 DestX, uint32 DestY, FRHITexture* Source, const FRHIBox& SourceBox) override;
+
+	virtual void SetVertexBuffer(FRHIBuffer* Buffer, uint32 Stride, uint32 Offset) override;
+	virtual void SetIndexBuffer(FRHIBuffer* Buffer, ERHIIndexFormat Format, uint32 Offset) override;
+	virtual void SetPrimitiveTopology(ERHIPrimitiveTopology Topology) override;
+	virtual void SetInputLayout(FRHIInputLayout* InputLayout) override;
+
+	virtual void SetVertexShader(FRHIVertexShader* Shader) override;
+	virtual void SetPixelShader(FRHIPixelShader* Shader) override;
+	virtual void SetConstantBuffer(ERHIShaderStage Stage, uint32 Slot, FRHIBuffer* Buffer) override;
+	virtual void SetShaderResource(ERHIShaderStage Stage, uint32 Slot, FRHIShaderResourceView* View) override;
+	virtual void SetSampler(ERHIShaderStage Stage, uint32 Slot, FRHISamplerState* Sampler) override;
+
+	virtual void SetRasterizerState(FRHIRasterizerState* State) override;
+	virtual void SetBlendState(FRHIBlendState* State, const float* BlendFactor, uint32 SampleMask) override;
+	virtual void SetDepthStencilState(FRHIDepthStencilState* State, uint32 StencilRef) override;
+
+	/** PSO의 바인딩을 하나씩 세고, 안쪽 백엔드에는 PSO 그대로 전달 */
+	virtual void SetPipelineState(const FRHIPipelineState& State) override;
+
+	virtual void Draw(uint32 VertexCount, uint32 StartVertex) override;
+	virtual void DrawIndexed(uint32 IndexCount, uint32 StartIndex, int32 BaseVertex) override;
+
+	virtual void EndFrame() override;
+	virtual void InvalidateState() override;
+
+private:
+	/** 바인딩 하나를 셈, bChanged가 false면 (이미 같은 값이 바인딩되어 있었으면) 중복으로도 셈 */
+	void CountBind(ERHIBindCategory Category, bool bChanged);
+
+private:
+	std::unique_ptr<FRHICommandContext> Inner;
+
+	FRHIFrameStats CurrentFrame;
+	FRHIFrameStats LastFrame;
+
+	FRHIBindingState Bindings;
+};
@@ -0,0 +1,21 @@
+#include "DrawCommandList.h"
+
+
+void FDrawCommandList::Reset()
+{
+	Entries.Empty();
+	Commands.Empty();
+}
+
+int32 FDrawCommandList::Add(uint64 SortKey, UPrimitiveComponent* Component, const FRHIPipelineState* PipelineState, const FConstantsComponentData& Constants)
+{
+	const int32 CommandIndex = Commands.Num();
+	Commands.Add(FDrawCommand{ Component, PipelineState, Constants });
+	Entries.Add(FSortEntry{ SortKey, static_cast<uint32>(CommandIndex) });
+	return CommandIndex;
+}
+
+void FDrawCommandList::Sort()
+{
+	ParallelAlgo::ParallelRadixSort(Entries, [](const FSortEntry& Entry) { return Entry.Key; });
+}
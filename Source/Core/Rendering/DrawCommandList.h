@@ -0,0 +1,100 @@
+#pragma once
+
+#include "Core/Async/ParallelAlgorithms.h"
+#include "Core/Container/Array.h"
+#include "Core/HAL/PlatformType.h"
+#include "Object/PrimitiveComponent/UPrimitiveComponent.h"
+
+
+/** Draw를 나누는 단계, 정렬 키의 최상위 비트라서 Pass 순서대로 제출됩니다. */
+enum class EDrawPass : uint8
+{
+	/** 씬 깊이 버퍼, 앞에서 뒤로 */
+	Main,
+
+	/** 비어 있는 별도 깊이 버퍼 (Gizmo처럼 항상 위에 보이는 ZIgnore Component) */
+	Foreground,
+
+	Num
+};
+
+
+/**
+ * 64bit Draw 정렬 키 [Pass 4 | Material 16 | Mesh 16 | Depth 28]
+ *
+ * 같은 Material끼리, 그 안에서 같은 Mesh끼리 모여서 Shader / State와 Vertex / Index Buffer 바인딩이 줄고,
+ * 같은 Material + Mesh 안에서는 카메라에서 가까운 것부터 그려서 Early-Z가 잘 걸립니다.
+ * Id는 하위 16bit만 쓰므로 65536개가 넘으면 다른 리소스가 같은 묶음에 섞일 수 있습니다. (순서만 나빠짐)
+ */
+namespace DrawSortKey
+{
+	constexpr uint32 DepthBits = 28;
+	constexpr uint32 MeshBits = 16;
+	constexpr uint32 MaterialBits = 16;
+
+	constexpr uint32 MeshShift = DepthBits;
+	constexpr uint32 MaterialShift = MeshShift + MeshBits;
+	constexpr uint32 PassShift = MaterialShift + MaterialBits;
+
+	/** @param ViewDepth 카메라 앞 방향으로의 거리, 음수도 순서가 유지됨 */
+	FORCEINLINE uint64 Make(EDrawPass Pass, uint32 MaterialId, uint32 MeshId, float ViewDepth)
+	{
+		const uint64 Depth = ParallelAlgo::FloatToRadixKey(ViewDepth) >> (32 - DepthBits);
+		return (static_cast<uint64>(Pass) << PassShift)
+			| (static_cast<uint64>(MaterialId & ((1u << MaterialBits) - 1)) << MaterialShift)
+			| (static_cast<uint64>(MeshId & ((1u << MeshBits) - 1)) << MeshShift)
+			| Depth;
+	}
+
+	FORCEINLINE EDrawPass GetPass(uint64 Key)
+	{
+		return static_cast<EDrawPass>(Key >> PassShift);
+	}
+}
+
+
+/** 정렬 키에 딸린 Payload, 제출할 때 Component의 상수 버퍼에 Constants를 넣고 PipelineState로 그립니다. */
+struct FDrawCommand
+{
+	UPrimitiveComponent* Component = nullptr;
+
+	/** Game Thread에서 FRenderResourceCollection::ResolvePipelineState로 찾아 둔 PSO (Cache가 소유) */
+	const class FRHIPipelineState* PipelineState = nullptr;
+	FConstantsComponentData Constants;
+};
+
+
+/**
+ * 한 프레임의 Draw 목록, Game Thread에서 Add → Sort 한 뒤 Render Thread에서 정렬 순서대로 제출합니다.
+ *
+ * Payload는 Add 순서대로 두고 (Key, Index)만 Radix Sort 하므로 정렬 중에 큰 상수 데이터를 옮기지 않습니다.
+ * Reset은 메모리를 유지하므로 프레임마다 재사용하면 할당이 없습니다.
+ */
+class FDrawCommandList
+{
+public:
+	void Reset();
+
+	/** @return Add 순서의 Command Index */
+	int32 Add(uint64 SortKey, UPrimitiveComponent* Component, const FRHIPipelineState* PipelineState, const FConstantsComponentData& Constants);
+
+	/** Key 오름차순 안정 정렬, Sort하지 않으면 Add 순서 그대로 제출 */
+	void Sort();
+
+	int32 Num() const { return Entries.Num(); }
+
+	/** 제출 순서 (Sort 이후면 정렬 순서)로 Index번째 */
+	uint64 GetSortKey(int32 Index) const { return Entries[Index].Key; }
+	int32 GetCommandIndex(int32 Index) const { return static_cast<int32>(Entries[Index].CommandIndex); }
+	const FDrawCommand& GetCommand(int32 Index) const { return Commands[Entries[Index].CommandIndex]; }
+
+private:
+	struct FSortEntry
+	{
+		uint64 Key;
+		uint32 CommandIndex;
+	};
+
+	TArray<FSortEntry> Entries;
+	TArray<FDrawCommand> Commands;
+};
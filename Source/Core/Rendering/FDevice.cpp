@@ -1,6 +1,5 @@
 #include "FDevice.h"
 
-#include "DirectXTK/SimpleMath.h"
 #include <Debug/DebugConsole.h>
 #include "Static/FEditorManager.h"
 #include "Resource/Texture.h"
@@ -60,6 +60,9 @@ public:
 	//렌더러에 필요한 기본 리소스 생성
 	void InitResource();
 
+	/** 기본 Mesh만 생성 (Headless 모드에서는 Device 없이 CPU 데이터만 만들어짐) */
+	void InitMeshResource();
+
 	
 private:
 	// Direct3D 11 장치(Device)와 장치 컨텍스트(Device Context) 및 스왑 체인(Swap Chain)을 관리하기 위한 포인터들
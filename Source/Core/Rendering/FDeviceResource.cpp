@@ -197,6 +197,11 @@ void FDevice::InitResource()
 		Mat->SetPixelShader("Simple_PS");
 	}
 
+	InitMeshResource();
+}
+
+void FDevice::InitMeshResource()
+{
 	/// Mesh
 	{
 		TArray<FVertexSimple> vertices;
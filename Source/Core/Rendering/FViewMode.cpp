@@ -1,5 +1,6 @@
 #include "FViewMode.h"
 #include "Core/Rendering/FDevice.h" 
+#include "Core/RHI/D3D11RHI.h"
 
 void FViewMode::Initialize(ID3D11Device* InDevice)
 {
@@ -49,9 +50,15 @@ void FViewMode::SetViewMode(EViewModeIndex ViewMode)
 	CurrentViewMode = ViewMode;
 }
 
+ID3D11RasterizerState* FViewMode::GetRasterizerState() const
+{
+	ID3D11RasterizerState* const* State = RasterizerStates.Find(CurrentViewMode);
+	return State != nullptr ? *State : nullptr;
+}
+
 void FViewMode::ApplyViewMode()
 {
-	FDevice::Get().GetDeviceContext()->RSSetState(RasterizerStates[CurrentViewMode]);
+	FRHI::Get().SetRasterizerState(D3D11RHI::ToRHI(RasterizerStates[CurrentViewMode]));
 	
 	// auto res = RasterizerStates.Find(CurrentViewMode);
 	// if (res)
@@ -29,6 +29,9 @@ public:
 	void ApplyViewMode();
 
 	EViewModeIndex GetViewMode() const { return CurrentViewMode; }
+
+	/** 현재 View Mode의 Rasterizer State, Default처럼 없으면 nullptr */
+	ID3D11RasterizerState* GetRasterizerState() const;
 private:
 	FViewMode() : CurrentViewMode(EViewModeIndex::VMI_Solid), Device(nullptr) {}
 	~FViewMode();
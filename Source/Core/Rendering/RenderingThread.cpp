@@ -0,0 +1,314 @@
+#include "RenderingThread.h"
+
+#include <chrono>
+
+#include "Core/Stats/Stats.h"
+#include "Debug/DebugConsole.h"
+
+
+namespace
+{
+// Render Command를 실행 중인 스레드 (Inline 모드에서는 Game Thread)
+thread_local bool GIsExecutingRenderCommands = false;
+
+double ToMs(std::chrono::steady_clock::duration Duration)
+{
+	return std::chrono::duration<double, std::milli>(Duration).count();
+}
+}
+
+
+FRenderCommandList::~FRenderCommandList()
+{
+	// 실행되지 않은 Command의 캡처 변수만 정리합니다.
+	Reset(false);
+}
+
+void FRenderCommandList::ExecuteAndReset()
+{
+	Reset(true);
+}
+
+size_t FRenderCommandList::GetAllocatedSize() const
+{
+	size_t Size = 0;
+	for (const FBlock& Block : Blocks)
+	{
+		Size += Block.Size;
+	}
+	return Size;
+}
+
+void* FRenderCommandList::Allocate(size_t Size, size_t Alignment)
+{
+	while (true)
+	{
+		if (CurrentBlock < static_cast<int32>(Blocks.size()))
+		{
+			FBlock& Block = Blocks[CurrentBlock];
+			const uintptr_t Base = reinterpret_cast<uintptr_t>(Block.Memory.get());
+			const uintptr_t Aligned = (Base + CurrentOffset + Alignment - 1) & ~(static_cast<uintptr_t>(Alignment) - 1);
+			const size_t NewOffset = Aligned - Base + Size;
+			if (NewOffset <= Block.Size)
+			{
+				CurrentOffset = NewOffset;
+				return reinterpret_cast<void*>(Aligned);
+			}
+
+			// 다음 블록으로 넘어갑니다. (다음 블록이 작으면 새로 할당)
+			++CurrentBlock;
+			CurrentOffset = 0;
+			if (CurrentBlock < static_cast<int32>(Blocks.size()) && Blocks[CurrentBlock].Size >= Size + Alignment)
+			{
+				continue;
+			}
+		}
+
+		const size_t NewBlockSize = Size + Alignment > BlockSize ? Size + Alignment : BlockSize;
+		FBlock NewBlock;
+		NewBlock.Memory = std::make_unique<uint8[]>(NewBlockSize);
+		NewBlock.Size = NewBlockSize;
+		Blocks.insert(Blocks.begin() + CurrentBlock, std::move(NewBlock));
+		CurrentOffset = 0;
+	}
+}
+
+void FRenderCommandList::Reset(bool bExecute)
+{
+	FCommandHeader* Header = Head;
+	while (Header)
+	{
+		// Invoke가 람다를 소멸시키므로 Next를 먼저 읽어둡니다.
+		FCommandHeader* Next = Header->Next;
+		Header->Invoke(Header->Lambda, bExecute);
+		Header = Next;
+	}
+
+	Head = nullptr;
+	Tail = nullptr;
+	NumCommands = 0;
+	CurrentBlock = 0;
+	CurrentOffset = 0;
+}
+
+
+FRenderingThread::~FRenderingThread()
+{
+	Stop();
+}
+
+void FRenderingThread::Start(int32 InMaxFrameLag, bool bInUseThread)
+{
+	if (bIsRunning)
+	{
+		return;
+	}
+
+	SetMaxFrameLag(InMaxFrameLag);
+	bUseThread = bInUseThread;
+	bIsStopping = false;
+
+	SubmittedFrame = 0;
+	KickedBatches = 0;
+	CompletedFrame = 0;
+	ExecutedBatches = 0;
+	GameThreadWaitMs = 0.0;
+	RenderThreadFrameMs = 0.0;
+
+	RecordingList = AcquireCommandList();
+	bIsRunning = true;
+
+	if (bUseThread)
+	{
+		Thread = std::thread([this] { RenderThreadMain(); });
+	}
+}
+
+void FRenderingThread::Stop()
+{
+	if (!bIsRunning)
+	{
+		return;
+	}
+
+	Flush();
+
+	if (Thread.joinable())
+	{
+		{
+			std::lock_guard Lock(QueueMutex);
+			bIsStopping = true;
+		}
+		QueueCondition.notify_all();
+		Thread.join();
+	}
+
+	bIsRunning = false;
+	DeferredReleases.clear();
+
+	FreeLists.push_back(RecordingList);
+	RecordingList = nullptr;
+}
+
+bool FRenderingThread::IsInRenderingThread()
+{
+	return GIsExecutingRenderCommands;
+}
+
+void FRenderingThread::DeferRelease(std::shared_ptr<void> Object)
+{
+	if (!bIsRunning)
+	{
+		return;
+	}
+	DeferredReleases.push_back({GetFrameNumber(), std::move(Object)});
+}
+
+void FRenderingThread::EndFrame()
+{
+	if (!bIsRunning)
+	{
+		return;
+	}
+
+	++SubmittedFrame;
+	Kick(SubmittedFrame);
+
+	// Frame Fence: Render Thread가 MaxFrameLag 프레임 이내로 따라올 때까지 대기
+	const auto WaitStart = std::chrono::steady_clock::now();
+	{
+		SCOPE_CYCLE_COUNTER("Wait for RenderThread");
+		std::unique_lock Lock(CompletionMutex);
+		CompletionCondition.wait(Lock, [this]
+		{
+			return SubmittedFrame - CompletedFrame.load(std::memory_order_acquire) <= static_cast<uint64>(GetMaxFrameLag());
+		});
+	}
+	GameThreadWaitMs = ToMs(std::chrono::steady_clock::now() - WaitStart);
+
+	ReleaseCompletedObjects();
+}
+
+void FRenderingThread::Flush()
+{
+	if (!bIsRunning || IsInRenderingThread())
+	{
+		return;
+	}
+
+	Kick(0);
+
+	std::unique_lock Lock(CompletionMutex);
+	CompletionCondition.wait(Lock, [this]
+	{
+		return ExecutedBatches.load(std::memory_order_acquire) == KickedBatches;
+	});
+}
+
+void FRenderingThread::SetMaxFrameLag(int32 InMaxFrameLag)
+{
+	MaxFrameLag.store(InMaxFrameLag < 0 ? 0 : InMaxFrameLag, std::memory_order_relaxed);
+}
+
+void FRenderingThread::RenderThreadMain()
+{
+	PROFILER_THREAD_NAME("RenderThread");
+
+	while (true)
+	{
+		FBatch Batch;
+		{
+			std::unique_lock Lock(QueueMutex);
+			QueueCondition.wait(Lock, [this] { return !PendingBatches.empty() || bIsStopping; });
+			if (PendingBatches.empty())
+			{
+				break;
+			}
+			Batch = PendingBatches.front();
+			PendingBatches.pop_front();
+		}
+		ExecuteBatch(Batch);
+	}
+}
+
+void FRenderingThread::Kick(uint64 EndOfFrame)
+{
+	if (RecordingList->IsEmpty() && EndOfFrame == 0)
+	{
+		return;
+	}
+
+	const FBatch Batch{RecordingList, EndOfFrame};
+	RecordingList = AcquireCommandList();
+	++KickedBatches;
+
+	if (bUseThread)
+	{
+		{
+			std::lock_guard Lock(QueueMutex);
+			PendingBatches.push_back(Batch);
+		}
+		QueueCondition.notify_one();
+	}
+	else
+	{
+		ExecuteBatch(Batch);
+	}
+}
+
+void FRenderingThread::ExecuteBatch(const FBatch& Batch)
+{
+	// 한 프레임이 여러 Batch로 나뉘어 실행될 수 있으므로 (Flush) 누적해서 측정합니다.
+	static thread_local double FrameAccumMs = 0.0;
+
+	const auto Start = std::chrono::steady_clock::now();
+	GIsExecutingRenderCommands = true;
+	{
+		SCOPE_CYCLE_COUNTER("Render Commands");
+		Batch.Commands->ExecuteAndReset();
+	}
+	GIsExecutingRenderCommands = false;
+	FrameAccumMs += ToMs(std::chrono::steady_clock::now() - Start);
+
+	{
+		std::lock_guard Lock(QueueMutex);
+		FreeLists.push_back(Batch.Commands);
+	}
+
+	{
+		std::lock_guard Lock(CompletionMutex);
+		if (Batch.EndOfFrame != 0)
+		{
+			RenderThreadFrameMs.store(FrameAccumMs, std::memory_order_relaxed);
+			FrameAccumMs = 0.0;
+			CompletedFrame.store(Batch.EndOfFrame, std::memory_order_release);
+		}
+		ExecutedBatches.fetch_add(1, std::memory_order_release);
+	}
+	CompletionCondition.notify_all();
+}
+
+void FRenderingThread::ReleaseCompletedObjects()
+{
+	const uint64 Completed = CompletedFrame.load(std::memory_order_acquire);
+	while (!DeferredReleases.empty() && DeferredReleases.front().Frame <= Completed)
+	{
+		DeferredReleases.pop_front();
+	}
+}
+
+FRenderCommandList* FRenderingThread::AcquireCommandList()
+{
+	{
+		std::lock_guard Lock(QueueMutex);
+		if (!FreeLists.empty())
+		{
+			FRenderCommandList* List = FreeLists.back();
+			FreeLists.pop_back();
+			return List;
+		}
+	}
+
+	AllLists.push_back(std::make_unique<FRenderCommandList>());
+	return AllLists.back().get();
+}
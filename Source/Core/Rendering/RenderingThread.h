@@ -0,0 +1,234 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Core/AbstractClass/Singleton.h"
+#include "Core/HAL/PlatformType.h"
+
+
+/**
+ * 한 프레임 동안 기록된 Render Command 목록
+ *
+ * Command(람다)는 큰 블록에 연속으로 배치(Placement New)되므로, Command마다 힙 할당이 일어나지 않습니다.
+ * 블록은 Reset 이후에도 재사용됩니다.
+ */
+class FRenderCommandList
+{
+	struct FCommandHeader
+	{
+		// bExecute가 false면 실행하지 않고 소멸만 시킵니다.
+		void (*Invoke)(void* Lambda, bool bExecute);
+		void* Lambda;
+		FCommandHeader* Next;
+	};
+
+	struct FBlock
+	{
+		std::unique_ptr<uint8[]> Memory;
+		size_t Size = 0;
+	};
+
+public:
+	FRenderCommandList() = default;
+	~FRenderCommandList();
+
+	FRenderCommandList(const FRenderCommandList&) = delete;
+	FRenderCommandList& operator=(const FRenderCommandList&) = delete;
+
+	template <typename LambdaType>
+	void Enqueue(LambdaType&& Lambda);
+
+	/** 기록된 순서대로 모든 Command를 실행하고 비웁니다. */
+	void ExecuteAndReset();
+
+	int32 Num() const { return NumCommands; }
+	bool IsEmpty() const { return NumCommands == 0; }
+
+	/** 할당된 블록 전체의 크기 (byte) */
+	size_t GetAllocatedSize() const;
+
+	static constexpr size_t BlockSize = 64 * 1024;
+
+private:
+	void* Allocate(size_t Size, size_t Alignment);
+	void Reset(bool bExecute);
+
+private:
+	std::vector<FBlock> Blocks;
+	int32 CurrentBlock = 0;
+	size_t CurrentOffset = 0;
+
+	FCommandHeader* Head = nullptr;
+	FCommandHeader* Tail = nullptr;
+	int32 NumCommands = 0;
+};
+
+
+/**
+ * Game Thread가 기록한 Render Command를 실행하는 전용 Render Thread
+ *
+ * - Game Thread는 N번째 프레임의 Command를 기록하고, Render Thread는 그 동안 N-1번째 프레임을 실행합니다.
+ * - EndFrame에서 기록이 끝난 프레임을 넘기고, Render Thread가 MaxFrameLag 프레임 이상 뒤처지면 기다립니다. (Frame Fence)
+ * - Render Thread가 참조하는 객체는 DeferRelease로 넘겨, 해당 프레임의 실행이 끝난 뒤에 해제합니다.
+ * - bUseThread가 false거나 Start 전이라면 Command를 Game Thread에서 실행합니다. (Null Backend/Headless 측정용)
+ */
+class FRenderingThread : public TSingleton<FRenderingThread>
+{
+	struct FBatch
+	{
+		FRenderCommandList* Commands = nullptr;
+
+		// 프레임의 마지막 Batch라면 해당 프레임 번호, 아니면 0
+		uint64 EndOfFrame = 0;
+	};
+
+	struct FDeferredRelease
+	{
+		uint64 Frame;
+		std::shared_ptr<void> Object;
+	};
+
+public:
+	FRenderingThread() = default;
+	~FRenderingThread();
+
+	/**
+	 * Render Thread를 시작합니다. 호출한 스레드가 Game Thread가 됩니다.
+	 * @param InMaxFrameLag Game Thread가 Render Thread보다 앞설 수 있는 최대 프레임 수 (0이면 매 프레임 동기화)
+	 * @param bInUseThread false면 스레드를 만들지 않고 EndFrame에서 바로 실행합니다.
+	 */
+	void Start(int32 InMaxFrameLag = 1, bool bInUseThread = true);
+	void Stop();
+
+	bool IsRunning() const { return bIsRunning; }
+	bool IsThreaded() const { return bUseThread; }
+
+	/** 현재 스레드가 Render Command를 실행하는 스레드인지 여부 */
+	static bool IsInRenderingThread();
+
+	/** Render Command를 현재 프레임에 기록합니다. Start 전이라면 바로 실행합니다. */
+	template <typename LambdaType>
+	void Enqueue(LambdaType&& Lambda);
+
+	/** Object를 현재 프레임의 Command가 모두 실행된 뒤에 해제합니다. */
+	void DeferRelease(std::shared_ptr<void> Object);
+
+	/** 현재 프레임의 기록을 마치고 Render Thread에 넘깁니다. 필요하면 Frame Fence에서 기다립니다. */
+	void EndFrame();
+
+	/** 지금까지 기록된 모든 Command가 실행될 때까지 기다립니다. (Resize, Readback 등) */
+	void Flush();
+
+	int32 GetMaxFrameLag() const { return MaxFrameLag.load(std::memory_order_relaxed); }
+	void SetMaxFrameLag(int32 InMaxFrameLag);
+
+	/** 기록 중인 프레임 번호 (1부터 시작) */
+	uint64 GetFrameNumber() const { return SubmittedFrame + 1; }
+
+	/** 마지막 EndFrame에서 Game Thread가 Fence를 기다린 시간 (ms) */
+	double GetGameThreadWaitMs() const { return GameThreadWaitMs; }
+
+	/** Render Thread가 마지막 프레임의 Command를 실행하는 데 걸린 시간 (ms) */
+	double GetRenderThreadFrameMs() const { return RenderThreadFrameMs.load(std::memory_order_relaxed); }
+
+private:
+	void RenderThreadMain();
+
+	void Kick(uint64 EndOfFrame);
+	void ExecuteBatch(const FBatch& Batch);
+	void ReleaseCompletedObjects();
+
+	FRenderCommandList* AcquireCommandList();
+
+private:
+	bool bIsRunning = false;
+	bool bUseThread = true;
+	std::atomic<int32> MaxFrameLag = 1;
+
+	std::thread Thread;
+	std::atomic<bool> bIsStopping = false;
+
+	// Game Thread만 접근
+	FRenderCommandList* RecordingList = nullptr;
+	uint64 SubmittedFrame = 0;
+	uint64 KickedBatches = 0;
+	std::deque<FDeferredRelease> DeferredReleases;
+	double GameThreadWaitMs = 0.0;
+
+	// Game Thread -> Render Thread
+	std::mutex QueueMutex;
+	std::condition_variable QueueCondition;
+	std::deque<FBatch> PendingBatches;
+	std::vector<FRenderCommandList*> FreeLists;
+
+	// Render Thread -> Game Thread
+	std::mutex CompletionMutex;
+	std::condition_variable CompletionCondition;
+	std::atomic<uint64> CompletedFrame = 0;
+	std::atomic<uint64> ExecutedBatches = 0;
+	std::atomic<double> RenderThreadFrameMs = 0.0;
+
+	std::vector<std::unique_ptr<FRenderCommandList>> AllLists;
+};
+
+
+template <typename LambdaType>
+void FRenderCommandList::Enqueue(LambdaType&& Lambda)
+{
+	using FLambda = std::decay_t<LambdaType>;
+
+	FCommandHeader* Header = static_cast<FCommandHeader*>(Allocate(sizeof(FCommandHeader), alignof(FCommandHeader)));
+	void* LambdaMemory = Allocate(sizeof(FLambda), alignof(FLambda));
+	new (LambdaMemory) FLambda(std::forward<LambdaType>(Lambda));
+
+	Header->Invoke = [](void* Ptr, bool bExecute)
+	{
+		FLambda* Command = static_cast<FLambda*>(Ptr);
+		if (bExecute)
+		{
+			(*Command)();
+		}
+		Command->~FLambda();
+	};
+	Header->Lambda = LambdaMemory;
+	Header->Next = nullptr;
+
+	if (Tail)
+	{
+		Tail->Next = Header;
+	}
+	else
+	{
+		Head = Header;
+	}
+	Tail = Header;
+	++NumCommands;
+}
+
+template <typename LambdaType>
+void FRenderingThread::Enqueue(LambdaType&& Lambda)
+{
+	// Render Thread에서 다시 Enqueue하면 바로 실행합니다.
+	if (IsInRenderingThread() || !bIsRunning)
+	{
+		Lambda();
+		return;
+	}
+	RecordingList->Enqueue(std::forward<LambdaType>(Lambda));
+}
+
+
+/**
+ * Render Thread에서 실행할 Command를 기록합니다.
+ *
+ * 람다는 값으로 캡처해야 합니다. Game Thread는 다음 프레임을 진행하면서 원본을 바꿀 수 있습니다.
+ */
+#define ENQUEUE_RENDER_COMMAND(...) FRenderingThread::Get().Enqueue(__VA_ARGS__)
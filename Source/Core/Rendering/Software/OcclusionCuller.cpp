@@ -0,0 +1,322 @@
+#include "OcclusionCuller.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+#if PLATFORM_ENABLE_VECTORINTRINSICS
+#include <emmintrin.h>
+#endif
+
+
+namespace
+{
+/** w가 이보다 작으면 Near 평면 근처라 투영하지 않음 */
+constexpr float MinClipW = 1.0e-5f;
+
+/** 완전히 덮였다고 보려면 변에서 이만큼(픽셀) 더 안쪽이어야 함, 부동소수 오차와 Rasterizer의 Sub-pixel Snap 대비 */
+constexpr float CoverageBias = 0.01f;
+
+FORCEINLINE uint32 AlignPitch(uint32 InWidth)
+{
+	return (InWidth + 3) & ~3u;
+}
+}
+
+void FOcclusionCuller::Resize(uint32 InWidth, uint32 InHeight)
+{
+	Width = std::max(InWidth, 1u);
+	Height = std::max(InHeight, 1u);
+
+	Levels.Empty();
+	uint32 LevelWidth = Width;
+	uint32 LevelHeight = Height;
+	while (true)
+	{
+		FLevel Level;
+		Level.Width = LevelWidth;
+		Level.Height = LevelHeight;
+		Level.Pitch = AlignPitch(LevelWidth);
+		Level.Depth.SetNum(static_cast<int32>(Level.Pitch * LevelHeight));
+		std::fill_n(Level.Depth.GetData(), Level.Depth.Num(), 1.0f);
+		Levels.Add(std::move(Level));
+
+		if (LevelWidth == 1 && LevelHeight == 1)
+		{
+			break;
+		}
+		LevelWidth = (LevelWidth + 1) / 2;
+		LevelHeight = (LevelHeight + 1) / 2;
+	}
+}
+
+void FOcclusionCuller::BeginFrame(const FMatrix& InViewProjection)
+{
+	ViewProjection = InViewProjection;
+	Stats = {};
+
+	TArray<float>& Depth = Levels[0].Depth;
+	std::fill_n(Depth.GetData(), Depth.Num(), 1.0f);
+}
+
+void FOcclusionCuller::SubmitTriangles(std::span<const uint32> Indices)
+{
+	const FClipVertex* Vertices = ClipVertices.GetData();
+	for (size_t Index = 0; Index + 2 < Indices.size(); Index += 3)
+	{
+		RasterizeTriangle(Vertices[Indices[Index]], Vertices[Indices[Index + 1]], Vertices[Indices[Index + 2]]);
+	}
+	Stats.NumOccluderTriangles += static_cast<int32>(Indices.size() / 3);
+}
+
+void FOcclusionCuller::RasterizeTriangle(const FClipVertex& V0, const FClipVertex& V1, const FClipVertex& V2)
+{
+	const FClipVertex* Vertices[3] = {&V0, &V1, &V2};
+
+	// Viewport 변환, 삼각형 안의 z / w는 화면 공간에서 선형이므로 가장 먼 정점의 깊이가 삼각형 전체의 최댓값
+	float ScreenX[3], ScreenY[3];
+	float MaxZ = 0.0f;
+	for (int32 Index = 0; Index < 3; ++Index)
+	{
+		const FClipVertex& Vertex = *Vertices[Index];
+		if (Vertex.W < MinClipW || Vertex.Z < 0.0f)
+		{
+			return;
+		}
+
+		const float InvW = 1.0f / Vertex.W;
+		ScreenX[Index] = (Vertex.X * InvW * 0.5f + 0.5f) * static_cast<float>(Width);
+		ScreenY[Index] = (0.5f - Vertex.Y * InvW * 0.5f) * static_cast<float>(Height);
+		MaxZ = std::max(MaxZ, Vertex.Z * InvW);
+	}
+	if (MaxZ >= 1.0f)
+	{
+		return;
+	}
+
+	// Occluder는 앞뒷면 모두 가리므로 시계 방향으로 맞춤
+	const float Area = (ScreenX[1] - ScreenX[0]) * (ScreenY[2] - ScreenY[0]) - (ScreenX[2] - ScreenX[0]) * (ScreenY[1] - ScreenY[0]);
+	if (Area == 0.0f)
+	{
+		return;
+	}
+	if (Area < 0.0f)
+	{
+		std::swap(ScreenX[1], ScreenX[2]);
+		std::swap(ScreenY[1], ScreenY[2]);
+	}
+
+	// 완전히 덮일 수 있는 픽셀은 [x, x + 1]이 삼각형의 Bounding Box 안에 들어가는 것뿐
+	const int32 MinX = std::max(0, static_cast<int32>(std::ceil(std::min({ScreenX[0], ScreenX[1], ScreenX[2]}))));
+	const int32 MinY = std::max(0, static_cast<int32>(std::ceil(std::min({ScreenY[0], ScreenY[1], ScreenY[2]}))));
+	const int32 MaxX = std::min(static_cast<int32>(Width) - 1, static_cast<int32>(std::floor(std::max({ScreenX[0], ScreenX[1], ScreenX[2]}))) - 1);
+	const int32 MaxY = std::min(static_cast<int32>(Height) - 1, static_cast<int32>(std::floor(std::max({ScreenY[0], ScreenY[1], ScreenY[2]}))) - 1);
+	if (MinX > MaxX || MinY > MaxY)
+	{
+		return;
+	}
+
+	// Edge i는 정점 i의 맞은편 (j → k), 안쪽이 양수
+	// 픽셀 [x, x + 1] x [y, y + 1]에서 Edge Function의 최솟값은 (x, y)의 값 + min(A, 0) + min(B, 0)
+	float EdgeA[3], EdgeB[3], EdgeC[3];
+	for (int32 Edge = 0; Edge < 3; ++Edge)
+	{
+		const int32 J = (Edge + 1) % 3;
+		const int32 K = (Edge + 2) % 3;
+		const float A = -(ScreenY[K] - ScreenY[J]);
+		const float B = ScreenX[K] - ScreenX[J];
+		const float C = -(A * ScreenX[J] + B * ScreenY[J]);
+
+		EdgeA[Edge] = A;
+		EdgeB[Edge] = B;
+		EdgeC[Edge] = C + std::min(A, 0.0f) + std::min(B, 0.0f) - CoverageBias * (std::abs(A) + std::abs(B));
+	}
+
+	FLevel& Level = Levels[0];
+	float* Depth = Level.Depth.GetData();
+
+#if PLATFORM_ENABLE_VECTORINTRINSICS
+	// 4의 배수에서 시작해도 Bounding Box 밖 픽셀은 Edge 검사에서 빠지고, Pitch가 4의 배수라 넘치지 않음
+	const int32 StartX = MinX & ~3;
+	const __m128 LaneOffset = _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f);
+	const __m128 TriangleZ = _mm_set1_ps(MaxZ);
+	const __m128 Zero = _mm_setzero_ps();
+
+	__m128 A[3], StepX[3], StartValue[3];
+	for (int32 Edge = 0; Edge < 3; ++Edge)
+	{
+		A[Edge] = _mm_set1_ps(EdgeA[Edge]);
+		StepX[Edge] = _mm_set1_ps(EdgeA[Edge] * 4.0f);
+		StartValue[Edge] = _mm_add_ps(_mm_mul_ps(A[Edge], _mm_add_ps(_mm_set1_ps(static_cast<float>(StartX)), LaneOffset)), _mm_set1_ps(EdgeC[Edge]));
+	}
+
+	for (int32 Y = MinY; Y <= MaxY; ++Y)
+	{
+		__m128 Value[3];
+		for (int32 Edge = 0; Edge < 3; ++Edge)
+		{
+			Value[Edge] = _mm_add_ps(StartValue[Edge], _mm_set1_ps(EdgeB[Edge] * static_cast<float>(Y)));
+		}
+
+		float* Row = Depth + Y * Level.Pitch;
+		for (int32 X = StartX; X <= MaxX; X += 4)
+		{
+			const __m128 Covered = _mm_and_ps(
+				_mm_and_ps(_mm_cmpge_ps(Value[0], Zero), _mm_cmpge_ps(Value[1], Zero)),
+				_mm_cmpge_ps(Value[2], Zero)
+			);
+			if (_mm_movemask_ps(Covered) != 0)
+			{
+				const __m128 Old = _mm_loadu_ps(Row + X);
+				const __m128 New = _mm_min_ps(Old, TriangleZ);
+				_mm_storeu_ps(Row + X, _mm_or_ps(_mm_and_ps(Covered, New), _mm_andnot_ps(Covered, Old)));
+			}
+
+			for (int32 Edge = 0; Edge < 3; ++Edge)
+			{
+				Value[Edge] = _mm_add_ps(Value[Edge], StepX[Edge]);
+			}
+		}
+	}
+#else
+	for (int32 Y = MinY; Y <= MaxY; ++Y)
+	{
+		float* Row = Depth + Y * Level.Pitch;
+		for (int32 X = MinX; X <= MaxX; ++X)
+		{
+			bool bCovered = true;
+			for (int32 Edge = 0; Edge < 3 && bCovered; ++Edge)
+			{
+				bCovered = EdgeA[Edge] * static_cast<float>(X) + EdgeB[Edge] * static_cast<float>(Y) + EdgeC[Edge] >= 0.0f;
+			}
+			if (bCovered)
+			{
+				Row[X] = std::min(Row[X], MaxZ);
+			}
+		}
+	}
+#endif
+}
+
+void FOcclusionCuller::BuildHierarchy()
+{
+	for (int32 LevelIndex = 1; LevelIndex < Levels.Num(); ++LevelIndex)
+	{
+		const FLevel& Source = Levels[LevelIndex - 1];
+		FLevel& Target = Levels[LevelIndex];
+		const float* Src = Source.Depth.GetData();
+		float* Dest = Target.Depth.GetData();
+
+		for (uint32 Y = 0; Y < Target.Height; ++Y)
+		{
+			// 홀수 크기면 마지막 텍셀은 자기 자신을 한 번 더 봄
+			const float* Row0 = Src + (2 * Y) * Source.Pitch;
+			const float* Row1 = Src + std::min(2 * Y + 1, Source.Height - 1) * Source.Pitch;
+			for (uint32 X = 0; X < Target.Width; ++X)
+			{
+				const uint32 X0 = 2 * X;
+				const uint32 X1 = std::min(2 * X + 1, Source.Width - 1);
+				Dest[Y * Target.Pitch + X] = std::max(std::max(Row0[X0], Row0[X1]), std::max(Row1[X0], Row1[X1]));
+			}
+		}
+	}
+}
+
+bool FOcclusionCuller::IsOccluded(const FBox& WorldBox)
+{
+	++Stats.NumTested;
+
+	// Box의 8개 꼭짓점을 투영해서 화면 사각형과 가장 가까운 깊이를 구함
+	const auto& M = ViewProjection.M;
+	float MinNDCX = FLT_MAX, MinNDCY = FLT_MAX, MaxNDCX = -FLT_MAX, MaxNDCY = -FLT_MAX;
+	float MinZ = FLT_MAX;
+	for (int32 Corner = 0; Corner < 8; ++Corner)
+	{
+		const float X = (Corner & 1) ? WorldBox.Max.X : WorldBox.Min.X;
+		const float Y = (Corner & 2) ? WorldBox.Max.Y : WorldBox.Min.Y;
+		const float Z = (Corner & 4) ? WorldBox.Max.Z : WorldBox.Min.Z;
+
+		const float ClipZ = X * M[0][2] + Y * M[1][2] + Z * M[2][2] + M[3][2];
+		const float ClipW = X * M[0][3] + Y * M[1][3] + Z * M[2][3] + M[3][3];
+		if (ClipW < MinClipW || ClipZ < 0.0f)
+		{
+			return false;
+		}
+
+		const float InvW = 1.0f / ClipW;
+		const float NDCX = (X * M[0][0] + Y * M[1][0] + Z * M[2][0] + M[3][0]) * InvW;
+		const float NDCY = (X * M[0][1] + Y * M[1][1] + Z * M[2][1] + M[3][1]) * InvW;
+		MinNDCX = std::min(MinNDCX, NDCX);
+		MaxNDCX = std::max(MaxNDCX, NDCX);
+		MinNDCY = std::min(MinNDCY, NDCY);
+		MaxNDCY = std::max(MaxNDCY, NDCY);
+		MinZ = std::min(MinZ, ClipZ * InvW);
+	}
+
+	// 사각형에 닿는 픽셀은 모두 포함 (경계에 걸친 픽셀도)
+	const int32 MinX = std::max(0, static_cast<int32>(std::floor((MinNDCX * 0.5f + 0.5f) * static_cast<float>(Width))));
+	const int32 MaxX = std::min(static_cast<int32>(Width) - 1, static_cast<int32>(std::floor((MaxNDCX * 0.5f + 0.5f) * static_cast<float>(Width))));
+	const int32 MinY = std::max(0, static_cast<int32>(std::floor((0.5f - MaxNDCY * 0.5f) * static_cast<float>(Height))));
+	const int32 MaxY = std::min(static_cast<int32>(Height) - 1, static_cast<int32>(std::floor((0.5f - MinNDCY * 0.5f) * static_cast<float>(Height))));
+	if (MinX > MaxX || MinY > MaxY)
+	{
+		return false;
+	}
+
+	// 사각형이 2x2 텍셀 안에 들어가는 Level에서 시작
+	int32 Level = 0;
+	while (Level + 1 < Levels.Num() && ((MaxX >> Level) - (MinX >> Level) > 1 || (MaxY >> Level) - (MinY >> Level) > 1))
+	{
+		++Level;
+	}
+
+	for (int32 Y = MinY >> Level; Y <= MaxY >> Level; ++Y)
+	{
+		for (int32 X = MinX >> Level; X <= MaxX >> Level; ++X)
+		{
+			if (!IsTexelOccluded(Level, X, Y, MinZ, MinX, MinY, MaxX, MaxY))
+			{
+				return false;
+			}
+		}
+	}
+
+	++Stats.NumOccluded;
+	return true;
+}
+
+bool FOcclusionCuller::IsTexelOccluded(int32 Level, int32 X, int32 Y, float MinZ, int32 MinX, int32 MinY, int32 MaxX, int32 MaxY) const
+{
+	if (ReadDepth(Level, X, Y) < MinZ)
+	{
+		return true;
+	}
+	if (Level == 0)
+	{
+		return false;
+	}
+
+	// 텍셀 전체로는 판정이 안 나면 사각형에 걸치는 자식만 다시 봄
+	const int32 Child = Level - 1;
+	const int32 ChildMinX = std::max(2 * X, MinX >> Child);
+	const int32 ChildMinY = std::max(2 * Y, MinY >> Child);
+	const int32 ChildMaxX = std::min({2 * X + 1, MaxX >> Child, static_cast<int32>(Levels[Child].Width) - 1});
+	const int32 ChildMaxY = std::min({2 * Y + 1, MaxY >> Child, static_cast<int32>(Levels[Child].Height) - 1});
+	for (int32 ChildY = ChildMinY; ChildY <= ChildMaxY; ++ChildY)
+	{
+		for (int32 ChildX = ChildMinX; ChildX <= ChildMaxX; ++ChildX)
+		{
+			if (!IsTexelOccluded(Child, ChildX, ChildY, MinZ, MinX, MinY, MaxX, MaxY))
+			{
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+float FOcclusionCuller::GetOccluderScore(const FBox& WorldBox, const FVector& ViewOrigin)
+{
+	const float DistanceSquared = (WorldBox.GetCenter() - ViewOrigin).LengthSquared();
+	return WorldBox.GetExtent().LengthSquared() / std::max(DistanceSquared, 1.0e-4f);
+}
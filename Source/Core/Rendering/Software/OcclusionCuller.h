@@ -0,0 +1,127 @@
+#pragma once
+#include <span>
+
+#include "Core/Container/Array.h"
+#include "Core/HAL/PlatformType.h"
+#include "Core/Math/BoxSphereBounds.h"
+#include "Core/Math/Matrix.h"
+#include "Core/Math/Vector.h"
+
+
+/**
+ * Software Hierarchical-Z Occlusion Culling (Masked Occlusion Culling 방식)
+ *
+ * 1. 큰 Occluder의 삼각형을 저해상도 깊이 버퍼에 4픽셀씩 SIMD로 그립니다.
+ *    픽셀을 완전히 덮는 삼각형만, 그 삼각형의 가장 먼 깊이로 씁니다. (가려진다고 잘못 판정하지 않도록 보수적으로)
+ * 2. 깊이 버퍼를 2x2 최댓값으로 줄여 Mip 피라미드(HiZ)를 만듭니다.
+ * 3. Occludee는 Box의 화면 사각형과 가장 가까운 깊이를 HiZ 위에서부터 내려가며 비교합니다.
+ *
+ * 깊이는 D3D 규약(z / w, 0 = Near, 1 = Far)이고, 화면 좌표는 FSoftwareRasterizer와 같습니다. (y는 아래쪽)
+ */
+class FOcclusionCuller
+{
+public:
+	struct FStats
+	{
+		int32 NumOccluders = 0;
+		int32 NumOccluderTriangles = 0;
+		int32 NumTested = 0;
+		int32 NumOccluded = 0;
+	};
+
+	static constexpr uint32 DefaultWidth = 256;
+	static constexpr uint32 DefaultHeight = 128;
+
+	FOcclusionCuller() { Resize(DefaultWidth, DefaultHeight); }
+	FOcclusionCuller(uint32 InWidth, uint32 InHeight) { Resize(InWidth, InHeight); }
+
+	void Resize(uint32 InWidth, uint32 InHeight);
+
+	/** 깊이 버퍼를 Far(1)로 지우고 이번 프레임의 ViewProjection을 정합니다. */
+	void BeginFrame(const FMatrix& InViewProjection);
+
+	/**
+	 * Triangle List 하나를 Occluder로 그립니다. (FVertexSimple 등 X, Y, Z를 가진 정점)
+	 * Near 평면에 걸치는 삼각형은 Clipping 하지 않고 건너뜁니다.
+	 */
+	template <typename VertexType>
+	void RenderOccluder(std::span<const VertexType> Vertices, std::span<const uint32> Indices, const FMatrix& ModelMatrix);
+
+	/** Occluder를 다 그린 뒤 호출해서 HiZ를 만듭니다. */
+	void BuildHierarchy();
+
+	/** World Box가 Occluder에 완전히 가려졌으면 true, 화면 밖이거나 Near 평면에 걸치면 false */
+	bool IsOccluded(const FBox& WorldBox);
+
+	/** Occluder로 쓸 만큼 화면에서 큰지 (Box 크기 / 거리)², 클수록 좋은 Occluder */
+	static float GetOccluderScore(const FBox& WorldBox, const FVector& ViewOrigin);
+
+	uint32 GetWidth() const { return Width; }
+	uint32 GetHeight() const { return Height; }
+	int32 GetNumLevels() const { return Levels.Num(); }
+
+	/** Level 0은 Occluder를 그린 깊이 버퍼, 위로 갈수록 2x2 최댓값 */
+	float ReadDepth(int32 Level, uint32 X, uint32 Y) const { return Levels[Level].Depth[static_cast<int32>(Y * Levels[Level].Pitch + X)]; }
+
+	const FStats& GetStats() const { return Stats; }
+
+private:
+	struct FLevel
+	{
+		uint32 Width = 0;
+		uint32 Height = 0;
+		uint32 Pitch = 0;
+		TArray<float> Depth;
+	};
+
+	/** Clip 공간 정점 (x, y, z, w) */
+	struct FClipVertex
+	{
+		float X, Y, Z, W;
+	};
+
+	void SubmitTriangles(std::span<const uint32> Indices);
+	void RasterizeTriangle(const FClipVertex& V0, const FClipVertex& V1, const FClipVertex& V2);
+
+	/**
+	 * Level의 텍셀 (X, Y) 중 Level 0 사각형 [MinX, MaxX] x [MinY, MaxY]에 들어가는 부분이 모두 MinZ보다 가까운 Occluder로 덮였는지
+	 * 텍셀의 최댓값으로 판정이 안 나면 자식 텍셀로 내려갑니다.
+	 */
+	bool IsTexelOccluded(int32 Level, int32 X, int32 Y, float MinZ, int32 MinX, int32 MinY, int32 MaxX, int32 MaxY) const;
+
+private:
+	uint32 Width = 0;
+	uint32 Height = 0;
+
+	FMatrix ViewProjection = FMatrix::Identity();
+
+	/** Level 0 (4픽셀 SIMD 접근을 위해 Pitch는 4의 배수) ~ 1x1 */
+	TArray<FLevel> Levels;
+
+	TArray<FClipVertex> ClipVertices;
+
+	FStats Stats;
+};
+
+
+template <typename VertexType>
+void FOcclusionCuller::RenderOccluder(std::span<const VertexType> Vertices, std::span<const uint32> Indices, const FMatrix& ModelMatrix)
+{
+	// 행 벡터 * 행렬 (Model * ViewProjection)
+	const FMatrix MVP = ModelMatrix * ViewProjection;
+	const auto& M = MVP.M;
+
+	ClipVertices.SetNum(static_cast<int32>(Vertices.size()));
+	FClipVertex* Out = ClipVertices.GetData();
+	for (const VertexType& Vertex : Vertices)
+	{
+		Out->X = Vertex.X * M[0][0] + Vertex.Y * M[1][0] + Vertex.Z * M[2][0] + M[3][0];
+		Out->Y = Vertex.X * M[0][1] + Vertex.Y * M[1][1] + Vertex.Z * M[2][1] + M[3][1];
+		Out->Z = Vertex.X * M[0][2] + Vertex.Y * M[1][2] + Vertex.Z * M[2][2] + M[3][2];
+		Out->W = Vertex.X * M[0][3] + Vertex.Y * M[1][3] + Vertex.Z * M[2][3] + M[3][3];
+		++Out;
+	}
+
+	++Stats.NumOccluders;
+	SubmitTriangles(Indices);
+}
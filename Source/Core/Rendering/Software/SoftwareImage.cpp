@@ -0,0 +1,148 @@
+#include "SoftwareImage.h"
+
+#include <algorithm>
+#include <fstream>
+
+
+namespace
+{
+#pragma pack(push, 1)
+struct FTGAHeader
+{
+	uint8 IdLength = 0;
+	uint8 ColorMapType = 0;
+	uint8 ImageType = 2;        // 무압축 True Color
+	uint8 ColorMapSpec[5] = {};
+	uint16 OriginX = 0;
+	uint16 OriginY = 0;
+	uint16 Width = 0;
+	uint16 Height = 0;
+	uint8 BitsPerPixel = 32;
+	uint8 Descriptor = 0x28;    // Alpha 8bit, 위에서 아래로
+};
+#pragma pack(pop)
+
+static_assert(sizeof(FTGAHeader) == 18);
+
+constexpr uint8 TopToBottomBit = 0x20;
+}
+
+
+bool FSoftwareImage::SaveTGA(const std::string& Path) const
+{
+	if (Width == 0 || Height == 0 || Width > 0xffff || Height > 0xffff)
+	{
+		return false;
+	}
+
+	std::ofstream Output(Path, std::ios::binary);
+	if (!Output.is_open())
+	{
+		return false;
+	}
+
+	FTGAHeader Header;
+	Header.Width = static_cast<uint16>(Width);
+	Header.Height = static_cast<uint16>(Height);
+	Output.write(reinterpret_cast<const char*>(&Header), sizeof(Header));
+
+	// RGBA → BGRA
+	TArray<uint8> Row;
+	Row.SetNum(static_cast<int32>(Width * 4));
+	for (uint32 Y = 0; Y < Height; ++Y)
+	{
+		for (uint32 X = 0; X < Width; ++X)
+		{
+			const uint32 Pixel = GetPixel(X, Y);
+			uint8* Dest = &Row[static_cast<int32>(X * 4)];
+			Dest[0] = static_cast<uint8>(Pixel >> 16);
+			Dest[1] = static_cast<uint8>(Pixel >> 8);
+			Dest[2] = static_cast<uint8>(Pixel);
+			Dest[3] = static_cast<uint8>(Pixel >> 24);
+		}
+		Output.write(reinterpret_cast<const char*>(Row.GetData()), Row.Num());
+	}
+
+	return Output.good();
+}
+
+bool FSoftwareImage::LoadTGA(const std::string& Path)
+{
+	std::ifstream Input(Path, std::ios::binary);
+	if (!Input.is_open())
+	{
+		return false;
+	}
+
+	FTGAHeader Header;
+	Input.read(reinterpret_cast<char*>(&Header), sizeof(Header));
+	if (!Input || Header.ImageType != 2 || Header.ColorMapType != 0 || (Header.BitsPerPixel != 32 && Header.BitsPerPixel != 24))
+	{
+		return false;
+	}
+	Input.ignore(Header.IdLength);
+
+	Width = Header.Width;
+	Height = Header.Height;
+	Pixels.SetNum(static_cast<int32>(Width * Height));
+
+	const uint32 BytesPerPixel = Header.BitsPerPixel / 8;
+	const bool bTopToBottom = (Header.Descriptor & TopToBottomBit) != 0;
+
+	TArray<uint8> Row;
+	Row.SetNum(static_cast<int32>(Width * BytesPerPixel));
+	for (uint32 FileY = 0; FileY < Height; ++FileY)
+	{
+		Input.read(reinterpret_cast<char*>(Row.GetData()), Row.Num());
+		if (!Input)
+		{
+			return false;
+		}
+
+		const uint32 Y = bTopToBottom ? FileY : Height - 1 - FileY;
+		for (uint32 X = 0; X < Width; ++X)
+		{
+			const uint8* Src = &Row[static_cast<int32>(X * BytesPerPixel)];
+			const uint32 A = BytesPerPixel == 4 ? Src[3] : 0xff;
+			Pixels[static_cast<int32>(Y * Width + X)] = Src[2] | (Src[1] << 8) | (Src[0] << 16) | (A << 24);
+		}
+	}
+
+	return true;
+}
+
+FSoftwareImage::FDiff FSoftwareImage::Compare(const FSoftwareImage& A, const FSoftwareImage& B, uint32 Tolerance)
+{
+	FDiff Diff;
+	if (A.Width != B.Width || A.Height != B.Height)
+	{
+		Diff.bSizeMismatch = true;
+		return Diff;
+	}
+
+	for (int32 Index = 0; Index < A.Pixels.Num(); ++Index)
+	{
+		const uint32 PixelA = A.Pixels[Index];
+		const uint32 PixelB = B.Pixels[Index];
+		if (PixelA == PixelB)
+		{
+			continue;
+		}
+
+		uint32 MaxDelta = 0;
+		for (uint32 Shift = 0; Shift < 32; Shift += 8)
+		{
+			const int32 ChannelA = (PixelA >> Shift) & 0xff;
+			const int32 ChannelB = (PixelB >> Shift) & 0xff;
+			MaxDelta = std::max(MaxDelta, static_cast<uint32>(ChannelA > ChannelB ? ChannelA - ChannelB : ChannelB - ChannelA));
+		}
+
+		Diff.MaxChannelDelta = std::max(Diff.MaxChannelDelta, MaxDelta);
+		if (MaxDelta > Tolerance)
+		{
+			++Diff.NumDifferentPixels;
+		}
+	}
+
+	return Diff;
+}
@@ -0,0 +1,45 @@
+#pragma once
+#include <string>
+
+#include "Core/Container/Array.h"
+#include "Core/HAL/PlatformType.h"
+
+
+/**
+ * CPU에 있는 32bit 이미지 (Color Target은 RGBA8, UUID Target은 UUID 값 그대로)
+ *
+ * Golden Image 비교용으로 무압축 TGA 저장/불러오기만 지원합니다.
+ */
+struct FSoftwareImage
+{
+	struct FDiff
+	{
+		bool bSizeMismatch = false;
+		uint32 NumDifferentPixels = 0;
+
+		/** 채널(byte) 단위 최대 차이 */
+		uint32 MaxChannelDelta = 0;
+
+		bool IsIdentical() const { return !bSizeMismatch && NumDifferentPixels == 0; }
+	};
+
+	uint32 Width = 0;
+	uint32 Height = 0;
+
+	/** 행 우선, 패딩 없음. 0xAABBGGRR (DXGI_FORMAT_R8G8B8A8) */
+	TArray<uint32> Pixels;
+
+	uint32 GetPixel(uint32 X, uint32 Y) const { return Pixels[static_cast<int32>(Y * Width + X)]; }
+
+	/** 32bit BGRA 무압축 TGA로 저장합니다. */
+	bool SaveTGA(const std::string& Path) const;
+
+	/** SaveTGA로 저장한 형식(24/32bit 무압축)만 읽을 수 있습니다. */
+	bool LoadTGA(const std::string& Path);
+
+	/**
+	 * 두 이미지를 픽셀 단위로 비교합니다.
+	 * @param Tolerance 채널 차이가 이 값 이하면 같은 픽셀로 봅니다. (GPU와 비교할 때 반올림 오차 허용)
+	 */
+	static FDiff Compare(const FSoftwareImage& A, const FSoftwareImage& B, uint32 Tolerance = 0);
+};
@@ -0,0 +1,685 @@
+#include "SoftwareRasterizer.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+
+#include "Core/Async/JobSystem.h"
+
+#if PLATFORM_ENABLE_VECTORINTRINSICS
+#include <emmintrin.h>
+#endif
+
+
+namespace
+{
+//~ 4-wide float 연산 (SSE2가 없으면 스칼라로 같은 결과)
+#if PLATFORM_ENABLE_VECTORINTRINSICS
+using FFloat4 = __m128;
+using FMask4 = __m128;
+
+FORCEINLINE FFloat4 Splat(float Value) { return _mm_set1_ps(Value); }
+FORCEINLINE FFloat4 Set(float A, float B, float C, float D) { return _mm_setr_ps(A, B, C, D); }
+FORCEINLINE FFloat4 Load(const float* Src) { return _mm_loadu_ps(Src); }
+FORCEINLINE void Store(float* Dest, FFloat4 Value) { _mm_storeu_ps(Dest, Value); }
+FORCEINLINE FFloat4 Add(FFloat4 A, FFloat4 B) { return _mm_add_ps(A, B); }
+FORCEINLINE FFloat4 Mul(FFloat4 A, FFloat4 B) { return _mm_mul_ps(A, B); }
+FORCEINLINE FFloat4 Div(FFloat4 A, FFloat4 B) { return _mm_div_ps(A, B); }
+FORCEINLINE FFloat4 MulAdd(FFloat4 A, FFloat4 B, FFloat4 C) { return _mm_add_ps(_mm_mul_ps(A, B), C); }
+FORCEINLINE FMask4 CmpGT(FFloat4 A, FFloat4 B) { return _mm_cmpgt_ps(A, B); }
+FORCEINLINE FMask4 CmpGE(FFloat4 A, FFloat4 B) { return _mm_cmpge_ps(A, B); }
+FORCEINLINE FMask4 CmpLE(FFloat4 A, FFloat4 B) { return _mm_cmple_ps(A, B); }
+FORCEINLINE FMask4 And(FMask4 A, FMask4 B) { return _mm_and_ps(A, B); }
+FORCEINLINE FFloat4 Select(FMask4 Mask, FFloat4 A, FFloat4 B) { return _mm_or_ps(_mm_and_ps(Mask, A), _mm_andnot_ps(Mask, B)); }
+FORCEINLINE int32 MoveMask(FMask4 Mask) { return _mm_movemask_ps(Mask); }
+#else
+struct FFloat4 { float V[4]; };
+struct FMask4 { bool V[4]; };
+
+template <typename FuncType>
+FORCEINLINE FFloat4 Map(const FuncType& Func) { return {Func(0), Func(1), Func(2), Func(3)}; }
+template <typename FuncType>
+FORCEINLINE FMask4 MapMask(const FuncType& Func) { return {Func(0), Func(1), Func(2), Func(3)}; }
+
+FORCEINLINE FFloat4 Splat(float Value) { return {Value, Value, Value, Value}; }
+FORCEINLINE FFloat4 Set(float A, float B, float C, float D) { return {A, B, C, D}; }
+FORCEINLINE FFloat4 Load(const float* Src) { return {Src[0], Src[1], Src[2], Src[3]}; }
+FORCEINLINE void Store(float* Dest, FFloat4 Value) { std::memcpy(Dest, Value.V, sizeof(Value.V)); }
+FORCEINLINE FFloat4 Add(FFloat4 A, FFloat4 B) { return Map([&](int I) { return A.V[I] + B.V[I]; }); }
+FORCEINLINE FFloat4 Mul(FFloat4 A, FFloat4 B) { return Map([&](int I) { return A.V[I] * B.V[I]; }); }
+FORCEINLINE FFloat4 Div(FFloat4 A, FFloat4 B) { return Map([&](int I) { return A.V[I] / B.V[I]; }); }
+FORCEINLINE FFloat4 MulAdd(FFloat4 A, FFloat4 B, FFloat4 C) { return Add(Mul(A, B), C); }
+FORCEINLINE FMask4 CmpGT(FFloat4 A, FFloat4 B) { return MapMask([&](int I) { return A.V[I] > B.V[I]; }); }
+FORCEINLINE FMask4 CmpGE(FFloat4 A, FFloat4 B) { return MapMask([&](int I) { return A.V[I] >= B.V[I]; }); }
+FORCEINLINE FMask4 CmpLE(FFloat4 A, FFloat4 B) { return MapMask([&](int I) { return A.V[I] <= B.V[I]; }); }
+FORCEINLINE FMask4 And(FMask4 A, FMask4 B) { return MapMask([&](int I) { return A.V[I] && B.V[I]; }); }
+FORCEINLINE FFloat4 Select(FMask4 Mask, FFloat4 A, FFloat4 B) { return Map([&](int I) { return Mask.V[I] ? A.V[I] : B.V[I]; }); }
+FORCEINLINE int32 MoveMask(FMask4 Mask) { return Mask.V[0] | (Mask.V[1] << 1) | (Mask.V[2] << 2) | (Mask.V[3] << 3); }
+#endif
+//~ 4-wide float 연산
+
+
+/** Linear ↔ sRGB 변환 테이블 (R8G8B8A8_UNORM_SRGB Target) */
+struct FSRGBTable
+{
+	static constexpr int32 EncodeSize = 4096;
+
+	uint8 Encode[EncodeSize];
+	float Decode[256];
+
+	FSRGBTable()
+	{
+		for (int32 Index = 0; Index < EncodeSize; ++Index)
+		{
+			const float Linear = static_cast<float>(Index) / (EncodeSize - 1);
+			const float SRGB = Linear <= 0.0031308f ? Linear * 12.92f : 1.055f * std::pow(Linear, 1.0f / 2.4f) - 0.055f;
+			Encode[Index] = static_cast<uint8>(std::clamp(SRGB, 0.0f, 1.0f) * 255.0f + 0.5f);
+		}
+		for (int32 Index = 0; Index < 256; ++Index)
+		{
+			const float SRGB = static_cast<float>(Index) / 255.0f;
+			Decode[Index] = SRGB <= 0.04045f ? SRGB / 12.92f : std::pow((SRGB + 0.055f) / 1.055f, 2.4f);
+		}
+	}
+
+	FORCEINLINE uint32 ToSRGB(float Linear) const
+	{
+		return Encode[static_cast<int32>(std::clamp(Linear, 0.0f, 1.0f) * (EncodeSize - 1) + 0.5f)];
+	}
+
+	FORCEINLINE static uint32 ToUNorm(float Value)
+	{
+		return static_cast<uint32>(std::clamp(Value, 0.0f, 1.0f) * 255.0f + 0.5f);
+	}
+};
+
+const FSRGBTable& GetSRGBTable()
+{
+	static const FSRGBTable Table;
+	return Table;
+}
+
+/** 선형 색을 Target 형식으로 변환하고, 알파가 1보다 작으면 DefaultBlendState(SrcAlpha, InvSrcAlpha)로 섞습니다. */
+FORCEINLINE uint32 BlendColor(const FSRGBTable& Table, float R, float G, float B, float A, uint32 Dest)
+{
+	if (A < 1.0f)
+	{
+		const float SrcAlpha = std::clamp(A, 0.0f, 1.0f);
+		const float DestAlpha = 1.0f - SrcAlpha;
+		R = R * SrcAlpha + Table.Decode[Dest & 0xff] * DestAlpha;
+		G = G * SrcAlpha + Table.Decode[(Dest >> 8) & 0xff] * DestAlpha;
+		B = B * SrcAlpha + Table.Decode[(Dest >> 16) & 0xff] * DestAlpha;
+	}
+	return Table.ToSRGB(R) | (Table.ToSRGB(G) << 8) | (Table.ToSRGB(B) << 16) | (FSRGBTable::ToUNorm(A) << 24);
+}
+
+/** D3D11과 같은 8bit Sub-pixel 정밀도로 맞춥니다. */
+FORCEINLINE float SnapSubPixel(float Value)
+{
+	return std::round(Value * 256.0f) / 256.0f;
+}
+
+template <typename ClipVertexType>
+ClipVertexType LerpVertex(const ClipVertexType& A, const ClipVertexType& B, float T)
+{
+	ClipVertexType Result;
+	Result.X = A.X + (B.X - A.X) * T;
+	Result.Y = A.Y + (B.Y - A.Y) * T;
+	Result.Z = A.Z + (B.Z - A.Z) * T;
+	Result.W = A.W + (B.W - A.W) * T;
+	Result.R = A.R + (B.R - A.R) * T;
+	Result.G = A.G + (B.G - A.G) * T;
+	Result.B = A.B + (B.B - A.B) * T;
+	Result.A = A.A + (B.A - A.A) * T;
+	return Result;
+}
+
+/** 모든 정점이 Clip 공간의 같은 평면 바깥에 있으면 true */
+template <typename ClipVertexType>
+bool IsTriviallyOutside(std::initializer_list<const ClipVertexType*> Vertices)
+{
+	bool bLeft = true, bRight = true, bBottom = true, bTop = true, bFar = true;
+	for (const ClipVertexType* Vertex : Vertices)
+	{
+		bLeft &= Vertex->X < -Vertex->W;
+		bRight &= Vertex->X > Vertex->W;
+		bBottom &= Vertex->Y < -Vertex->W;
+		bTop &= Vertex->Y > Vertex->W;
+		bFar &= Vertex->Z > Vertex->W;
+	}
+	return bLeft || bRight || bBottom || bTop || bFar;
+}
+}
+
+
+void FSoftwareRasterizer::Resize(uint32 InWidth, uint32 InHeight)
+{
+	Width = InWidth;
+	Height = InHeight;
+	Pitch = (InWidth + 3) & ~3u;
+
+	const int32 NumPixels = static_cast<int32>(Pitch * Height);
+	ColorTarget.SetNum(NumPixels);
+	UUIDTarget.SetNum(NumPixels);
+	DepthTarget.SetNum(NumPixels);
+
+	NumTilesX = static_cast<int32>((Width + TileSize - 1) / TileSize);
+	NumTilesY = static_cast<int32>((Height + TileSize - 1) / TileSize);
+	TileBins.SetNum(NumTilesX * NumTilesY);
+
+	Triangles.Empty();
+	Lines.Empty();
+	for (TArray<uint32>& Bin : TileBins)
+	{
+		Bin.Empty();
+	}
+}
+
+void FSoftwareRasterizer::Clear(const FVector4& InColor, float InDepth, uint32 InUUID)
+{
+	const FSRGBTable& Table = GetSRGBTable();
+	const uint32 ClearColor = Table.ToSRGB(InColor.X) | (Table.ToSRGB(InColor.Y) << 8) | (Table.ToSRGB(InColor.Z) << 16)
+		| (FSRGBTable::ToUNorm(InColor.W) << 24);
+
+	std::fill(ColorTarget.begin(), ColorTarget.end(), ClearColor);
+	std::fill(UUIDTarget.begin(), UUIDTarget.end(), InUUID);
+	std::fill(DepthTarget.begin(), DepthTarget.end(), InDepth);
+
+	Triangles.Empty();
+	Lines.Empty();
+	for (TArray<uint32>& Bin : TileBins)
+	{
+		Bin.Empty();
+	}
+}
+
+void FSoftwareRasterizer::ClearDepth(float InDepth)
+{
+	std::fill(DepthTarget.begin(), DepthTarget.end(), InDepth);
+}
+
+void FSoftwareRasterizer::SubmitTriangles(std::span<const uint32> Indices, const FSoftwareDrawState& State)
+{
+	const uint32 NumVertices = static_cast<uint32>(ClipVertices.Num());
+	const FClipVertex* Vertices = ClipVertices.GetData();
+
+	for (size_t Index = 0; Index + 2 < Indices.size(); Index += 3)
+	{
+		++Stats.NumTriangles;
+
+		const uint32 I0 = Indices[Index], I1 = Indices[Index + 1], I2 = Indices[Index + 2];
+		if (I0 >= NumVertices || I1 >= NumVertices || I2 >= NumVertices)
+		{
+			++Stats.NumCulledTriangles;
+			continue;
+		}
+
+		const FClipVertex& V0 = Vertices[I0];
+		const FClipVertex& V1 = Vertices[I1];
+		const FClipVertex& V2 = Vertices[I2];
+		if (IsTriviallyOutside<FClipVertex>({&V0, &V1, &V2}))
+		{
+			++Stats.NumCulledTriangles;
+			continue;
+		}
+
+		if (V0.Z >= 0.0f && V1.Z >= 0.0f && V2.Z >= 0.0f)
+		{
+			SetupTriangle(V0, V1, V2, State);
+			continue;
+		}
+
+		// Near 평면 (z >= 0)으로 자르면 최대 4각형이 되므로 Fan으로 나눕니다.
+		++Stats.NumClippedTriangles;
+
+		const FClipVertex* Input[3] = {&V0, &V1, &V2};
+		FClipVertex Polygon[4];
+		int32 NumPolygon = 0;
+		for (int32 Edge = 0; Edge < 3; ++Edge)
+		{
+			const FClipVertex& A = *Input[Edge];
+			const FClipVertex& B = *Input[(Edge + 1) % 3];
+			if (A.Z >= 0.0f)
+			{
+				Polygon[NumPolygon++] = A;
+			}
+			if ((A.Z >= 0.0f) != (B.Z >= 0.0f))
+			{
+				Polygon[NumPolygon++] = LerpVertex(A, B, A.Z / (A.Z - B.Z));
+			}
+		}
+
+		for (int32 Fan = 1; Fan + 1 < NumPolygon; ++Fan)
+		{
+			SetupTriangle(Polygon[0], Polygon[Fan], Polygon[Fan + 1], State);
+		}
+	}
+}
+
+void FSoftwareRasterizer::SetupTriangle(const FClipVertex& V0, const FClipVertex& V1, const FClipVertex& V2, const FSoftwareDrawState& State)
+{
+	const FClipVertex* Vertices[3] = {&V0, &V1, &V2};
+
+	// Viewport 변환 (NDC y는 위쪽, 화면 y는 아래쪽)
+	float ScreenX[3], ScreenY[3], InvW[3];
+	for (int32 Index = 0; Index < 3; ++Index)
+	{
+		InvW[Index] = 1.0f / Vertices[Index]->W;
+		ScreenX[Index] = SnapSubPixel((Vertices[Index]->X * InvW[Index] * 0.5f + 0.5f) * static_cast<float>(Width));
+		ScreenY[Index] = SnapSubPixel((0.5f - Vertices[Index]->Y * InvW[Index] * 0.5f) * static_cast<float>(Height));
+	}
+
+	// 화면에서 시계 방향이면 양수
+	float Area = (ScreenX[1] - ScreenX[0]) * (ScreenY[2] - ScreenY[0]) - (ScreenX[2] - ScreenX[0]) * (ScreenY[1] - ScreenY[0]);
+	if (Area == 0.0f || (Area < 0.0f && State.CullMode == ESoftwareCullMode::Back))
+	{
+		++Stats.NumCulledTriangles;
+		return;
+	}
+
+	// Cull None에서 뒷면이면 정점 순서를 바꿔 항상 시계 방향으로 만듭니다.
+	if (Area < 0.0f)
+	{
+		std::swap(Vertices[1], Vertices[2]);
+		std::swap(ScreenX[1], ScreenX[2]);
+		std::swap(ScreenY[1], ScreenY[2]);
+		std::swap(InvW[1], InvW[2]);
+		Area = -Area;
+	}
+
+	FRasterTriangle Triangle;
+	Triangle.MinX = std::max(0, static_cast<int32>(std::floor(std::min({ScreenX[0], ScreenX[1], ScreenX[2]}))));
+	Triangle.MinY = std::max(0, static_cast<int32>(std::floor(std::min({ScreenY[0], ScreenY[1], ScreenY[2]}))));
+	Triangle.MaxX = std::min(static_cast<int32>(Width) - 1, static_cast<int32>(std::ceil(std::max({ScreenX[0], ScreenX[1], ScreenX[2]}))));
+	Triangle.MaxY = std::min(static_cast<int32>(Height) - 1, static_cast<int32>(std::ceil(std::max({ScreenY[0], ScreenY[1], ScreenY[2]}))));
+	if (Triangle.MinX > Triangle.MaxX || Triangle.MinY > Triangle.MaxY)
+	{
+		++Stats.NumCulledTriangles;
+		return;
+	}
+
+	// Edge i는 정점 i의 맞은편 (j → k), 픽셀 중심(+0.5)을 C에 미리 더해 정수 좌표로 평가합니다.
+	const float InvArea = 1.0f / Area;
+	Triangle.TopLeftMask = 0;
+	for (int32 Edge = 0; Edge < 3; ++Edge)
+	{
+		const int32 J = (Edge + 1) % 3;
+		const int32 K = (Edge + 2) % 3;
+		const float DeltaX = ScreenX[K] - ScreenX[J];
+		const float DeltaY = ScreenY[K] - ScreenY[J];
+
+		const float A = -DeltaY;
+		const float B = DeltaX;
+		const float C = -(A * ScreenX[J] + B * ScreenY[J]);
+
+		Triangle.EdgeA[Edge] = A * InvArea;
+		Triangle.EdgeB[Edge] = B * InvArea;
+		Triangle.EdgeC[Edge] = (C + 0.5f * A + 0.5f * B) * InvArea;
+
+		// 시계 방향에서 위로 가는 변은 Left, 오른쪽으로 가는 수평 변은 Top
+		if (DeltaY < 0.0f || (DeltaY == 0.0f && DeltaX > 0.0f))
+		{
+			Triangle.TopLeftMask |= 1 << Edge;
+		}
+	}
+
+	Triangle.bFlatColor = !State.bUseVertexColor;
+	for (int32 Index = 0; Index < 3; ++Index)
+	{
+		const FClipVertex& Vertex = *Vertices[Index];
+		Triangle.Z[Index] = Vertex.Z * InvW[Index];
+		Triangle.InvW[Index] = InvW[Index];
+
+		// 원근 보정 보간을 위해 w로 나눠둠
+		const float Scale = Triangle.bFlatColor ? 1.0f : InvW[Index];
+		Triangle.Color[Index][0] = Vertex.R * Scale;
+		Triangle.Color[Index][1] = Vertex.G * Scale;
+		Triangle.Color[Index][2] = Vertex.B * Scale;
+		Triangle.Color[Index][3] = Vertex.A * Scale;
+	}
+
+	Triangle.UUID = State.UUID;
+	Triangle.bDepthTest = State.bDepthTest;
+
+	const uint32 PrimitiveId = static_cast<uint32>(Triangles.Add(Triangle));
+	BinPrimitive(PrimitiveId, Triangle.MinX, Triangle.MinY, Triangle.MaxX, Triangle.MaxY);
+}
+
+void FSoftwareRasterizer::SubmitLines(std::span<const uint32> Indices, const FSoftwareDrawState& State)
+{
+	const uint32 NumVertices = static_cast<uint32>(ClipVertices.Num());
+	const FClipVertex* Vertices = ClipVertices.GetData();
+
+	for (size_t Index = 0; Index + 1 < Indices.size(); Index += 2)
+	{
+		++Stats.NumLines;
+
+		const uint32 I0 = Indices[Index], I1 = Indices[Index + 1];
+		if (I0 >= NumVertices || I1 >= NumVertices)
+		{
+			continue;
+		}
+
+		FClipVertex V0 = Vertices[I0];
+		FClipVertex V1 = Vertices[I1];
+		if (IsTriviallyOutside<FClipVertex>({&V0, &V1}) || (V0.Z < 0.0f && V1.Z < 0.0f))
+		{
+			continue;
+		}
+
+		// Near 평면으로 자르기
+		if (V0.Z < 0.0f)
+		{
+			V0 = LerpVertex(V0, V1, V0.Z / (V0.Z - V1.Z));
+		}
+		else if (V1.Z < 0.0f)
+		{
+			V1 = LerpVertex(V1, V0, V1.Z / (V1.Z - V0.Z));
+		}
+
+		FRasterLine Line;
+		const float InvW0 = 1.0f / V0.W;
+		const float InvW1 = 1.0f / V1.W;
+		Line.X0 = (V0.X * InvW0 * 0.5f + 0.5f) * static_cast<float>(Width);
+		Line.Y0 = (0.5f - V0.Y * InvW0 * 0.5f) * static_cast<float>(Height);
+		Line.Z0 = V0.Z * InvW0;
+		Line.X1 = (V1.X * InvW1 * 0.5f + 0.5f) * static_cast<float>(Width);
+		Line.Y1 = (0.5f - V1.Y * InvW1 * 0.5f) * static_cast<float>(Height);
+		Line.Z1 = V1.Z * InvW1;
+
+		const float Colors[2][4] = {{V0.R, V0.G, V0.B, V0.A}, {V1.R, V1.G, V1.B, V1.A}};
+		std::memcpy(Line.Color0, Colors[0], sizeof(Line.Color0));
+		std::memcpy(Line.Color1, Colors[1], sizeof(Line.Color1));
+
+		Line.MinX = std::max(0, static_cast<int32>(std::floor(std::min(Line.X0, Line.X1))));
+		Line.MinY = std::max(0, static_cast<int32>(std::floor(std::min(Line.Y0, Line.Y1))));
+		Line.MaxX = std::min(static_cast<int32>(Width) - 1, static_cast<int32>(std::ceil(std::max(Line.X0, Line.X1))));
+		Line.MaxY = std::min(static_cast<int32>(Height) - 1, static_cast<int32>(std::ceil(std::max(Line.Y0, Line.Y1))));
+		Line.bDepthTest = State.bDepthTest;
+		if (Line.MinX > Line.MaxX || Line.MinY > Line.MaxY)
+		{
+			continue;
+		}
+
+		const uint32 PrimitiveId = static_cast<uint32>(Lines.Add(Line));
+		BinPrimitive(PrimitiveId | LineBit, Line.MinX, Line.MinY, Line.MaxX, Line.MaxY);
+	}
+}
+
+void FSoftwareRasterizer::BinPrimitive(uint32 PrimitiveId, int32 MinX, int32 MinY, int32 MaxX, int32 MaxY)
+{
+	const int32 TileMinX = MinX / TileSize;
+	const int32 TileMinY = MinY / TileSize;
+	const int32 TileMaxX = MaxX / TileSize;
+	const int32 TileMaxY = MaxY / TileSize;
+
+	for (int32 TileY = TileMinY; TileY <= TileMaxY; ++TileY)
+	{
+		for (int32 TileX = TileMinX; TileX <= TileMaxX; ++TileX)
+		{
+			TileBins[TileY * NumTilesX + TileX].Add(PrimitiveId);
+		}
+	}
+	Stats.NumBinnedPrimitives += static_cast<uint64>((TileMaxX - TileMinX + 1) * (TileMaxY - TileMinY + 1));
+}
+
+void FSoftwareRasterizer::Flush()
+{
+	if (Triangles.Num() == 0 && Lines.Num() == 0)
+	{
+		return;
+	}
+
+	// Tile끼리는 겹치는 픽셀이 없으므로 동기화 없이 병렬로 처리합니다.
+	std::atomic<uint64> ShadedPixels = 0;
+	FJobSystem::Get().ParallelFor(NumTilesX * NumTilesY, [this, &ShadedPixels](int32 TileIndex)
+	{
+		if (TileBins[TileIndex].Num() > 0)
+		{
+			ShadedPixels.fetch_add(RasterizeTile(TileIndex), std::memory_order_relaxed);
+		}
+	});
+
+	Stats.NumShadedPixels += ShadedPixels.load(std::memory_order_relaxed);
+	Triangles.Empty();
+	Lines.Empty();
+}
+
+uint64 FSoftwareRasterizer::RasterizeTile(int32 TileIndex)
+{
+	const int32 TileMinX = (TileIndex % NumTilesX) * TileSize;
+	const int32 TileMinY = (TileIndex / NumTilesX) * TileSize;
+	const int32 TileMaxX = std::min(TileMinX + TileSize, static_cast<int32>(Width)) - 1;
+	const int32 TileMaxY = std::min(TileMinY + TileSize, static_cast<int32>(Height)) - 1;
+
+	uint64 ShadedPixels = 0;
+	for (const uint32 PrimitiveId : TileBins[TileIndex])
+	{
+		if (PrimitiveId & LineBit)
+		{
+			RasterizeLine(Lines[static_cast<int32>(PrimitiveId & ~LineBit)], TileMinX, TileMinY, TileMaxX, TileMaxY, ShadedPixels);
+		}
+		else
+		{
+			RasterizeTriangle(Triangles[static_cast<int32>(PrimitiveId)], TileMinX, TileMinY, TileMaxX, TileMaxY, ShadedPixels);
+		}
+	}
+	TileBins[TileIndex].Empty();
+
+	return ShadedPixels;
+}
+
+void FSoftwareRasterizer::RasterizeTriangle(
+	const FRasterTriangle& Triangle, int32 TileMinX, int32 TileMinY, int32 TileMaxX, int32 TileMaxY, uint64& OutShadedPixels
+)
+{
+	// 4픽셀 단위로 평가하므로 시작 x를 4의 배수로 내림 (Tile 시작은 항상 4의 배수)
+	const int32 StartX = std::max(Triangle.MinX, TileMinX) & ~3;
+	const int32 EndX = std::min(Triangle.MaxX, TileMaxX);
+	const int32 StartY = std::max(Triangle.MinY, TileMinY);
+	const int32 EndY = std::min(Triangle.MaxY, TileMaxY);
+	if (StartX > EndX || StartY > EndY)
+	{
+		return;
+	}
+
+	const FSRGBTable& Table = GetSRGBTable();
+	const FFloat4 LaneOffset = Set(0.0f, 1.0f, 2.0f, 3.0f);
+	const FFloat4 Zero = Splat(0.0f);
+	const FFloat4 One = Splat(1.0f);
+	const FFloat4 LastX = Splat(static_cast<float>(EndX));
+
+	FFloat4 EdgeA[3], EdgeB[3], EdgeC[3];
+	for (int32 Edge = 0; Edge < 3; ++Edge)
+	{
+		EdgeA[Edge] = Splat(Triangle.EdgeA[Edge]);
+		EdgeB[Edge] = Splat(Triangle.EdgeB[Edge]);
+		EdgeC[Edge] = Splat(Triangle.EdgeC[Edge]);
+	}
+	const bool bTopLeft[3] = {
+		(Triangle.TopLeftMask & 1) != 0, (Triangle.TopLeftMask & 2) != 0, (Triangle.TopLeftMask & 4) != 0
+	};
+
+	const FFloat4 Z0 = Splat(Triangle.Z[0]), Z1 = Splat(Triangle.Z[1]), Z2 = Splat(Triangle.Z[2]);
+	const FFloat4 W0 = Splat(Triangle.InvW[0]), W1 = Splat(Triangle.InvW[1]), W2 = Splat(Triangle.InvW[2]);
+
+	// 단색이면 픽셀마다 변환하지 않도록 미리 계산
+	const float* FlatColor = Triangle.Color[0];
+	const bool bOpaqueFlat = Triangle.bFlatColor && FlatColor[3] >= 1.0f;
+	const uint32 OpaqueFlatColor = bOpaqueFlat ? BlendColor(Table, FlatColor[0], FlatColor[1], FlatColor[2], FlatColor[3], 0) : 0;
+
+	uint64 ShadedPixels = 0;
+	for (int32 Y = StartY; Y <= EndY; ++Y)
+	{
+		const FFloat4 PixelY = Splat(static_cast<float>(Y));
+		FFloat4 RowEdge[3];
+		for (int32 Edge = 0; Edge < 3; ++Edge)
+		{
+			RowEdge[Edge] = MulAdd(EdgeB[Edge], PixelY, EdgeC[Edge]);
+		}
+
+		for (int32 X = StartX; X <= EndX; X += 4)
+		{
+			const FFloat4 PixelX = Add(Splat(static_cast<float>(X)), LaneOffset);
+
+			FMask4 Mask = CmpLE(PixelX, LastX);
+			FFloat4 Bary[3];
+			for (int32 Edge = 0; Edge < 3; ++Edge)
+			{
+				Bary[Edge] = MulAdd(EdgeA[Edge], PixelX, RowEdge[Edge]);
+				Mask = And(Mask, bTopLeft[Edge] ? CmpGE(Bary[Edge], Zero) : CmpGT(Bary[Edge], Zero));
+			}
+			if (MoveMask(Mask) == 0)
+			{
+				continue;
+			}
+
+			const FFloat4 Depth = MulAdd(Bary[0], Z0, MulAdd(Bary[1], Z1, Mul(Bary[2], Z2)));
+			Mask = And(Mask, And(CmpGE(Depth, Zero), CmpLE(Depth, One)));
+
+			const int32 PixelIndex = GetPixelIndex(X, Y);
+			if (Triangle.bDepthTest)
+			{
+				float* DepthPtr = &DepthTarget[PixelIndex];
+				const FFloat4 OldDepth = Load(DepthPtr);
+				Mask = And(Mask, CmpLE(Depth, OldDepth));
+				Store(DepthPtr, Select(Mask, Depth, OldDepth));
+			}
+
+			const int32 LaneMask = MoveMask(Mask);
+			if (LaneMask == 0)
+			{
+				continue;
+			}
+
+			uint32* ColorPtr = &ColorTarget[PixelIndex];
+			uint32* UUIDPtr = &UUIDTarget[PixelIndex];
+
+			if (bOpaqueFlat)
+			{
+				for (int32 Lane = 0; Lane < 4; ++Lane)
+				{
+					if (LaneMask & (1 << Lane))
+					{
+						ColorPtr[Lane] = OpaqueFlatColor;
+						UUIDPtr[Lane] = Triangle.UUID;
+						++ShadedPixels;
+					}
+				}
+				continue;
+			}
+
+			float Colors[4][4];
+			if (Triangle.bFlatColor)
+			{
+				for (int32 Channel = 0; Channel < 4; ++Channel)
+				{
+					Store(Colors[Channel], Splat(FlatColor[Channel]));
+				}
+			}
+			else
+			{
+				// 원근 보정: (Σ b·c/w) / (Σ b/w)
+				const FFloat4 InvW = MulAdd(Bary[0], W0, MulAdd(Bary[1], W1, Mul(Bary[2], W2)));
+				for (int32 Channel = 0; Channel < 4; ++Channel)
+				{
+					const FFloat4 Value = MulAdd(
+						Bary[0], Splat(Triangle.Color[0][Channel]),
+						MulAdd(Bary[1], Splat(Triangle.Color[1][Channel]), Mul(Bary[2], Splat(Triangle.Color[2][Channel])))
+					);
+					Store(Colors[Channel], Div(Value, InvW));
+				}
+			}
+
+			for (int32 Lane = 0; Lane < 4; ++Lane)
+			{
+				if (LaneMask & (1 << Lane))
+				{
+					ColorPtr[Lane] = BlendColor(Table, Colors[0][Lane], Colors[1][Lane], Colors[2][Lane], Colors[3][Lane], ColorPtr[Lane]);
+					UUIDPtr[Lane] = Triangle.UUID;
+					++ShadedPixels;
+				}
+			}
+		}
+	}
+
+	OutShadedPixels += ShadedPixels;
+}
+
+void FSoftwareRasterizer::RasterizeLine(
+	const FRasterLine& Line, int32 TileMinX, int32 TileMinY, int32 TileMaxX, int32 TileMaxY, uint64& OutShadedPixels
+)
+{
+	const float DeltaX = Line.X1 - Line.X0;
+	const float DeltaY = Line.Y1 - Line.Y0;
+	const bool bMajorX = std::abs(DeltaX) >= std::abs(DeltaY);
+	const float MajorDelta = bMajorX ? DeltaX : DeltaY;
+	if (MajorDelta == 0.0f)
+	{
+		return;
+	}
+
+	// 주축의 픽셀 중심마다 한 픽셀씩 (Diamond Exit 규칙의 근사)
+	const float MajorStart = bMajorX ? std::min(Line.X0, Line.X1) : std::min(Line.Y0, Line.Y1);
+	const float MajorEnd = bMajorX ? std::max(Line.X0, Line.X1) : std::max(Line.Y0, Line.Y1);
+	int32 First = static_cast<int32>(std::ceil(MajorStart - 0.5f));
+	int32 Last = static_cast<int32>(std::ceil(MajorEnd - 0.5f)) - 1;
+	First = std::max(First, bMajorX ? TileMinX : TileMinY);
+	Last = std::min(Last, bMajorX ? TileMaxX : TileMaxY);
+
+	const FSRGBTable& Table = GetSRGBTable();
+	uint64 ShadedPixels = 0;
+	for (int32 Major = First; Major <= Last; ++Major)
+	{
+		const float T = ((static_cast<float>(Major) + 0.5f) - (bMajorX ? Line.X0 : Line.Y0)) / MajorDelta;
+		const float Minor = bMajorX ? Line.Y0 + DeltaY * T : Line.X0 + DeltaX * T;
+		const int32 MinorPixel = static_cast<int32>(std::floor(Minor));
+
+		const int32 X = bMajorX ? Major : MinorPixel;
+		const int32 Y = bMajorX ? MinorPixel : Major;
+		if (X < TileMinX || X > TileMaxX || Y < TileMinY || Y > TileMaxY)
+		{
+			continue;
+		}
+
+		const float Depth = Line.Z0 + (Line.Z1 - Line.Z0) * T;
+		if (Depth < 0.0f || Depth > 1.0f)
+		{
+			continue;
+		}
+
+		const int32 PixelIndex = GetPixelIndex(X, Y);
+		if (Line.bDepthTest)
+		{
+			if (Depth > DepthTarget[PixelIndex])
+			{
+				continue;
+			}
+			DepthTarget[PixelIndex] = Depth;
+		}
+
+		float Color[4];
+		for (int32 Channel = 0; Channel < 4; ++Channel)
+		{
+			Color[Channel] = Line.Color0[Channel] + (Line.Color1[Channel] - Line.Color0[Channel]) * T;
+		}
+		ColorTarget[PixelIndex] = BlendColor(Table, Color[0], Color[1], Color[2], Color[3], ColorTarget[PixelIndex]);
+		++ShadedPixels;
+	}
+
+	OutShadedPixels += ShadedPixels;
+}
+
+FSoftwareImage FSoftwareRasterizer::Resolve(const TArray<uint32>& Target) const
+{
+	FSoftwareImage Image;
+	Image.Width = Width;
+	Image.Height = Height;
+	Image.Pixels.SetNum(static_cast<int32>(Width * Height));
+	for (uint32 Y = 0; Y < Height; ++Y)
+	{
+		std::memcpy(&Image.Pixels[static_cast<int32>(Y * Width)], &Target[GetPixelIndex(0, Y)], Width * sizeof(uint32));
+	}
+	return Image;
+}
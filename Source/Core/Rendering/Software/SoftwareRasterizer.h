@@ -0,0 +1,225 @@
+#pragma once
+#include <span>
+
+#include "SoftwareImage.h"
+#include "Core/Container/Array.h"
+#include "Core/HAL/PlatformType.h"
+#include "Core/Math/Matrix.h"
+#include "Core/Math/Vector.h"
+
+
+enum class ESoftwareCullMode : uint8
+{
+	None,
+	Back,   // DefaultRasterizer (시계 방향이 앞면)
+};
+
+/**
+ * Draw 한 번에 적용되는 상태 (ShaderW0.hlsl의 cbuffer + Rasterizer/Depth State)
+ */
+struct FSoftwareDrawState
+{
+	/** 행 벡터 규약 (Model * ViewProjection), Constant Buffer에 넣을 때처럼 전치하지 않습니다. */
+	FMatrix MVP = FMatrix::Identity();
+
+	/** bUseVertexColor가 false일 때 모든 정점에 사용하는 색 */
+	FVector4 Color = FVector4(1.0f, 1.0f, 1.0f, 1.0f);
+
+	/** UUID Target에 쓰는 값 (FEditorManager::DecodeUUID(UUIDColor)) */
+	uint32 UUID = 0;
+
+	bool bUseVertexColor = true;
+	ESoftwareCullMode CullMode = ESoftwareCullMode::Back;
+
+	/** false면 AlwaysVisibleDepthStencilState처럼 깊이 검사/쓰기를 하지 않습니다. */
+	bool bDepthTest = true;
+};
+
+
+/**
+ * GPU 없이 현재 파이프라인의 출력을 재현하는 CPU Rasterizer
+ *
+ * - Color(R8G8B8A8_UNORM_SRGB), UUID(uint32), Depth(float) 세 Target에 씁니다.
+ * - Triangle은 Half-space(Edge Function) 방식으로 4픽셀씩 SIMD 평가하고, D3D의 Top-Left 규칙과 LESS_EQUAL 깊이 검사를 따릅니다.
+ * - Draw는 정점 변환/Clipping/Setup 후 64x64 Tile에 Binning만 하고, Flush에서 Tile 단위로 병렬 Rasterize 합니다.
+ *   Tile 안에서는 제출 순서를 지키므로 결과는 스레드 수와 관계없이 항상 같습니다. (Golden Image 비교 가능)
+ * - Line은 ShaderLine처럼 Color와 Depth만 씁니다.
+ */
+class FSoftwareRasterizer
+{
+public:
+	struct FStats
+	{
+		uint64 NumTriangles = 0;
+		uint64 NumCulledTriangles = 0;
+		uint64 NumClippedTriangles = 0;
+		uint64 NumLines = 0;
+		uint64 NumBinnedPrimitives = 0;
+		uint64 NumShadedPixels = 0;
+	};
+
+	static constexpr int32 TileSize = 64;
+
+	FSoftwareRasterizer() = default;
+	FSoftwareRasterizer(uint32 InWidth, uint32 InHeight) { Resize(InWidth, InHeight); }
+
+	void Resize(uint32 InWidth, uint32 InHeight);
+
+	/** 모든 Target을 지우고, Binning 중인 Primitive도 버립니다. */
+	void Clear(const FVector4& InColor, float InDepth = 1.0f, uint32 InUUID = 0);
+
+	/** 깊이만 지웁니다. Binning 중인 Primitive가 있으면 먼저 Flush 해야 합니다. */
+	void ClearDepth(float InDepth = 1.0f);
+
+	/** Triangle List (FVertexSimple 등 X, Y, Z, R, G, B, A를 가진 정점) */
+	template <typename VertexType>
+	void DrawIndexedTriangles(std::span<const VertexType> Vertices, std::span<const uint32> Indices, const FSoftwareDrawState& State);
+
+	/** Line List (FLineVertexSimple, FVertexSimple) */
+	template <typename VertexType>
+	void DrawIndexedLines(std::span<const VertexType> Vertices, std::span<const uint32> Indices, const FSoftwareDrawState& State);
+
+	/** Binning된 Primitive를 Rasterize 합니다. Read/Resolve 전에 호출해야 합니다. */
+	void Flush();
+
+	uint32 GetWidth() const { return Width; }
+	uint32 GetHeight() const { return Height; }
+
+	uint32 ReadColor(uint32 X, uint32 Y) const { return ColorTarget[GetPixelIndex(X, Y)]; }
+	uint32 ReadUUID(uint32 X, uint32 Y) const { return UUIDTarget[GetPixelIndex(X, Y)]; }
+	float ReadDepth(uint32 X, uint32 Y) const { return DepthTarget[GetPixelIndex(X, Y)]; }
+
+	FSoftwareImage ResolveColor() const { return Resolve(ColorTarget); }
+	FSoftwareImage ResolveUUID() const { return Resolve(UUIDTarget); }
+
+	const FStats& GetStats() const { return Stats; }
+	void ResetStats() { Stats = {}; }
+
+private:
+	/** Clip 공간 정점 */
+	struct FClipVertex
+	{
+		float X, Y, Z, W;
+		float R, G, B, A;
+	};
+
+	/** Setup이 끝난 Triangle, Edge Function은 넓이로 정규화되어 세 값의 합이 1 (Barycentric) */
+	struct FRasterTriangle
+	{
+		float EdgeA[3];
+		float EdgeB[3];
+		float EdgeC[3];
+
+		float Z[3];         // z / w
+		float InvW[3];      // 1 / w
+		float Color[3][4];  // Color / w (bFlatColor면 Color[0]만 사용)
+
+		int32 MinX, MinY, MaxX, MaxY;
+		uint32 UUID;
+		uint8 TopLeftMask;
+		bool bFlatColor;
+		bool bDepthTest;
+	};
+
+	struct FRasterLine
+	{
+		float X0, Y0, Z0;
+		float X1, Y1, Z1;
+		float Color0[4];
+		float Color1[4];
+
+		int32 MinX, MinY, MaxX, MaxY;
+		bool bDepthTest;
+	};
+
+	/** Tile Bin 항목, 최상위 비트가 1이면 Line */
+	static constexpr uint32 LineBit = 0x80000000u;
+
+	int32 GetPixelIndex(uint32 X, uint32 Y) const { return static_cast<int32>(Y * Pitch + X); }
+
+	template <typename VertexType>
+	void TransformVertices(std::span<const VertexType> Vertices, const FSoftwareDrawState& State);
+
+	void SubmitTriangles(std::span<const uint32> Indices, const FSoftwareDrawState& State);
+	void SubmitLines(std::span<const uint32> Indices, const FSoftwareDrawState& State);
+
+	void SetupTriangle(const FClipVertex& V0, const FClipVertex& V1, const FClipVertex& V2, const FSoftwareDrawState& State);
+	void BinPrimitive(uint32 PrimitiveId, int32 MinX, int32 MinY, int32 MaxX, int32 MaxY);
+
+	/** @return 칠한 픽셀 수 */
+	uint64 RasterizeTile(int32 TileIndex);
+	void RasterizeTriangle(const FRasterTriangle& Triangle, int32 TileMinX, int32 TileMinY, int32 TileMaxX, int32 TileMaxY, uint64& OutShadedPixels);
+	void RasterizeLine(const FRasterLine& Line, int32 TileMinX, int32 TileMinY, int32 TileMaxX, int32 TileMaxY, uint64& OutShadedPixels);
+
+	FSoftwareImage Resolve(const TArray<uint32>& Target) const;
+
+private:
+	uint32 Width = 0;
+	uint32 Height = 0;
+
+	/** 4픽셀 단위 SIMD 접근을 위해 4의 배수로 맞춘 행 길이 */
+	uint32 Pitch = 0;
+
+	int32 NumTilesX = 0;
+	int32 NumTilesY = 0;
+
+	TArray<uint32> ColorTarget;
+	TArray<uint32> UUIDTarget;
+	TArray<float> DepthTarget;
+
+	// Draw 사이에 재사용하는 버퍼
+	TArray<FClipVertex> ClipVertices;
+	TArray<FRasterTriangle> Triangles;
+	TArray<FRasterLine> Lines;
+	TArray<TArray<uint32>> TileBins;
+
+	FStats Stats;
+};
+
+
+template <typename VertexType>
+void FSoftwareRasterizer::TransformVertices(std::span<const VertexType> Vertices, const FSoftwareDrawState& State)
+{
+	// mul(float4(Position, 1), MVP), 행 벡터 * 행렬
+	const auto& M = State.MVP.M;
+
+	ClipVertices.SetNum(static_cast<int32>(Vertices.size()));
+	FClipVertex* Out = ClipVertices.GetData();
+	for (const VertexType& Vertex : Vertices)
+	{
+		Out->X = Vertex.X * M[0][0] + Vertex.Y * M[1][0] + Vertex.Z * M[2][0] + M[3][0];
+		Out->Y = Vertex.X * M[0][1] + Vertex.Y * M[1][1] + Vertex.Z * M[2][1] + M[3][1];
+		Out->Z = Vertex.X * M[0][2] + Vertex.Y * M[1][2] + Vertex.Z * M[2][2] + M[3][2];
+		Out->W = Vertex.X * M[0][3] + Vertex.Y * M[1][3] + Vertex.Z * M[2][3] + M[3][3];
+
+		if (State.bUseVertexColor)
+		{
+			Out->R = Vertex.R;
+			Out->G = Vertex.G;
+			Out->B = Vertex.B;
+			Out->A = Vertex.A;
+		}
+		else
+		{
+			Out->R = State.Color.X;
+			Out->G = State.Color.Y;
+			Out->B = State.Color.Z;
+			Out->A = State.Color.W;
+		}
+		++Out;
+	}
+}
+
+template <typename VertexType>
+void FSoftwareRasterizer::DrawIndexedTriangles(std::span<const VertexType> Vertices, std::span<const uint32> Indices, const FSoftwareDrawState& State)
+{
+	TransformVertices(Vertices, State);
+	SubmitTriangles(Indices, State);
+}
+
+template <typename VertexType>
+void FSoftwareRasterizer::DrawIndexedLines(std::span<const VertexType> Vertices, std::span<const uint32> Indices, const FSoftwareDrawState& State)
+{
+	TransformVertices(Vertices, State);
+	SubmitLines(Indices, State);
+}
@@ -1,12 +1,16 @@
 #include "UI.h"
 
+#include <cinttypes>
+#include <cstring>
+
 #include "FDevice.h"
 #include "FViewMode.h"
+#include "RenderingThread.h"
 #include "Core/Engine.h"
 #include "Core/Input/PlayerInput.h"
+#include "Core/RHI/RHI.h"
+#include "Core/Stats/StatCounter.h"
 #include "Debug/DebugConsole.h"
-#include "ImGui/imgui_impl_dx11.h"
-#include "ImGui/imgui_impl_win32.h"
 #include "ImGui/imgui_internal.h"
 #include "Object/Actor/Camera.h"
 #include "Object/Actor/Cone.h"
@@ -18,6 +22,12 @@
 #include "Object/World/World.h"
 #include "Static/FEditorManager.h"
 #include "Static/FUUIDBillBoard.h"
+
+// ImGui Backend는 Win32 / D3D11 전용, Headless 빌드에는 포함하지 않습니다.
+#if PLATFORM_WINDOWS
+#include "ImGui/imgui_impl_dx11.h"
+#include "ImGui/imgui_impl_win32.h"
+#endif
 // #include "FDevice.h"
 // #include "FViewMode.h"
 // #include "Core/Engine.h"
@@ -40,6 +50,37 @@
 // #include "Static/FUUIDBillBoard.h"
 
 
+namespace
+{
+/** Render Thread로 넘기는 ImGui DrawData 복사본 (원본 DrawList는 다음 NewFrame에서 다시 쓰임) */
+struct FImGuiDrawDataSnapshot
+{
+    ImDrawData DrawData;
+
+    FImGuiDrawDataSnapshot(const ImDrawData& Source)
+        : DrawData(Source)
+    {
+        DrawData.CmdLists.resize(0);
+        for (const ImDrawList* DrawList : Source.CmdLists)
+        {
+            DrawData.CmdLists.push_back(DrawList->CloneOutput());
+        }
+    }
+
+    ~FImGuiDrawDataSnapshot()
+    {
+        for (ImDrawList* DrawList : DrawData.CmdLists)
+        {
+            IM_DELETE(DrawList);
+        }
+    }
+
+    FImGuiDrawDataSnapshot(const FImGuiDrawDataSnapshot&) = delete;
+    FImGuiDrawDataSnapshot& operator=(const FImGuiDrawDataSnapshot&) = delete;
+};
+}
+
+
 void UI::Initialize(HWND hWnd, const FDevice& Device, UINT ScreenWidth, UINT ScreenHeight)
 {
     // ImGui 초기화
@@ -54,8 +95,10 @@ void UI::Initialize(HWND hWnd, const FDevice& Device, UINT ScreenWidth, UINT Scr
     io.DisplaySize = ScreenSize;
     //io.WantSetMousePos = true;
     // ImGui Backend 초기화
+#if PLATFORM_WINDOWS
     ImGui_ImplWin32_Init(hWnd);
     ImGui_ImplDX11_Init(Device.GetDevice(), Device.GetDeviceContext());
+#endif
 
 	ScreenSize = ImVec2(static_cast<float>(ScreenWidth), static_cast<float>(ScreenHeight));
     InitialScreenSize = ScreenSize;
@@ -69,6 +112,8 @@ void UI::Initialize(HWND hWnd, const FDevice& Device, UINT ScreenWidth, UINT Scr
 
 void UI::Update()
 {
+    SCOPE_CYCLE_COUNTER("UI Update");
+
     POINT mousePos;
     if (GetCursorPos(&mousePos)) {
         HWND hwnd = GetActiveWindow();
@@ -81,8 +126,10 @@ void UI::Update()
 
     
     // ImGui Frame 생성
+#if PLATFORM_WINDOWS
     ImGui_ImplDX11_NewFrame();
     ImGui_ImplWin32_NewFrame();
+#endif
     ImGui::NewFrame();
 
     if (bWasWindowSizeUpdated)
@@ -97,12 +144,24 @@ void UI::Update()
     RenderPropertyWindow();
 	RenderShowFlagsPanel();
 	RenderViewModePanel();
+	RenderProfiler();
+	RenderStatCounters();
 
     Debug::ShowConsole(bWasWindowSizeUpdated, PreRatio, CurRatio);
 
     // ImGui 렌더링
     ImGui::Render();
-    ImGui_ImplDX11_RenderDrawData(ImGui::GetDrawData());
+
+    auto Snapshot = std::make_shared<FImGuiDrawDataSnapshot>(*ImGui::GetDrawData());
+    ENQUEUE_RENDER_COMMAND([Snapshot]
+    {
+#if PLATFORM_WINDOWS
+        ImGui_ImplDX11_RenderDrawData(&Snapshot->DrawData);
+
+        // ImGui는 Device Context에 직접 바인딩하므로 RHI가 기억한 바인딩을 버림
+        FRHI::Get().InvalidateState();
+#endif
+    });
 
     bWasWindowSizeUpdated = false;
 }
@@ -110,16 +169,20 @@ void UI::Update()
 
 void UI::Shutdown() const
 {
+#if PLATFORM_WINDOWS
     ImGui_ImplDX11_Shutdown();
     ImGui_ImplWin32_Shutdown();
+#endif
     ImGui::DestroyContext();
 }
 
 void UI::OnUpdateWindowSize(UINT InScreenWidth, UINT InScreenHeight)
 {
     // ImGUI 리소스 다시 생성
+#if PLATFORM_WINDOWS
     ImGui_ImplDX11_InvalidateDeviceObjects();
     ImGui_ImplDX11_CreateDeviceObjects();
+#endif
    // ImGui 창 크기 업데이트
 	//ScreenSize = ImVec2(static_cast<float>(InScreenWidth), static_cast<float>(InScreenHeight));
 
@@ -144,6 +207,16 @@ void UI::RenderControlPanel()
     ImGui::Text("Hello, Jungle World!");
     ImGui::Text("FPS: %.3f (%.2f ms)", ImGui::GetIO().Framerate , 1000.0f / ImGui::GetIO().Framerate);
 
+    // 평균 FPS에 묻히는 순간적인 멈춤은 p99 / max와 Hitch 수로 확인
+    FFrameStats& FrameStats = UEngine::Get().GetFrameStats();
+    const FFrameTimeSummary FrameTimes = FrameStats.GetWindowSummary();
+    ImGui::Text("Frame (10 s): p50 %.2f / p95 %.2f / p99 %.2f / max %.2f ms", FrameTimes.P50Ms, FrameTimes.P95Ms, FrameTimes.P99Ms, FrameTimes.MaxMs);
+    ImGui::Text("Hitches: %" PRIu64 " (worst %.2f ms)", FrameStats.GetNumHitches(), FrameStats.GetWorstHitchMs());
+
+    const FViewCullingStats& Culling = UEngine::Get().GetWorld()->GetCullingStats();
+    ImGui::Text("Culling: %d visible, %d culled (%.3f ms)", Culling.NumVisible, Culling.NumCulled, Culling.CullMs);
+    ImGui::Text("Occlusion: %d occluders, %d occluded (%.3f ms)", Culling.NumOccluders, Culling.NumOccluded, Culling.OcclusionMs);
+
     RenderMemoryUsage();
     RenderPrimitiveSelection();
     RenderCameraSettings();
@@ -608,3 +681,143 @@ void UI::RenderGridSettings() const
 		World->OnChangedGridSize();
 	}
 }
+
+void UI::RenderProfiler()
+{
+	if (ImGui::Begin("Profiler"))
+	{
+		bool bEnabled = FProfiler::IsEnabled();
+		if (ImGui::Checkbox("Enabled", &bEnabled))
+		{
+			FProfiler::Get().SetEnabled(bEnabled);
+		}
+		ImGui::SameLine();
+		ImGui::Checkbox("Pause", &bProfilerPaused);
+		ImGui::SameLine();
+		ImGui::SetNextItemWidth(120.0f);
+		ImGui::SliderInt("Frames", &ProfilerNumFrames, 1, 30);
+		ImGui::SameLine();
+		if (ImGui::Button("Export Trace"))
+		{
+			FProfiler::Get().ExportChromeTrace("ProfilerTrace.json", ProfilerNumFrames);
+		}
+
+		// 멈춰 있는 동안은 마지막 Capture를 계속 보여줌
+		if (!bProfilerPaused)
+		{
+			FProfiler::Get().Capture(ProfilerNumFrames, ProfilerCapture);
+		}
+
+		const int32 NumFrames = ProfilerCapture.GetNumFrames();
+		if (NumFrames == 0)
+		{
+			ImGui::Text("No completed frames");
+			ImGui::End();
+			return;
+		}
+
+		const uint64 BaseCycles = ProfilerCapture.GetStartCycles();
+		const double SpanCycles = static_cast<double>(ProfilerCapture.GetEndCycles() - BaseCycles);
+		ImGui::Text("%d frames, %.3f ms", NumFrames, FPlatformTime::ToMilliseconds(ProfilerCapture.GetEndCycles() - BaseCycles));
+
+		ImDrawList* DrawList = ImGui::GetWindowDrawList();
+		const float RowHeight = ImGui::GetTextLineHeight() + 2.0f;
+		const float Width = FMath::Max(ImGui::GetContentRegionAvail().x, 100.0f);
+		const ImVec2 Origin = ImGui::GetCursorScreenPos();
+		auto ToScreenX = [&](uint64 Cycles)
+		{
+			const double Offset = Cycles > BaseCycles ? static_cast<double>(Cycles - BaseCycles) : 0.0;
+			return Origin.x + static_cast<float>(Offset / SpanCycles) * Width;
+		};
+
+		float LaneTop = Origin.y;
+		for (const FProfilerCapture::FThread& Thread : ProfilerCapture.Threads)
+		{
+			DrawList->AddText(ImVec2(Origin.x, LaneTop), IM_COL32(220, 220, 220, 255), *Thread.Name);
+			LaneTop += RowHeight;
+
+			uint32 MaxDepth = 0;
+			for (const FProfilerEvent& Event : Thread.Events)
+			{
+				MaxDepth = FMath::Max(MaxDepth, Event.Depth);
+
+				const float X0 = ToScreenX(Event.StartCycles);
+				const float X1 = FMath::Max(ToScreenX(FMath::Min(Event.EndCycles, ProfilerCapture.GetEndCycles())), X0 + 1.0f);
+				const float Y0 = LaneTop + static_cast<float>(Event.Depth) * RowHeight;
+				const ImVec2 Min(X0, Y0);
+				const ImVec2 Max(X1, Y0 + RowHeight - 1.0f);
+
+				// 같은 이름은 같은 색
+				uint32 Hash = 2166136261u;
+				for (const char* Char = Event.Name; *Char != '\0'; ++Char)
+				{
+					Hash = (Hash ^ static_cast<uint8>(*Char)) * 16777619u;
+				}
+				DrawList->AddRectFilled(Min, Max, IM_COL32(80 + Hash % 150, 80 + (Hash >> 8) % 150, 80 + (Hash >> 16) % 150, 255));
+
+				if (X1 - X0 > 24.0f)
+				{
+					DrawList->PushClipRect(Min, Max, true);
+					DrawList->AddText(ImVec2(X0 + 2.0f, Y0), IM_COL32(0, 0, 0, 255), Event.Name);
+					DrawList->PopClipRect();
+				}
+
+				if (ImGui::IsMouseHoveringRect(Min, Max))
+				{
+					ImGui::SetTooltip("%s\n%.3f ms", Event.Name, FPlatformTime::ToMilliseconds(Event.EndCycles - Event.StartCycles));
+				}
+			}
+			LaneTop += static_cast<float>(MaxDepth + 1) * RowHeight + 4.0f;
+		}
+
+		// 프레임 경계
+		for (const uint64 FrameStart : ProfilerCapture.FrameStartCycles)
+		{
+			const float X = ToScreenX(FrameStart);
+			DrawList->AddLine(ImVec2(X, Origin.y), ImVec2(X, LaneTop), IM_COL32(255, 255, 255, 96));
+		}
+
+		ImGui::Dummy(ImVec2(Width, LaneTop - Origin.y));
+	}
+	ImGui::End();
+}
+
+void UI::RenderStatCounters() const
+{
+	if (ImGui::Begin("Render Stats"))
+	{
+		const FStatCounterRegistry& StatCounters = FStatCounterRegistry::Get();
+		for (const char* Group : StatCounters.GetGroups())
+		{
+			if (!ImGui::CollapsingHeader(Group, ImGuiTreeNodeFlags_DefaultOpen))
+			{
+				continue;
+			}
+
+			if (ImGui::BeginTable(Group, 3, ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingStretchProp))
+			{
+				ImGui::TableSetupColumn("Counter");
+				ImGui::TableSetupColumn("Last");
+				ImGui::TableSetupColumn("Avg");
+				ImGui::TableHeadersRow();
+
+				for (const FStatCounter* Counter : StatCounters.GetCounters())
+				{
+					if (std::strcmp(Counter->GetGroup(), Group) != 0)
+					{
+						continue;
+					}
+					ImGui::TableNextRow();
+					ImGui::TableNextColumn();
+					ImGui::TextUnformatted(Counter->GetName());
+					ImGui::TableNextColumn();
+					ImGui::Text("%" PRIu64, Counter->GetLastFrameValue());
+					ImGui::TableNextColumn();
+					ImGui::Text("%.1f", Counter->GetSmoothedValue());
+				}
+				ImGui::EndTable();
+			}
+		}
+	}
+	ImGui::End();
+}
@@ -1,6 +1,7 @@
 #pragma once
 #include "Core/Container/Array.h"
 #include "Core/Container/String.h"
+#include "Core/Stats/Stats.h"
 #include "ImGui/imgui.h"
 
 
@@ -30,6 +31,12 @@ public:// UIWindows
 	void RenderViewModePanel() const;
 	void RenderGridSettings() const;
 
+	/** 최근 몇 프레임의 SCOPE_CYCLE_COUNTER를 Thread별 Flame Graph로 */
+	void RenderProfiler();
+
+	/** FStatCounter를 Group별 표로 (지난 프레임 / 최근 평균) */
+	void RenderStatCounters() const;
+
 private:
 	// Mouse 전용
 	ImVec2 ResizeToScreenByCurrentRatio(const ImVec2& vec2) const
@@ -85,4 +92,9 @@ private:
 	TArray<uint32> UUIDs;
 	uint32 PrevSize = 0;
 	AActor* CurActor = nullptr;
+
+	// Profiler 창
+	FProfilerCapture ProfilerCapture;
+	int32 ProfilerNumFrames = 3;
+	bool bProfilerPaused = false;
 };
@@ -1,5 +1,6 @@
 #include "URenderer.h"
 #include <d3dcompiler.h>
+#include "DrawCommandList.h"
 #include "DirectXTK/WICTextureLoader.h"
 #include "FDevice.h"
 #include "FViewMode.h"
@@ -21,6 +22,12 @@
 #include "Resource/DirectResource/BlendState.h"
 #include "Resource/DirectResource/Rasterizer.h"
 #include "Resource/DirectResource/ShaderResourceBinding.h"
+#include "Resource/RenderResourceCollection.h"
+#include "Core/Stats/StatCounter.h"
+
+
+DECLARE_STAT_COUNTER(STAT_DrawCommands, "Draw", "Draw Commands");
+DECLARE_STAT_COUNTER(STAT_SkippedBinds, "Draw", "Skipped Resource Binds");
 
 void URenderer::Create(HWND hWindow)
 {
@@ -114,9 +121,40 @@ void URenderer::ReleaseConstantBuffer()
 //     }
 // }
 
-void URenderer::Render(FRenderResourceCollection& InRenderResourceCollection)
+void URenderer::Render(FRenderResourceCollection& InRenderResourceCollection, const FRHIPipelineState* InPipelineState)
+{
+	InRenderResourceCollection.Render(InPipelineState);
+}
+
+void URenderer::SubmitDrawCommands(const FDrawCommandList& DrawList, bool bSkipRedundantBinds)
 {
-	InRenderResourceCollection.Render();
+	// 이 목록 밖에서 바인딩한 것은 모르므로 매번 빈 상태에서 시작
+	FRenderResourceBindCache BindCache;
+	EDrawPass CurrentPass = EDrawPass::Main;
+
+	for (int32 Index = 0; Index < DrawList.Num(); ++Index)
+	{
+		const EDrawPass Pass = DrawSortKey::GetPass(DrawList.GetSortKey(Index));
+		if (Pass != CurrentPass && Pass == EDrawPass::Foreground && FDevice::Get().IsInit())
+		{
+			FDevice::Get().PickingPrepare();
+		}
+		CurrentPass = Pass;
+
+		const FDrawCommand& Command = DrawList.GetCommand(Index);
+		Command.Component->GetConstantsComponentData() = Command.Constants;
+		if (bSkipRedundantBinds)
+		{
+			Command.Component->GetRenderResourceCollection().Render(Command.PipelineState, BindCache);
+		}
+		else
+		{
+			Command.Component->GetRenderResourceCollection().Render(Command.PipelineState);
+		}
+	}
+
+	INC_STAT_COUNTER(STAT_DrawCommands, DrawList.Num());
+	INC_STAT_COUNTER(STAT_SkippedBinds, BindCache.NumSkipped);
 }
 
 
@@ -143,6 +181,9 @@ void URenderer::LoadTexture(const wchar_t* texturePath)
 	FDevice::Get().GetDevice()->CreateSamplerState(&samplerDesc, &FontSamplerState);
 	FDevice::Get().GetDeviceContext()->PSSetShaderResources(0, 1, &FontTextureSRV);
 	FDevice::Get().GetDeviceContext()->PSSetSamplers(0, 1, &FontSamplerState);
+
+	// RHI를 거치지 않고 바인딩했으므로
+	FRHI::Get().InvalidateState();
 }
 
 
@@ -55,7 +55,15 @@ public:
     /** 셰이더를 준비 합니다. */
     //void PrepareShader() const;
 
-	void Render(class FRenderResourceCollection& InRenderResourceCollection);
+	/** @param InPipelineState Game Thread에서 ResolvePipelineState로 찾은 PSO (Render Thread) */
+	void Render(class FRenderResourceCollection& InRenderResourceCollection, const class FRHIPipelineState* InPipelineState);
+
+	/**
+	 * 정렬된 Draw 목록을 순서대로 제출합니다. (Render Thread)
+	 * Foreground Pass의 첫 Draw 앞에서 ZIgnore용 깊이 버퍼로 바꿉니다. (Device가 없는 Headless에서는 생략)
+	 * @param bSkipRedundantBinds false면 Draw마다 모든 리소스를 다시 바인딩 (정렬 전과 비교용)
+	 */
+	static void SubmitDrawCommands(const class FDrawCommandList& DrawList, bool bSkipRedundantBinds);
 
     /** PrimitiveComponent를 초기화 합니다. */
     // void RenderPrimitiveInternal(UPrimitiveComponent& PrimitiveComp) const;
@@ -0,0 +1,244 @@
+#include "FrameStats.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+
+#include "Stats.h"
+#include "Core/HAL/PlatformTime.h"
+#include "Debug/DebugConsole.h"
+
+
+void FFrameTimeHistogram::Add(uint64 Value)
+{
+	++Counts[GetBucketIndex(Value)];
+	++TotalCount;
+}
+
+void FFrameTimeHistogram::Remove(uint64 Value)
+{
+	uint32& Count = Counts[GetBucketIndex(Value)];
+	if (Count > 0)
+	{
+		--Count;
+		--TotalCount;
+	}
+}
+
+void FFrameTimeHistogram::Reset()
+{
+	std::fill(std::begin(Counts), std::end(Counts), 0u);
+	TotalCount = 0;
+}
+
+uint64 FFrameTimeHistogram::GetValueAtPercentile(double Percentile) const
+{
+	if (TotalCount == 0)
+	{
+		return 0;
+	}
+
+	// 정렬했을 때 Rank번째 (1부터) 값이 들어 있는 칸
+	const double Fraction = std::clamp(Percentile, 0.0, 100.0) / 100.0;
+	const uint64 Rank = std::max<uint64>(1, static_cast<uint64>(std::ceil(Fraction * static_cast<double>(TotalCount))));
+	uint64 Accumulated = 0;
+	for (int32 Index = 0; Index < NumBuckets; ++Index)
+	{
+		Accumulated += Counts[Index];
+		if (Accumulated >= Rank)
+		{
+			return GetBucketUpperBound(Index);
+		}
+	}
+	return MaxValue;
+}
+
+int32 FFrameTimeHistogram::GetBucketIndex(uint64 Value)
+{
+	Value = std::min(Value, MaxValue);
+	if (Value < 128)
+	{
+		return static_cast<int32>(Value);
+	}
+
+	// 가장 높은 비트 아래로 6비트를 칸 번호로, 구간마다 [64, 128) << Shift
+	const int32 Shift = static_cast<int32>(std::bit_width(Value)) - 7;
+	return 128 + (Shift - 1) * 64 + static_cast<int32>((Value >> Shift) - 64);
+}
+
+uint64 FFrameTimeHistogram::GetBucketUpperBound(int32 BucketIndex)
+{
+	if (BucketIndex < 128)
+	{
+		return static_cast<uint64>(BucketIndex);
+	}
+
+	const int32 Shift = (BucketIndex - 128) / 64 + 1;
+	const uint64 SubBucket = static_cast<uint64>((BucketIndex - 128) % 64 + 64);
+	return ((SubBucket + 1) << Shift) - 1;
+}
+
+
+FFrameStats::FFrameStats()
+{
+	WindowSamples.SetNum(MaxWindowFrames);
+}
+
+FFrameStats::~FFrameStats()
+{
+	WaitForCaptures();
+}
+
+void FFrameStats::BeginFrame()
+{
+	const uint64 Now = FPlatformTime::Cycles64();
+	if (LastFrameCycles != 0)
+	{
+		RecordFrame(FPlatformTime::ToMilliseconds(Now - LastFrameCycles));
+	}
+	LastFrameCycles = Now;
+}
+
+bool FFrameStats::RecordFrame(double FrameMs)
+{
+	// Histogram 범위를 넘는 값도 max에는 그대로 남도록 여기서는 double 정밀도 (2^53)로만 자름
+	const uint64 FrameUs = static_cast<uint64>(std::min(std::max(FrameMs, 0.0) * 1000.0, 9.0e15));
+	++NumRecordedFrames;
+
+	// 중앙값은 이번 프레임을 넣기 전의 분포로, Hitch가 자기 자신을 기준에 섞지 않게
+	const double MedianMs = static_cast<double>(WindowHistogram.GetValueAtPercentile(50.0)) / 1000.0;
+	const bool bIsHitch = HitchSettings.ThresholdMs > 0.0 && FrameMs >= HitchSettings.ThresholdMs
+		&& FrameMs >= HitchSettings.MedianRatio * MedianMs;
+
+	// 오래된 프레임을 빼서 최근 WindowSeconds초만 남김
+	while (WindowCount > 0 && (WindowCount == MaxWindowFrames || WindowSumUs + FrameUs > static_cast<uint64>(WindowSeconds * 1e6)))
+	{
+		const uint64 OldestUs = WindowSamples[WindowHead];
+		WindowHistogram.Remove(OldestUs);
+		WindowSumUs -= OldestUs;
+		WindowHead = (WindowHead + 1) % MaxWindowFrames;
+		--WindowCount;
+	}
+	WindowSamples[(WindowHead + WindowCount) % MaxWindowFrames] = FrameUs;
+	++WindowCount;
+	WindowSumUs += FrameUs;
+	WindowHistogram.Add(FrameUs);
+
+	TotalHistogram.Add(FrameUs);
+	TotalSumUs += FrameUs;
+	TotalMaxUs = std::max(TotalMaxUs, FrameUs);
+
+	if (bIsHitch)
+	{
+		++NumHitches;
+		WorstHitchMs = std::max(WorstHitchMs, FrameMs);
+		CaptureHitch(FrameMs, MedianMs);
+	}
+	return bIsHitch;
+}
+
+void FFrameStats::CaptureHitch(double FrameMs, double MedianMs)
+{
+	const unsigned long long Frame = NumRecordedFrames;
+	if (!HitchSettings.bCapture || NumHitchCaptures >= HitchSettings.MaxCaptures)
+	{
+		UE_LOG("Hitch: frame %llu took %.2f ms (p50 %.2f ms)", Frame, FrameMs, MedianMs);
+		return;
+	}
+
+	const uint64 Now = FPlatformTime::Cycles64();
+	if (LastCaptureCycles != 0 && FPlatformTime::ToSeconds(Now - LastCaptureCycles) < HitchSettings.CaptureCooldownSeconds)
+	{
+		UE_LOG("Hitch: frame %llu took %.2f ms (p50 %.2f ms), capture skipped (cooldown)", Frame, FrameMs, MedianMs);
+		return;
+	}
+
+	// 방금 끝난 프레임이 Hitch 프레임이므로 마지막 CaptureFrames 프레임에 포함됨
+	const std::shared_ptr<FProfilerCapture> Capture = std::make_shared<FProfilerCapture>();
+	if (FProfiler::Get().Capture(HitchSettings.CaptureFrames, *Capture) == 0)
+	{
+		UE_LOG("Hitch: frame %llu took %.2f ms (p50 %.2f ms), profiler has no frames to capture", Frame, FrameMs, MedianMs);
+		return;
+	}
+
+	std::error_code Error;
+	std::filesystem::create_directories(*HitchSettings.CaptureDirectory, Error);
+	if (Error)
+	{
+		UE_LOG("Hitch: failed to create %s", *HitchSettings.CaptureDirectory);
+		return;
+	}
+
+	const std::string Path = std::string(*HitchSettings.CaptureDirectory) + "/Hitch_" + std::to_string(NumRecordedFrames) + ".json";
+	UE_LOG("Hitch: frame %llu took %.2f ms (p50 %.2f ms), saving last %d frames to %s", Frame, FrameMs, MedianMs, Capture->GetNumFrames(), Path.c_str());
+
+	LastCaptureCycles = Now;
+	++NumHitchCaptures;
+
+	// 파일 쓰기가 다음 프레임의 Hitch가 되지 않게 Worker에서, UE_LOG는 Main Thread 전용이라 여기서는 남기지 않음
+	FJobSystem::Get().Submit([Capture, Path]
+	{
+		std::ofstream Output(Path, std::ios::binary);
+		const FString Json = FProfiler::ToChromeTraceJson(*Capture);
+		Output.write(*Json, static_cast<std::streamsize>(Json.Len()));
+	}, &CaptureCounter, EJobPriority::Low);
+}
+
+FFrameTimeSummary FFrameStats::GetWindowSummary() const
+{
+	uint64 MaxUs = 0;
+	for (int32 Offset = 0; Offset < WindowCount; ++Offset)
+	{
+		MaxUs = std::max(MaxUs, WindowSamples[(WindowHead + Offset) % MaxWindowFrames]);
+	}
+	return Summarize(WindowHistogram, WindowSumUs, MaxUs);
+}
+
+FFrameTimeSummary FFrameStats::Summarize(const FFrameTimeHistogram& Histogram, uint64 SumUs, uint64 MaxUs)
+{
+	FFrameTimeSummary Summary;
+	Summary.NumFrames = Histogram.GetTotalCount();
+	if (Summary.NumFrames == 0)
+	{
+		return Summary;
+	}
+
+	const auto GetPercentileMs = [&Histogram, MaxUs](double Percentile)
+	{
+		return static_cast<double>(std::min(Histogram.GetValueAtPercentile(Percentile), MaxUs)) / 1000.0;
+	};
+
+	Summary.AverageMs = static_cast<double>(SumUs) / static_cast<double>(Summary.NumFrames) / 1000.0;
+	Summary.P50Ms = GetPercentileMs(50.0);
+	Summary.P95Ms = GetPercentileMs(95.0);
+	Summary.P99Ms = GetPercentileMs(99.0);
+	Summary.MaxMs = static_cast<double>(MaxUs) / 1000.0;
+	return Summary;
+}
+
+void FFrameStats::ResetStats()
+{
+	WindowHistogram.Reset();
+	TotalHistogram.Reset();
+	WindowHead = 0;
+	WindowCount = 0;
+	WindowSumUs = 0;
+	TotalSumUs = 0;
+	TotalMaxUs = 0;
+	NumRecordedFrames = 0;
+	NumHitches = 0;
+	WorstHitchMs = 0.0;
+	NumHitchCaptures = 0;
+	LastCaptureCycles = 0;
+}
+
+void FFrameStats::WaitForCaptures()
+{
+	if (!CaptureCounter.IsDone())
+	{
+		FJobSystem::Get().Wait(CaptureCounter);
+	}
+}
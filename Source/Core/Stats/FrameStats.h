@@ -0,0 +1,151 @@
+#pragma once
+#include "Core/Async/JobSystem.h"
+#include "Core/Container/Array.h"
+#include "Core/Container/String.h"
+#include "Core/HAL/PlatformType.h"
+
+
+/**
+ * HdrHistogram처럼 값의 크기 구간 (2의 거듭제곱)마다 같은 수의 칸으로 나눈 Histogram
+ *
+ * 0 ~ 127은 1 단위, 그 위로는 구간마다 64칸이라 상대 오차가 1/64 (약 1.6%) 이하입니다.
+ * 칸 수가 고정이라 추가 / 제거가 O(1)이고, 백분위수는 칸을 한 번 훑어서 구합니다.
+ */
+class FFrameTimeHistogram
+{
+public:
+	/** 이보다 큰 값은 마지막 칸에 (us 단위면 약 19시간) */
+	static constexpr uint32 MaxValueBits = 36;
+	static constexpr uint64 MaxValue = (1ull << MaxValueBits) - 1;
+	static constexpr int32 NumBuckets = 128 + (MaxValueBits - 7) * 64;
+
+	void Add(uint64 Value);
+
+	/** Add했던 값만 제거할 수 있음 (Rolling Window에서 오래된 값을 뺄 때) */
+	void Remove(uint64 Value);
+
+	void Reset();
+
+	uint64 GetTotalCount() const { return TotalCount; }
+
+	/**
+	 * @param Percentile 0 ~ 100
+	 * @return 그 백분위수가 들어 있는 칸에서 가장 큰 값 (HdrHistogram의 highest equivalent value), 비어 있으면 0
+	 * 칸의 경계는 실제 값보다 클 수 있으므로 max는 칸이 아니라 기록한 값으로 따로 구해야 합니다.
+	 */
+	uint64 GetValueAtPercentile(double Percentile) const;
+
+	static int32 GetBucketIndex(uint64 Value);
+	static uint64 GetBucketUpperBound(int32 BucketIndex);
+
+private:
+	uint32 Counts[NumBuckets] = {};
+	uint64 TotalCount = 0;
+};
+
+
+/** 프레임 시간 분포 (ms) */
+struct FFrameTimeSummary
+{
+	uint64 NumFrames = 0;
+	double AverageMs = 0.0;
+	double P50Ms = 0.0;
+	double P95Ms = 0.0;
+	double P99Ms = 0.0;
+	double MaxMs = 0.0;
+};
+
+
+/** Hitch 판정 / 자동 Capture 설정 */
+struct FHitchSettings
+{
+	/** 이 시간을 넘고 최근 중앙값의 MedianRatio배도 넘으면 Hitch, 0이면 감지 안 함 */
+	double ThresholdMs = 50.0;
+	double MedianRatio = 2.5;
+
+	/** Hitch가 나면 Profiler의 마지막 CaptureFrames 프레임을 CaptureDirectory에 Chrome Trace로 저장 */
+	bool bCapture = false;
+	int32 CaptureFrames = 5;
+	FString CaptureDirectory = "Saved/Hitches";
+
+	/** 연속된 Hitch로 파일이 쏟아지지 않게, Capture 사이의 최소 간격과 실행 중 최대 개수 */
+	double CaptureCooldownSeconds = 5.0;
+	int32 MaxCaptures = 16;
+};
+
+
+/**
+ * 프레임 시간의 Rolling 백분위수 (p50 / p95 / p99 / max)와 Hitch 감지
+ *
+ * - 최근 WindowSeconds초의 프레임은 Ring Buffer에 두고, 밀려나는 값은 Histogram에서 빼서 Rolling 분포를 유지합니다.
+ * - 평균 FPS에 묻히는 LoadAssets, Scene 로드, 대량 Spawn 같은 순간적인 멈춤을 Hitch로 잡아 로그와 Trace 파일로 남깁니다.
+ * - Trace는 Main Thread에서 복사만 하고 JSON 변환 / 파일 쓰기는 Job System에서 합니다.
+ */
+class FFrameStats
+{
+public:
+	static constexpr double WindowSeconds = 10.0;
+	static constexpr int32 MaxWindowFrames = 1 << 14;
+
+	FFrameStats();
+	~FFrameStats();
+
+	FFrameStats(const FFrameStats&) = delete;
+	FFrameStats& operator=(const FFrameStats&) = delete;
+
+	/**
+	 * Main Thread, 매 프레임 시작 (PROFILER_FRAME_MARKER 직후)에 호출
+	 * 지난 호출부터의 시간을 이전 프레임의 시간으로 기록합니다. 첫 호출은 기준 시각만 잡습니다.
+	 */
+	void BeginFrame();
+
+	/** 프레임 하나의 시간을 기록하고 Hitch면 true */
+	bool RecordFrame(double FrameMs);
+
+	/** 최근 WindowSeconds초, max는 Ring Buffer를 훑어서 구한 실제 값 */
+	FFrameTimeSummary GetWindowSummary() const;
+
+	/** ResetStats 이후 전체 */
+	FFrameTimeSummary GetTotalSummary() const { return Summarize(TotalHistogram, TotalSumUs, TotalMaxUs); }
+
+	void SetHitchSettings(const FHitchSettings& InSettings) { HitchSettings = InSettings; }
+	const FHitchSettings& GetHitchSettings() const { return HitchSettings; }
+
+	uint64 GetNumHitches() const { return NumHitches; }
+	double GetWorstHitchMs() const { return WorstHitchMs; }
+	int32 GetNumHitchCaptures() const { return NumHitchCaptures; }
+
+	void ResetStats();
+
+	/** 저장 중인 Hitch Trace가 끝날 때까지 대기, Job System을 끄기 전에 호출 */
+	void WaitForCaptures();
+
+private:
+	/** 백분위수는 Histogram에서, 칸 경계가 MaxUs를 넘으면 MaxUs로 */
+	static FFrameTimeSummary Summarize(const FFrameTimeHistogram& Histogram, uint64 SumUs, uint64 MaxUs);
+
+	/** @param MedianMs Hitch 프레임을 넣기 전 Window의 중앙값 */
+	void CaptureHitch(double FrameMs, double MedianMs);
+
+private:
+	FFrameTimeHistogram WindowHistogram;
+	FFrameTimeHistogram TotalHistogram;
+
+	/** 최근 프레임 시간 (us), 합이 WindowSeconds를 넘거나 가득 차면 오래된 것부터 제거 */
+	TArray<uint64> WindowSamples;
+	int32 WindowHead = 0;
+	int32 WindowCount = 0;
+	uint64 WindowSumUs = 0;
+	uint64 TotalSumUs = 0;
+	uint64 TotalMaxUs = 0;
+
+	uint64 LastFrameCycles = 0;
+	uint64 NumRecordedFrames = 0;
+
+	FHitchSettings HitchSettings;
+	uint64 NumHitches = 0;
+	double WorstHitchMs = 0.0;
+	int32 NumHitchCaptures = 0;
+	uint64 LastCaptureCycles = 0;
+	FJobCounter CaptureCounter;
+};
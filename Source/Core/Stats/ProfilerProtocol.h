@@ -0,0 +1,145 @@
+#pragma once
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "Core/HAL/PlatformType.h"
+
+
+/**
+ * FProfilerServer가 보내는 실시간 Profiler Stream의 형식, 엔진과 JungleProfilerClient가 같이 사용합니다.
+ *
+ * 연결하면 Server가 먼저 Magic / Version을 보내고, 이후로는 Packet만 이어집니다.
+ * Packet = Type (uint8) + Payload 크기 (uint32) + Payload, 모든 값은 Little Endian
+ *
+ * - Name       : uint16 NameId, uint16 길이, 문자열 (NUL 없음)
+ *                Scope / Counter 이름은 처음 쓰기 전에 한 번만 보내고 이후로는 Id만 보냅니다.
+ * - ThreadName : uint16 ThreadIndex, uint16 길이, 문자열
+ * - Frame      : uint64 FrameIndex, uint32 FrameNs, uint32 누적 DroppedFrames, uint16 Thread 수
+ *                Thread마다 uint16 ThreadIndex, uint32 Event 수, Event (uint16 NameId, uint8 Depth, uint32 StartNs, uint32 DurationNs)
+ *                uint16 Counter 수, Counter (uint16 NameId, double Value)
+ *                StartNs는 프레임 시작 기준, 프레임 전에 시작한 Scope는 0
+ * - Reset      : Payload 없음, 이전에 받은 Name Id는 모두 무효 (Server가 Packet을 버린 뒤 Name을 다시 보낼 때)
+ */
+namespace ProfilerProtocol
+{
+constexpr uint32 Magic = 0x4650524A; // "JPRF"
+constexpr uint16 Version = 1;
+constexpr uint16 DefaultPort = 27100;
+
+/** Magic + Version */
+constexpr size_t HandshakeSize = 6;
+
+/** Type + Payload 크기 */
+constexpr size_t PacketHeaderSize = 5;
+
+/** 받는 쪽이 거부할 Payload 크기, Stream이 깨졌을 때 거대한 할당을 막음 */
+constexpr uint32 MaxPayloadSize = 64u << 20;
+
+enum class EPacketType : uint8
+{
+	Name = 1,
+	ThreadName = 2,
+	Frame = 3,
+	Reset = 4,
+};
+
+
+/** Packet을 이어 붙여 쓰는 Buffer */
+class FWriter
+{
+public:
+	explicit FWriter(std::vector<uint8>& InBuffer) : Buffer(InBuffer) {}
+
+	template <typename T>
+	void Write(T Value)
+	{
+		const size_t Offset = Buffer.size();
+		Buffer.resize(Offset + sizeof(T));
+		std::memcpy(Buffer.data() + Offset, &Value, sizeof(T));
+	}
+
+	void WriteString(const char* String)
+	{
+		const size_t Length = std::min<size_t>(std::strlen(String), 0xFFFF);
+		Write(static_cast<uint16>(Length));
+		Buffer.insert(Buffer.end(), String, String + Length);
+	}
+
+	/** Payload 크기는 EndPacket에서 채움 */
+	void BeginPacket(EPacketType Type)
+	{
+		Write(static_cast<uint8>(Type));
+		PacketSizeOffset = Buffer.size();
+		Write(static_cast<uint32>(0));
+	}
+
+	void EndPacket()
+	{
+		const uint32 PayloadSize = static_cast<uint32>(Buffer.size() - PacketSizeOffset - sizeof(uint32));
+		std::memcpy(Buffer.data() + PacketSizeOffset, &PayloadSize, sizeof(uint32));
+	}
+
+	/** 나중에 값을 채울 자리 (Event 수 등) */
+	size_t Reserve(size_t Size)
+	{
+		const size_t Offset = Buffer.size();
+		Buffer.resize(Offset + Size);
+		return Offset;
+	}
+
+	template <typename T>
+	void WriteAt(size_t Offset, T Value)
+	{
+		std::memcpy(Buffer.data() + Offset, &Value, sizeof(T));
+	}
+
+private:
+	std::vector<uint8>& Buffer;
+	size_t PacketSizeOffset = 0;
+};
+
+
+/** Payload 하나를 읽는 Cursor, 끝을 넘어가면 bOverflow가 켜지고 0을 반환 */
+class FReader
+{
+public:
+	FReader(const uint8* InData, size_t InSize) : Data(InData), Size(InSize) {}
+
+	template <typename T>
+	T Read()
+	{
+		T Value{};
+		if (Offset + sizeof(T) > Size)
+		{
+			bOverflow = true;
+			return Value;
+		}
+		std::memcpy(&Value, Data + Offset, sizeof(T));
+		Offset += sizeof(T);
+		return Value;
+	}
+
+	std::string ReadString()
+	{
+		const uint16 Length = Read<uint16>();
+		if (Offset + Length > Size)
+		{
+			bOverflow = true;
+			return {};
+		}
+		std::string String(reinterpret_cast<const char*>(Data + Offset), Length);
+		Offset += Length;
+		return String;
+	}
+
+	bool HasOverflowed() const { return bOverflow; }
+
+private:
+	const uint8* Data;
+	size_t Size;
+	size_t Offset = 0;
+	bool bOverflow = false;
+};
+}
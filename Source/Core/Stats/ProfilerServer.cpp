@@ -0,0 +1,298 @@
+#include "ProfilerServer.h"
+
+#include <algorithm>
+#include <chrono>
+
+#include "Core/HAL/PlatformTime.h"
+#include "Debug/DebugConsole.h"
+
+
+namespace
+{
+uint32 ToNanoseconds(uint64 Cycles)
+{
+	return static_cast<uint32>(std::min(FPlatformTime::ToSeconds(Cycles) * 1e9, 4294967295.0));
+}
+}
+
+
+FProfilerServer::~FProfilerServer()
+{
+	Stop();
+}
+
+bool FProfilerServer::Start(uint16 InPort)
+{
+	if (IsRunning())
+	{
+		if (InPort == Port)
+		{
+			return true;
+		}
+		Stop();
+	}
+
+	if (!Listener.Listen(InPort))
+	{
+		UE_LOG("Profiler: failed to listen on 127.0.0.1:%u", InPort);
+		return false;
+	}
+
+	Port = InPort;
+	bIsStopping.store(false, std::memory_order_relaxed);
+	ServerThread = std::thread([this] { ServerMain(); });
+	UE_LOG("Profiler: streaming on 127.0.0.1:%u", Port);
+	return true;
+}
+
+void FProfilerServer::Stop()
+{
+	if (!IsRunning())
+	{
+		return;
+	}
+
+	bIsStopping.store(true, std::memory_order_relaxed);
+	QueueCondition.notify_all();
+	ServerThread.join();
+	Listener.Close();
+
+	std::lock_guard Lock(QueueMutex);
+	Queue.clear();
+	QueuedBytes = 0;
+}
+
+FProfilerServerStats FProfilerServer::GetStats() const
+{
+	std::lock_guard Lock(QueueMutex);
+	return Stats;
+}
+
+void FProfilerServer::Tick()
+{
+	if (!HasClient())
+	{
+		return;
+	}
+
+	// 새 Client에는 Name을 처음부터 다시 보냄
+	const uint64 CurrentConnection = Connection.load(std::memory_order_acquire);
+	if (CurrentConnection != EncodedConnection)
+	{
+		EncodedConnection = CurrentConnection;
+		NameIds.clear();
+		SentThreadNames.clear();
+		bResetPending = false;
+	}
+
+	// 끝난 프레임이 없거나 이미 보냈으면 그냥 넘어감
+	const uint64 NumMarkers = FProfiler::Get().GetNumMarkedFrames();
+	if (NumMarkers < 2 || NumMarkers == NumMarkersAtLastEncode)
+	{
+		return;
+	}
+	NumMarkersAtLastEncode = NumMarkers;
+
+	// Queue는 Server Thread가 비우기만 하므로, 이미 가득 차 있으면 만들지도 않고 버림
+	{
+		std::lock_guard Lock(QueueMutex);
+		if (Queue.size() >= MaxQueuedPackets)
+		{
+			DropFrame();
+			return;
+		}
+	}
+
+	SCOPE_CYCLE_COUNTER("Profiler Stream Encode");
+	if (FProfiler::Get().Capture(1, Capture) == 0)
+	{
+		return;
+	}
+
+	FPacket Packet;
+	Packet.Connection = CurrentConnection;
+	EncodeFrame(Capture, NumMarkers - 2, Packet.Data);
+
+	{
+		std::lock_guard Lock(QueueMutex);
+		if (QueuedBytes + Packet.Data.size() > MaxQueuedBytes)
+		{
+			DropFrame();
+			return;
+		}
+		QueuedBytes += Packet.Data.size();
+		Queue.push_back(std::move(Packet));
+	}
+	QueueCondition.notify_one();
+}
+
+void FProfilerServer::DropFrame()
+{
+	// 버린 Packet에 처음 보낸 Name이 있었을 수 있으므로 다음 Packet에서 모두 다시 보냄
+	Stats.DroppedFrames = ++NumDroppedFrames;
+	NameIds.clear();
+	SentThreadNames.clear();
+	bResetPending = true;
+}
+
+uint16 FProfilerServer::GetNameId(const char* Name, ProfilerProtocol::FWriter& Writer)
+{
+	const auto Found = NameIds.find(Name);
+	if (Found != NameIds.end())
+	{
+		return Found->second;
+	}
+
+	const uint16 NameId = static_cast<uint16>(NameIds.size());
+	NameIds.emplace(Name, NameId);
+
+	Writer.BeginPacket(ProfilerProtocol::EPacketType::Name);
+	Writer.Write(NameId);
+	Writer.WriteString(Name);
+	Writer.EndPacket();
+	return NameId;
+}
+
+void FProfilerServer::EncodeFrame(const FProfilerCapture& InCapture, uint64 FrameIndex, std::vector<uint8>& OutData)
+{
+	using namespace ProfilerProtocol;
+	FWriter Writer(OutData);
+
+	if (bResetPending)
+	{
+		Writer.BeginPacket(EPacketType::Reset);
+		Writer.EndPacket();
+		bResetPending = false;
+	}
+
+	// Frame Packet 안에서는 Id만 쓰므로 처음 보는 Name / Thread 이름을 먼저
+	for (const FProfilerCapture::FThread& Thread : InCapture.Threads)
+	{
+		if (Thread.ThreadIndex >= SentThreadNames.size())
+		{
+			SentThreadNames.resize(Thread.ThreadIndex + 1, false);
+		}
+		if (!SentThreadNames[Thread.ThreadIndex])
+		{
+			SentThreadNames[Thread.ThreadIndex] = true;
+			Writer.BeginPacket(EPacketType::ThreadName);
+			Writer.Write(static_cast<uint16>(Thread.ThreadIndex));
+			Writer.WriteString(*Thread.Name);
+			Writer.EndPacket();
+		}
+
+		for (const FProfilerEvent& Event : Thread.Events)
+		{
+			GetNameId(Event.Name, Writer);
+		}
+	}
+
+	const TArray<FProfilerCounter>& Counters = FProfiler::Get().GetCounters();
+	for (const FProfilerCounter& Counter : Counters)
+	{
+		GetNameId(Counter.Name, Writer);
+	}
+
+	const uint64 FrameStart = InCapture.GetStartCycles();
+	const uint64 FrameEnd = InCapture.GetEndCycles();
+
+	Writer.BeginPacket(EPacketType::Frame);
+	Writer.Write(FrameIndex);
+	Writer.Write(ToNanoseconds(FrameEnd - FrameStart));
+	Writer.Write(static_cast<uint32>(NumDroppedFrames));
+	Writer.Write(static_cast<uint16>(InCapture.Threads.Num()));
+	for (const FProfilerCapture::FThread& Thread : InCapture.Threads)
+	{
+		Writer.Write(static_cast<uint16>(Thread.ThreadIndex));
+		Writer.Write(static_cast<uint32>(Thread.Events.Num()));
+		for (const FProfilerEvent& Event : Thread.Events)
+		{
+			Writer.Write(NameIds[Event.Name]);
+			Writer.Write(static_cast<uint8>(std::min<uint32>(Event.Depth, 255)));
+			Writer.Write(ToNanoseconds(Event.StartCycles > FrameStart ? Event.StartCycles - FrameStart : 0));
+			Writer.Write(ToNanoseconds(Event.EndCycles - Event.StartCycles));
+		}
+	}
+	Writer.Write(static_cast<uint16>(Counters.Num()));
+	for (const FProfilerCounter& Counter : Counters)
+	{
+		Writer.Write(NameIds[Counter.Name]);
+		Writer.Write(Counter.Value);
+	}
+	Writer.EndPacket();
+}
+
+void FProfilerServer::ServerMain()
+{
+	PROFILER_THREAD_NAME("ProfilerServer");
+
+	while (!bIsStopping.load(std::memory_order_relaxed))
+	{
+		FPlatformSocket Client;
+		if (!Listener.Accept(Client, 100))
+		{
+			continue;
+		}
+
+		// 이전 연결을 위해 쌓인 Packet은 버리고 새 연결 번호로 시작
+		{
+			std::lock_guard Lock(QueueMutex);
+			Queue.clear();
+			QueuedBytes = 0;
+		}
+		const uint64 CurrentConnection = Connection.fetch_add(1, std::memory_order_acq_rel) + 1;
+
+		uint8 Handshake[ProfilerProtocol::HandshakeSize];
+		std::memcpy(Handshake, &ProfilerProtocol::Magic, sizeof(uint32));
+		std::memcpy(Handshake + sizeof(uint32), &ProfilerProtocol::Version, sizeof(uint16));
+		if (!Client.SendAll(Handshake, sizeof(Handshake), &bIsStopping))
+		{
+			continue;
+		}
+		bHasClient.store(true, std::memory_order_release);
+
+		while (!bIsStopping.load(std::memory_order_relaxed))
+		{
+			FPacket Packet;
+			{
+				std::unique_lock Lock(QueueMutex);
+				QueueCondition.wait_for(Lock, std::chrono::milliseconds(100), [this]
+				{
+					return !Queue.empty() || bIsStopping.load(std::memory_order_relaxed);
+				});
+				if (!Queue.empty())
+				{
+					Packet = std::move(Queue.front());
+					Queue.pop_front();
+					QueuedBytes -= Packet.Data.size();
+				}
+			}
+
+			if (Packet.Data.empty())
+			{
+				// 보낼 게 없는 동안 Client가 끊겼는지 확인, Client가 보낸 데이터는 무시
+				uint8 Discard[256];
+				if (Client.Receive(Discard, sizeof(Discard), 0) < 0)
+				{
+					break;
+				}
+				continue;
+			}
+			if (Packet.Connection != CurrentConnection)
+			{
+				continue;
+			}
+
+			// Client가 느리면 여기서만 기다리고, 그동안 Main Thread는 Queue가 차면 프레임을 버림
+			if (!Client.SendAll(Packet.Data.data(), Packet.Data.size(), &bIsStopping))
+			{
+				break;
+			}
+
+			std::lock_guard Lock(QueueMutex);
+			++Stats.SentFrames;
+			Stats.SentBytes += Packet.Data.size();
+		}
+		bHasClient.store(false, std::memory_order_release);
+	}
+}
@@ -0,0 +1,99 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "ProfilerProtocol.h"
+#include "Stats.h"
+#include "Core/AbstractClass/Singleton.h"
+#include "Core/HAL/PlatformSocket.h"
+#include "Core/HAL/PlatformType.h"
+
+
+struct FProfilerServerStats
+{
+	uint64 SentFrames = 0;
+	uint64 SentBytes = 0;
+
+	/** Queue가 차서 보내지 못하고 버린 프레임 */
+	uint64 DroppedFrames = 0;
+};
+
+
+/**
+ * 끝난 프레임의 Scope / Counter를 Loopback TCP로 실시간 전송하는 Server (형식은 ProfilerProtocol.h)
+ *
+ * - Main Thread는 Tick에서 프레임 하나를 Packet으로 만들어 크기가 정해진 Queue에 넣기만 하고, 보내는 건 Server Thread가 합니다.
+ * - Client가 느려서 Queue가 차면 새 프레임을 버리고 다음 Packet에서 Name을 다시 보내므로, 엔진 프레임은 절대 기다리지 않습니다.
+ * - Client는 한 번에 하나, 끊기면 다음 연결을 기다립니다.
+ */
+class FProfilerServer : public TSingleton<FProfilerServer>
+{
+public:
+	/** Queue에 쌓아 둘 최대 프레임 수 / 바이트 */
+	static constexpr size_t MaxQueuedPackets = 16;
+	static constexpr size_t MaxQueuedBytes = 16u << 20;
+
+	~FProfilerServer();
+
+	/** @return 127.0.0.1:Port에서 기다리기 시작했으면 true */
+	bool Start(uint16 InPort);
+	void Stop();
+
+	bool IsRunning() const { return ServerThread.joinable(); }
+	bool HasClient() const { return bHasClient.load(std::memory_order_acquire); }
+	uint16 GetPort() const { return Port; }
+
+	/** Main Thread, PROFILER_FRAME_MARKER 직후에 호출, Client가 있으면 방금 끝난 프레임을 Queue에 넣음 */
+	void Tick();
+
+	FProfilerServerStats GetStats() const;
+
+private:
+	struct FPacket
+	{
+		/** 어느 연결을 위해 만든 Packet인지, 연결이 바뀌면 이전 Packet은 버림 */
+		uint64 Connection = 0;
+		std::vector<uint8> Data;
+	};
+
+	void ServerMain();
+
+	/** Capture의 프레임 하나를 Frame Packet으로, 처음 보는 Name은 Name Packet을 앞에 붙임 */
+	void EncodeFrame(const FProfilerCapture& Capture, uint64 FrameIndex, std::vector<uint8>& OutData);
+	uint16 GetNameId(const char* Name, ProfilerProtocol::FWriter& Writer);
+
+	/** QueueMutex를 잡은 상태에서 호출 */
+	void DropFrame();
+
+private:
+	std::thread ServerThread;
+	FPlatformSocket Listener;
+	std::atomic<bool> bIsStopping = false;
+	std::atomic<bool> bHasClient = false;
+	uint16 Port = 0;
+
+	/** Server Thread가 Client를 받을 때마다 증가 */
+	std::atomic<uint64> Connection = 0;
+
+	mutable std::mutex QueueMutex;
+	std::condition_variable QueueCondition;
+	std::deque<FPacket> Queue;
+	size_t QueuedBytes = 0;
+	FProfilerServerStats Stats;
+
+	//~ Main Thread 전용
+	/** 지금 연결에 보낸 Name / Thread 이름, 연결이 바뀌거나 Packet을 버리면 비움 */
+	std::unordered_map<const char*, uint16> NameIds;
+	std::vector<bool> SentThreadNames;
+	bool bResetPending = false;
+
+	uint64 EncodedConnection = 0;
+	uint64 NumMarkersAtLastEncode = 0;
+	uint64 NumDroppedFrames = 0;
+	FProfilerCapture Capture;
+};
@@ -0,0 +1,95 @@
+#include "StatCounter.h"
+
+#include <cstring>
+
+
+namespace
+{
+/** Smoothed 값의 가중치, 약 30프레임에 걸쳐 따라감 */
+constexpr double SmoothingFactor = 1.0 / 30.0;
+}
+
+
+FStatCounter::FStatCounter(const char* InGroup, const char* InName)
+	: Group(InGroup)
+	, Name(InName)
+{
+	FStatCounterRegistry::Get().Register(this);
+}
+
+void FStatCounterRegistry::EndFrame()
+{
+	const bool bFirstFrame = NumFrames.load(std::memory_order_relaxed) == 0;
+	for (FStatCounter* Counter : Counters)
+	{
+		const uint64 FrameValue = Counter->Value.exchange(0, std::memory_order_relaxed);
+		const double Smoothed = Counter->SmoothedValue.load(std::memory_order_relaxed);
+
+		Counter->LastFrameValue.store(FrameValue, std::memory_order_relaxed);
+		Counter->SmoothedValue.store(
+			bFirstFrame ? static_cast<double>(FrameValue) : Smoothed + (static_cast<double>(FrameValue) - Smoothed) * SmoothingFactor,
+			std::memory_order_relaxed
+		);
+		Counter->TotalValue.fetch_add(FrameValue, std::memory_order_relaxed);
+	}
+	NumFrames.fetch_add(1, std::memory_order_relaxed);
+}
+
+void FStatCounterRegistry::ResetTotals()
+{
+	for (FStatCounter* Counter : Counters)
+	{
+		Counter->TotalValue.store(0, std::memory_order_relaxed);
+	}
+	NumFrames.store(0, std::memory_order_relaxed);
+}
+
+FStatCounterSnapshot FStatCounterRegistry::TakeSnapshot() const
+{
+	FStatCounterSnapshot Snapshot;
+	Snapshot.Counters.Reserve(Counters.Num());
+	for (const FStatCounter* Counter : Counters)
+	{
+		Snapshot.Counters.Add({
+			Counter->Value.load(std::memory_order_relaxed),
+			Counter->LastFrameValue.load(std::memory_order_relaxed),
+			Counter->SmoothedValue.load(std::memory_order_relaxed),
+			Counter->TotalValue.load(std::memory_order_relaxed),
+		});
+	}
+	Snapshot.NumFrames = NumFrames.load(std::memory_order_relaxed);
+	return Snapshot;
+}
+
+void FStatCounterRegistry::RestoreSnapshot(const FStatCounterSnapshot& Snapshot)
+{
+	// 등록은 전역 초기화 중에만 하므로 Snapshot과 Counter 순서가 같음
+	for (int32 Index = 0; Index < Counters.Num() && Index < Snapshot.Counters.Num(); ++Index)
+	{
+		FStatCounter* Counter = Counters[Index];
+		const FStatCounterSnapshot::FValues& Values = Snapshot.Counters[Index];
+		Counter->Value.store(Values.Value, std::memory_order_relaxed);
+		Counter->LastFrameValue.store(Values.LastFrameValue, std::memory_order_relaxed);
+		Counter->SmoothedValue.store(Values.SmoothedValue, std::memory_order_relaxed);
+		Counter->TotalValue.store(Values.TotalValue, std::memory_order_relaxed);
+	}
+	NumFrames.store(Snapshot.NumFrames, std::memory_order_relaxed);
+}
+
+TArray<const char*> FStatCounterRegistry::GetGroups() const
+{
+	TArray<const char*> Groups;
+	for (const FStatCounter* Counter : Counters)
+	{
+		bool bFound = false;
+		for (const char* Group : Groups)
+		{
+			bFound |= std::strcmp(Group, Counter->GetGroup()) == 0;
+		}
+		if (!bFound)
+		{
+			Groups.Add(Counter->GetGroup());
+		}
+	}
+	return Groups;
+}
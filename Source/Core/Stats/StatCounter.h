@@ -0,0 +1,134 @@
+#pragma once
+#include <atomic>
+
+#include "Stats.h"
+#include "Core/AbstractClass/Singleton.h"
+#include "Core/Container/Array.h"
+#include "Core/HAL/PlatformType.h"
+
+
+/**
+ * 프레임마다 0부터 다시 세는 정수 Counter (Draw Call 수, 업로드한 Byte 등)
+ *
+ * DECLARE_STAT_COUNTER로 전역에 선언하면 FStatCounterRegistry에 자동으로 등록됩니다.
+ * Add는 어느 Thread에서나 부를 수 있고, 값은 FStatCounterRegistry::EndFrame에서 지난 프레임 값으로 넘어갑니다.
+ */
+class FStatCounter
+{
+public:
+	/** @param InGroup, InName 문자열 리터럴 */
+	FStatCounter(const char* InGroup, const char* InName);
+
+	FStatCounter(const FStatCounter&) = delete;
+	FStatCounter& operator=(const FStatCounter&) = delete;
+
+	void Add(uint64 Amount = 1) { Value.fetch_add(Amount, std::memory_order_relaxed); }
+
+	const char* GetGroup() const { return Group; }
+	const char* GetName() const { return Name; }
+
+	/** 마지막으로 끝난 프레임의 값 */
+	uint64 GetLastFrameValue() const { return LastFrameValue.load(std::memory_order_relaxed); }
+
+	/** 최근 프레임의 지수 이동 평균 (화면에 표시할 때 깜빡이지 않게) */
+	double GetSmoothedValue() const { return SmoothedValue.load(std::memory_order_relaxed); }
+
+	/** FStatCounterRegistry::ResetTotals 이후의 합 */
+	uint64 GetTotalValue() const { return TotalValue.load(std::memory_order_relaxed); }
+
+private:
+	friend class FStatCounterRegistry;
+
+	const char* Group;
+	const char* Name;
+
+	std::atomic<uint64> Value = 0;
+	std::atomic<uint64> LastFrameValue = 0;
+	std::atomic<double> SmoothedValue = 0.0;
+	std::atomic<uint64> TotalValue = 0;
+};
+
+
+/** FStatCounterRegistry::TakeSnapshot 시점의 모든 Counter 값, 등록 순서대로 */
+struct FStatCounterSnapshot
+{
+	struct FValues
+	{
+		uint64 Value = 0;
+		uint64 LastFrameValue = 0;
+		double SmoothedValue = 0.0;
+		uint64 TotalValue = 0;
+	};
+
+	TArray<FValues> Counters;
+	uint64 NumFrames = 0;
+};
+
+
+/**
+ * 모든 FStatCounter의 목록, Overlay / Console / Headless 출력은 여기서 Group별로 읽습니다.
+ *
+ * 렌더링 Counter는 Render Thread에서 쌓이므로, 한 프레임의 명령이 다 실행된 뒤 (SwapBuffer 다음)
+ * Render Command로 EndFrame을 불러서 프레임 경계를 Render Thread 기준으로 맞춥니다.
+ */
+class FStatCounterRegistry : public TSingleton<FStatCounterRegistry>
+{
+public:
+	/** 등록은 전역 변수 초기화 중 (Main Thread)에만 */
+	void Register(FStatCounter* Counter) { Counters.Add(Counter); }
+
+	/** 이번 프레임 값을 지난 프레임 값으로 넘기고 0으로 되돌림 */
+	void EndFrame();
+
+	/** 누적 합과 프레임 수를 0으로 */
+	void ResetTotals();
+
+	/** 지금 값을 모두 복사, 그 사이에 다른 Thread가 Add하지 않을 때만 (Render Thread를 Flush한 뒤) */
+	FStatCounterSnapshot TakeSnapshot() const;
+
+	/** TakeSnapshot 이후에 쌓이거나 넘어간 값을 버리고 그때로 되돌림 */
+	void RestoreSnapshot(const FStatCounterSnapshot& Snapshot);
+
+	const TArray<FStatCounter*>& GetCounters() const { return Counters; }
+
+	/** 등록된 순서대로 중복 없이 */
+	TArray<const char*> GetGroups() const;
+
+	/** EndFrame 횟수 (ResetTotals 이후) */
+	uint64 GetNumFrames() const { return NumFrames.load(std::memory_order_relaxed); }
+
+private:
+	TArray<FStatCounter*> Counters;
+	std::atomic<uint64> NumFrames = 0;
+};
+
+
+/**
+ * 범위 안에서 쌓인 Counter 값을 버립니다.
+ * Benchmark처럼 가짜 프레임을 제출하는 코드가 Overlay / Headless 합계에 섞이지 않게 감쌉니다.
+ *
+ * ex) FScopedStatCounterRestore RestoreStats;
+ */
+class FScopedStatCounterRestore
+{
+public:
+	FScopedStatCounterRestore() : Snapshot(FStatCounterRegistry::Get().TakeSnapshot()) {}
+	~FScopedStatCounterRestore() { FStatCounterRegistry::Get().RestoreSnapshot(Snapshot); }
+
+	FScopedStatCounterRestore(const FScopedStatCounterRestore&) = delete;
+	FScopedStatCounterRestore& operator=(const FScopedStatCounterRestore&) = delete;
+
+private:
+	FStatCounterSnapshot Snapshot;
+};
+
+
+#if STATS
+	/** 전역 Counter 선언, Group / Name은 문자열 리터럴 */
+	#define DECLARE_STAT_COUNTER(Variable, Group, Name) static FStatCounter Variable(Group, Name)
+
+	#define INC_STAT_COUNTER(Variable, Amount) Variable.Add(Amount)
+#else
+	#define DECLARE_STAT_COUNTER(Variable, Group, Name)
+	#define INC_STAT_COUNTER(Variable, Amount)
+#endif
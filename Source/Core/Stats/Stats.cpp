@@ -0,0 +1,253 @@
+#include "Stats.h"
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include "Debug/DebugConsole.h"
+
+
+std::atomic<bool> FProfiler::bIsEnabled = true;
+
+namespace
+{
+thread_local FProfilerThreadBuffer* GThreadBuffer = nullptr;
+
+/** 이름에 들어갈 수 있는 " \ 와 제어 문자만 처리 */
+void AppendJsonString(std::string& Out, const char* String)
+{
+	Out += '"';
+	for (const char* Char = String; *Char != '\0'; ++Char)
+	{
+		if (*Char == '"' || *Char == '\\')
+		{
+			Out += '\\';
+			Out += *Char;
+		}
+		else if (static_cast<unsigned char>(*Char) >= 0x20)
+		{
+			Out += *Char;
+		}
+	}
+	Out += '"';
+}
+}
+
+
+FProfilerThreadBuffer& FProfiler::GetThreadBuffer()
+{
+	if (GThreadBuffer == nullptr)
+	{
+		GThreadBuffer = &Get().RegisterThread();
+	}
+	return *GThreadBuffer;
+}
+
+FProfilerThreadBuffer& FProfiler::RegisterThread()
+{
+	std::lock_guard Lock(ThreadsMutex);
+	FThreadEntry Entry;
+	Entry.Buffer = std::make_unique<FProfilerThreadBuffer>();
+	Entry.Buffer->ThreadIndex = static_cast<uint32>(Threads.Num());
+	Entry.Name = "Thread " + std::to_string(Threads.Num());
+
+	FProfilerThreadBuffer& Buffer = *Entry.Buffer;
+	Threads.Emplace(std::move(Entry));
+	return Buffer;
+}
+
+void FProfiler::SetThreadName(const FString& Name)
+{
+	const uint32 ThreadIndex = GetThreadBuffer().ThreadIndex;
+
+	std::lock_guard Lock(ThreadsMutex);
+	Threads[static_cast<int32>(ThreadIndex)].Name = Name;
+}
+
+void FProfiler::MarkFrame()
+{
+	const uint64 Index = NumFrameMarkers.load(std::memory_order_relaxed);
+	FrameMarkers[Index % MaxFrames] = FPlatformTime::Cycles64();
+	NumFrameMarkers.store(Index + 1, std::memory_order_release);
+}
+
+void FProfiler::SetCounter(const char* Name, double Value)
+{
+	for (FProfilerCounter& Counter : Counters)
+	{
+		if (Counter.Name == Name)
+		{
+			Counter.Value = Value;
+			return;
+		}
+	}
+	Counters.Add({ Name, Value });
+}
+
+int32 FProfiler::Capture(int32 NumFrames, FProfilerCapture& OutCapture) const
+{
+	OutCapture.FrameStartCycles.Empty();
+	OutCapture.Threads.Empty();
+
+	// 마지막 Marker는 아직 진행 중인 프레임의 시작이므로 그 앞까지만, 덮어쓰는 중일 수 있는 가장 오래된 칸은 제외
+	const uint64 NumMarkers = GetNumMarkedFrames();
+	const uint64 NumCompleted = NumMarkers > 0 ? NumMarkers - 1 : 0;
+	const uint64 NumCaptured = std::min<uint64>({ static_cast<uint64>(std::max(NumFrames, 0)), NumCompleted, MaxFrames - 2 });
+	if (NumCaptured == 0)
+	{
+		return 0;
+	}
+
+	for (uint64 Marker = NumMarkers - 1 - NumCaptured; Marker < NumMarkers; ++Marker)
+	{
+		OutCapture.FrameStartCycles.Add(FrameMarkers[Marker % MaxFrames]);
+	}
+	const uint64 StartCycles = OutCapture.GetStartCycles();
+	const uint64 EndCycles = OutCapture.GetEndCycles();
+
+	std::lock_guard Lock(ThreadsMutex);
+	for (const FThreadEntry& Entry : Threads)
+	{
+		const FProfilerThreadBuffer& Buffer = *Entry.Buffer;
+		FProfilerCapture::FThread Thread;
+		Thread.Name = Entry.Name;
+		Thread.ThreadIndex = Buffer.ThreadIndex;
+
+		// 끝난 순서로 쌓여 있으므로 뒤에서부터 구간 앞에서 끝난 Scope를 만날 때까지
+		const uint64 NumWritten = Buffer.NumWritten.load(std::memory_order_acquire);
+		const uint64 Oldest = NumWritten > FProfilerThreadBuffer::Capacity ? NumWritten - FProfilerThreadBuffer::Capacity : 0;
+		uint64 First = NumWritten;
+		while (First > Oldest && Buffer.Events[(First - 1) & (FProfilerThreadBuffer::Capacity - 1)].EndCycles > StartCycles)
+		{
+			--First;
+		}
+		TArray<uint64> SourceIndices;
+		for (uint64 Index = First; Index < NumWritten; ++Index)
+		{
+			const FProfilerEvent& Event = Buffer.Events[Index & (FProfilerThreadBuffer::Capacity - 1)];
+			if (Event.StartCycles < EndCycles)
+			{
+				Thread.Events.Add(Event);
+				SourceIndices.Add(Index);
+			}
+		}
+
+		// 복사하는 동안 Thread가 계속 기록해서 덮어썼을 수 있는 앞부분은 버림
+		const uint64 NumWrittenAfter = Buffer.NumWritten.load(std::memory_order_acquire);
+		const uint64 OldestAfter = NumWrittenAfter > FProfilerThreadBuffer::Capacity ? NumWrittenAfter - FProfilerThreadBuffer::Capacity : 0;
+		int32 NumOverwritten = 0;
+		while (NumOverwritten < SourceIndices.Num() && SourceIndices[NumOverwritten] < OldestAfter)
+		{
+			++NumOverwritten;
+		}
+		if (NumOverwritten > 0)
+		{
+			TArray<FProfilerEvent> Remaining;
+			for (int32 Index = NumOverwritten; Index < Thread.Events.Num(); ++Index)
+			{
+				Remaining.Add(Thread.Events[Index]);
+			}
+			Thread.Events = std::move(Remaining);
+		}
+
+		if (Thread.Events.Num() == 0)
+		{
+			continue;
+		}
+
+		// Flame View는 바깥 Scope부터 그리므로 시작 순서로
+		Thread.Events.Sort([](const FProfilerEvent& A, const FProfilerEvent& B)
+		{
+			return A.StartCycles != B.StartCycles ? A.StartCycles < B.StartCycles : A.Depth < B.Depth;
+		});
+		OutCapture.Threads.Add(std::move(Thread));
+	}
+
+	return static_cast<int32>(NumCaptured);
+}
+
+FString FProfiler::ToChromeTraceJson(const FProfilerCapture& Capture)
+{
+	// ts / dur는 us, 첫 프레임의 시작을 0으로
+	const uint64 BaseCycles = Capture.GetStartCycles();
+	auto ToMicroseconds = [BaseCycles](uint64 Cycles)
+	{
+		return FPlatformTime::ToSeconds(Cycles > BaseCycles ? Cycles - BaseCycles : 0) * 1e6;
+	};
+
+	std::string Json;
+	Json.reserve(256 + Capture.Threads.Num() * 64 * 1024);
+	Json += "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+
+	char Buffer[256];
+	bool bFirst = true;
+	auto BeginEvent = [&]
+	{
+		Json += bFirst ? "" : ",\n";
+		bFirst = false;
+	};
+
+	for (const FProfilerCapture::FThread& Thread : Capture.Threads)
+	{
+		BeginEvent();
+		snprintf(Buffer, sizeof(Buffer), "{\"ph\":\"M\",\"pid\":0,\"tid\":%u,\"name\":\"thread_name\",\"args\":{\"name\":", Thread.ThreadIndex);
+		Json += Buffer;
+		AppendJsonString(Json, *Thread.Name);
+		Json += "}}";
+
+		for (const FProfilerEvent& Event : Thread.Events)
+		{
+			BeginEvent();
+			Json += "{\"ph\":\"X\",\"pid\":0,\"name\":";
+			AppendJsonString(Json, Event.Name);
+			snprintf(
+				Buffer, sizeof(Buffer), ",\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+				Thread.ThreadIndex, ToMicroseconds(Event.StartCycles), FPlatformTime::ToSeconds(Event.EndCycles - Event.StartCycles) * 1e6
+			);
+			Json += Buffer;
+		}
+	}
+
+	// 프레임 경계는 전역 Instant Event로
+	for (int32 Frame = 0; Frame < Capture.FrameStartCycles.Num(); ++Frame)
+	{
+		BeginEvent();
+		snprintf(
+			Buffer, sizeof(Buffer), "{\"ph\":\"i\",\"s\":\"g\",\"pid\":0,\"tid\":0,\"name\":\"Frame %d\",\"ts\":%.3f}",
+			Frame, ToMicroseconds(Capture.FrameStartCycles[Frame])
+		);
+		Json += Buffer;
+	}
+
+	Json += "\n]}\n";
+	return FString(std::move(Json));
+}
+
+bool FProfiler::ExportChromeTrace(const FString& Path, int32 NumFrames) const
+{
+	FProfilerCapture ProfilerCapture;
+	const int32 NumCaptured = Capture(NumFrames, ProfilerCapture);
+	if (NumCaptured == 0)
+	{
+		UE_LOG("Profiler: no completed frames to export");
+		return false;
+	}
+
+	std::ofstream Output(*Path, std::ios::binary);
+	if (!Output)
+	{
+		UE_LOG("Profiler: failed to open %s", *Path);
+		return false;
+	}
+
+	const FString Json = ToChromeTraceJson(ProfilerCapture);
+	Output.write(*Json, static_cast<std::streamsize>(Json.Len()));
+
+	int32 NumEvents = 0;
+	for (const FProfilerCapture::FThread& Thread : ProfilerCapture.Threads)
+	{
+		NumEvents += Thread.Events.Num();
+	}
+	UE_LOG("Profiler: exported %d frames, %d events from %d threads to %s", NumCaptured, NumEvents, ProfilerCapture.Threads.Num(), *Path);
+	return true;
+}
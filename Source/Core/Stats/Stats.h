@@ -0,0 +1,217 @@
+#pragma once
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+#include "Core/AbstractClass/Singleton.h"
+#include "Core/Container/Array.h"
+#include "Core/Container/String.h"
+#include "Core/HAL/PlatformTime.h"
+#include "Core/HAL/PlatformType.h"
+
+
+/**
+ * 계측 Profiler on / off 빌드 스위치
+ * 배포 빌드에서 STATS=0으로 정의하면 (CMake: -DENGINE_STATS=OFF) 아래 매크로가 아무 코드도 만들지 않습니다.
+ */
+#ifndef STATS
+#define STATS 1
+#endif
+
+
+/** Scope 하나의 기록, 끝날 때 기록하므로 Thread 안에서는 EndCycles 순서 */
+struct FProfilerEvent
+{
+	/** SCOPE_CYCLE_COUNTER에 넘긴 문자열 리터럴, 복사하지 않으므로 프로그램이 끝날 때까지 살아 있어야 함 */
+	const char* Name = nullptr;
+	uint64 StartCycles = 0;
+	uint64 EndCycles = 0;
+
+	/** 같은 Thread에서 바깥 Scope의 수 */
+	uint32 Depth = 0;
+};
+
+
+/**
+ * Thread 하나가 쓰는 고정 크기 Ring Buffer
+ *
+ * 쓰는 쪽은 그 Thread 하나뿐이라 Lock 없이 기록하고 NumWritten을 release로 올립니다.
+ * 읽는 쪽은 NumWritten을 acquire로 읽고 복사한 뒤, 복사하는 동안 덮어써졌을 수 있는 항목은 버립니다.
+ */
+struct FProfilerThreadBuffer
+{
+	static constexpr uint64 Capacity = 1 << 16;
+
+	FProfilerEvent Events[Capacity];
+	std::atomic<uint64> NumWritten = 0;
+
+	/** 지금 열려 있는 Scope의 수, 이 Thread에서만 사용 */
+	uint32 Depth = 0;
+
+	/** Chrome Trace의 tid */
+	uint32 ThreadIndex = 0;
+
+	void Record(const char* Name, uint64 StartCycles, uint64 EndCycles, uint32 InDepth)
+	{
+		const uint64 Index = NumWritten.load(std::memory_order_relaxed);
+		Events[Index & (Capacity - 1)] = { Name, StartCycles, EndCycles, InDepth };
+		NumWritten.store(Index + 1, std::memory_order_release);
+	}
+};
+
+
+/** 프레임마다 값 하나를 남기는 Counter (Actor 수, Culling 결과 등) */
+struct FProfilerCounter
+{
+	/** 문자열 리터럴, Scope 이름과 같은 규칙 */
+	const char* Name = nullptr;
+	double Value = 0.0;
+};
+
+
+/** 최근 몇 프레임 동안 모든 Thread가 기록한 Scope, Flame View와 Trace 내보내기에서 사용 */
+struct FProfilerCapture
+{
+	struct FThread
+	{
+		FString Name;
+		uint32 ThreadIndex = 0;
+
+		/** StartCycles 순서 */
+		TArray<FProfilerEvent> Events;
+	};
+
+	/** 프레임 시작 시각, 마지막 값은 마지막 프레임의 끝 (= 다음 프레임의 시작) */
+	TArray<uint64> FrameStartCycles;
+	TArray<FThread> Threads;
+
+	uint64 GetStartCycles() const { return FrameStartCycles.Num() > 0 ? FrameStartCycles[0] : 0; }
+	uint64 GetEndCycles() const { return FrameStartCycles.Num() > 0 ? FrameStartCycles[FrameStartCycles.Num() - 1] : 0; }
+	int32 GetNumFrames() const { return FrameStartCycles.Num() > 1 ? FrameStartCycles.Num() - 1 : 0; }
+};
+
+
+/**
+ * SCOPE_CYCLE_COUNTER로 계측한 구간을 Thread별로 모으는 Profiler
+ *
+ * - 기록은 Thread별 Buffer에 Lock 없이 추가하고, Buffer는 Thread가 처음 기록할 때 한 번만 등록합니다.
+ * - Main Thread가 매 프레임 시작에 PROFILER_FRAME_MARKER로 프레임 경계를 남기고, 읽을 때는 프레임 단위로 자릅니다.
+ * - 최근 프레임을 chrome://tracing / Perfetto에서 여는 JSON으로 내보낼 수 있습니다.
+ */
+class FProfiler : public TSingleton<FProfiler>
+{
+public:
+	/** 경계를 기억하는 최근 프레임 수 */
+	static constexpr int32 MaxFrames = 256;
+
+	static bool IsEnabled() { return bIsEnabled.load(std::memory_order_relaxed); }
+	void SetEnabled(bool bEnabled) { bIsEnabled.store(bEnabled, std::memory_order_relaxed); }
+
+	/** 이 Thread의 Buffer, 처음 호출하면 등록 */
+	static FProfilerThreadBuffer& GetThreadBuffer();
+
+	/** Trace / Flame View에 표시할 이 Thread의 이름 */
+	void SetThreadName(const FString& Name);
+
+	/** Main Thread에서 매 프레임 시작에 호출 */
+	void MarkFrame();
+
+	/** 기록된 프레임 경계의 수 (MaxFrames에서 넘친 것도 포함) */
+	uint64 GetNumMarkedFrames() const { return NumFrameMarkers.load(std::memory_order_acquire); }
+
+	/**
+	 * 끝난 프레임 중 최근 NumFrames 프레임 동안의 Scope를 복사합니다.
+	 * @return 복사한 프레임 수, 아직 끝난 프레임이 없으면 0
+	 */
+	int32 Capture(int32 NumFrames, FProfilerCapture& OutCapture) const;
+
+	/** 최근 NumFrames 프레임을 Chrome Trace Event 형식 (JSON)으로 저장 */
+	bool ExportChromeTrace(const FString& Path, int32 NumFrames) const;
+
+	/** Capture를 Chrome Trace Event 형식으로 직렬화 */
+	static FString ToChromeTraceJson(const FProfilerCapture& Capture);
+
+	/** Main Thread 전용, 같은 이름은 마지막 값으로 덮어씀 */
+	void SetCounter(const char* Name, double Value);
+	const TArray<FProfilerCounter>& GetCounters() const { return Counters; }
+
+private:
+	struct FThreadEntry
+	{
+		std::unique_ptr<FProfilerThreadBuffer> Buffer;
+		FString Name;
+	};
+
+	FProfilerThreadBuffer& RegisterThread();
+
+private:
+	static std::atomic<bool> bIsEnabled;
+
+	/** Buffer 등록 / 이름 변경 / Capture에서 Thread 목록을 보호, 기록에는 사용하지 않음 */
+	mutable std::mutex ThreadsMutex;
+	TArray<FThreadEntry> Threads;
+
+	uint64 FrameMarkers[MaxFrames] = {};
+	std::atomic<uint64> NumFrameMarkers = 0;
+
+	TArray<FProfilerCounter> Counters;
+};
+
+
+/** 생성부터 소멸까지를 이 Thread의 Buffer에 기록 */
+class FScopeCycleCounter
+{
+public:
+	explicit FScopeCycleCounter(const char* InName)
+	{
+		if (FProfiler::IsEnabled())
+		{
+			Name = InName;
+			Buffer = &FProfiler::GetThreadBuffer();
+			Depth = Buffer->Depth++;
+			StartCycles = FPlatformTime::Cycles64();
+		}
+	}
+
+	~FScopeCycleCounter()
+	{
+		if (Buffer)
+		{
+			const uint64 EndCycles = FPlatformTime::Cycles64();
+			--Buffer->Depth;
+			Buffer->Record(Name, StartCycles, EndCycles, Depth);
+		}
+	}
+
+	FScopeCycleCounter(const FScopeCycleCounter&) = delete;
+	FScopeCycleCounter& operator=(const FScopeCycleCounter&) = delete;
+
+private:
+	FProfilerThreadBuffer* Buffer = nullptr;
+	const char* Name = nullptr;
+	uint64 StartCycles = 0;
+	uint32 Depth = 0;
+};
+
+
+#define STATS_JOIN_INNER(A, B) A##B
+#define STATS_JOIN(A, B) STATS_JOIN_INNER(A, B)
+
+#if STATS
+	/** 이 Scope의 시간을 Name (문자열 리터럴)으로 기록 */
+	#define SCOPE_CYCLE_COUNTER(Name) FScopeCycleCounter STATS_JOIN(ScopeCycleCounter_, __LINE__)(Name)
+
+	/** Main Thread의 프레임 시작 */
+	#define PROFILER_FRAME_MARKER() FProfiler::Get().MarkFrame()
+
+	/** 이 Thread의 이름 */
+	#define PROFILER_THREAD_NAME(Name) FProfiler::Get().SetThreadName(Name)
+
+	/** Main Thread에서 이번 프레임의 Counter 값 (Name은 문자열 리터럴) */
+	#define PROFILER_COUNTER(Name, Value) FProfiler::Get().SetCounter(Name, static_cast<double>(Value))
+#else
+	#define SCOPE_CYCLE_COUNTER(Name)
+	#define PROFILER_FRAME_MARKER()
+	#define PROFILER_THREAD_NAME(Name)
+	#define PROFILER_COUNTER(Name, Value)
+#endif
@@ -0,0 +1,190 @@
+#include <cfloat>
+#include <cstring>
+#include <random>
+
+#include "Benchmark.h"
+#include "Core/Math/BatchTransform.h"
+#include "Core/Math/Transform.h"
+#include "Debug/DebugConsole.h"
+#include "Primitive/PrimitiveVertices.h"
+
+
+namespace
+{
+constexpr int32 NumPoints = 1'000'003; // 4로 나누어 떨어지지 않게 해서 나머지 처리도 검사
+constexpr int32 NumBoxes = 100'003;
+constexpr int32 NumMatrices = 100'003;
+
+template <typename T>
+int32 CountBitwiseMismatches(const TArray<T>& A, const TArray<T>& B)
+{
+	int32 NumMismatches = 0;
+	for (int32 Index = 0; Index < A.Num(); ++Index)
+	{
+		NumMismatches += std::memcmp(&A[Index], &B[Index], sizeof(T)) != 0 ? 1 : 0;
+	}
+	return NumMismatches;
+}
+
+FMatrix MakeRandomModelMatrix(std::mt19937& Random)
+{
+	std::uniform_real_distribution<float> Angle(-180.0f, 180.0f);
+	std::uniform_real_distribution<float> Position(-500.0f, 500.0f);
+	std::uniform_real_distribution<float> Scale(0.1f, 10.0f);
+	const FTransform Transform(
+		FVector(Position(Random), Position(Random), Position(Random)),
+		FVector(Angle(Random), Angle(Random), Angle(Random)),
+		FVector(Scale(Random), Scale(Random), Scale(Random))
+	);
+	return Transform.GetMatrix();
+}
+
+/**
+ * 점 변환, AABB 변환, Min/Max, Matrix 곱을 원소 하나씩 도는 기존 루프와 BatchTransform으로 비교합니다.
+ * 모두 같은 계산 순서라서 결과가 비트 단위로 같아야 합니다.
+ */
+void BenchmarkBatchTransform()
+{
+	std::mt19937 Random(1234);
+	std::uniform_real_distribution<float> Unit(-100.0f, 100.0f);
+	const FMatrix Model = MakeRandomModelMatrix(Random);
+
+	// 점 변환 (FVector 배열, FVertexSimple 배열)
+	TArray<FVector> Points;
+	TArray<FVertexSimple> Vertices;
+	Points.SetNum(NumPoints);
+	Vertices.SetNum(NumPoints);
+	for (int32 Index = 0; Index < NumPoints; ++Index)
+	{
+		Points[Index] = FVector(Unit(Random), Unit(Random), Unit(Random));
+		Vertices[Index] = FVertexSimple{Points[Index].X, Points[Index].Y, Points[Index].Z, 1.0f, 1.0f, 1.0f, 1.0f};
+	}
+
+	TArray<FVector> ScalarPoints;
+	TArray<FVector> BatchPoints;
+	TArray<FVector> BatchVertexPoints;
+	ScalarPoints.SetNum(NumPoints);
+	BatchPoints.SetNum(NumPoints);
+	BatchVertexPoints.SetNum(NumPoints);
+
+	const double ScalarPointsMs = BenchmarkUtils::MeasureBestMs([&]
+	{
+		for (int32 Index = 0; Index < NumPoints; ++Index)
+		{
+			ScalarPoints[Index] = Model.TransformPosition(Points[Index]);
+		}
+	}, 5);
+	const double BatchPointsMs = BenchmarkUtils::MeasureBestMs([&]
+	{
+		BatchTransform::TransformPositions(Model, std::span<const FVector>(Points.GetData(), NumPoints), std::span<FVector>(BatchPoints.GetData(), NumPoints));
+	}, 5);
+	const double ScalarVertexPointsMs = BenchmarkUtils::MeasureBestMs([&]
+	{
+		for (int32 Index = 0; Index < NumPoints; ++Index)
+		{
+			const FVertexSimple& Vertex = Vertices[Index];
+			BatchVertexPoints[Index] = Model.TransformPosition(FVector(Vertex.X, Vertex.Y, Vertex.Z));
+		}
+	}, 5);
+	const double BatchVertexPointsMs = BenchmarkUtils::MeasureBestMs([&]
+	{
+		BatchTransform::TransformVertexPositions(Model, std::span<const FVertexSimple>(Vertices.GetData(), NumPoints), std::span<FVector>(BatchVertexPoints.GetData(), NumPoints));
+	}, 5);
+	const int32 PointMismatches = CountBitwiseMismatches(BatchPoints, ScalarPoints) + CountBitwiseMismatches(BatchVertexPoints, ScalarPoints);
+
+	// Mesh Bounds (FVertexBuffer::Create의 기존 루프)
+	FBox ScalarBounds;
+	const double ScalarBoundsMs = BenchmarkUtils::MeasureBestMs([&]
+	{
+		FVector Min(FLT_MAX);
+		FVector Max(-FLT_MAX);
+		for (const FVertexSimple& Vertex : Vertices)
+		{
+			Min = FVector::Min(Min, FVector(Vertex.X, Vertex.Y, Vertex.Z));
+			Max = FVector::Max(Max, FVector(Vertex.X, Vertex.Y, Vertex.Z));
+		}
+		ScalarBounds = FBox(Min, Max);
+	}, 5);
+	FBox BatchBounds;
+	const double BatchBoundsMs = BenchmarkUtils::MeasureBestMs([&]
+	{
+		BatchBounds = BatchTransform::ComputeVertexBounds(std::span<const FVertexSimple>(Vertices.GetData(), NumPoints));
+	}, 5);
+	const int32 BoundsMismatches = std::memcmp(&ScalarBounds, &BatchBounds, sizeof(FBox)) != 0 ? 1 : 0;
+
+	// Primitive Bounds (UWorld::FlushPrimitiveUpdates), Box마다 다른 Matrix
+	TArray<FBox> LocalBoxes;
+	TArray<FMatrix> Matrices;
+	LocalBoxes.SetNum(NumBoxes);
+	Matrices.SetNum(NumBoxes);
+	for (int32 Index = 0; Index < NumBoxes; ++Index)
+	{
+		const FVector Center(Unit(Random), Unit(Random), Unit(Random));
+		const FVector Extent(FMath::Abs(Unit(Random)), FMath::Abs(Unit(Random)), FMath::Abs(Unit(Random)));
+		LocalBoxes[Index] = FBox(Center - Extent, Center + Extent);
+		Matrices[Index] = MakeRandomModelMatrix(Random);
+	}
+
+	TArray<FBox> ScalarBoxes;
+	TArray<FBox> BatchBoxes;
+	ScalarBoxes.SetNum(NumBoxes);
+	BatchBoxes.SetNum(NumBoxes);
+	const double ScalarBoxesMs = BenchmarkUtils::MeasureBestMs([&]
+	{
+		for (int32 Index = 0; Index < NumBoxes; ++Index)
+		{
+			ScalarBoxes[Index] = LocalBoxes[Index].TransformBy(Matrices[Index]);
+		}
+	}, 5);
+	const double BatchBoxesMs = BenchmarkUtils::MeasureBestMs([&]
+	{
+		BatchTransform::TransformBoxes(
+			std::span<const FBox>(LocalBoxes.GetData(), NumBoxes), std::span<const FMatrix>(Matrices.GetData(), NumBoxes),
+			std::span<FBox>(BatchBoxes.GetData(), NumBoxes)
+		);
+	}, 5);
+	const int32 BoxMismatches = CountBitwiseMismatches(BatchBoxes, ScalarBoxes);
+
+	// Model * ViewProjection
+	const FMatrix ViewProjection = FMatrix::LookAtLH(FVector(-10.0f, 0.0f, 5.0f), FVector::ZeroVector, FVector(0.0f, 0.0f, 1.0f))
+		* FMatrix::PerspectiveFovLH(FMath::DegreesToRadians(60.0f), 16.0f / 9.0f, 0.1f, 1000.0f);
+	TArray<FMatrix> ScalarProducts;
+	TArray<FMatrix> BatchProducts;
+	ScalarProducts.SetNum(NumMatrices);
+	BatchProducts.SetNum(NumMatrices);
+	const double ScalarProductsMs = BenchmarkUtils::MeasureBestMs([&]
+	{
+		for (int32 Index = 0; Index < NumMatrices; ++Index)
+		{
+			ScalarProducts[Index] = Matrices[Index % NumBoxes] * ViewProjection;
+		}
+	}, 5);
+	const double BatchProductsMs = BenchmarkUtils::MeasureBestMs([&]
+	{
+		BatchTransform::MultiplyMatrices(
+			std::span<const FMatrix>(Matrices.GetData(), NumMatrices), ViewProjection, std::span<FMatrix>(BatchProducts.GetData(), NumMatrices)
+		);
+	}, 5);
+	const int32 ProductMismatches = CountBitwiseMismatches(BatchProducts, ScalarProducts);
+
+	UE_LOG(
+		"[Bench] batch: transform %d points: FVector per-point %.3f ms, batch %.3f ms (%.1fx), FVertexSimple per-vertex %.3f ms, batch %.3f ms (%.1fx), %d mismatches",
+		NumPoints, ScalarPointsMs, BatchPointsMs, ScalarPointsMs / BatchPointsMs,
+		ScalarVertexPointsMs, BatchVertexPointsMs, ScalarVertexPointsMs / BatchVertexPointsMs, PointMismatches
+	);
+	UE_LOG(
+		"[Bench] batch: bounds of %d vertices: scalar %.3f ms, batch %.3f ms (%.1fx), %d mismatches",
+		NumPoints, ScalarBoundsMs, BatchBoundsMs, ScalarBoundsMs / BatchBoundsMs, BoundsMismatches
+	);
+	UE_LOG(
+		"[Bench] batch: %d AABBs x matrices: TransformBy %.3f ms, batch %.3f ms (%.1fx), %d mismatches",
+		NumBoxes, ScalarBoxesMs, BatchBoxesMs, ScalarBoxesMs / BatchBoxesMs, BoxMismatches
+	);
+	UE_LOG(
+		"[Bench] batch: %d matrix products: operator* %.3f ms, batch %.3f ms (%.1fx), %d mismatches",
+		NumMatrices, ScalarProductsMs, BatchProductsMs, ScalarProductsMs / BatchProductsMs, ProductMismatches
+	);
+}
+}
+
+REGISTER_BENCHMARK("batch", "BatchTransform point/AABB/matrix kernels and vertex bounds vs per-element loops, with bitwise comparison", BenchmarkBatchTransform);
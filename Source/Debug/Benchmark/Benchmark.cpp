@@ -0,0 +1,35 @@
+#include "Benchmark.h"
+
+#include "Core/Rendering/RenderingThread.h"
+#include "Debug/DebugConsole.h"
+
+
+void FBenchmarkRegistry::Register(const char* InName, const char* InDescription, FBenchmarkFunction InFunction)
+{
+	GetMutableBenchmarks().Add({InName, InDescription, InFunction});
+}
+
+bool FBenchmarkRegistry::Run(const FString& Name)
+{
+	// Benchmark는 RHI와 Stat Counter를 Game Thread에서 직접 쓰므로, Render Thread에 남은 프레임을 먼저 비움
+	FRenderingThread::Get().Flush();
+
+	bool bFound = false;
+	for (const FEntry& Entry : GetMutableBenchmarks())
+	{
+		if (Name == "all" || Name == Entry.Name)
+		{
+			UE_LOG("[Bench] ----- %s -----", Entry.Name);
+			Entry.Function();
+			bFound = true;
+		}
+	}
+	return bFound;
+}
+
+TArray<FBenchmarkRegistry::FEntry>& FBenchmarkRegistry::GetMutableBenchmarks()
+{
+	// Static 초기화 순서 문제를 피하기 위해 함수 안의 static으로 둡니다.
+	static TArray<FEntry> Benchmarks;
+	return Benchmarks;
+}
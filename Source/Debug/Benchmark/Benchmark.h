@@ -0,0 +1,77 @@
+#pragma once
+#include <chrono>
+
+#include "Core/Container/Array.h"
+#include "Core/Container/String.h"
+#include "Core/HAL/PlatformType.h"
+
+
+/**
+ * Console의 "bench" 명령어로 실행할 수 있는 성능 측정 목록
+ *
+ * 각 Benchmark는 REGISTER_BENCHMARK로 등록하고, 결과는 UE_LOG로 출력합니다.
+ */
+class FBenchmarkRegistry
+{
+public:
+	using FBenchmarkFunction = void(*)();
+
+	struct FEntry
+	{
+		const char* Name;
+		const char* Description;
+		FBenchmarkFunction Function;
+	};
+
+	static void Register(const char* InName, const char* InDescription, FBenchmarkFunction InFunction);
+
+	/** Name과 일치하는 Benchmark를 실행합니다. "all"이면 전부 실행합니다. */
+	static bool Run(const FString& Name);
+
+	static const TArray<FEntry>& GetBenchmarks() { return GetMutableBenchmarks(); }
+
+private:
+	static TArray<FEntry>& GetMutableBenchmarks();
+};
+
+
+struct FBenchmarkAutoRegister
+{
+	FBenchmarkAutoRegister(const char* InName, const char* InDescription, FBenchmarkRegistry::FBenchmarkFunction InFunction)
+	{
+		FBenchmarkRegistry::Register(InName, InDescription, InFunction);
+	}
+};
+
+#define REGISTER_BENCHMARK(Name, Description, Function) \
+	static FBenchmarkAutoRegister GBenchmarkAutoRegister_##Function(Name, Description, Function)
+
+
+/** Benchmark 측정용 함수들 */
+namespace BenchmarkUtils
+{
+	/** Func를 Iterations번 실행하고 가장 빠른 시간을 ms로 반환합니다. */
+	template <typename FuncType>
+	double MeasureBestMs(const FuncType& Func, int32 Iterations = 5)
+	{
+		double Best = 1e30;
+		for (int32 Index = 0; Index < Iterations; ++Index)
+		{
+			const auto Start = std::chrono::steady_clock::now();
+			Func();
+			const auto End = std::chrono::steady_clock::now();
+
+			const double Elapsed = std::chrono::duration<double, std::milli>(End - Start).count();
+			Best = Elapsed < Best ? Elapsed : Best;
+		}
+		return Best;
+	}
+
+	/** 최적화로 결과가 지워지지 않도록 값을 소비합니다. */
+	template <typename T>
+	FORCEINLINE void DoNotOptimize(const T& Value)
+	{
+		volatile const T* Sink = &Value;
+		(void)Sink;
+	}
+}
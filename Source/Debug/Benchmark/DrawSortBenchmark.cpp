@@ -0,0 +1,219 @@
+#include <algorithm>
+#include <memory>
+#include <random>
+
+#include "Benchmark.h"
+#include "Core/Rendering/DrawCommandList.h"
+#include "Core/RHI/NullRHI.h"
+#include "Core/RHI/RHIPipelineState.h"
+#include "Core/RHI/RHIStatsContext.h"
+#include "Core/Stats/StatCounter.h"
+#include "Debug/DebugConsole.h"
+#include "Resource/RenderResourceCollection.h"
+
+
+namespace
+{
+constexpr int32 NumPrimitives = 20'000;
+constexpr int32 NumMeshes = 6;              // Cube, Sphere, Cylinder, Cone, Plane, Arrow 정도
+constexpr int32 NumMaterials = 4;
+constexpr uint32 VertexStride = 48;
+constexpr uint32 ConstantBufferSize = sizeof(FConstantsComponentData);
+
+/** Null 백엔드는 Shader / State 핸들을 해석하지 않으므로 서로 다른 주소만 있으면 됨 */
+uint8 FakeHandles[64];
+
+template <typename T>
+T* FakeHandle(int32 Index)
+{
+	return reinterpret_cast<T*>(&FakeHandles[Index]);
+}
+
+struct FFakePrimitive
+{
+	int32 Mesh;
+	int32 Material;
+	float ViewDepth;
+};
+
+/** 섞여 있는 씬의 Mesh / Material / Buffer, FRenderResourceCollection::Render와 같은 RHI 호출 (Buffer + PSO)을 냄 */
+struct FFakeScene
+{
+	FRHIBuffer* VertexBuffers[NumMeshes] = {};
+	FRHIBuffer* IndexBuffers[NumMeshes] = {};
+	FRHIBuffer* ConstantBuffer = nullptr;
+	const FRHIPipelineState* PipelineStates[NumMaterials] = {};
+	TArray<FFakePrimitive> Primitives;
+
+	void Create(FRHICommandContext& RHI)
+	{
+		uint8 Vertices[VertexStride * 24] = {};
+		uint32 Indices[36] = {};
+		for (int32 Mesh = 0; Mesh < NumMeshes; ++Mesh)
+		{
+			VertexBuffers[Mesh] = RHI.CreateBuffer(ERHIBufferUsage::Vertex, sizeof(Vertices), false, Vertices);
+			IndexBuffers[Mesh] = RHI.CreateBuffer(ERHIBufferUsage::Index, sizeof(Indices), false, Indices);
+		}
+		ConstantBuffer = RHI.CreateBuffer(ERHIBufferUsage::Constant, ConstantBufferSize, true, nullptr);
+
+		// Material 두 개씩 Vertex Shader를 공유, State는 모두 같음
+		for (int32 Material = 0; Material < NumMaterials; ++Material)
+		{
+			FRHIPipelineStateDesc Desc;
+			Desc.VertexShader = FakeHandle<FRHIVertexShader>(30 + Material / 2);
+			Desc.PixelShader = FakeHandle<FRHIPixelShader>(32 + Material);
+			Desc.InputLayout = FakeHandle<FRHIInputLayout>(16);
+			Desc.RasterizerState = FakeHandle<FRHIRasterizerState>(40);
+			Desc.BlendState = FakeHandle<FRHIBlendState>(41);
+			Desc.DepthStencilState = FakeHandle<FRHIDepthStencilState>(42);
+			PipelineStates[Material] = FRHIPipelineStateCache::Get().FindOrCreate(Desc);
+		}
+
+		std::mt19937 Random(49);
+		std::uniform_int_distribution<int32> MeshDist(0, NumMeshes - 1);
+		std::uniform_int_distribution<int32> MaterialDist(0, NumMaterials - 1);
+		std::uniform_real_distribution<float> DepthDist(1.0f, 500.0f);
+		Primitives.SetNum(NumPrimitives);
+		for (FFakePrimitive& Primitive : Primitives)
+		{
+			Primitive = { MeshDist(Random), MaterialDist(Random), DepthDist(Random) };
+		}
+	}
+
+	void Release(FRHICommandContext& RHI)
+	{
+		for (int32 Mesh = 0; Mesh < NumMeshes; ++Mesh)
+		{
+			RHI.ReleaseBuffer(VertexBuffers[Mesh]);
+			RHI.ReleaseBuffer(IndexBuffers[Mesh]);
+		}
+		RHI.ReleaseBuffer(ConstantBuffer);
+	}
+
+	/** FRenderResourceCollection::Render(Cache)와 같은 순서, bSkip이 false면 Render()처럼 전부 바인딩 */
+	void Submit(FRHICommandContext& RHI, const FFakePrimitive& Primitive, FRenderResourceBindCache& Cache, bool bSkip) const
+	{
+		const FConstantsComponentData Constants = {};
+
+		if (!bSkip || Cache.ShouldBind(Cache.Mesh, FakeHandle<const FMesh>(Primitive.Mesh)))
+		{
+			RHI.SetVertexBuffer(VertexBuffers[Primitive.Mesh], VertexStride, 0);
+			RHI.SetIndexBuffer(IndexBuffers[Primitive.Mesh], ERHIIndexFormat::UInt32, 0);
+		}
+		const FRHIPipelineState* PipelineState = PipelineStates[Primitive.Material];
+		if (!bSkip || Cache.ShouldBind(Cache.PipelineState, PipelineState))
+		{
+			RHI.SetPipelineState(*PipelineState);
+		}
+
+		RHI.UpdateBuffer(ConstantBuffer, &Constants, ConstantBufferSize);
+		if (!bSkip || Cache.ShouldBindSlot(Cache.ConstantBuffers, 0, ConstantBuffer, true, true))
+		{
+			RHI.SetConstantBuffer(ERHIShaderStage::Vertex, 0, ConstantBuffer);
+			RHI.SetConstantBuffer(ERHIShaderStage::Pixel, 0, ConstantBuffer);
+		}
+
+		RHI.DrawIndexed(36, 0, 0);
+	}
+};
+
+void BuildDrawList(const FFakeScene& Scene, FDrawCommandList& DrawList)
+{
+	DrawList.Reset();
+	const FConstantsComponentData Constants = {};
+	for (const FFakePrimitive& Primitive : Scene.Primitives)
+	{
+		// Resource Id는 1부터
+		DrawList.Add(DrawSortKey::Make(EDrawPass::Main, Primitive.Material + 1, Primitive.Mesh + 1, Primitive.ViewDepth), nullptr, nullptr, Constants);
+	}
+}
+
+struct FSubmitResult
+{
+	double Ms = 0.0;
+	uint64 Binds = 0;
+	uint64 StateChanges = 0;
+};
+
+/** DrawList 순서대로 제출하고, FRHIStatsContext로 바인딩 수와 실제로 바뀐 바인딩 수를 셈 */
+FSubmitResult SubmitDrawList(FRHIStatsContext& Stats, const FFakeScene& Scene, const FDrawCommandList& DrawList, bool bSkip)
+{
+	FSubmitResult Result;
+	Result.Ms = BenchmarkUtils::MeasureBestMs([&]
+	{
+		FRenderResourceBindCache Cache;
+		for (int32 Index = 0; Index < DrawList.Num(); ++Index)
+		{
+			Scene.Submit(Stats, Scene.Primitives[DrawList.GetCommandIndex(Index)], Cache, bSkip);
+		}
+		Stats.EndFrame();
+	});
+
+	const FRHIFrameStats& Frame = Stats.GetLastFrameStats();
+	Result.Binds = Frame.GetTotalBinds();
+	Result.StateChanges = Frame.GetTotalBinds() - Frame.GetTotalRedundantBinds();
+	return Result;
+}
+
+/** Culling 순서 그대로 / 정렬만 / 정렬 + 중복 바인딩 생략을 비교하고, Radix Sort 결과를 std::stable_sort와 비교 */
+void BenchmarkDrawSort()
+{
+	// 가짜 Scene의 제출이 전역 RHI Counter에 섞이지 않게
+	FScopedStatCounterRestore RestoreStats;
+
+	FRHIStatsContext Stats(std::make_unique<FNullRHI>(false));
+	FFakeScene Scene;
+	Scene.Create(Stats);
+
+	FDrawCommandList DrawList;
+	const double BuildMs = BenchmarkUtils::MeasureBestMs([&] { BuildDrawList(Scene, DrawList); });
+	const FSubmitResult Unsorted = SubmitDrawList(Stats, Scene, DrawList, false);
+
+	const double SortMs = BenchmarkUtils::MeasureBestMs([&]
+	{
+		BuildDrawList(Scene, DrawList);
+		DrawList.Sort();
+	}) - BuildMs;
+
+	// (Key, Add 순서)로 안정 정렬한 것과 같아야 함
+	TArray<std::pair<uint64, int32>> Expected;
+	for (int32 Index = 0; Index < NumPrimitives; ++Index)
+	{
+		const FFakePrimitive& Primitive = Scene.Primitives[Index];
+		Expected.Add({ DrawSortKey::Make(EDrawPass::Main, Primitive.Material + 1, Primitive.Mesh + 1, Primitive.ViewDepth), Index });
+	}
+	const double StdSortMs = BenchmarkUtils::MeasureBestMs([&]
+	{
+		TArray<std::pair<uint64, int32>> Work = Expected;
+		std::stable_sort(Work.begin(), Work.end(), [](const auto& A, const auto& B) { return A.first < B.first; });
+	});
+	std::stable_sort(Expected.begin(), Expected.end(), [](const auto& A, const auto& B) { return A.first < B.first; });
+	bool bOrderMatches = true;
+	for (int32 Index = 0; Index < NumPrimitives; ++Index)
+	{
+		bOrderMatches &= DrawList.GetCommandIndex(Index) == Expected[Index].second;
+	}
+
+	const FSubmitResult Sorted = SubmitDrawList(Stats, Scene, DrawList, false);
+	const FSubmitResult SortedSkip = SubmitDrawList(Stats, Scene, DrawList, true);
+	Scene.Release(Stats);
+
+	UE_LOG("[Bench] drawsort: %d primitives, %d meshes x %d materials, random order", NumPrimitives, NumMeshes, NumMaterials);
+	UE_LOG("[Bench]   build %.3f ms, radix sort %.3f ms (std::stable_sort %.3f ms), order %s", BuildMs, SortMs, StdSortMs, bOrderMatches ? "OK" : "MISMATCH");
+	for (const auto& [Name, Result] : {
+		std::pair{ "unsorted", &Unsorted }, std::pair{ "sorted", &Sorted }, std::pair{ "sorted + skip binds", &SortedSkip } })
+	{
+		UE_LOG(
+			"[Bench]   %-20s : %8.3f ms, %7llu binds, %7llu state changes (%.2f per draw)", Name, Result->Ms,
+			Result->Binds, Result->StateChanges, static_cast<double>(Result->StateChanges) / NumPrimitives
+		);
+	}
+	UE_LOG(
+		"[Bench]   state changes x%.1f fewer, binds issued x%.1f fewer",
+		static_cast<double>(Unsorted.StateChanges) / static_cast<double>(std::max<uint64>(1, SortedSkip.StateChanges)),
+		static_cast<double>(Unsorted.Binds) / static_cast<double>(std::max<uint64>(1, SortedSkip.Binds))
+	);
+}
+}
+
+REGISTER_BENCHMARK("drawsort", "Draw sort keys + radix sort + redundant bind skipping vs culling order on a mixed 20k scene", BenchmarkDrawSort);
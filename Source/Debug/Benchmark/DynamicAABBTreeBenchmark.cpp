@@ -0,0 +1,224 @@
+#include <atomic>
+#include <cfloat>
+#include <random>
+
+#include "Benchmark.h"
+#include "Core/Async/JobSystem.h"
+#include "Core/Math/DynamicAABBTree.h"
+#include "Core/Math/Matrix.h"
+#include "Debug/DebugConsole.h"
+
+
+namespace
+{
+constexpr int32 NumPrimitives = 100'000;
+constexpr int32 NumRays = 1'000'000;
+constexpr int32 NumVerifiedRays = 2'000;
+constexpr float WorldSize = 1000.0f;
+constexpr float MaxRayDistance = 2000.0f;
+
+FRay MakeRandomRay(std::mt19937& Random)
+{
+	std::uniform_real_distribution<float> Position(0.0f, WorldSize);
+	std::uniform_real_distribution<float> Direction(-1.0f, 1.0f);
+
+	FVector RayDirection;
+	do
+	{
+		RayDirection = FVector(Direction(Random), Direction(Random), Direction(Random));
+	}
+	while (RayDirection.Length() < 0.01f);
+
+	return FRay(FVector(Position(Random), Position(Random), Position(Random)), RayDirection.GetSafeNormal());
+}
+
+/** Tree의 Leaf에서 실제 Box까지 검사하는 가장 가까운 교차 거리 */
+float RayCastTree(const FDynamicAABBTree& Tree, const TArray<FBox>& Boxes, const FRay& Ray)
+{
+	const FVector& Direction = Ray.GetDirection();
+	const FVector InvDirection(1.0f / Direction.X, 1.0f / Direction.Y, 1.0f / Direction.Z);
+
+	float Closest = FLT_MAX;
+	Tree.RayCast(Ray, MaxRayDistance, [&](int32 ProxyId, float MaxDistance)
+	{
+		const int32 Index = static_cast<int32>(reinterpret_cast<intptr_t>(Tree.GetUserData(ProxyId)));
+		float Distance;
+		if (FDynamicAABBTree::IntersectRayBox(Ray.GetOrigin(), InvDirection, Boxes[Index], MaxDistance, Distance))
+		{
+			Closest = Distance;
+			return Distance;
+		}
+		return MaxDistance;
+	});
+	return Closest;
+}
+
+float RayCastBruteForce(const TArray<FBox>& Boxes, const FRay& Ray)
+{
+	const FVector& Direction = Ray.GetDirection();
+	const FVector InvDirection(1.0f / Direction.X, 1.0f / Direction.Y, 1.0f / Direction.Z);
+
+	float Closest = FLT_MAX;
+	for (const FBox& Box : Boxes)
+	{
+		float Distance;
+		if (FDynamicAABBTree::IntersectRayBox(Ray.GetOrigin(), InvDirection, Box, FMath::Min(Closest, MaxRayDistance), Distance))
+		{
+			Closest = Distance;
+		}
+	}
+	return Closest;
+}
+
+/**
+ * 무작위 Box 10만 개로 Tree를 만들고 Ray 100만 개를 쏩니다.
+ * 일부 Ray는 전부 검사한 결과와 비교하고, Box / Frustum Query와 Refit(MoveProxy) 비용도 함께 잽니다.
+ */
+void BenchmarkDynamicAABBTree()
+{
+	std::mt19937 Random(1234);
+	std::uniform_real_distribution<float> Position(0.0f, WorldSize);
+	std::uniform_real_distribution<float> HalfSize(0.25f, 2.5f);
+
+	TArray<FBox> Boxes;
+	Boxes.SetNum(NumPrimitives);
+	for (FBox& Box : Boxes)
+	{
+		const FVector Center(Position(Random), Position(Random), Position(Random));
+		const FVector Extent(HalfSize(Random), HalfSize(Random), HalfSize(Random));
+		Box = FBox(Center - Extent, Center + Extent);
+	}
+
+	// Build (하나씩 넣기)
+	FDynamicAABBTree Tree;
+	TArray<int32> ProxyIds;
+	ProxyIds.SetNum(NumPrimitives);
+	const double BuildMs = BenchmarkUtils::MeasureBestMs([&]
+	{
+		Tree.Clear();
+		for (int32 Index = 0; Index < NumPrimitives; ++Index)
+		{
+			ProxyIds[Index] = Tree.CreateProxy(Boxes[Index], reinterpret_cast<void*>(static_cast<intptr_t>(Index)));
+		}
+	}, 3);
+
+	UE_LOG(
+		"[Bench] bvh: build %d proxies %.2f ms, height %d, area ratio %.1f, %s",
+		NumPrimitives, BuildMs, Tree.GetHeight(), Tree.GetAreaRatio(), Tree.Validate() ? "valid" : "INVALID"
+	);
+
+	// Refit: 매 프레임 조금씩 움직이는 물체, Fat AABB를 벗어난 것만 다시 넣음
+	std::uniform_real_distribution<float> Step(-0.05f, 0.05f);
+	int32 NumReinserted = 0;
+	const double RefitMs = BenchmarkUtils::MeasureBestMs([&]
+	{
+		NumReinserted = 0;
+		for (int32 Index = 0; Index < NumPrimitives; ++Index)
+		{
+			const FVector Displacement(Step(Random), Step(Random), Step(Random));
+			Boxes[Index] = Boxes[Index].ShiftBy(Displacement);
+			NumReinserted += Tree.MoveProxy(ProxyIds[Index], Boxes[Index], Displacement) ? 1 : 0;
+		}
+	}, 3);
+
+	UE_LOG(
+		"[Bench] bvh: refit %d moving proxies %.2f ms (%d reinserted), height %d, area ratio %.1f, %s",
+		NumPrimitives, RefitMs, NumReinserted, Tree.GetHeight(), Tree.GetAreaRatio(), Tree.Validate() ? "valid" : "INVALID"
+	);
+
+	TArray<FRay> Rays;
+	Rays.SetNum(NumRays);
+	for (FRay& Ray : Rays)
+	{
+		Ray = MakeRandomRay(Random);
+	}
+
+	// 정확도: Tree와 전부 검사의 가장 가까운 거리가 같아야 함
+	int32 NumMismatches = 0;
+	for (int32 Index = 0; Index < NumVerifiedRays; ++Index)
+	{
+		if (RayCastTree(Tree, Boxes, Rays[Index]) != RayCastBruteForce(Boxes, Rays[Index]))
+		{
+			++NumMismatches;
+		}
+	}
+
+	const double BruteForceMs = BenchmarkUtils::MeasureBestMs([&]
+	{
+		for (int32 Index = 0; Index < NumVerifiedRays; ++Index)
+		{
+			BenchmarkUtils::DoNotOptimize(RayCastBruteForce(Boxes, Rays[Index]));
+		}
+	}, 1);
+
+	int32 NumHits = 0;
+	const double SingleMs = BenchmarkUtils::MeasureBestMs([&]
+	{
+		NumHits = 0;
+		for (const FRay& Ray : Rays)
+		{
+			NumHits += RayCastTree(Tree, Boxes, Ray) != FLT_MAX ? 1 : 0;
+		}
+	}, 1);
+
+	// Query끼리는 Tree를 읽기만 하므로 동시에 해도 됨
+	std::atomic<int32> NumParallelHits = 0;
+	const double ParallelMs = BenchmarkUtils::MeasureBestMs([&]
+	{
+		NumParallelHits = 0;
+		FJobSystem::Get().ParallelForRange(NumRays, [&](int32 Begin, int32 End)
+		{
+			int32 LocalHits = 0;
+			for (int32 Index = Begin; Index < End; ++Index)
+			{
+				LocalHits += RayCastTree(Tree, Boxes, Rays[Index]) != FLT_MAX ? 1 : 0;
+			}
+			NumParallelHits += LocalHits;
+		}, 1024);
+	}, 3);
+
+	UE_LOG(
+		"[Bench] bvh: %d rays, tree %.3f us/ray (%.1f ms), parallel %.1f ms, brute force %.1f us/ray, %d hits, %d/%d mismatches vs brute force",
+		NumRays, SingleMs * 1000.0 / NumRays, SingleMs, ParallelMs, BruteForceMs * 1000.0 / NumVerifiedRays,
+		NumHits, NumMismatches, NumVerifiedRays
+	);
+
+	// Box / Frustum Query
+	int32 NumBoxResults = 0;
+	const double BoxQueryMs = BenchmarkUtils::MeasureBestMs([&]
+	{
+		NumBoxResults = 0;
+		for (int32 Index = 0; Index < 10'000; ++Index)
+		{
+			const FVector Center = Rays[Index].GetOrigin();
+			Tree.QueryBox(FBox(Center, Center).ExpandBy(10.0f), [&NumBoxResults](int32)
+			{
+				++NumBoxResults;
+				return true;
+			});
+		}
+	}, 3);
+
+	const FMatrix View = FMatrix::LookAtLH(FVector(-100.0f, WorldSize * 0.5f, WorldSize * 0.5f), FVector(WorldSize, WorldSize * 0.5f, WorldSize * 0.5f), FVector(0.0f, 0.0f, 1.0f));
+	const FMatrix Projection = FMatrix::PerspectiveFovLH(FMath::DegreesToRadians(60.0f), 16.0f / 9.0f, 0.1f, 800.0f);
+	const FFrustum Frustum = FFrustum::FromViewProjection(View * Projection);
+
+	int32 NumVisible = 0;
+	const double FrustumMs = BenchmarkUtils::MeasureBestMs([&]
+	{
+		NumVisible = 0;
+		Tree.QueryFrustum(Frustum, [&NumVisible](int32)
+		{
+			++NumVisible;
+			return true;
+		});
+	}, 5);
+
+	UE_LOG(
+		"[Bench] bvh: 10000 box queries %.2f ms (%d results), frustum query %.3f ms (%d/%d visible)",
+		BoxQueryMs, NumBoxResults, FrustumMs, NumVisible, NumPrimitives
+	);
+}
+}
+
+REGISTER_BENCHMARK("bvh", "Dynamic AABB tree build, refit, ray / box / frustum queries on 100k boxes", BenchmarkDynamicAABBTree);
@@ -0,0 +1,179 @@
+#include <cmath>
+#include <random>
+
+#include "Benchmark.h"
+#include "Core/FixedTimestep.h"
+#include "Core/Math/TransformHierarchy.h"
+#include "Debug/DebugConsole.h"
+
+
+namespace
+{
+constexpr int32 SimulatedSeconds = 2;
+constexpr int32 FixedTickRate = 60;
+constexpr int32 MaxStepsPerFrame = 8;
+constexpr int32 RenderRates[] = { 24, 30, 60, 144, 500, 750 };
+
+constexpr int32 NumInterpolatedTransforms = 100'000;
+
+/** 감쇠 스프링 한 Tick (Semi-implicit Euler), DeltaTime에 따라 결과가 달라지는 시뮬레이션의 예 */
+struct FSpringState
+{
+	float Position = 1.0f;
+	float Velocity = 0.0f;
+
+	void Step(float DeltaTime)
+	{
+		constexpr float Stiffness = 40.0f;
+		constexpr float Damping = 0.8f;
+		Velocity += (-Stiffness * Position - Damping * Velocity) * DeltaTime;
+		Position += Velocity * DeltaTime;
+	}
+};
+
+bool NearlyEqual(const FTransform& A, const FTransform& B)
+{
+	constexpr float Tolerance = 1e-4f;
+	const FVector DeltaPosition = A.GetPosition() - B.GetPosition();
+	const FVector DeltaScale = A.GetScale() - B.GetScale();
+	const FQuat RotationA = A.GetRotation();
+	const FQuat RotationB = B.GetRotation();
+
+	// q와 -q는 같은 회전
+	const float Dot = FMath::Abs(RotationA.X * RotationB.X + RotationA.Y * RotationB.Y + RotationA.Z * RotationB.Z + RotationA.W * RotationB.W);
+	return FMath::Abs(DeltaPosition.X) < Tolerance && FMath::Abs(DeltaPosition.Y) < Tolerance && FMath::Abs(DeltaPosition.Z) < Tolerance
+		&& FMath::Abs(DeltaScale.X) < Tolerance && FMath::Abs(DeltaScale.Y) < Tolerance && FMath::Abs(DeltaScale.Z) < Tolerance
+		&& Dot > 1.0f - Tolerance;
+}
+
+/**
+ * 렌더링 프레임 속도를 바꿔 가며 같은 시간만큼 시뮬레이션합니다.
+ * 프레임마다 Tick하면 Tick 수와 결과가 프레임 속도에 따라 달라지고, Fixed Step이면 Tick 수와 결과가 같아야 합니다.
+ */
+void BenchmarkFixedStepDeterminism()
+{
+	float ReferencePosition = 0.0f;
+	int32 NumDivergentRates = 0;
+	for (const int32 RenderRate : RenderRates)
+	{
+		const float FrameDeltaTime = 1.0f / static_cast<float>(RenderRate);
+		const int32 NumFrames = RenderRate * SimulatedSeconds;
+
+		FSpringState VariableState;
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			VariableState.Step(FrameDeltaTime);
+		}
+
+		FFixedTimestep Timestep;
+		Timestep.Configure(FixedTickRate, MaxStepsPerFrame);
+		FSpringState FixedState;
+		float MaxAlpha = 0.0f;
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			const int32 NumSteps = Timestep.Advance(FrameDeltaTime);
+			for (int32 Step = 0; Step < NumSteps; ++Step)
+			{
+				FixedState.Step(Timestep.GetStepSeconds());
+			}
+			MaxAlpha = FMath::Max(MaxAlpha, Timestep.GetAlpha());
+		}
+
+		if (RenderRate == RenderRates[0])
+		{
+			ReferencePosition = FixedState.Position;
+		}
+		NumDivergentRates += FixedState.Position != ReferencePosition ? 1 : 0;
+
+		UE_LOG(
+			"[Bench] fixedstep: %3d fps for %d s: per-frame tick %4d ticks x = %+.6f, fixed %d Hz %4llu steps x = %+.6f (max alpha %.3f)",
+			RenderRate, SimulatedSeconds, NumFrames, VariableState.Position, FixedTickRate, Timestep.GetNumSteps(), FixedState.Position, MaxAlpha
+		);
+	}
+
+	// 한 프레임이 MaxStepsPerFrame Step보다 길면 따라잡지 않고 버림
+	FFixedTimestep Timestep;
+	Timestep.Configure(FixedTickRate, MaxStepsPerFrame);
+	const int32 HitchSteps = Timestep.Advance(1.0f);
+
+	UE_LOG(
+		"[Bench] fixedstep: %d render rates diverge from %d fps with fixed step, 1 s hitch runs %d steps and drops %llu",
+		NumDivergentRates, RenderRates[0], HitchSteps, Timestep.GetNumDroppedSteps()
+	);
+}
+
+/** FTransformHierarchy의 Step 전 / 후 보간이 양 끝에서 맞는지, 렌더링 Matrix를 만드는 비용이 얼마인지 */
+void BenchmarkFixedStepInterpolation()
+{
+	std::mt19937 Random(7);
+	std::uniform_real_distribution<float> Angle(-180.0f, 180.0f);
+	std::uniform_real_distribution<float> Position(-100.0f, 100.0f);
+	auto MakeRandomTransform = [&]
+	{
+		return FTransform(FVector(Position(Random), Position(Random), Position(Random)), FVector(Angle(Random), Angle(Random), Angle(Random)), FVector(1.0f, 1.0f, 1.0f));
+	};
+
+	FTransformHierarchy Hierarchy;
+	TArray<int32> Handles;
+	TArray<FTransform> Before;
+	TArray<FTransform> After;
+	for (int32 Index = 0; Index < NumInterpolatedTransforms; ++Index)
+	{
+		Before.Add(MakeRandomTransform());
+		After.Add(MakeRandomTransform());
+		Handles.Add(Hierarchy.Add(Before[Index], INDEX_NONE, nullptr));
+	}
+	Hierarchy.Update();
+
+	// 절반만 Fixed Step에서 움직이고, 나머지는 보간 없이 그대로
+	Hierarchy.BeginFixedStep();
+	for (int32 Index = 0; Index < NumInterpolatedTransforms; Index += 2)
+	{
+		Hierarchy.SetLocalTransform(Handles[Index], After[Index]);
+	}
+	Hierarchy.Update(true);
+
+	int32 NumMismatches = 0;
+	for (int32 Index = 0; Index < NumInterpolatedTransforms; ++Index)
+	{
+		const int32 HierarchyIndex = Hierarchy.GetIndex(Handles[Index]);
+		const bool bMoved = Index % 2 == 0;
+		NumMismatches += Hierarchy.IsInterpolated(HierarchyIndex) != bMoved ? 1 : 0;
+		NumMismatches += NearlyEqual(Hierarchy.GetInterpolatedTransform(HierarchyIndex, 0.0f), Before[Index]) ? 0 : 1;
+		NumMismatches += NearlyEqual(Hierarchy.GetInterpolatedTransform(HierarchyIndex, 1.0f), bMoved ? After[Index] : Before[Index]) ? 0 : 1;
+	}
+
+	const int32 NumInterpolated = Hierarchy.GetInterpolatedIndices().Num();
+	TArray<FMatrix> RenderMatrices;
+	RenderMatrices.SetNum(NumInterpolated);
+	const double InterpolateMs = BenchmarkUtils::MeasureBestMs([&]
+	{
+		for (int32 Slot = 0; Slot < NumInterpolated; ++Slot)
+		{
+			RenderMatrices[Slot] = Hierarchy.GetInterpolatedTransform(Hierarchy.GetInterpolatedIndices()[Slot], 0.5f).GetMatrix();
+		}
+	}, 5);
+
+	// 다음 Step에서 움직이지 않으면 보간이 끝남
+	Hierarchy.BeginFixedStep();
+	Hierarchy.Update(true);
+	int32 NumStillInterpolated = 0;
+	for (int32 Index = 0; Index < Hierarchy.Num(); ++Index)
+	{
+		NumStillInterpolated += Hierarchy.IsInterpolated(Index) ? 1 : 0;
+	}
+
+	UE_LOG(
+		"[Bench] fixedstep: %d transforms, %d moved in the step: interpolated render matrices %.3f ms, %d endpoint mismatches, %d still interpolated after a static step",
+		NumInterpolatedTransforms, NumInterpolated, InterpolateMs, NumMismatches, NumStillInterpolated
+	);
+}
+
+void BenchmarkFixedStep()
+{
+	BenchmarkFixedStepDeterminism();
+	BenchmarkFixedStepInterpolation();
+}
+}
+
+REGISTER_BENCHMARK("fixedstep", "Per-frame tick vs fixed-step accumulator across render rates, and interpolation between the last two fixed states", BenchmarkFixedStep);
@@ -0,0 +1,90 @@
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+#include "Benchmark.h"
+#include "Core/FramePacer.h"
+#include "Core/HAL/PlatformTime.h"
+#include "Debug/DebugConsole.h"
+
+
+namespace
+{
+constexpr int32 TargetRates[] = { 750, 240, 60 };
+constexpr double SecondsPerRate = 0.5;
+
+struct FPacingResult
+{
+	double AverageFrameMs = 0.0;
+	double FrameJitterUs = 0.0;
+	double MaxFrameErrorUs = 0.0;
+	double CPUPercent = 0.0;
+};
+
+/** 기존 RunWindowed처럼 프레임 시작부터 목표 간격이 지날 때까지 Sleep(0) (= yield) 반복 */
+FPacingResult RunBusyWait(int32 TargetFPS, int32 NumFrames)
+{
+	const uint64 Period = FPlatformTime::SecondsToCycles(1.0 / TargetFPS);
+	const double CPUStart = FPlatformTime::ThreadCPUSeconds();
+	const uint64 WallStart = FPlatformTime::Cycles64();
+
+	double Mean = 0.0;
+	double M2 = 0.0;
+	double MaxErrorUs = 0.0;
+	uint64 FrameStart = WallStart;
+	for (int32 Frame = 1; Frame <= NumFrames; ++Frame)
+	{
+		uint64 Now;
+		do
+		{
+			std::this_thread::yield();
+			Now = FPlatformTime::Cycles64();
+		} while (Now - FrameStart < Period);
+
+		const double FrameSeconds = FPlatformTime::ToSeconds(Now - FrameStart);
+		const double Delta = FrameSeconds - Mean;
+		Mean += Delta / Frame;
+		M2 += Delta * (FrameSeconds - Mean);
+		MaxErrorUs = std::max(MaxErrorUs, (FrameSeconds - 1.0 / TargetFPS) * 1e6);
+		FrameStart = Now;
+	}
+
+	const double WallSeconds = FPlatformTime::ToSeconds(FPlatformTime::Cycles64() - WallStart);
+	FPacingResult Result;
+	Result.AverageFrameMs = Mean * 1000.0;
+	Result.FrameJitterUs = NumFrames > 1 ? std::sqrt(M2 / (NumFrames - 1)) * 1e6 : 0.0;
+	Result.MaxFrameErrorUs = MaxErrorUs;
+	Result.CPUPercent = 100.0 * (FPlatformTime::ThreadCPUSeconds() - CPUStart) / WallSeconds;
+	return Result;
+}
+
+/** 프레임 작업이 없을 때 대기만의 정확도와 CPU 사용량 */
+void BenchmarkFramePacer()
+{
+	for (const int32 TargetFPS : TargetRates)
+	{
+		const int32 NumFrames = static_cast<int32>(TargetFPS * SecondsPerRate);
+		const FPacingResult BusyWait = RunBusyWait(TargetFPS, NumFrames);
+
+		FFramePacer FramePacer;
+		FramePacer.SetTargetFPS(TargetFPS);
+		FramePacer.WaitForNextFrame(); // 첫 호출은 격자의 시작점
+		FramePacer.ResetStats();
+		for (int32 Frame = 0; Frame <= NumFrames; ++Frame)
+		{
+			FramePacer.WaitForNextFrame();
+		}
+		const FFramePacerStats& Stats = FramePacer.GetStats();
+
+		UE_LOG(
+			"[Bench] pacer: %3d fps x %d frames: busy-wait avg %.4f ms, jitter %.1f us, max late %.1f us, CPU %.1f%% | pacer avg %.4f ms, jitter %.1f us, max wake error %.1f us, CPU %.1f%% (overshoot est %.1f us, sleep %.1f ms / spin %.1f ms, %llu late)",
+			TargetFPS, NumFrames,
+			BusyWait.AverageFrameMs, BusyWait.FrameJitterUs, BusyWait.MaxFrameErrorUs, BusyWait.CPUPercent,
+			Stats.AverageFrameMs, Stats.FrameJitterUs, Stats.MaxWakeErrorUs, Stats.WaitCPUPercent,
+			Stats.SleepOvershootUs, Stats.SleepMs, Stats.SpinMs, Stats.NumLateFrames
+		);
+	}
+}
+}
+
+REGISTER_BENCHMARK("pacer", "Sleep(0) busy-wait frame limiter vs hybrid sleep + spin frame pacer: interval jitter and idle CPU", BenchmarkFramePacer);
@@ -0,0 +1,114 @@
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "Benchmark.h"
+#include "Core/Stats/FrameStats.h"
+#include "Debug/DebugConsole.h"
+
+
+namespace
+{
+constexpr int32 NumFrames = 100'000;
+constexpr int32 NumInjectedHitches = 8;
+constexpr double HitchMs = 120.0;
+
+/** Asset 로드로 첫 프레임이 1분을 넘어도 max는 칸 경계가 아니라 기록한 값 그대로 */
+constexpr double LongFrameMs = 85'061.03;
+
+/** 정렬했을 때 Rank = ceil(p * N)번째 값, FFrameTimeHistogram과 같은 정의 */
+uint64 ExactPercentile(std::vector<uint64> Samples, double Percentile)
+{
+	std::sort(Samples.begin(), Samples.end());
+	const size_t Rank = std::max<size_t>(1, static_cast<size_t>(std::ceil(Percentile / 100.0 * static_cast<double>(Samples.size()))));
+	return Samples[Rank - 1];
+}
+
+double RelativeError(double Measured, uint64 ExactUs)
+{
+	return ExactUs > 0 ? std::abs(Measured * 1000.0 - static_cast<double>(ExactUs)) / static_cast<double>(ExactUs) : 0.0;
+}
+
+/** 16.7 ms 근처의 가짜 프레임 시간에 Hitch를 섞어서, Histogram 백분위수가 정렬한 값과 얼마나 다른지와 기록 비용 */
+void BenchmarkFrameStats()
+{
+	std::mt19937 Random(47);
+	std::lognormal_distribution<double> Noise(0.0, 0.08);
+
+	std::vector<uint64> SamplesUs(NumFrames);
+	for (int32 Index = 0; Index < NumFrames; ++Index)
+	{
+		SamplesUs[Index] = static_cast<uint64>(16'667.0 * Noise(Random));
+	}
+	for (int32 Hitch = 0; Hitch < NumInjectedHitches; ++Hitch)
+	{
+		SamplesUs[(Hitch + 1) * (NumFrames / (NumInjectedHitches + 1))] = static_cast<uint64>(HitchMs * 1000.0);
+	}
+
+	// Capture는 끄고 감지만, 엔진의 FFrameStats와는 별개
+	const std::unique_ptr<FFrameStats> FrameStats = std::make_unique<FFrameStats>();
+	FHitchSettings HitchSettings;
+	HitchSettings.bCapture = false;
+	FrameStats->SetHitchSettings(HitchSettings);
+
+	int32 NumDetected = 0;
+	const auto Start = std::chrono::steady_clock::now();
+	for (const uint64 SampleUs : SamplesUs)
+	{
+		NumDetected += FrameStats->RecordFrame(static_cast<double>(SampleUs) / 1000.0) ? 1 : 0;
+	}
+	const double RecordNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - Start).count() / NumFrames;
+
+	FFrameTimeSummary Window;
+	const double SummaryUs = BenchmarkUtils::MeasureBestMs([&] { Window = FrameStats->GetWindowSummary(); }, 5) * 1000.0;
+	const FFrameTimeSummary Total = FrameStats->GetTotalSummary();
+
+	// Rolling Window = 합이 WindowSeconds를 넘지 않는 가장 긴 끝부분
+	std::vector<uint64> WindowUs;
+	uint64 WindowSumUs = 0;
+	for (auto It = SamplesUs.rbegin(); It != SamplesUs.rend(); ++It)
+	{
+		if (WindowSumUs + *It > static_cast<uint64>(FFrameStats::WindowSeconds * 1e6) || WindowUs.size() == FFrameStats::MaxWindowFrames)
+		{
+			break;
+		}
+		WindowSumUs += *It;
+		WindowUs.push_back(*It);
+	}
+
+	double MaxError = 0.0;
+	for (const auto& [Measured, Samples, Percentile] : {
+		std::tuple{ Total.P50Ms, &SamplesUs, 50.0 }, std::tuple{ Total.P95Ms, &SamplesUs, 95.0 },
+		std::tuple{ Total.P99Ms, &SamplesUs, 99.0 }, std::tuple{ Total.MaxMs, &SamplesUs, 100.0 },
+		std::tuple{ Window.P50Ms, &WindowUs, 50.0 }, std::tuple{ Window.P95Ms, &WindowUs, 95.0 },
+		std::tuple{ Window.P99Ms, &WindowUs, 99.0 }, std::tuple{ Window.MaxMs, &WindowUs, 100.0 } })
+	{
+		MaxError = std::max(MaxError, RelativeError(Measured, ExactPercentile(*Samples, Percentile)));
+	}
+
+	// 긴 프레임 하나 뒤에 보통 프레임, max와 백분위수가 기록한 값을 넘지 않는지
+	const std::unique_ptr<FFrameStats> LongFrameStats = std::make_unique<FFrameStats>();
+	LongFrameStats->SetHitchSettings(HitchSettings);
+	LongFrameStats->RecordFrame(LongFrameMs);
+	LongFrameStats->RecordFrame(16.0);
+	const FFrameTimeSummary LongTotal = LongFrameStats->GetTotalSummary();
+	const bool bLongFrameExact = std::abs(LongTotal.MaxMs - LongFrameMs) < 0.001 && LongTotal.P99Ms <= LongTotal.MaxMs;
+
+	UE_LOG(
+		"[Bench] framestats: %d frames: total p50 %.3f / p95 %.3f / p99 %.3f / max %.3f ms, exact p99 %.3f ms",
+		NumFrames, Total.P50Ms, Total.P95Ms, Total.P99Ms, Total.MaxMs, ExactPercentile(SamplesUs, 99.0) / 1000.0
+	);
+	UE_LOG(
+		"[Bench] framestats: window %llu frames (exact %d), max percentile error %.2f%% (bound %.2f%%), record %.1f ns/frame, summary %.2f us, hitches %d/%d",
+		Window.NumFrames, static_cast<int32>(WindowUs.size()), MaxError * 100.0, 100.0 / 64.0, RecordNs, SummaryUs, NumDetected, NumInjectedHitches
+	);
+	UE_LOG(
+		"[Bench] framestats: %.2f ms frame reported as max %.3f ms (p99 %.3f ms): %s",
+		LongFrameMs, LongTotal.MaxMs, LongTotal.P99Ms, bLongFrameExact ? "OK" : "MISMATCH"
+	);
+}
+}
+
+REGISTER_BENCHMARK("framestats", "Rolling frame-time histogram percentiles vs exact sort, record cost, hitch detection", BenchmarkFrameStats);
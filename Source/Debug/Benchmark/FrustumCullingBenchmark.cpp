@@ -0,0 +1,87 @@
+#include <random>
+
+#include "Benchmark.h"
+#include "Core/Math/FrustumCulling.h"
+#include "Core/Math/Matrix.h"
+#include "Debug/DebugConsole.h"
+
+
+namespace
+{
+constexpr int32 NumBoxes = 100'003; // Batch 폭으로 나누어 떨어지지 않게 해서 나머지 처리도 검사
+constexpr float WorldSize = 1000.0f;
+
+/**
+ * 무작위 Box 10만 개를 Camera 하나의 Frustum으로 Culling합니다.
+ * FFrustum::IntersectBox를 FBox 배열에 하나씩 부르는 것, SoA 스칼라, SoA SIMD를 비교하고 결과가 같은지 확인합니다.
+ */
+void BenchmarkFrustumCulling()
+{
+	std::mt19937 Random(1234);
+	std::uniform_real_distribution<float> Position(0.0f, WorldSize);
+	std::uniform_real_distribution<float> HalfSize(0.25f, 2.5f);
+
+	TArray<FBox> Boxes;
+	Boxes.SetNum(NumBoxes);
+	FCullingBounds Bounds;
+	Bounds.Reset(NumBoxes);
+	for (FBox& Box : Boxes)
+	{
+		const FVector Center(Position(Random), Position(Random), Position(Random));
+		const FVector Extent(HalfSize(Random), HalfSize(Random), HalfSize(Random));
+		Box = FBox(Center - Extent, Center + Extent);
+		Bounds.Add(Center, Extent);
+	}
+
+	const FMatrix View = FMatrix::LookAtLH(FVector(-100.0f, WorldSize * 0.5f, WorldSize * 0.5f), FVector(WorldSize, WorldSize * 0.5f, WorldSize * 0.5f), FVector(0.0f, 0.0f, 1.0f));
+	const FMatrix Projection = FMatrix::PerspectiveFovLH(FMath::DegreesToRadians(60.0f), 16.0f / 9.0f, 0.1f, 800.0f);
+	const FFrustum Frustum = FFrustum::FromViewProjection(View * Projection);
+
+	TArray<int32> AoSVisible;
+	AoSVisible.Reserve(NumBoxes);
+	const double AoSMs = BenchmarkUtils::MeasureBestMs([&]
+	{
+		AoSVisible.Empty();
+		for (int32 Index = 0; Index < NumBoxes; ++Index)
+		{
+			if (Frustum.IntersectBox(Boxes[Index]))
+			{
+				AoSVisible.Add(Index);
+			}
+		}
+	}, 10);
+
+	TArray<int32> ScalarVisible;
+	const double ScalarMs = BenchmarkUtils::MeasureBestMs([&]
+	{
+		FrustumCulling::CullBoxesScalar(Frustum, Bounds, ScalarVisible);
+	}, 10);
+
+	TArray<int32> SIMDVisible;
+	const double SIMDMs = BenchmarkUtils::MeasureBestMs([&]
+	{
+		FrustumCulling::CullBoxes(Frustum, Bounds, SIMDVisible);
+	}, 10);
+
+	int32 NumMismatches = 0;
+	if (SIMDVisible.Num() != AoSVisible.Num() || ScalarVisible.Num() != AoSVisible.Num())
+	{
+		NumMismatches = NumBoxes;
+	}
+	else
+	{
+		for (int32 Index = 0; Index < AoSVisible.Num(); ++Index)
+		{
+			NumMismatches += (SIMDVisible[Index] != AoSVisible[Index] || ScalarVisible[Index] != AoSVisible[Index]) ? 1 : 0;
+		}
+	}
+
+	UE_LOG(
+		"[Bench] culling: %d boxes, %d visible / %d culled, AoS IntersectBox %.3f ms, SoA scalar %.3f ms, SoA SIMD x%d %.3f ms (%.1fx), %d mismatches",
+		NumBoxes, SIMDVisible.Num(), NumBoxes - SIMDVisible.Num(), AoSMs, ScalarMs,
+		FrustumCulling::GetBatchWidth(), SIMDMs, AoSMs / SIMDMs, NumMismatches
+	);
+}
+}
+
+REGISTER_BENCHMARK("culling", "SoA SIMD frustum culling vs per-box IntersectBox on 100k boxes", BenchmarkFrustumCulling);
@@ -0,0 +1,149 @@
+#include <atomic>
+#include <cmath>
+#include <memory>
+
+#include "Benchmark.h"
+#include "Core/Async/JobSystem.h"
+#include "Debug/DebugConsole.h"
+
+
+namespace
+{
+// 캐시에 영향을 덜 받는 순수 연산 부하
+float HeavyWork(int32 Index)
+{
+	float Value = static_cast<float>(Index);
+	for (int32 Iter = 0; Iter < 64; ++Iter)
+	{
+		Value = std::sqrt(Value * 1.0001f + 1.0f);
+	}
+	return Value;
+}
+
+/**
+ * A의 Worker 스레드에서 Worker가 적은 B로 Submit / Wait 해도 B의 Deque를 건드리지 않고 Injection Queue로 가는지 확인
+ * (Worker Index를 인스턴스 구분 없이 쓰면 B의 Workers[1]에 접근해서 범위를 벗어남)
+ */
+void CheckCrossInstanceSubmit()
+{
+	FJobSystem A;
+	FJobSystem B;
+	A.Initialize(2);
+	B.Initialize(0);
+
+	constexpr int32 NumJobs = 1000;
+	std::atomic<int32> NumExecuted = 0;
+	int32 IndexInA = -2;
+	int32 IndexInB = -2;
+
+	FJobCounter Counter;
+	A.Submit([&]
+	{
+		IndexInA = A.GetCurrentWorkerIndex();
+		IndexInB = B.GetCurrentWorkerIndex();
+
+		FJobCounter Inner;
+		for (int32 Index = 0; Index < NumJobs; ++Index)
+		{
+			B.Submit([&NumExecuted] { NumExecuted.fetch_add(1, std::memory_order_relaxed); }, &Inner);
+		}
+		B.Wait(Inner);
+	}, &Counter, EJobPriority::Normal, 1);
+	A.Wait(Counter);
+
+	B.Shutdown();
+	A.Shutdown();
+
+	const bool bMatches = IndexInA == 1 && IndexInB == -1 && NumExecuted.load() == NumJobs;
+	UE_LOG(
+		"[Bench] Cross-instance submit: worker %d of A is %d in B, %d/%d jobs ran: %s",
+		IndexInA, IndexInB, NumExecuted.load(), NumJobs, bMatches ? "OK" : "MISMATCH"
+	);
+}
+
+void BenchmarkJobSystem()
+{
+	// 엔진이 쓰는 FJobSystem::Get()은 다른 Job이 돌고 있을 수 있으므로 끄지 않고, Worker 수를 바꿔 가며 따로 만든 인스턴스로 측정
+	const std::unique_ptr<FJobSystem> JobSystemPtr = std::make_unique<FJobSystem>();
+	FJobSystem& JobSystem = *JobSystemPtr;
+	const int32 MaxWorkers = static_cast<int32>(std::thread::hardware_concurrency());
+
+	constexpr int32 NumElements = 1 << 20;
+	TArray<float> Results;
+	Results.SetNum(NumElements);
+	float* ResultData = Results.GetData();
+
+	// 1. ParallelFor 스케일링 (Worker 수 1 ~ 코어 수)
+	double SerialMs = 0.0;
+	for (int32 NumThreads = 1; NumThreads <= MaxWorkers; NumThreads *= 2)
+	{
+		JobSystem.Shutdown();
+		JobSystem.Initialize(NumThreads - 1);
+
+		const double Ms = BenchmarkUtils::MeasureBestMs([&]
+		{
+			JobSystem.ParallelFor(NumElements, [ResultData](int32 Index)
+			{
+				ResultData[Index] = HeavyWork(Index);
+			}, 1024);
+		});
+
+		if (NumThreads == 1)
+		{
+			SerialMs = Ms;
+		}
+		UE_LOG(
+			"[Bench] ParallelFor %d elems, %2d threads: %8.3f ms (x%.2f, efficiency %.0f%%)",
+			NumElements, NumThreads, Ms, SerialMs / Ms, SerialMs / Ms / NumThreads * 100.0
+		);
+	}
+	BenchmarkUtils::DoNotOptimize(Results[NumElements / 2]);
+
+	JobSystem.Shutdown();
+	JobSystem.Initialize();
+
+	// 2. 빈 Job의 Submit + 실행 오버헤드
+	constexpr int32 NumJobs = 100000;
+	const double EmptyMs = BenchmarkUtils::MeasureBestMs([&]
+	{
+		FJobCounter Counter;
+		for (int32 Index = 0; Index < NumJobs; ++Index)
+		{
+			JobSystem.Submit([] {}, &Counter);
+		}
+		JobSystem.Wait(Counter);
+	});
+	UE_LOG("[Bench] %d empty jobs: %.3f ms (%.1f ns/job)", NumJobs, EmptyMs, EmptyMs * 1e6 / NumJobs);
+
+	// 3. 중첩 Job (Job 안에서 Submit → Work-Stealing 확인)
+	const double NestedMs = BenchmarkUtils::MeasureBestMs([&]
+	{
+		FJobCounter Outer;
+		for (int32 Group = 0; Group < 64; ++Group)
+		{
+			JobSystem.Submit([&JobSystem, ResultData, Group]
+			{
+				FJobCounter Inner;
+				for (int32 Chunk = 0; Chunk < 16; ++Chunk)
+				{
+					JobSystem.Submit([ResultData, Group, Chunk]
+					{
+						const int32 Begin = (Group * 16 + Chunk) * 1024;
+						for (int32 Index = Begin; Index < Begin + 1024; ++Index)
+						{
+							ResultData[Index] = HeavyWork(Index);
+						}
+					}, &Inner);
+				}
+				JobSystem.Wait(Inner);
+			}, &Outer);
+		}
+		JobSystem.Wait(Outer);
+	});
+	UE_LOG("[Bench] Nested 64x16 jobs (%d threads): %.3f ms", JobSystem.GetNumWorkers(), NestedMs);
+
+	CheckCrossInstanceSubmit();
+}
+}
+
+REGISTER_BENCHMARK("jobs", "Job System ParallelFor scaling / job overhead", BenchmarkJobSystem);
@@ -0,0 +1,292 @@
+#include <cmath>
+#include <cstring>
+#include <random>
+
+#include "Benchmark.h"
+#include "Core/Math/Matrix.h"
+#include "Core/Math/Transform.h"
+#include "Debug/DebugConsole.h"
+
+
+namespace
+{
+constexpr int32 NumMatrices = 4096;
+constexpr int32 NumVectors = 100'000;
+
+//~ 기존 스칼라 구현 (비교 기준, 기존처럼 Matrix.cpp에 있는 함수 호출과 같게 inline 하지 않음)
+FORCENOINLINE FMatrix ScalarMultiply(const FMatrix& A, const FMatrix& B)
+{
+	FMatrix Result;
+	for (int i = 0; i < 4; i++)
+	{
+		for (int j = 0; j < 4; j++)
+		{
+			Result.M[i][j] = A.M[i][0] * B.M[0][j] +
+				A.M[i][1] * B.M[1][j] +
+				A.M[i][2] * B.M[2][j] +
+				A.M[i][3] * B.M[3][j];
+		}
+	}
+	return Result;
+}
+
+FORCENOINLINE FMatrix ScalarTranspose(const FMatrix& A)
+{
+	FMatrix Result;
+	for (int i = 0; i < 4; i++)
+	{
+		for (int j = 0; j < 4; j++)
+		{
+			Result.M[i][j] = A.M[j][i];
+		}
+	}
+	return Result;
+}
+
+FORCENOINLINE FMatrix ScalarInverse(const FMatrix& A)
+{
+	const float* m = &A.M[0][0];
+	const float Det =
+		m[0] * (m[5] * (m[10] * m[15] - m[11] * m[14]) - m[6] * (m[9] * m[15] - m[11] * m[13]) + m[7] * (m[9] * m[14] - m[10] * m[13])) -
+		m[1] * (m[4] * (m[10] * m[15] - m[11] * m[14]) - m[6] * (m[8] * m[15] - m[11] * m[12]) + m[7] * (m[8] * m[14] - m[10] * m[12])) +
+		m[2] * (m[4] * (m[9] * m[15] - m[11] * m[13]) - m[5] * (m[8] * m[15] - m[11] * m[12]) + m[7] * (m[8] * m[13] - m[9] * m[12])) -
+		m[3] * (m[4] * (m[9] * m[14] - m[10] * m[13]) - m[5] * (m[8] * m[14] - m[10] * m[12]) + m[6] * (m[8] * m[13] - m[9] * m[12]));
+	if (FMath::Abs(Det) < 1.0e-6f)
+	{
+		return {};
+	}
+
+	FMatrix Result;
+	const float InvDet = 1.0f / Det;
+	Result.M[0][0] = InvDet * (m[5] * (m[10] * m[15] - m[11] * m[14]) - m[6] * (m[9] * m[15] - m[11] * m[13]) + m[7] * (m[9] * m[14] - m[10] * m[13]));
+	Result.M[0][1] = -InvDet * (m[1] * (m[10] * m[15] - m[11] * m[14]) - m[2] * (m[9] * m[15] - m[11] * m[13]) + m[3] * (m[9] * m[14] - m[10] * m[13]));
+	Result.M[0][2] = InvDet * (m[1] * (m[6] * m[15] - m[7] * m[14]) - m[2] * (m[5] * m[15] - m[7] * m[13]) + m[3] * (m[5] * m[14] - m[6] * m[13]));
+	Result.M[0][3] = -InvDet * (m[1] * (m[6] * m[11] - m[7] * m[10]) - m[2] * (m[5] * m[11] - m[7] * m[9]) + m[3] * (m[5] * m[10] - m[6] * m[9]));
+	Result.M[1][0] = -InvDet * (m[4] * (m[10] * m[15] - m[11] * m[14]) - m[6] * (m[8] * m[15] - m[11] * m[12]) + m[7] * (m[8] * m[14] - m[10] * m[12]));
+	Result.M[1][1] = InvDet * (m[0] * (m[10] * m[15] - m[11] * m[14]) - m[2] * (m[8] * m[15] - m[11] * m[12]) + m[3] * (m[8] * m[14] - m[10] * m[12]));
+	Result.M[1][2] = -InvDet * (m[0] * (m[6] * m[15] - m[7] * m[14]) - m[2] * (m[4] * m[15] - m[7] * m[12]) + m[3] * (m[4] * m[14] - m[6] * m[12]));
+	Result.M[1][3] = InvDet * (m[0] * (m[6] * m[11] - m[7] * m[10]) - m[2] * (m[4] * m[11] - m[7] * m[8]) + m[3] * (m[4] * m[10] - m[6] * m[8]));
+	Result.M[2][0] = InvDet * (m[4] * (m[9] * m[15] - m[11] * m[13]) - m[5] * (m[8] * m[15] - m[11] * m[12]) + m[7] * (m[8] * m[13] - m[9] * m[12]));
+	Result.M[2][1] = -InvDet * (m[0] * (m[9] * m[15] - m[11] * m[13]) - m[1] * (m[8] * m[15] - m[11] * m[12]) + m[3] * (m[8] * m[13] - m[9] * m[12]));
+	Result.M[2][2] = InvDet * (m[0] * (m[5] * m[15] - m[7] * m[13]) - m[1] * (m[4] * m[15] - m[7] * m[12]) + m[3] * (m[4] * m[13] - m[5] * m[12]));
+	Result.M[2][3] = -InvDet * (m[0] * (m[5] * m[11] - m[7] * m[9]) - m[1] * (m[4] * m[11] - m[7] * m[8]) + m[3] * (m[4] * m[9] - m[5] * m[8]));
+	Result.M[3][0] = -InvDet * (m[4] * (m[9] * m[14] - m[10] * m[13]) - m[5] * (m[8] * m[14] - m[10] * m[12]) + m[6] * (m[8] * m[13] - m[9] * m[12]));
+	Result.M[3][1] = InvDet * (m[0] * (m[9] * m[14] - m[10] * m[13]) - m[1] * (m[8] * m[14] - m[10] * m[12]) + m[2] * (m[8] * m[13] - m[9] * m[12]));
+	Result.M[3][2] = -InvDet * (m[0] * (m[5] * m[14] - m[6] * m[13]) - m[1] * (m[4] * m[14] - m[6] * m[12]) + m[2] * (m[4] * m[13] - m[5] * m[12]));
+	Result.M[3][3] = InvDet * (m[0] * (m[5] * m[10] - m[6] * m[9]) - m[1] * (m[4] * m[10] - m[6] * m[8]) + m[2] * (m[4] * m[9] - m[5] * m[8]));
+	return Result;
+}
+
+FORCENOINLINE FVector ScalarTransformPosition(const FMatrix& A, const FVector& V)
+{
+	return {
+		V.X * A.M[0][0] + V.Y * A.M[1][0] + V.Z * A.M[2][0] + A.M[3][0],
+		V.X * A.M[0][1] + V.Y * A.M[1][1] + V.Z * A.M[2][1] + A.M[3][1],
+		V.X * A.M[0][2] + V.Y * A.M[1][2] + V.Z * A.M[2][2] + A.M[3][2]
+	};
+}
+
+FORCENOINLINE FVector ScalarTransformVector(const FMatrix& A, const FVector& V)
+{
+	return {
+		V.X * A.M[0][0] + V.Y * A.M[1][0] + V.Z * A.M[2][0],
+		V.X * A.M[0][1] + V.Y * A.M[1][1] + V.Z * A.M[2][1],
+		V.X * A.M[0][2] + V.Y * A.M[1][2] + V.Z * A.M[2][2]
+	};
+}
+//~ 기존 스칼라 구현
+
+int32 CountBitwiseMismatches(const FMatrix& A, const FMatrix& B)
+{
+	return std::memcmp(A.M, B.M, sizeof(A.M)) != 0 ? 1 : 0;
+}
+
+int32 CountBitwiseMismatches(const FVector& A, const FVector& B)
+{
+	return (std::memcmp(&A.X, &B.X, sizeof(float) * 3) != 0) ? 1 : 0;
+}
+
+/** 원소별 |A - B| / max(|B|, 1)의 최댓값 */
+float GetMaxRelativeError(const FMatrix& A, const FMatrix& B)
+{
+	float MaxError = 0.0f;
+	for (int32 Row = 0; Row < 4; ++Row)
+	{
+		for (int32 Column = 0; Column < 4; ++Column)
+		{
+			const float Error = FMath::Abs(A.M[Row][Column] - B.M[Row][Column]) / FMath::Max(FMath::Abs(B.M[Row][Column]), 1.0f);
+			MaxError = FMath::Max(MaxError, Error);
+		}
+	}
+	return MaxError;
+}
+
+/** 실제 Model 행렬처럼 Scale * Rotation * Translation으로 만든 행렬 */
+FMatrix MakeRandomModelMatrix(std::mt19937& Random)
+{
+	std::uniform_real_distribution<float> Angle(-180.0f, 180.0f);
+	std::uniform_real_distribution<float> Position(-500.0f, 500.0f);
+	std::uniform_real_distribution<float> Scale(0.1f, 10.0f);
+	const FTransform Transform(
+		FVector(Position(Random), Position(Random), Position(Random)),
+		FVector(Angle(Random), Angle(Random), Angle(Random)),
+		FVector(Scale(Random), Scale(Random), Scale(Random))
+	);
+	return Transform.GetMatrix();
+}
+
+/**
+ * Matrix 곱, 전치, 역행렬, 점/방향 변환을 기존 스칼라 구현과 VectorRegister 구현으로 재고 결과를 비교합니다.
+ * 곱, 전치, 변환은 비트 단위로 같아야 하고, 역행렬은 계산 순서가 달라 상대 오차를 보고합니다.
+ */
+void BenchmarkMath()
+{
+	std::mt19937 Random(1234);
+	std::uniform_real_distribution<float> Unit(-1000.0f, 1000.0f);
+
+	TArray<FMatrix> Models;
+	TArray<FMatrix> ViewProjections;
+	Models.SetNum(NumMatrices);
+	ViewProjections.SetNum(NumMatrices);
+	for (int32 Index = 0; Index < NumMatrices; ++Index)
+	{
+		Models[Index] = MakeRandomModelMatrix(Random);
+		const FVector Eye(Unit(Random), Unit(Random), Unit(Random));
+		const FMatrix View = FMatrix::LookAtLH(Eye, Eye + FVector(1.0f, 0.3f, -0.2f), FVector(0.0f, 0.0f, 1.0f));
+		ViewProjections[Index] = View * FMatrix::PerspectiveFovLH(FMath::DegreesToRadians(60.0f), 16.0f / 9.0f, 0.1f, 1000.0f);
+	}
+
+	TArray<FVector> Vectors;
+	Vectors.SetNum(NumVectors);
+	for (FVector& Vector : Vectors)
+	{
+		Vector = FVector(Unit(Random), Unit(Random), Unit(Random));
+	}
+
+	TArray<FMatrix> ScalarResults;
+	TArray<FMatrix> VectorResults;
+	ScalarResults.SetNum(NumMatrices);
+	VectorResults.SetNum(NumMatrices);
+
+	// MVP = Transpose(Model * ViewProjection), UPrimitiveComponent::Render와 같은 계산
+	const double ScalarMVPMs = BenchmarkUtils::MeasureBestMs([&]
+	{
+		for (int32 Index = 0; Index < NumMatrices; ++Index)
+		{
+			ScalarResults[Index] = ScalarTranspose(ScalarMultiply(Models[Index], ViewProjections[Index]));
+		}
+	}, 10);
+	const double VectorMVPMs = BenchmarkUtils::MeasureBestMs([&]
+	{
+		for (int32 Index = 0; Index < NumMatrices; ++Index)
+		{
+			VectorResults[Index] = FMatrix::Transpose(Models[Index] * ViewProjections[Index]);
+		}
+	}, 10);
+	int32 MVPMismatches = 0;
+	for (int32 Index = 0; Index < NumMatrices; ++Index)
+	{
+		MVPMismatches += CountBitwiseMismatches(VectorResults[Index], ScalarResults[Index]);
+	}
+
+	const double ScalarInverseMs = BenchmarkUtils::MeasureBestMs([&]
+	{
+		for (int32 Index = 0; Index < NumMatrices; ++Index)
+		{
+			ScalarResults[Index] = ScalarInverse(Models[Index]);
+		}
+	}, 10);
+	const double VectorInverseMs = BenchmarkUtils::MeasureBestMs([&]
+	{
+		for (int32 Index = 0; Index < NumMatrices; ++Index)
+		{
+			VectorResults[Index] = Models[Index].Inverse();
+		}
+	}, 10);
+	float InverseMaxError = 0.0f;
+	float ScalarRoundTripMaxError = 0.0f;
+	float RoundTripMaxError = 0.0f;
+	for (int32 Index = 0; Index < NumMatrices; ++Index)
+	{
+		InverseMaxError = FMath::Max(InverseMaxError, GetMaxRelativeError(VectorResults[Index], ScalarResults[Index]));
+		ScalarRoundTripMaxError = FMath::Max(ScalarRoundTripMaxError, GetMaxRelativeError(ScalarMultiply(Models[Index], ScalarResults[Index]), FMatrix::Identity()));
+		RoundTripMaxError = FMath::Max(RoundTripMaxError, GetMaxRelativeError(Models[Index] * VectorResults[Index], FMatrix::Identity()));
+	}
+
+	TArray<FVector> ScalarVectors;
+	TArray<FVector> VectorVectors;
+	ScalarVectors.SetNum(NumVectors);
+	VectorVectors.SetNum(NumVectors);
+	const FMatrix& Model = Models[0];
+
+	const double ScalarPositionMs = BenchmarkUtils::MeasureBestMs([&]
+	{
+		for (int32 Index = 0; Index < NumVectors; ++Index)
+		{
+			ScalarVectors[Index] = ScalarTransformPosition(Model, Vectors[Index]);
+		}
+	}, 10);
+	const double VectorPositionMs = BenchmarkUtils::MeasureBestMs([&]
+	{
+		for (int32 Index = 0; Index < NumVectors; ++Index)
+		{
+			VectorVectors[Index] = Model.TransformPosition(Vectors[Index]);
+		}
+	}, 10);
+	int32 PositionMismatches = 0;
+	for (int32 Index = 0; Index < NumVectors; ++Index)
+	{
+		PositionMismatches += CountBitwiseMismatches(VectorVectors[Index], ScalarVectors[Index]);
+	}
+
+	const double ScalarDirectionMs = BenchmarkUtils::MeasureBestMs([&]
+	{
+		for (int32 Index = 0; Index < NumVectors; ++Index)
+		{
+			ScalarVectors[Index] = ScalarTransformVector(Model, Vectors[Index]);
+		}
+	}, 10);
+	const double VectorDirectionMs = BenchmarkUtils::MeasureBestMs([&]
+	{
+		for (int32 Index = 0; Index < NumVectors; ++Index)
+		{
+			VectorVectors[Index] = Model.TransformVector(Vectors[Index]);
+		}
+	}, 10);
+	int32 DirectionMismatches = 0;
+	for (int32 Index = 0; Index < NumVectors; ++Index)
+	{
+		DirectionMismatches += CountBitwiseMismatches(VectorVectors[Index], ScalarVectors[Index]);
+	}
+
+#if PLATFORM_ENABLE_VECTORINTRINSICS && defined(__AVX__)
+	const char* Backend = "AVX";
+#elif PLATFORM_ENABLE_VECTORINTRINSICS
+	const char* Backend = "SSE2";
+#elif PLATFORM_ENABLE_VECTORINTRINSICS_NEON
+	const char* Backend = "NEON";
+#else
+	const char* Backend = "scalar";
+#endif
+
+	UE_LOG("[Bench] math: backend %s, %d matrices, %d vectors", Backend, NumMatrices, NumVectors);
+	UE_LOG(
+		"[Bench] math: MVP multiply + transpose scalar %.3f ms, vector %.3f ms (%.1fx), %d bitwise mismatches",
+		ScalarMVPMs, VectorMVPMs, ScalarMVPMs / VectorMVPMs, MVPMismatches
+	);
+	UE_LOG(
+		"[Bench] math: inverse scalar %.3f ms, vector %.3f ms (%.1fx), max relative error vs scalar %.2e, |M * Inverse - I| scalar %.2e / vector %.2e",
+		ScalarInverseMs, VectorInverseMs, ScalarInverseMs / VectorInverseMs, InverseMaxError, ScalarRoundTripMaxError, RoundTripMaxError
+	);
+	UE_LOG(
+		"[Bench] math: transform position scalar %.3f ms, vector %.3f ms (%.1fx), %d bitwise mismatches",
+		ScalarPositionMs, VectorPositionMs, ScalarPositionMs / VectorPositionMs, PositionMismatches
+	);
+	UE_LOG(
+		"[Bench] math: transform vector scalar %.3f ms, vector %.3f ms (%.1fx), %d bitwise mismatches",
+		ScalarDirectionMs, VectorDirectionMs, ScalarDirectionMs / VectorDirectionMs, DirectionMismatches
+	);
+}
+}
+
+REGISTER_BENCHMARK("math", "VectorRegister FMatrix multiply/transpose/inverse/transform vs the previous scalar code, with bitwise comparison", BenchmarkMath);
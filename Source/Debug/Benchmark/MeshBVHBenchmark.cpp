@@ -0,0 +1,122 @@
+#include <random>
+
+#include "Benchmark.h"
+#include "Core/Math/MeshBVH.h"
+#include "Debug/DebugConsole.h"
+#include "Resource/Mesh.h"
+
+
+namespace
+{
+constexpr int32 NumRays = 100'000;
+
+const char* const MeshNames[] = {"Cube", "Sphere", "Cylinder", "Cone", "Triangle", "Quad", "GizmoArrow", "GizmoRotation", "GizmoScale"};
+
+/** BVH 없이 모든 삼각형을 검사 (정답 비교용) */
+bool RayCastBruteForce(std::span<const FVertexSimple> Vertices, std::span<const uint32> Indices, const FRay& Ray, float& OutDistance)
+{
+	bool bHit = false;
+	float Closest = FLT_MAX;
+	for (size_t Index = 0; Index + 2 < Indices.size(); Index += 3)
+	{
+		const FVertexSimple& V0 = Vertices[Indices[Index]];
+		const FVertexSimple& V1 = Vertices[Indices[Index + 1]];
+		const FVertexSimple& V2 = Vertices[Indices[Index + 2]];
+
+		float Distance;
+		if (FRayCast::IntersectRayTriangle(
+			Ray, FVector(V0.X, V0.Y, V0.Z), FVector(V1.X, V1.Y, V1.Z), FVector(V2.X, V2.Y, V2.Z), true, Distance
+		) && Distance <= Closest)
+		{
+			Closest = Distance;
+			bHit = true;
+		}
+	}
+	OutDistance = Closest;
+	return bHit;
+}
+
+/**
+ * 기본 Mesh마다 바깥에서 Bounding Box 안쪽을 향하는 Ray를 쏴서
+ * BVH와 전체 삼각형 검사의 시간과 결과를 비교합니다.
+ */
+void BenchmarkMeshBVH()
+{
+	std::mt19937 Random(1234);
+	std::uniform_real_distribution<float> Unit(-1.0f, 1.0f);
+
+	for (const char* MeshName : MeshNames)
+	{
+		const std::shared_ptr<FMesh> Mesh = FMesh::Find(MeshName);
+		const FMeshBVH* BVH = Mesh ? Mesh->GetBVH() : nullptr;
+		if (BVH == nullptr)
+		{
+			UE_LOG("[Bench] meshbvh: %s has no triangle BVH", MeshName);
+			continue;
+		}
+
+		const FBox Bounds = BVH->GetBounds();
+		const FVector Center = Bounds.GetCenter();
+		const FVector Extent = Bounds.GetExtent();
+		const float Radius = FMath::Max(Extent.Length(), 0.01f);
+
+		TArray<FRay> Rays;
+		Rays.SetNum(NumRays);
+		for (FRay& Ray : Rays)
+		{
+			FVector Direction;
+			do
+			{
+				Direction = FVector(Unit(Random), Unit(Random), Unit(Random));
+			}
+			while (Direction.Length() < 0.01f);
+
+			const FVector Origin = Center + Direction.GetSafeNormal() * Radius * 3.0f;
+			const FVector Target = Center + FVector(Unit(Random) * Extent.X, Unit(Random) * Extent.Y, Unit(Random) * Extent.Z);
+			Ray = FRay(Origin, (Target - Origin).GetSafeNormal());
+		}
+
+		int32 NumHits = 0;
+		const double BVHMs = BenchmarkUtils::MeasureBestMs([&]
+		{
+			NumHits = 0;
+			for (const FRay& Ray : Rays)
+			{
+				float Distance;
+				NumHits += BVH->RayCast(Ray, FLT_MAX, true, false, Distance) ? 1 : 0;
+			}
+		}, 3);
+
+		const std::span<const FVertexSimple> Vertices = Mesh->GetVertexBuffer()->GetCPUVertices<FVertexSimple>();
+		const std::span<const uint32> Indices = Mesh->GetIndexBuffer()->GetCPUIndices();
+		const double BruteForceMs = BenchmarkUtils::MeasureBestMs([&]
+		{
+			for (const FRay& Ray : Rays)
+			{
+				float Distance;
+				BenchmarkUtils::DoNotOptimize(RayCastBruteForce(Vertices, Indices, Ray, Distance));
+			}
+		}, 1);
+
+		int32 NumMismatches = 0;
+		for (const FRay& Ray : Rays)
+		{
+			float BVHDistance, BruteForceDistance;
+			const bool bBVHHit = BVH->RayCast(Ray, FLT_MAX, true, false, BVHDistance);
+			const bool bBruteForceHit = RayCastBruteForce(Vertices, Indices, Ray, BruteForceDistance);
+			if (bBVHHit != bBruteForceHit || (bBVHHit && BVHDistance != BruteForceDistance))
+			{
+				++NumMismatches;
+			}
+		}
+
+		UE_LOG(
+			"[Bench] meshbvh: %-13s %5d tris, %5d nodes, depth %2d, bvh %7.1f ns/ray, brute force %8.1f ns/ray, %d hits, %d mismatches",
+			MeshName, BVH->GetNumTriangles(), BVH->GetNumNodes(), BVH->GetDepth(),
+			BVHMs * 1e6 / NumRays, BruteForceMs * 1e6 / NumRays, NumHits, NumMismatches
+		);
+	}
+}
+}
+
+REGISTER_BENCHMARK("meshbvh", "Per-mesh triangle BVH ray cast vs testing every triangle", BenchmarkMeshBVH);
@@ -0,0 +1,191 @@
+#include <algorithm>
+#include <random>
+
+#include "Benchmark.h"
+#include "Core/Math/Frustum.h"
+#include "Core/Rendering/Software/OcclusionCuller.h"
+#include "Core/Rendering/Software/SoftwareRasterizer.h"
+#include "Debug/DebugConsole.h"
+#include "Primitive/PrimitiveVertices.h"
+#include "Resource/Mesh.h"
+
+
+namespace
+{
+constexpr int32 MaxOccluders = 16;
+constexpr uint32 ReferenceWidth = 1280;
+constexpr uint32 ReferenceHeight = 720;
+
+struct FSceneObject
+{
+	FMatrix Model;
+	FBox Box;
+};
+
+/** Cube Mesh를 Scale, Translation 해서 놓은 물체 */
+FSceneObject MakeCube(const FVector& LocalMin, const FVector& LocalMax, const FVector& Center, const FVector& Scale)
+{
+	FSceneObject Object;
+	Object.Model = FMatrix::GetScaleMatrix(Scale) * FMatrix::GetTranslateMatrix(Center);
+	Object.Box = FBox(Center + LocalMin * Scale, Center + LocalMax * Scale);
+	return Object;
+}
+
+/**
+ * 한 장면에서 Occluder를 그리고 모든 물체를 HiZ로 검사한 뒤,
+ * 전체 장면을 FSoftwareRasterizer로 그린 UUID 버퍼(정답)와 비교합니다.
+ * 정답에서 한 픽셀이라도 보이는 물체를 가려졌다고 판정하면 오류입니다.
+ */
+void BenchmarkScene(const char* SceneName, const TArray<FSceneObject>& Objects, std::span<const FVertexSimple> Vertices, std::span<const uint32> Indices)
+{
+	const FVector Eye(-10.0f, 0.0f, 5.0f);
+	const FMatrix View = FMatrix::LookAtLH(Eye, FVector(100.0f, 0.0f, 5.0f), FVector(0.0f, 0.0f, 1.0f));
+	const FMatrix Projection = FMatrix::PerspectiveFovLH(FMath::DegreesToRadians(60.0f), 16.0f / 9.0f, 0.1f, 1000.0f);
+	const FMatrix ViewProjection = View * Projection;
+
+	// World::CullOccludedComponents와 같은 기준으로 Occluder 선택
+	TArray<std::pair<float, int32>> Candidates;
+	for (int32 Index = 0; Index < Objects.Num(); ++Index)
+	{
+		Candidates.Add({FOcclusionCuller::GetOccluderScore(Objects[Index].Box, Eye), Index});
+	}
+	const int32 NumOccluders = std::min(Candidates.Num(), MaxOccluders);
+	std::partial_sort(
+		Candidates.GetData(), Candidates.GetData() + NumOccluders, Candidates.GetData() + Candidates.Num(),
+		[](const std::pair<float, int32>& A, const std::pair<float, int32>& B) { return A.first > B.first; }
+	);
+
+	FOcclusionCuller Culler;
+	const double RasterizeMs = BenchmarkUtils::MeasureBestMs([&]
+	{
+		Culler.BeginFrame(ViewProjection);
+		for (int32 Rank = 0; Rank < NumOccluders; ++Rank)
+		{
+			Culler.RenderOccluder(Vertices, Indices, Objects[Candidates[Rank].second].Model);
+		}
+		Culler.BuildHierarchy();
+	}, 10);
+	const int32 NumOccluderTriangles = Culler.GetStats().NumOccluderTriangles;
+
+	TArray<uint8> Occluded;
+	Occluded.SetNum(Objects.Num());
+	const double TestMs = BenchmarkUtils::MeasureBestMs([&]
+	{
+		for (int32 Index = 0; Index < Objects.Num(); ++Index)
+		{
+			Occluded[Index] = Culler.IsOccluded(Objects[Index].Box) ? 1 : 0;
+		}
+	}, 10);
+
+	// 정답: 모든 물체를 전체 해상도로 그려서 UUID가 한 픽셀이라도 남은 물체
+	FSoftwareRasterizer Rasterizer(ReferenceWidth, ReferenceHeight);
+	const double ReferenceMs = BenchmarkUtils::MeasureBestMs([&]
+	{
+		Rasterizer.Clear(FVector4(0.0f, 0.0f, 0.0f, 1.0f));
+		for (int32 Index = 0; Index < Objects.Num(); ++Index)
+		{
+			FSoftwareDrawState State;
+			State.MVP = Objects[Index].Model * ViewProjection;
+			State.UUID = static_cast<uint32>(Index + 1);
+			Rasterizer.DrawIndexedTriangles(Vertices, Indices, State);
+		}
+		Rasterizer.Flush();
+	}, 3);
+
+	TArray<uint8> Visible;
+	Visible.SetNum(Objects.Num());
+	std::fill_n(Visible.GetData(), Visible.Num(), 0);
+	for (uint32 Y = 0; Y < ReferenceHeight; ++Y)
+	{
+		for (uint32 X = 0; X < ReferenceWidth; ++X)
+		{
+			if (const uint32 UUID = Rasterizer.ReadUUID(X, Y))
+			{
+				Visible[static_cast<int32>(UUID - 1)] = 1;
+			}
+		}
+	}
+
+	// 화면 밖 물체는 Frustum Culling 몫이므로 Frustum 안에서 가려진 것만 셈
+	const FFrustum Frustum = FFrustum::FromViewProjection(ViewProjection);
+	int32 NumInFrustum = 0;
+	int32 NumHidden = 0;
+	int32 NumOccluded = 0;
+	int32 NumWrong = 0;
+	for (int32 Index = 0; Index < Objects.Num(); ++Index)
+	{
+		const bool bInFrustum = Frustum.IntersectBox(Objects[Index].Box);
+		NumInFrustum += bInFrustum ? 1 : 0;
+		NumHidden += (bInFrustum && !Visible[Index]) ? 1 : 0;
+		NumOccluded += Occluded[Index] ? 1 : 0;
+		NumWrong += (Occluded[Index] && Visible[Index]) ? 1 : 0;
+	}
+
+	UE_LOG(
+		"[Bench] occlusion: %s: %d objects, %d occluders (%d tris) rasterized + HiZ %ux%u in %.3f ms, tests %.3f ms (%.3f us/object)",
+		SceneName, Objects.Num(), NumOccluders, NumOccluderTriangles, Culler.GetWidth(), Culler.GetHeight(),
+		RasterizeMs, TestMs, TestMs * 1000.0 / Objects.Num()
+	);
+	UE_LOG(
+		"[Bench] occlusion: %s: %d in frustum, %d hidden by brute force (%ux%u raster %.2f ms), %d occluded (%.1f%% of hidden), %d visible objects wrongly culled",
+		SceneName, NumInFrustum, NumHidden, ReferenceWidth, ReferenceHeight, ReferenceMs,
+		NumOccluded, NumHidden > 0 ? 100.0 * NumOccluded / NumHidden : 0.0, NumWrong
+	);
+}
+
+/**
+ * 벽 뒤에 작은 물체가 많은 장면과, 크기가 제각각인 물체가 흩어진 장면에서
+ * HiZ Occlusion Culling의 시간과 정확도(보이는 물체를 빼지 않는지)를 잽니다.
+ */
+void BenchmarkOcclusionCulling()
+{
+	const std::shared_ptr<FMesh> Mesh = FMesh::Find("Cube");
+	const std::span<const FVertexSimple> Vertices = Mesh ? Mesh->GetVertexBuffer()->GetCPUVertices<FVertexSimple>() : std::span<const FVertexSimple>();
+	if (Vertices.empty())
+	{
+		UE_LOG("[Bench] occlusion: Cube mesh has no CPU vertices");
+		return;
+	}
+	const std::span<const uint32> Indices = Mesh->GetIndexBuffer()->GetCPUIndices();
+	const FVector LocalMin = Mesh->GetVertexBuffer()->GetMin();
+	const FVector LocalMax = Mesh->GetVertexBuffer()->GetMax();
+	const FVector LocalSize = LocalMax - LocalMin;
+
+	std::mt19937 Random(1234);
+	std::uniform_real_distribution<float> Unit(0.0f, 1.0f);
+	auto Range = [&](float Min, float Max) { return Min + (Max - Min) * Unit(Random); };
+
+	// 틈이 있는 벽 6조각 뒤에 작은 Cube 4000개, 앞쪽에 500개
+	{
+		TArray<FSceneObject> Objects;
+		for (int32 Segment = 0; Segment < 6; ++Segment)
+		{
+			const FVector Size(1.0f, 9.0f, 20.0f);
+			Objects.Add(MakeCube(LocalMin, LocalMax, FVector(30.0f, -25.0f + 10.0f * Segment, 5.0f), Size / LocalSize));
+		}
+		for (int32 Index = 0; Index < 4500; ++Index)
+		{
+			const bool bBehind = Index < 4000;
+			const FVector Center(bBehind ? Range(35.0f, 200.0f) : Range(5.0f, 28.0f), Range(-60.0f, 60.0f), Range(-5.0f, 20.0f));
+			const float Size = Range(0.5f, 2.0f);
+			Objects.Add(MakeCube(LocalMin, LocalMax, Center, FVector(Size) / LocalSize));
+		}
+		BenchmarkScene("wall", Objects, Vertices, Indices);
+	}
+
+	// 크기가 제각각인 Cube 5000개가 흩어진 장면 (큰 것이 자연스럽게 Occluder가 됨)
+	{
+		TArray<FSceneObject> Objects;
+		for (int32 Index = 0; Index < 5000; ++Index)
+		{
+			const FVector Center(Range(5.0f, 300.0f), Range(-120.0f, 120.0f), Range(-20.0f, 30.0f));
+			const float Size = Unit(Random) < 0.02f ? Range(6.0f, 20.0f) : Range(0.5f, 3.0f);
+			const FVector Scale(Size * Range(0.5f, 1.5f), Size * Range(0.5f, 1.5f), Size * Range(0.5f, 1.5f));
+			Objects.Add(MakeCube(LocalMin, LocalMax, Center, Scale / LocalSize));
+		}
+		BenchmarkScene("scattered", Objects, Vertices, Indices);
+	}
+}
+}
+
+REGISTER_BENCHMARK("occlusion", "Software HiZ occlusion culling: occluder raster + HiZ + box tests, checked against a full-resolution UUID raster", BenchmarkOcclusionCulling);
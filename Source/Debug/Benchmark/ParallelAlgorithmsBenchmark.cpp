@@ -0,0 +1,144 @@
+#include <numeric>
+#include <random>
+
+#include "Benchmark.h"
+#include "Core/Async/ParallelAlgorithms.h"
+#include "Debug/DebugConsole.h"
+
+
+namespace
+{
+constexpr int32 NumElements = 1 << 20;
+
+struct FSortItem
+{
+	uint32 Key;
+	uint32 Payload;
+};
+
+void BenchmarkParallelAlgorithms()
+{
+	std::mt19937 Random(1234);
+
+	TArray<FSortItem> Source;
+	Source.SetNum(NumElements);
+	for (int32 Index = 0; Index < NumElements; ++Index)
+	{
+		Source[Index] = {static_cast<uint32>(Random()), static_cast<uint32>(Index)};
+	}
+
+	auto KeyFunc = [](const FSortItem& Item) { return Item.Key; };
+	auto Less = [](const FSortItem& A, const FSortItem& B) { return A.Key < B.Key; };
+
+	auto IsSorted = [](const TArray<FSortItem>& Items)
+	{
+		for (int32 Index = 1; Index < Items.Num(); ++Index)
+		{
+			if (Items[Index - 1].Key > Items[Index].Key)
+			{
+				return false;
+			}
+		}
+		return true;
+	};
+
+	// 1. 정렬
+	TArray<FSortItem> Work;
+	const double StdSortMs = BenchmarkUtils::MeasureBestMs([&]
+	{
+		Work = Source;
+		Work.Sort(Less);
+	}, 3);
+
+	const double RadixMs = BenchmarkUtils::MeasureBestMs([&]
+	{
+		Work = Source;
+		ParallelAlgo::ParallelRadixSort(Work, KeyFunc);
+	}, 3);
+	const bool bRadixSorted = IsSorted(Work);
+
+	const double MergeMs = BenchmarkUtils::MeasureBestMs([&]
+	{
+		Work = Source;
+		ParallelAlgo::ParallelMergeSortByKey(Work, KeyFunc);
+	}, 3);
+	const bool bMergeSorted = IsSorted(Work);
+
+	UE_LOG("[Bench] Sort %d items (incl. copy): std::sort %.3f ms", NumElements, StdSortMs);
+	UE_LOG("[Bench]   ParallelRadixSort %.3f ms (x%.2f) %s", RadixMs, StdSortMs / RadixMs, bRadixSorted ? "OK" : "FAILED");
+	UE_LOG("[Bench]   ParallelMergeSort %.3f ms (x%.2f) %s", MergeMs, StdSortMs / MergeMs, bMergeSorted ? "OK" : "FAILED");
+
+	// 2. Reduce
+	TArray<uint64> Values;
+	Values.SetNum(NumElements);
+	for (int32 Index = 0; Index < NumElements; ++Index)
+	{
+		Values[Index] = Source[Index].Key & 0xFFFF;
+	}
+
+	uint64 SerialSum = 0;
+	const double SerialReduceMs = BenchmarkUtils::MeasureBestMs([&]
+	{
+		SerialSum = std::accumulate(Values.begin(), Values.end(), uint64{0});
+	});
+
+	uint64 ParallelSum = 0;
+	const double ParallelReduceMs = BenchmarkUtils::MeasureBestMs([&]
+	{
+		ParallelSum = ParallelAlgo::ParallelReduce(Values, uint64{0}, [](uint64 A, uint64 B) { return A + B; });
+	});
+	UE_LOG(
+		"[Bench] Reduce: serial %.3f ms, parallel %.3f ms (x%.2f) %s",
+		SerialReduceMs, ParallelReduceMs, SerialReduceMs / ParallelReduceMs, SerialSum == ParallelSum ? "OK" : "FAILED"
+	);
+
+	// 3. Prefix Sum
+	TArray<uint64> SerialScan;
+	const double SerialScanMs = BenchmarkUtils::MeasureBestMs([&]
+	{
+		SerialScan = Values;
+		std::inclusive_scan(SerialScan.begin(), SerialScan.end(), SerialScan.begin());
+	});
+
+	TArray<uint64> ParallelScan;
+	const double ParallelScanMs = BenchmarkUtils::MeasureBestMs([&]
+	{
+		ParallelScan = Values;
+		ParallelAlgo::ParallelPrefixSum(ParallelScan);
+	});
+
+	bool bScanMatches = true;
+	for (int32 Index = 0; Index < NumElements; ++Index)
+	{
+		bScanMatches &= SerialScan[Index] == ParallelScan[Index];
+	}
+	UE_LOG(
+		"[Bench] PrefixSum (incl. copy): serial %.3f ms, parallel %.3f ms (x%.2f) %s",
+		SerialScanMs, ParallelScanMs, SerialScanMs / ParallelScanMs, bScanMatches ? "OK" : "FAILED"
+	);
+
+	// 4. ParallelForEach
+	TArray<float> Floats;
+	Floats.Init(1.0f, NumElements);
+	auto Transform = [](float& Value) { Value = Value * 1.5f + 0.25f; };
+
+	const double SerialForMs = BenchmarkUtils::MeasureBestMs([&]
+	{
+		for (float& Value : Floats)
+		{
+			Transform(Value);
+		}
+	});
+	const double ParallelForMs = BenchmarkUtils::MeasureBestMs([&]
+	{
+		ParallelAlgo::ParallelForEach(Floats, Transform);
+	});
+	BenchmarkUtils::DoNotOptimize(Floats[NumElements - 1]);
+	UE_LOG(
+		"[Bench] ForEach: serial %.3f ms, parallel %.3f ms (x%.2f)",
+		SerialForMs, ParallelForMs, SerialForMs / ParallelForMs
+	);
+}
+}
+
+REGISTER_BENCHMARK("parallel", "ParallelAlgorithms vs serial on 1M elements", BenchmarkParallelAlgorithms);
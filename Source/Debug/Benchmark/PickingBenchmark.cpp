@@ -0,0 +1,67 @@
+#include "Benchmark.h"
+#include "Core/Engine.h"
+#include "Core/Rendering/Software/SoftwareRasterizer.h"
+#include "Debug/DebugConsole.h"
+#include "Object/Actor/Camera.h"
+#include "Object/World/World.h"
+#include "Static/FPickingManager.h"
+
+
+namespace
+{
+constexpr uint32 SamplesX = 64;
+constexpr uint32 SamplesY = 36;
+
+/**
+ * 현재 World를 화면 전체에 고르게 Picking 해서 한 번에 걸리는 시간을 재고,
+ * 같은 픽셀의 UUID를 Software Rasterizer의 UUID Target(GPU Picking Texture와 같은 규칙)과 비교합니다.
+ */
+void BenchmarkPicking()
+{
+	UEngine& Engine = UEngine::Get();
+	UWorld* World = Engine.GetWorld();
+	ACamera* Camera = World ? World->GetCamera() : nullptr;
+	if (Camera == nullptr || World->GetRenderComponents().Num() == 0)
+	{
+		UE_LOG("[Bench] picking: no camera or primitive in the world (spawn actors first)");
+		return;
+	}
+
+	const uint32 Width = static_cast<uint32>(Engine.GetScreenWidth());
+	const uint32 Height = static_cast<uint32>(Engine.GetScreenHeight());
+
+	FSoftwareRasterizer Rasterizer(Width, Height);
+	Rasterizer.Clear(FVector4(0.0f, 0.0f, 0.0f, 0.0f));
+	World->RenderSoftware(Rasterizer);
+
+	FPickingManager& PickingManager = FPickingManager::Get();
+	uint32 NumHits = 0;
+	uint32 NumMismatches = 0;
+	const double TotalMs = BenchmarkUtils::MeasureBestMs([&]
+	{
+		NumHits = 0;
+		NumMismatches = 0;
+		for (uint32 SampleY = 0; SampleY < SamplesY; ++SampleY)
+		{
+			for (uint32 SampleX = 0; SampleX < SamplesX; ++SampleX)
+			{
+				const uint32 X = (SampleX * 2 + 1) * Width / (SamplesX * 2);
+				const uint32 Y = (SampleY * 2 + 1) * Height / (SamplesY * 2);
+				const FPickResult Result = PickingManager.PickCPU(
+					*World, *Camera, static_cast<float>(X), static_cast<float>(Y), static_cast<float>(Width), static_cast<float>(Height)
+				);
+				NumHits += Result.IsHit() ? 1 : 0;
+				NumMismatches += Result.UUID != Rasterizer.ReadUUID(X, Y) ? 1 : 0;
+			}
+		}
+	}, 3);
+
+	const uint32 NumSamples = SamplesX * SamplesY;
+	UE_LOG(
+		"[Bench] picking: %u samples, %d components, %.3f us/pick, %u hits, %u mismatches vs UUID target",
+		NumSamples, World->GetRenderComponents().Num(), TotalMs * 1000.0 / NumSamples, NumHits, NumMismatches
+	);
+}
+}
+
+REGISTER_BENCHMARK("picking", "CPU raycast picking cost and agreement with the UUID target", BenchmarkPicking);
@@ -0,0 +1,313 @@
+#include <algorithm>
+#include <memory>
+#include <random>
+
+#include "Benchmark.h"
+#include "Core/RHI/NullRHI.h"
+#include "Core/RHI/RHIPipelineState.h"
+#include "Core/RHI/RHIStateTracking.h"
+#include "Core/Stats/StatCounter.h"
+#include "Debug/DebugConsole.h"
+
+
+namespace
+{
+constexpr int32 NumPrimitives = 20'000;
+constexpr int32 NumMeshes = 6;
+constexpr int32 NumMaterials = 4;
+constexpr uint32 NumIndices = 36;
+constexpr uint32 VertexStride = 48;
+constexpr uint32 ConstantBufferSize = 112;
+
+/** Null 백엔드는 Shader / State 핸들을 해석하지 않으므로 서로 다른 주소만 있으면 됨 */
+uint8 FakeHandles[64];
+
+template <typename T>
+T* FakeHandle(int32 Index)
+{
+	return reinterpret_cast<T*>(&FakeHandles[Index]);
+}
+
+/**
+ * Draw마다 그 시점의 바인딩 전체를 Hash에 섞는 Null 백엔드
+ * 걸러낸 경로와 모두 바인딩한 경로의 Hash가 같으면 모든 Draw가 같은 상태에서 그려진 것
+ */
+class FStateHashRHI : public FNullRHI
+{
+public:
+	FStateHashRHI()
+		: FNullRHI(false)
+	{
+	}
+
+	uint64 GetHash() const { return Hash; }
+	void ResetHash() { Hash = 0; }
+
+	virtual void SetVertexBuffer(FRHIBuffer* Buffer, uint32 Stride, uint32 Offset) override
+	{
+		State[0] = reinterpret_cast<uintptr_t>(Buffer) + Stride + Offset;
+		FNullRHI::SetVertexBuffer(Buffer, Stride, Offset);
+	}
+
+	virtual void SetIndexBuffer(FRHIBuffer* Buffer, ERHIIndexFormat Format, uint32 Offset) override
+	{
+		State[1] = reinterpret_cast<uintptr_t>(Buffer) + static_cast<uintptr_t>(Format) + Offset;
+		FNullRHI::SetIndexBuffer(Buffer, Format, Offset);
+	}
+
+	virtual void SetPrimitiveTopology(ERHIPrimitiveTopology Topology) override
+	{
+		State[2] = static_cast<uintptr_t>(Topology);
+		FNullRHI::SetPrimitiveTopology(Topology);
+	}
+
+	virtual void SetInputLayout(FRHIInputLayout* InputLayout) override
+	{
+		State[3] = reinterpret_cast<uintptr_t>(InputLayout);
+		FNullRHI::SetInputLayout(InputLayout);
+	}
+
+	virtual void SetVertexShader(FRHIVertexShader* Shader) override
+	{
+		State[4] = reinterpret_cast<uintptr_t>(Shader);
+		FNullRHI::SetVertexShader(Shader);
+	}
+
+	virtual void SetPixelShader(FRHIPixelShader* Shader) override
+	{
+		State[5] = reinterpret_cast<uintptr_t>(Shader);
+		FNullRHI::SetPixelShader(Shader);
+	}
+
+	virtual void SetConstantBuffer(ERHIShaderStage Stage, uint32 Slot, FRHIBuffer* Buffer) override
+	{
+		State[6 + (Stage == ERHIShaderStage::Pixel ? 1 : 0)] = reinterpret_cast<uintptr_t>(Buffer) + Slot;
+		FNullRHI::SetConstantBuffer(Stage, Slot, Buffer);
+	}
+
+	virtual void SetRasterizerState(FRHIRasterizerState* InState) override
+	{
+		State[8] = reinterpret_cast<uintptr_t>(InState);
+		FNullRHI::SetRasterizerState(InState);
+	}
+
+	virtual void SetBlendState(FRHIBlendState* InState, const float* BlendFactor, uint32 SampleMask) override
+	{
+		State[9] = reinterpret_cast<uintptr_t>(InState) + SampleMask;
+		FNullRHI::SetBlendState(InState, BlendFactor, SampleMask);
+	}
+
+	virtual void SetDepthStencilState(FRHIDepthStencilState* InState, uint32 StencilRef) override
+	{
+		State[10] = reinterpret_cast<uintptr_t>(InState) + StencilRef;
+		FNullRHI::SetDepthStencilState(InState, StencilRef);
+	}
+
+	virtual void DrawIndexed(uint32 IndexCount, uint32 StartIndex, int32 BaseVertex) override
+	{
+		for (const uintptr_t Value : State)
+		{
+			Hash = (Hash ^ Value) * 0x100000001b3ull;
+		}
+		FNullRHI::DrawIndexed(IndexCount, StartIndex, BaseVertex);
+	}
+
+private:
+	uintptr_t State[11] = {};
+	uint64 Hash = 0;
+};
+
+struct FFakePrimitive
+{
+	int32 Mesh;
+	int32 Material;
+};
+
+/** Material 두 개씩 Vertex Shader를 공유, Material 3은 Blend State만 다름 */
+FRHIPipelineStateDesc MakeMaterialDesc(int32 Material)
+{
+	FRHIPipelineStateDesc Desc;
+	Desc.VertexShader = FakeHandle<FRHIVertexShader>(30 + Material / 2);
+	Desc.PixelShader = FakeHandle<FRHIPixelShader>(32 + Material);
+	Desc.InputLayout = FakeHandle<FRHIInputLayout>(16);
+	Desc.RasterizerState = FakeHandle<FRHIRasterizerState>(40);
+	Desc.BlendState = FakeHandle<FRHIBlendState>(Material == 3 ? 43 : 41);
+	Desc.DepthStencilState = FakeHandle<FRHIDepthStencilState>(42);
+	return Desc;
+}
+
+struct FFakeScene
+{
+	FRHIBuffer* VertexBuffers[NumMeshes] = {};
+	FRHIBuffer* IndexBuffers[NumMeshes] = {};
+	FRHIBuffer* ConstantBuffer = nullptr;
+	FRHIPipelineStateDesc Descs[NumMaterials];
+	const FRHIPipelineState* PipelineStates[NumMaterials] = {};
+	TArray<FFakePrimitive> Primitives;
+
+	void Create(FRHICommandContext& RHI)
+	{
+		uint8 Vertices[VertexStride * 24] = {};
+		uint32 Indices[NumIndices] = {};
+		for (int32 Mesh = 0; Mesh < NumMeshes; ++Mesh)
+		{
+			VertexBuffers[Mesh] = RHI.CreateBuffer(ERHIBufferUsage::Vertex, sizeof(Vertices), false, Vertices);
+			IndexBuffers[Mesh] = RHI.CreateBuffer(ERHIBufferUsage::Index, sizeof(Indices), false, Indices);
+		}
+		ConstantBuffer = RHI.CreateBuffer(ERHIBufferUsage::Constant, ConstantBufferSize, true, nullptr);
+
+		for (int32 Material = 0; Material < NumMaterials; ++Material)
+		{
+			Descs[Material] = MakeMaterialDesc(Material);
+			PipelineStates[Material] = FRHIPipelineStateCache::Get().FindOrCreate(Descs[Material]);
+		}
+
+		// Draw 정렬 뒤와 같이 Material, Mesh 순으로 모여 있음
+		std::mt19937 Random(50);
+		std::uniform_int_distribution<int32> MeshDist(0, NumMeshes - 1);
+		std::uniform_int_distribution<int32> MaterialDist(0, NumMaterials - 1);
+		Primitives.SetNum(NumPrimitives);
+		for (FFakePrimitive& Primitive : Primitives)
+		{
+			Primitive = { MeshDist(Random), MaterialDist(Random) };
+		}
+		std::sort(Primitives.begin(), Primitives.end(), [](const FFakePrimitive& A, const FFakePrimitive& B)
+		{
+			return A.Material != B.Material ? A.Material < B.Material : A.Mesh < B.Mesh;
+		});
+	}
+
+	void Release(FRHICommandContext& RHI)
+	{
+		for (int32 Mesh = 0; Mesh < NumMeshes; ++Mesh)
+		{
+			RHI.ReleaseBuffer(VertexBuffers[Mesh]);
+			RHI.ReleaseBuffer(IndexBuffers[Mesh]);
+		}
+		RHI.ReleaseBuffer(ConstantBuffer);
+	}
+
+	/** 예전 FRenderResourceCollection::Render, Draw마다 Mesh / Layout / Material State를 하나씩 전부 바인딩 */
+	void SubmitLegacy(FRHICommandContext& RHI) const
+	{
+		float Constants[ConstantBufferSize / sizeof(float)] = {};
+		for (const FFakePrimitive& Primitive : Primitives)
+		{
+			const FRHIPipelineStateDesc& Desc = Descs[Primitive.Material];
+			RHI.SetVertexBuffer(VertexBuffers[Primitive.Mesh], VertexStride, 0);
+			RHI.SetPrimitiveTopology(Desc.Topology);
+			RHI.SetIndexBuffer(IndexBuffers[Primitive.Mesh], ERHIIndexFormat::UInt32, 0);
+			RHI.SetInputLayout(Desc.InputLayout);
+			RHI.SetVertexShader(Desc.VertexShader);
+			RHI.SetRasterizerState(Desc.RasterizerState);
+			RHI.SetPixelShader(Desc.PixelShader);
+			RHI.SetBlendState(Desc.BlendState, nullptr, Desc.SampleMask);
+			RHI.SetDepthStencilState(Desc.DepthStencilState, Desc.StencilRef);
+
+			Constants[0] = static_cast<float>(Primitive.Mesh);
+			RHI.UpdateBuffer(ConstantBuffer, Constants, ConstantBufferSize);
+			RHI.SetConstantBuffer(ERHIShaderStage::Vertex, 0, ConstantBuffer);
+			RHI.SetConstantBuffer(ERHIShaderStage::Pixel, 0, ConstantBuffer);
+			RHI.DrawIndexed(NumIndices, 0, 0);
+		}
+	}
+
+	/** 지금 FRenderResourceCollection::Render, Vertex / Index Buffer + PSO */
+	void SubmitPipelineState(FRHICommandContext& RHI) const
+	{
+		float Constants[ConstantBufferSize / sizeof(float)] = {};
+		for (const FFakePrimitive& Primitive : Primitives)
+		{
+			RHI.SetVertexBuffer(VertexBuffers[Primitive.Mesh], VertexStride, 0);
+			RHI.SetIndexBuffer(IndexBuffers[Primitive.Mesh], ERHIIndexFormat::UInt32, 0);
+			RHI.SetPipelineState(*PipelineStates[Primitive.Material]);
+
+			Constants[0] = static_cast<float>(Primitive.Mesh);
+			RHI.UpdateBuffer(ConstantBuffer, Constants, ConstantBufferSize);
+			RHI.SetConstantBuffer(ERHIShaderStage::Vertex, 0, ConstantBuffer);
+			RHI.SetConstantBuffer(ERHIShaderStage::Pixel, 0, ConstantBuffer);
+			RHI.DrawIndexed(NumIndices, 0, 0);
+		}
+	}
+};
+
+struct FSubmitResult
+{
+	double Ms = 0.0;
+	uint64 BackendBinds = 0;
+	uint64 FilteredBinds = 0;
+	uint64 StateHash = 0;
+};
+
+/** Submit을 RHI로 제출, Backend는 RHI 안쪽 (또는 RHI 자체)의 FStateHashRHI */
+template <typename SubmitType>
+FSubmitResult Measure(FRHICommandContext& RHI, FStateHashRHI& Backend, FRHIStateTrackingContext* Tracking, const SubmitType& Submit)
+{
+	FSubmitResult Result;
+	Result.Ms = BenchmarkUtils::MeasureBestMs([&]
+	{
+		Backend.ResetStats();
+		Backend.ResetHash();
+		Submit(RHI);
+		RHI.EndFrame();
+	});
+	Result.BackendBinds = Backend.GetStats().NumStateChanges;
+	Result.FilteredBinds = Tracking != nullptr ? Tracking->GetLastFrameFilteredBinds() : 0;
+	Result.StateHash = Backend.GetHash();
+	return Result;
+}
+
+/** 모두 바인딩 / 개별 Set* + 걸러내기 / PSO + 걸러내기를 비교하고, 모든 Draw의 상태가 같은지와 PSO Cache 중복 제거를 확인 */
+void BenchmarkPipelineState()
+{
+	// Tracking.EndFrame이 전역 Filtered Binds Counter에 더하므로 끝나면 되돌림
+	FScopedStatCounterRestore RestoreStats;
+
+	FRHIStateTrackingContext Tracking(std::make_unique<FStateHashRHI>());
+	FStateHashRHI& Backend = static_cast<FStateHashRHI&>(Tracking.GetInner());
+	FFakeScene Scene;
+	Scene.Create(Tracking);
+
+	const auto SubmitLegacy = [&](FRHICommandContext& RHI) { Scene.SubmitLegacy(RHI); };
+	const auto SubmitPipelineState = [&](FRHICommandContext& RHI) { Scene.SubmitPipelineState(RHI); };
+	const FSubmitResult Legacy = Measure(Backend, Backend, nullptr, SubmitLegacy);
+	const FSubmitResult DirectPipelineState = Measure(Backend, Backend, nullptr, SubmitPipelineState);
+	const FSubmitResult LegacyFiltered = Measure(Tracking, Backend, &Tracking, SubmitLegacy);
+	const FSubmitResult PipelineState = Measure(Tracking, Backend, &Tracking, SubmitPipelineState);
+
+	// 걸러낸 바인딩이 있어도 모든 Draw 시점의 상태가 모두 바인딩한 것과 같아야 함
+	const bool bStateMatches =
+		Legacy.StateHash == DirectPipelineState.StateHash
+		&& Legacy.StateHash == LegacyFiltered.StateHash
+		&& Legacy.StateHash == PipelineState.StateHash;
+
+	// 같은 Desc는 같은 PSO, 하나만 달라도 다른 PSO
+	FRHIPipelineStateCache& Cache = FRHIPipelineStateCache::Get();
+	const int32 NumBefore = Cache.Num();
+	bool bCacheDedups = Cache.FindOrCreate(MakeMaterialDesc(0)) == Scene.PipelineStates[0] && Cache.Num() == NumBefore;
+	FRHIPipelineStateDesc Changed = MakeMaterialDesc(0);
+	Changed.StencilRef = 1;
+	const FRHIPipelineState* ChangedState = Cache.FindOrCreate(Changed);
+	bCacheDedups &= ChangedState != Scene.PipelineStates[0] && Cache.FindOrCreate(Changed) == ChangedState;
+
+	Scene.Release(Tracking);
+
+	UE_LOG("[Bench] pso: %d primitives, %d meshes x %d materials, sorted by material / mesh", NumPrimitives, NumMeshes, NumMaterials);
+	for (const auto& [Name, Result] : {
+		std::pair{ "legacy (all binds)", &Legacy }, std::pair{ "pso (all binds)", &DirectPipelineState },
+		std::pair{ "legacy + filter", &LegacyFiltered }, std::pair{ "pso + filter", &PipelineState } })
+	{
+		UE_LOG(
+			"[Bench]   %-20s : %8.3f ms, %7llu binds reach backend (%.2f per draw), %7llu filtered", Name, Result->Ms,
+			Result->BackendBinds, static_cast<double>(Result->BackendBinds) / NumPrimitives, Result->FilteredBinds
+		);
+	}
+	UE_LOG(
+		"[Bench]   backend binds x%.1f fewer, draw state %s, pso cache %d entries (dedup %s)",
+		static_cast<double>(Legacy.BackendBinds) / static_cast<double>(std::max<uint64>(1, PipelineState.BackendBinds)),
+		bStateMatches ? "OK" : "MISMATCH", Cache.Num(), bCacheDedups ? "OK" : "FAILED"
+	);
+}
+}
+
+REGISTER_BENCHMARK("pso", "Pipeline state objects + redundant state filtering vs per-draw individual binds on a sorted 20k scene", BenchmarkPipelineState);
@@ -0,0 +1,127 @@
+#include <string>
+
+#include "Benchmark.h"
+#include "Core/Stats/Stats.h"
+#include "Debug/DebugConsole.h"
+
+
+namespace
+{
+constexpr int32 NumOverheadScopes = 1'000'000;
+constexpr int32 NumTraceFrames = 4;
+constexpr int32 NumInnerScopesPerFrame = 100;
+
+FORCENOINLINE void ScopedWork(volatile uint64& Sink)
+{
+	SCOPE_CYCLE_COUNTER("Bench Scope");
+	Sink = Sink + 1;
+}
+
+FORCENOINLINE void PlainWork(volatile uint64& Sink)
+{
+	Sink = Sink + 1;
+}
+
+/** Scope 하나의 비용 (켜짐 / 꺼짐)과, 프레임으로 잘라 Capture / 내보내기한 결과가 기록과 맞는지 */
+void BenchmarkProfiler()
+{
+	FProfiler& Profiler = FProfiler::Get();
+	const bool bWasEnabled = FProfiler::IsEnabled();
+	volatile uint64 Sink = 0;
+
+	const double PlainMs = BenchmarkUtils::MeasureBestMs([&]
+	{
+		for (int32 Index = 0; Index < NumOverheadScopes; ++Index)
+		{
+			PlainWork(Sink);
+		}
+	}, 3);
+
+	Profiler.SetEnabled(true);
+	const double EnabledMs = BenchmarkUtils::MeasureBestMs([&]
+	{
+		for (int32 Index = 0; Index < NumOverheadScopes; ++Index)
+		{
+			ScopedWork(Sink);
+		}
+	}, 3);
+
+	Profiler.SetEnabled(false);
+	const double DisabledMs = BenchmarkUtils::MeasureBestMs([&]
+	{
+		for (int32 Index = 0; Index < NumOverheadScopes; ++Index)
+		{
+			ScopedWork(Sink);
+		}
+	}, 3);
+
+	UE_LOG(
+		"[Bench] profiler: %d scopes: no scope %.3f ms, enabled %.3f ms (%.1f ns/scope), disabled %.3f ms (%.1f ns/scope)",
+		NumOverheadScopes, PlainMs, EnabledMs, (EnabledMs - PlainMs) * 1e6 / NumOverheadScopes,
+		DisabledMs, (DisabledMs - PlainMs) * 1e6 / NumOverheadScopes
+	);
+
+	// 실제 프레임 사이에 가짜 프레임 경계를 끼워 넣으므로 Flame View에서 잠깐 짧은 프레임으로 보임
+	Profiler.SetEnabled(true);
+	for (int32 Frame = 0; Frame < NumTraceFrames; ++Frame)
+	{
+		PROFILER_FRAME_MARKER();
+		SCOPE_CYCLE_COUNTER("Bench Outer");
+		for (int32 Index = 0; Index < NumInnerScopesPerFrame; ++Index)
+		{
+			SCOPE_CYCLE_COUNTER("Bench Inner");
+			Sink = Sink + 1;
+		}
+	}
+	PROFILER_FRAME_MARKER();
+
+	FProfilerCapture Capture;
+	const int32 NumFrames = Profiler.Capture(NumTraceFrames, Capture);
+
+	int32 NumOuter = 0;
+	int32 NumInner = 0;
+	int32 NumMisnested = 0;
+	int32 NumEvents = 0;
+	const FProfilerEvent* CurrentOuter = nullptr;
+	for (const FProfilerCapture::FThread& Thread : Capture.Threads)
+	{
+		NumEvents += Thread.Events.Num();
+		for (const FProfilerEvent& Event : Thread.Events)
+		{
+			if (std::string(Event.Name) == "Bench Outer")
+			{
+				++NumOuter;
+				CurrentOuter = &Event;
+			}
+			else if (std::string(Event.Name) == "Bench Inner")
+			{
+				++NumInner;
+				const bool bNested = CurrentOuter != nullptr && Event.Depth == CurrentOuter->Depth + 1
+					&& Event.StartCycles >= CurrentOuter->StartCycles && Event.EndCycles <= CurrentOuter->EndCycles;
+				NumMisnested += bNested ? 0 : 1;
+			}
+		}
+	}
+
+	const std::string Json = *FProfiler::ToChromeTraceJson(Capture);
+	int32 NumJsonEvents = 0;
+	for (size_t Offset = Json.find("\"ph\":\"X\""); Offset != std::string::npos; Offset = Json.find("\"ph\":\"X\"", Offset + 1))
+	{
+		++NumJsonEvents;
+	}
+
+	const double ExportMs = BenchmarkUtils::MeasureBestMs([&]
+	{
+		FProfiler::ToChromeTraceJson(Capture);
+	}, 3);
+
+	UE_LOG(
+		"[Bench] profiler: captured %d frames: %d/%d outer, %d/%d inner scopes, %d misnested, %d events -> %d trace events (%d bytes, %.3f ms)",
+		NumFrames, NumOuter, NumTraceFrames, NumInner, NumTraceFrames * NumInnerScopesPerFrame, NumMisnested, NumEvents, NumJsonEvents, static_cast<int32>(Json.size()), ExportMs
+	);
+
+	Profiler.SetEnabled(bWasEnabled);
+}
+}
+
+REGISTER_BENCHMARK("profiler", "SCOPE_CYCLE_COUNTER cost per scope, and frame capture / Chrome trace export round trip", BenchmarkProfiler);
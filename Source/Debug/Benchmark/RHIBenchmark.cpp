@@ -0,0 +1,124 @@
+#include "Benchmark.h"
+#include "Core/RHI/NullRHI.h"
+#include "Core/RHI/RHICommandLog.h"
+#include "Debug/DebugConsole.h"
+
+
+namespace
+{
+constexpr int32 NumPrimitives = 100'000;
+constexpr uint32 NumIndices = 36;           // Cube
+constexpr uint32 VertexStride = 48;         // FVertexSimple
+constexpr uint32 ConstantBufferSize = 112;  // MVP + Color + bUseVertexColor 정도
+
+// Shader, State 핸들은 Null 백엔드에서 해석하지 않으므로 서로 다른 주소만 있으면 됩니다.
+uint8 FakeHandles[8];
+
+template <typename T>
+T* FakeHandle(int32 Index)
+{
+	return reinterpret_cast<T*>(&FakeHandles[Index]);
+}
+
+/**
+ * FRenderResourceCollection::Render와 같은 순서로 NumPrimitives개를 제출합니다.
+ * (Mesh → Layout → Material → Constant Buffer → Draw)
+ */
+void SubmitPrimitives(FRHICommandContext& RHI)
+{
+	uint8 Vertices[VertexStride * 24] = {};
+	uint32 Indices[NumIndices] = {};
+	FRHIBuffer* VertexBuffer = RHI.CreateBuffer(ERHIBufferUsage::Vertex, sizeof(Vertices), false, Vertices);
+	FRHIBuffer* IndexBuffer = RHI.CreateBuffer(ERHIBufferUsage::Index, sizeof(Indices), false, Indices);
+	FRHIBuffer* ConstantBuffer = RHI.CreateBuffer(ERHIBufferUsage::Constant, ConstantBufferSize, true, nullptr);
+
+	float Constants[ConstantBufferSize / sizeof(float)] = {};
+	for (int32 Index = 0; Index < NumPrimitives; ++Index)
+	{
+		Constants[0] = static_cast<float>(Index);
+
+		RHI.SetVertexBuffer(VertexBuffer, VertexStride, 0);
+		RHI.SetPrimitiveTopology(ERHIPrimitiveTopology::TriangleList);
+		RHI.SetIndexBuffer(IndexBuffer, ERHIIndexFormat::UInt32, 0);
+		RHI.SetInputLayout(FakeHandle<FRHIInputLayout>(0));
+
+		RHI.SetVertexShader(FakeHandle<FRHIVertexShader>(1));
+		RHI.SetPixelShader(FakeHandle<FRHIPixelShader>(2));
+		RHI.SetRasterizerState(FakeHandle<FRHIRasterizerState>(3));
+		RHI.SetBlendState(FakeHandle<FRHIBlendState>(4), nullptr, 0xffffffff);
+		RHI.SetDepthStencilState(FakeHandle<FRHIDepthStencilState>(5), 0);
+
+		RHI.UpdateBuffer(ConstantBuffer, Constants, ConstantBufferSize);
+		RHI.SetConstantBuffer(ERHIShaderStage::Vertex, 0, ConstantBuffer);
+		RHI.SetConstantBuffer(ERHIShaderStage::Pixel, 0, ConstantBuffer);
+
+		RHI.DrawIndexed(NumIndices, 0, 0);
+	}
+
+	RHI.ReleaseBuffer(ConstantBuffer);
+	RHI.ReleaseBuffer(IndexBuffer);
+	RHI.ReleaseBuffer(VertexBuffer);
+}
+
+void LogResult(const char* Name, double Ms)
+{
+	UE_LOG("[Bench]   %-22s : %8.3f ms (%.1f ns/primitive)", Name, Ms, Ms * 1.0e6 / NumPrimitives);
+}
+
+void BenchmarkRHI()
+{
+	UE_LOG("[Bench] RHI submission, %d primitives (13 calls each) on the null backend", NumPrimitives);
+
+	// 1. 검증 없이 (순수 가상 호출 + Constant Buffer 복사 비용)
+	FNullRHI NoValidate(false);
+	const double NoValidateMs = BenchmarkUtils::MeasureBestMs([&] { SubmitPrimitives(NoValidate); });
+	LogResult("null", NoValidateMs);
+
+	// 2. 바인딩/핸들 검증
+	FNullRHI Validate(true);
+	const double ValidateMs = BenchmarkUtils::MeasureBestMs([&]
+	{
+		Validate.ResetStats();
+		SubmitPrimitives(Validate);
+	});
+	LogResult("null + validate", ValidateMs);
+
+	// 3. 명령 기록 (Decorator)
+	FRHICommandLog Log;
+	FRHIRecordingContext Recording(std::make_unique<FNullRHI>(false), &Log);
+	const double RecordMs = BenchmarkUtils::MeasureBestMs([&]
+	{
+		Log.Empty();
+		SubmitPrimitives(Recording);
+	});
+	LogResult("null + record", RecordMs);
+
+	// 4. 기록한 명령을 검증 백엔드로 다시 실행
+	FNullRHI ReplayTarget(true);
+	const double ReplayMs = BenchmarkUtils::MeasureBestMs([&]
+	{
+		ReplayTarget.ResetStats();
+		Log.Replay(ReplayTarget);
+	});
+	LogResult("replay + validate", ReplayMs);
+
+	const FNullRHI::FStats& Stats = Validate.GetStats();
+	const FNullRHI::FStats& ReplayStats = ReplayTarget.GetStats();
+	const bool bReplayMatches =
+		ReplayStats.NumDrawCalls == Stats.NumDrawCalls
+		&& ReplayStats.NumStateChanges == Stats.NumStateChanges
+		&& ReplayStats.UploadedBytes == Stats.UploadedBytes;
+
+	UE_LOG(
+		"[Bench]   draws %llu, state changes %llu, uploaded %.2f MB, errors %llu",
+		Stats.NumDrawCalls, Stats.NumStateChanges, Stats.UploadedBytes / (1024.0 * 1024.0), Stats.NumErrors
+	);
+	UE_LOG(
+		"[Bench]   command log %d commands, %.2f MB, replay %s",
+		Log.Num(), Log.GetMemorySize() / (1024.0 * 1024.0),
+		bReplayMatches && ReplayStats.NumErrors == 0 ? "OK" : "FAILED"
+	);
+}
+}
+
+REGISTER_BENCHMARK("rhi", "CPU submission cost of 100k primitives through the null RHI", BenchmarkRHI);
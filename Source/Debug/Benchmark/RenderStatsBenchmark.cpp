@@ -0,0 +1,108 @@
+#include "Benchmark.h"
+#include "Core/RHI/NullRHI.h"
+#include "Core/RHI/RHIStatsContext.h"
+#include "Core/Stats/StatCounter.h"
+#include "Debug/DebugConsole.h"
+
+
+namespace
+{
+constexpr int32 NumPrimitives = 100'000;
+constexpr uint32 NumIndices = 36;           // Cube
+constexpr uint32 VertexStride = 48;         // FVertexSimple
+constexpr uint32 ConstantBufferSize = 112;
+
+/** 프리미티브 하나마다 부르는 Set* 호출 수 (SubmitPrimitives) */
+constexpr uint64 BindsPerPrimitive = 11;
+
+uint8 FakeHandles[8];
+
+template <typename T>
+T* FakeHandle(int32 Index)
+{
+	return reinterpret_cast<T*>(&FakeHandles[Index]);
+}
+
+/**
+ * RHIBenchmark와 같은 제출 순서, 모든 프리미티브가 같은 Mesh / Shader / State를 쓰므로
+ * 첫 프리미티브 뒤의 바인딩은 전부 중복이어야 합니다.
+ */
+void SubmitPrimitives(FRHICommandContext& RHI)
+{
+	uint8 Vertices[VertexStride * 24] = {};
+	uint32 Indices[NumIndices] = {};
+	FRHIBuffer* VertexBuffer = RHI.CreateBuffer(ERHIBufferUsage::Vertex, sizeof(Vertices), false, Vertices);
+	FRHIBuffer* IndexBuffer = RHI.CreateBuffer(ERHIBufferUsage::Index, sizeof(Indices), false, Indices);
+	FRHIBuffer* ConstantBuffer = RHI.CreateBuffer(ERHIBufferUsage::Constant, ConstantBufferSize, true, nullptr);
+
+	float Constants[ConstantBufferSize / sizeof(float)] = {};
+	for (int32 Index = 0; Index < NumPrimitives; ++Index)
+	{
+		Constants[0] = static_cast<float>(Index);
+
+		RHI.SetVertexBuffer(VertexBuffer, VertexStride, 0);
+		RHI.SetPrimitiveTopology(ERHIPrimitiveTopology::TriangleList);
+		RHI.SetIndexBuffer(IndexBuffer, ERHIIndexFormat::UInt32, 0);
+		RHI.SetInputLayout(FakeHandle<FRHIInputLayout>(0));
+
+		RHI.SetVertexShader(FakeHandle<FRHIVertexShader>(1));
+		RHI.SetPixelShader(FakeHandle<FRHIPixelShader>(2));
+		RHI.SetRasterizerState(FakeHandle<FRHIRasterizerState>(3));
+		RHI.SetBlendState(FakeHandle<FRHIBlendState>(4), nullptr, 0xffffffff);
+		RHI.SetDepthStencilState(FakeHandle<FRHIDepthStencilState>(5), 0);
+
+		RHI.UpdateBuffer(ConstantBuffer, Constants, ConstantBufferSize);
+		RHI.SetConstantBuffer(ERHIShaderStage::Vertex, 0, ConstantBuffer);
+		RHI.SetConstantBuffer(ERHIShaderStage::Pixel, 0, ConstantBuffer);
+
+		RHI.DrawIndexed(NumIndices, 0, 0);
+	}
+
+	RHI.ReleaseBuffer(ConstantBuffer);
+	RHI.ReleaseBuffer(IndexBuffer);
+	RHI.ReleaseBuffer(VertexBuffer);
+}
+
+/** Null 백엔드 그대로 / FRHIStatsContext로 감싼 것을 비교하고, 센 값이 제출한 양과 맞는지 확인 */
+void BenchmarkRenderStats()
+{
+	// Stats.EndFrame이 전역 RHI Counter에 더하므로, 끝나면 Engine의 실제 프레임 값으로 되돌림
+	FScopedStatCounterRestore RestoreStats;
+
+	FNullRHI Null(false);
+	const double NullMs = BenchmarkUtils::MeasureBestMs([&] { SubmitPrimitives(Null); });
+
+	FRHIStatsContext Stats(std::make_unique<FNullRHI>(false));
+	const double StatsMs = BenchmarkUtils::MeasureBestMs([&]
+	{
+		SubmitPrimitives(Stats);
+		Stats.EndFrame();
+	});
+
+	// EndFrame 직후이므로 LastFrame = 마지막 한 번의 제출
+	const FRHIFrameStats& Frame = Stats.GetLastFrameStats();
+	const uint64 ExpectedBinds = NumPrimitives * BindsPerPrimitive;
+	const uint64 ExpectedRedundant = (NumPrimitives - 1) * BindsPerPrimitive;
+	const bool bMatches =
+		Frame.NumDrawCalls == NumPrimitives
+		&& Frame.NumPrimitives == static_cast<uint64>(NumPrimitives) * (NumIndices / 3)
+		&& Frame.GetTotalBinds() == ExpectedBinds
+		&& Frame.GetTotalRedundantBinds() == ExpectedRedundant
+		&& Frame.NumBufferUpdates == NumPrimitives
+		&& Frame.UploadedBytes == static_cast<uint64>(NumPrimitives) * ConstantBufferSize;
+
+	UE_LOG("[Bench] renderstats: %d primitives on the null backend", NumPrimitives);
+	UE_LOG("[Bench]   %-22s : %8.3f ms (%.1f ns/primitive)", "null", NullMs, NullMs * 1.0e6 / NumPrimitives);
+	UE_LOG(
+		"[Bench]   %-22s : %8.3f ms (%.1f ns/primitive, +%.1f%%)", "null + stats", StatsMs, StatsMs * 1.0e6 / NumPrimitives,
+		NullMs > 0.0 ? (StatsMs / NullMs - 1.0) * 100.0 : 0.0
+	);
+	UE_LOG(
+		"[Bench]   draws %llu, primitives %llu, binds %llu (redundant %llu), buffer maps %llu, uploaded %.2f MB: %s",
+		Frame.NumDrawCalls, Frame.NumPrimitives, Frame.GetTotalBinds(), Frame.GetTotalRedundantBinds(),
+		Frame.NumBufferUpdates, Frame.UploadedBytes / (1024.0 * 1024.0), bMatches ? "OK" : "MISMATCH"
+	);
+}
+}
+
+REGISTER_BENCHMARK("renderstats", "Overhead and accuracy of the render stat counters (FRHIStatsContext) for 100k primitives", BenchmarkRenderStats);
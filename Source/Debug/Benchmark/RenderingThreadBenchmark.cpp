@@ -0,0 +1,97 @@
+#include <chrono>
+
+#include "Benchmark.h"
+#include "Core/Rendering/RenderingThread.h"
+#include "Debug/DebugConsole.h"
+
+
+namespace
+{
+constexpr int32 NumFrames = 240;
+constexpr double GameWorkMs = 2.0;
+constexpr double RenderWorkMs = 1.5;
+constexpr int32 CommandsPerFrame = 1000;
+
+// 주어진 시간 동안 CPU를 사용하는 가짜 작업
+void SpinFor(double Ms)
+{
+	const auto End = std::chrono::steady_clock::now() + std::chrono::duration<double, std::milli>(Ms);
+	volatile uint32 Sink = 0;
+	while (std::chrono::steady_clock::now() < End)
+	{
+		for (uint32 Iter = 0; Iter < 256; ++Iter)
+		{
+			Sink = Sink * 1664525u + 1013904223u;
+		}
+	}
+}
+
+/** Game Work + Render Command 기록을 NumFrames번 반복하고 프레임당 시간을 반환합니다. */
+double RunFrames(FRenderingThread& RenderingThread, double& OutAvgWaitMs)
+{
+	OutAvgWaitMs = 0.0;
+	const auto Start = std::chrono::steady_clock::now();
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		SpinFor(GameWorkMs);
+
+		// Null Backend: Draw Call 하나당 고정 비용을 나눠서 기록
+		for (int32 Index = 0; Index < CommandsPerFrame; ++Index)
+		{
+			const uint32 DrawIndex = static_cast<uint32>(Index);
+			ENQUEUE_RENDER_COMMAND([DrawIndex]
+			{
+				BenchmarkUtils::DoNotOptimize(DrawIndex);
+			});
+		}
+		ENQUEUE_RENDER_COMMAND([] { SpinFor(RenderWorkMs); });
+
+		RenderingThread.EndFrame();
+		OutAvgWaitMs += RenderingThread.GetGameThreadWaitMs();
+	}
+	RenderingThread.Flush();
+
+	OutAvgWaitMs /= NumFrames;
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - Start).count() / NumFrames;
+}
+
+void BenchmarkRenderingThread()
+{
+	FRenderingThread& RenderingThread = FRenderingThread::Get();
+	const bool bWasRunning = RenderingThread.IsRunning();
+	const bool bWasThreaded = RenderingThread.IsThreaded();
+	const int32 OriginalFrameLag = RenderingThread.GetMaxFrameLag();
+	RenderingThread.Stop();
+
+	UE_LOG(
+		"[Bench] %d frames, game %.2f ms + render %.2f ms (+%d null draw commands) per frame",
+		NumFrames, GameWorkMs, RenderWorkMs, CommandsPerFrame
+	);
+
+	// 1. 기존 방식: 한 스레드에서 Game → Render 순서대로
+	double WaitMs = 0.0;
+	RenderingThread.Start(0, false);
+	const double SerialMs = RunFrames(RenderingThread, WaitMs);
+	RenderingThread.Stop();
+	UE_LOG("[Bench] Serial (inline)    : %.3f ms/frame", SerialMs);
+
+	// 2. Render Thread, Frame Lag별
+	for (int32 FrameLag = 0; FrameLag <= 2; ++FrameLag)
+	{
+		RenderingThread.Start(FrameLag, true);
+		const double PipelinedMs = RunFrames(RenderingThread, WaitMs);
+		RenderingThread.Stop();
+		UE_LOG(
+			"[Bench] Render Thread lag %d : %.3f ms/frame (x%.2f), fence wait %.3f ms/frame",
+			FrameLag, PipelinedMs, SerialMs / PipelinedMs, WaitMs
+		);
+	}
+
+	if (bWasRunning)
+	{
+		RenderingThread.Start(OriginalFrameLag, bWasThreaded);
+	}
+}
+}
+
+REGISTER_BENCHMARK("renderthread", "Serial vs pipelined game/render frames with a null backend", BenchmarkRenderingThread);
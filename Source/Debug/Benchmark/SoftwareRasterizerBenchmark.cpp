@@ -0,0 +1,101 @@
+#include "Benchmark.h"
+#include "Core/Math/MathUtility.h"
+#include "Core/Rendering/Software/SoftwareRasterizer.h"
+#include "Debug/DebugConsole.h"
+#include "Primitive/PrimitiveVertices.h"
+#include "Primitive/UGeometryGenerator.h"
+
+
+namespace
+{
+constexpr uint32 TargetWidth = 1280;
+constexpr uint32 TargetHeight = 720;
+
+/** GridSize^3개의 Cube를 카메라 앞에 배치해서 그립니다. */
+void DrawCubeGrid(FSoftwareRasterizer& Rasterizer, const TArray<FVertexSimple>& Vertices, const TArray<uint32>& Indices, int32 GridSize)
+{
+	const FMatrix ViewProjection =
+		FMatrix::LookAtLH(FVector(-12.0f, -6.0f, 6.0f), FVector(0.0f, 0.0f, 0.0f), FVector(0.0f, 0.0f, 1.0f))
+		* FMatrix::PerspectiveFovLH(FMath::DegreesToRadians(60.0f), static_cast<float>(TargetWidth) / TargetHeight, 0.1f, 100.0f);
+
+	const float Spacing = 8.0f / static_cast<float>(GridSize);
+	const float Scale = Spacing * 0.6f;
+
+	FSoftwareDrawState State;
+	for (int32 Z = 0; Z < GridSize; ++Z)
+	{
+		for (int32 Y = 0; Y < GridSize; ++Y)
+		{
+			for (int32 X = 0; X < GridSize; ++X)
+			{
+				const FVector Position = FVector(static_cast<float>(X), static_cast<float>(Y), static_cast<float>(Z)) * Spacing - FVector(4.0f, 4.0f, 4.0f);
+				State.MVP = FMatrix::GetScaleMatrix(Scale, Scale, Scale) * FMatrix::GetTranslateMatrix(Position) * ViewProjection;
+				State.UUID = static_cast<uint32>((Z * GridSize + Y) * GridSize + X + 1);
+				State.bUseVertexColor = (X + Y + Z) % 2 == 0;
+				State.Color = FVector4(0.2f, 0.6f, 1.0f, 1.0f);
+				Rasterizer.DrawIndexedTriangles<FVertexSimple>(Vertices, Indices, State);
+			}
+		}
+	}
+}
+
+void BenchmarkSoftwareRasterizer()
+{
+	TArray<FVertexSimple> Vertices;
+	TArray<uint32> Indices;
+	UGeometryGenerator::CreateCube(1.0f, Vertices, Indices);
+	const int32 TrianglesPerCube = Indices.Num() / 3;
+
+	UE_LOG("[Bench] Software rasterizer, %ux%u, %d tiles of %d px", TargetWidth, TargetHeight,
+		((TargetWidth + FSoftwareRasterizer::TileSize - 1) / FSoftwareRasterizer::TileSize)
+		* ((TargetHeight + FSoftwareRasterizer::TileSize - 1) / FSoftwareRasterizer::TileSize),
+		FSoftwareRasterizer::TileSize);
+
+	FSoftwareRasterizer Rasterizer(TargetWidth, TargetHeight);
+	FSoftwareImage FirstImage;
+
+	for (const int32 GridSize : {4, 10, 22, 47})
+	{
+		const int32 NumCubes = GridSize * GridSize * GridSize;
+		const int32 NumTriangles = NumCubes * TrianglesPerCube;
+
+		double SubmitMs = 0.0;
+		double FlushMs = 0.0;
+		const double TotalMs = BenchmarkUtils::MeasureBestMs([&]
+		{
+			Rasterizer.Clear(FVector4(0.025f, 0.025f, 0.025f, 1.0f));
+			Rasterizer.ResetStats();
+
+			const auto Start = std::chrono::steady_clock::now();
+			DrawCubeGrid(Rasterizer, Vertices, Indices, GridSize);
+			const auto Submitted = std::chrono::steady_clock::now();
+			Rasterizer.Flush();
+			const auto End = std::chrono::steady_clock::now();
+
+			SubmitMs = std::chrono::duration<double, std::milli>(Submitted - Start).count();
+			FlushMs = std::chrono::duration<double, std::milli>(End - Submitted).count();
+		}, 3);
+
+		const FSoftwareRasterizer::FStats& Stats = Rasterizer.GetStats();
+		UE_LOG(
+			"[Bench]   %6d tris : %8.3f ms (submit %.3f, raster %.3f), %.1f ns/tri, %.1f Mpix, culled %llu",
+			NumTriangles, TotalMs, SubmitMs, FlushMs, TotalMs * 1.0e6 / NumTriangles,
+			Stats.NumShadedPixels / 1.0e6, Stats.NumCulledTriangles
+		);
+
+		if (GridSize == 4)
+		{
+			FirstImage = Rasterizer.ResolveColor();
+		}
+	}
+
+	// 같은 장면을 다시 그려서 결과가 항상 같은지 (Golden Image 비교의 전제) 확인
+	Rasterizer.Clear(FVector4(0.025f, 0.025f, 0.025f, 1.0f));
+	DrawCubeGrid(Rasterizer, Vertices, Indices, 4);
+	Rasterizer.Flush();
+	const FSoftwareImage::FDiff Diff = FSoftwareImage::Compare(FirstImage, Rasterizer.ResolveColor());
+	UE_LOG("[Bench]   deterministic output: %s", Diff.IsIdentical() ? "OK" : "FAILED");
+}
+}
+
+REGISTER_BENCHMARK("raster", "CPU software rasterizer cost per triangle count (tiled, SIMD, job system)", BenchmarkSoftwareRasterizer);
@@ -0,0 +1,229 @@
+#include <algorithm>
+#include <cstdio>
+#include <random>
+
+#include "Benchmark.h"
+#include "Core/Math/LooseOctree.h"
+#include "Core/Math/Matrix.h"
+#include "Core/Math/SpatialHashGrid.h"
+#include "Debug/DebugConsole.h"
+
+
+namespace
+{
+constexpr int32 NumElements = 100'000;
+constexpr int32 NumQueries = 10'000;
+constexpr int32 NumVerifiedQueries = 200;
+constexpr int32 NumNearest = 8;
+constexpr float WorldSize = 1000.0f;
+constexpr float QueryRadius = 10.0f;
+
+/** 고른 분포, 또는 작은 구역 50개에 몰린 분포 */
+TArray<FBox> MakeBoxes(bool bClustered, std::mt19937& Random)
+{
+	std::uniform_real_distribution<float> Position(0.0f, WorldSize);
+	std::uniform_real_distribution<float> HalfSize(0.25f, 2.5f);
+	std::normal_distribution<float> ClusterOffset(0.0f, 15.0f);
+
+	TArray<FVector> ClusterCenters;
+	for (int32 Index = 0; Index < 50; ++Index)
+	{
+		ClusterCenters.Add(FVector(Position(Random), Position(Random), Position(Random)));
+	}
+
+	TArray<FBox> Boxes;
+	Boxes.SetNum(NumElements);
+	for (int32 Index = 0; Index < NumElements; ++Index)
+	{
+		FVector Center;
+		if (bClustered)
+		{
+			Center = ClusterCenters[Index % ClusterCenters.Num()] + FVector(ClusterOffset(Random), ClusterOffset(Random), ClusterOffset(Random));
+		}
+		else
+		{
+			Center = FVector(Position(Random), Position(Random), Position(Random));
+		}
+		const FVector Extent(HalfSize(Random), HalfSize(Random), HalfSize(Random));
+		Boxes[Index] = FBox(Center - Extent, Center + Extent);
+	}
+	return Boxes;
+}
+
+/** 결과 Id를 원래 Box 번호로 바꿔 정렬 (순서와 관계없이 비교) */
+void ToSortedIndices(const FSpatialIndex& Index, const TArray<int32>& Ids, TArray<int32>& OutIndices)
+{
+	OutIndices.SetNum(Ids.Num());
+	for (int32 Position = 0; Position < Ids.Num(); ++Position)
+	{
+		OutIndices[Position] = static_cast<int32>(reinterpret_cast<intptr_t>(Index.GetUserData(Ids[Position])));
+	}
+	std::sort(OutIndices.GetData(), OutIndices.GetData() + OutIndices.Num());
+}
+
+bool IsSame(const TArray<int32>& A, const TArray<int32>& B)
+{
+	return A.Num() == B.Num() && std::equal(A.GetData(), A.GetData() + A.Num(), B.GetData());
+}
+
+void BenchmarkSpatialIndex(FSpatialIndex& Index, const char* Label, const char* DistributionName, TArray<FBox> Boxes, const TArray<FVector>& QueryPoints, std::mt19937& Random)
+{
+	TArray<int32> Ids;
+	Ids.SetNum(NumElements);
+	const double BuildMs = BenchmarkUtils::MeasureBestMs([&]
+	{
+		Index.Clear();
+		for (int32 Element = 0; Element < NumElements; ++Element)
+		{
+			Ids[Element] = Index.Add(Boxes[Element], reinterpret_cast<void*>(static_cast<intptr_t>(Element)));
+		}
+	}, 3);
+
+	// 매 프레임 조금씩 움직이는 물체
+	std::uniform_real_distribution<float> Step(-0.05f, 0.05f);
+	const double UpdateMs = BenchmarkUtils::MeasureBestMs([&]
+	{
+		for (int32 Element = 0; Element < NumElements; ++Element)
+		{
+			Boxes[Element] = Boxes[Element].ShiftBy(FVector(Step(Random), Step(Random), Step(Random)));
+			Index.Update(Ids[Element], Boxes[Element]);
+		}
+	}, 3);
+
+	TArray<int32> Result;
+	int32 NumSphereResults = 0;
+	const double SphereMs = BenchmarkUtils::MeasureBestMs([&]
+	{
+		NumSphereResults = 0;
+		for (const FVector& Point : QueryPoints)
+		{
+			Index.QuerySphere(Point, QueryRadius, Result);
+			NumSphereResults += Result.Num();
+		}
+	}, 3);
+
+	int32 NumBoxResults = 0;
+	const double BoxMs = BenchmarkUtils::MeasureBestMs([&]
+	{
+		NumBoxResults = 0;
+		for (const FVector& Point : QueryPoints)
+		{
+			Index.QueryBox(FBox(Point, Point).ExpandBy(QueryRadius), Result);
+			NumBoxResults += Result.Num();
+		}
+	}, 3);
+
+	const double NearestMs = BenchmarkUtils::MeasureBestMs([&]
+	{
+		for (const FVector& Point : QueryPoints)
+		{
+			Index.QueryNearest(Point, NumNearest, Result);
+			BenchmarkUtils::DoNotOptimize(Result.Num());
+		}
+	}, 3);
+
+	const FMatrix View = FMatrix::LookAtLH(FVector(-100.0f, WorldSize * 0.5f, WorldSize * 0.5f), FVector(WorldSize, WorldSize * 0.5f, WorldSize * 0.5f), FVector(0.0f, 0.0f, 1.0f));
+	const FMatrix Projection = FMatrix::PerspectiveFovLH(FMath::DegreesToRadians(60.0f), 16.0f / 9.0f, 0.1f, 800.0f);
+	const FFrustum Frustum = FFrustum::FromViewProjection(View * Projection);
+
+	int32 NumVisible = 0;
+	const double FrustumMs = BenchmarkUtils::MeasureBestMs([&]
+	{
+		Index.QueryFrustum(Frustum, Result);
+		NumVisible = Result.Num();
+	}, 5);
+
+	// 정확도: 전부 검사한 결과와 같은 원소 (K Nearest는 거리 순서까지 같아야 함)
+	int32 NumMismatches = 0;
+	TArray<int32> Actual;
+	TArray<int32> Expected;
+	for (int32 Query = 0; Query < NumVerifiedQueries; ++Query)
+	{
+		const FVector& Point = QueryPoints[Query];
+
+		Index.QuerySphere(Point, QueryRadius, Result);
+		ToSortedIndices(Index, Result, Actual);
+		Expected.Empty();
+		for (int32 Element = 0; Element < NumElements; ++Element)
+		{
+			if (Boxes[Element].ComputeSquaredDIstanceToPoint(Point) <= QueryRadius * QueryRadius)
+			{
+				Expected.Add(Element);
+			}
+		}
+		NumMismatches += IsSame(Actual, Expected) ? 0 : 1;
+
+		Index.QueryNearest(Point, NumNearest, Result);
+		TArray<float> Distances;
+		for (const FBox& Box : Boxes)
+		{
+			Distances.Add(Box.ComputeSquaredDIstanceToPoint(Point));
+		}
+		std::partial_sort(Distances.GetData(), Distances.GetData() + NumNearest, Distances.GetData() + Distances.Num());
+		bool bSame = Result.Num() == NumNearest;
+		for (int32 Rank = 0; bSame && Rank < NumNearest; ++Rank)
+		{
+			bSame = Index.GetBox(Result[Rank]).ComputeSquaredDIstanceToPoint(Point) == Distances[Rank];
+		}
+		NumMismatches += bSame ? 0 : 1;
+	}
+
+	Index.QueryFrustum(Frustum, Result);
+	ToSortedIndices(Index, Result, Actual);
+	Expected.Empty();
+	for (int32 Element = 0; Element < NumElements; ++Element)
+	{
+		if (Frustum.IntersectBox(Boxes[Element]))
+		{
+			Expected.Add(Element);
+		}
+	}
+	NumMismatches += IsSame(Actual, Expected) ? 0 : 1;
+
+	UE_LOG(
+		"[Bench] spatial: %s %s: build %.2f ms, update %.2f ms, %d sphere %.3f us/query (%d results), box %.3f us/query (%d results), %d-nearest %.3f us/query, frustum %.3f ms (%d visible), %d mismatches",
+		Label, DistributionName, BuildMs, UpdateMs,
+		NumQueries, SphereMs * 1000.0 / NumQueries, NumSphereResults, BoxMs * 1000.0 / NumQueries, NumBoxResults,
+		NumNearest, NearestMs * 1000.0 / NumQueries, FrustumMs, NumVisible, NumMismatches
+	);
+}
+
+/**
+ * 고른 분포와 몰린 분포의 Box 10만 개로 Loose Octree와 Hash Grid를 비교합니다.
+ * Query 점은 Box들 사이에서 고르므로, 몰린 분포에서는 한 Query에 걸리는 원소가 훨씬 많습니다.
+ */
+void BenchmarkSpatialIndices()
+{
+	for (const bool bClustered : {false, true})
+	{
+		std::mt19937 Random(1234);
+		const TArray<FBox> Boxes = MakeBoxes(bClustered, Random);
+
+		std::uniform_int_distribution<int32> Pick(0, NumElements - 1);
+		TArray<FVector> QueryPoints;
+		QueryPoints.SetNum(NumQueries);
+		for (FVector& Point : QueryPoints)
+		{
+			Point = Boxes[Pick(Random)].GetCenter();
+		}
+
+		const char* DistributionName = bClustered ? "clustered" : "uniform";
+
+		FLooseOctree Octree;
+		BenchmarkSpatialIndex(Octree, "LooseOctree", DistributionName, Boxes, QueryPoints, Random);
+		UE_LOG("[Bench] spatial: LooseOctree %s: %d nodes", DistributionName, Octree.GetNumNodes());
+
+		// 기본 Cell 크기(Editor의 물체 크기 기준)와, 원소 간격에 가까운 큰 Cell
+		for (const float CellSize : {FSpatialHashGrid::DefaultCellSize, 16.0f})
+		{
+			FSpatialHashGrid Grid(CellSize);
+			char Label[32];
+			snprintf(Label, sizeof(Label), "HashGrid(%g)", CellSize);
+			BenchmarkSpatialIndex(Grid, Label, DistributionName, Boxes, QueryPoints, Random);
+			UE_LOG("[Bench] spatial: %s %s: %d cells, %d large", Label, DistributionName, Grid.GetNumCells(), Grid.GetNumLargeElements());
+		}
+	}
+}
+}
+
+REGISTER_BENCHMARK("spatial", "Loose octree vs hashed grid: build, update, sphere / box / frustum / k-nearest on uniform and clustered 100k boxes", BenchmarkSpatialIndices);
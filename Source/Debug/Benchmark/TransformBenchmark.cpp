@@ -0,0 +1,478 @@
+#include <cstring>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "Benchmark.h"
+#include "Core/Engine.h"
+#include "Core/Math/Transform.h"
+#include "Core/Math/TransformHierarchy.h"
+#include "Debug/DebugConsole.h"
+#include "Object/Actor/Actor.h"
+#include "Object/PrimitiveComponent/UPrimitiveComponent.h"
+#include "Object/USceneComponent.h"
+#include "Object/World/World.h"
+
+
+namespace
+{
+constexpr int32 NumTransforms = 100'000;
+constexpr int32 NumChains = 512;
+constexpr int32 ChainDepth = 8;
+
+/** Render, Gizmo, Picking이 한 프레임에 같은 Component의 Matrix를 읽는 횟수 */
+constexpr int32 QueriesPerFrame = 4;
+
+/** World Benchmark에서 움직이는 Actor 비율 (N개 중 하나) */
+constexpr int32 MovedActorStride = 100;
+
+/** Hierarchy Benchmark의 Component 수는 두 모양 모두 NumRoots * NodesPerRoot */
+constexpr int32 NumHierarchyNodes = 65'536;
+constexpr int32 DeepNumRoots = 64;   // Root마다 1024 깊이의 사슬 하나
+constexpr int32 WideNumRoots = 256;  // Root마다 자식 255개
+
+//~ 기존 구현 (비교 기준)
+FORCENOINLINE FMatrix MatrixProductGetMatrix(const FTransform& Transform)
+{
+	const FVector Position = Transform.GetPosition();
+	const FVector Scale = Transform.GetScale();
+	return FMatrix::GetScaleMatrix(Scale.X, Scale.Y, Scale.Z)
+		* FMatrix::GetRotateMatrix(Transform.GetRotation())
+		* FMatrix::GetTranslateMatrix(Position.X, Position.Y, Position.Z);
+}
+
+/** 기존 USceneComponent::GetWorldMatrix, 요청마다 부모 체인을 따라 올라가며 Matrix를 곱함 */
+FORCENOINLINE FMatrix RecursiveWorldMatrix(USceneComponent* Component)
+{
+	const FTransform Relative = Component->GetRelativeTransform();
+	if (USceneComponent* Parent = Component->GetParent())
+	{
+		const FMatrix LocalMatrix = MatrixProductGetMatrix(FTransform(Relative.GetPosition(), Relative.GetRotation(), FVector(1.0f, 1.0f, 1.0f)))
+			* RecursiveWorldMatrix(Parent);
+		return LocalMatrix * Relative.GetScaleMatrix();
+	}
+	return MatrixProductGetMatrix(Relative);
+}
+//~ 기존 구현
+
+/** FTransform은 FQuat 정렬 때문에 Padding이 있어서 멤버별로 비교 */
+int32 CountBitwiseMismatches(const FTransform& A, const FTransform& B)
+{
+	const FVector PositionA = A.GetPosition(), PositionB = B.GetPosition();
+	const FQuat RotationA = A.GetRotation(), RotationB = B.GetRotation();
+	const FVector ScaleA = A.GetScale(), ScaleB = B.GetScale();
+	const bool bSame = std::memcmp(&PositionA, &PositionB, sizeof(FVector)) == 0
+		&& std::memcmp(&RotationA, &RotationB, sizeof(FQuat)) == 0
+		&& std::memcmp(&ScaleA, &ScaleB, sizeof(FVector)) == 0;
+	return bSame ? 0 : 1;
+}
+
+int32 CountValueMismatches(const FMatrix& A, const FMatrix& B)
+{
+	int32 NumMismatches = 0;
+	for (int32 Row = 0; Row < 4; ++Row)
+	{
+		for (int32 Col = 0; Col < 4; ++Col)
+		{
+			NumMismatches += A.M[Row][Col] != B.M[Row][Col] ? 1 : 0;
+		}
+	}
+	return NumMismatches;
+}
+
+float MaxAbsDifference(const FMatrix& A, const FMatrix& B)
+{
+	float MaxDifference = 0.0f;
+	for (int32 Row = 0; Row < 4; ++Row)
+	{
+		for (int32 Col = 0; Col < 4; ++Col)
+		{
+			MaxDifference = FMath::Max(MaxDifference, FMath::Abs(A.M[Row][Col] - B.M[Row][Col]));
+		}
+	}
+	return MaxDifference;
+}
+
+/**
+ * Scale된 부모 아래 자식의 GetWorldMatrix를 기존 렌더링 Matrix (FTransform::MultiPly 후 S*R*T 곱), 기존 재귀 합성과 비교
+ * 기존 재귀 합성은 부모가 회전되어 있거나 Scale이 비균등하면 렌더링 Matrix와 달랐음 (Bounds의 역변환만 이 값을 씀)
+ */
+void CompareScaledParent(
+	const FVector& ParentRotation, const FVector& ParentScale, const FVector& ChildRotation, const FVector& ChildScale,
+	float& OutRenderDifference, float& OutBaselineDifference
+)
+{
+	const std::unique_ptr<USceneComponent> Parent = std::make_unique<USceneComponent>();
+	const std::unique_ptr<USceneComponent> Child = std::make_unique<USceneComponent>();
+	Child->SetupAttachment(Parent.get());
+	Parent->SetRelativeTransform(FTransform(FVector(10.0f, -20.0f, 5.0f), ParentRotation, ParentScale));
+	Child->SetRelativeTransform(FTransform(FVector(3.0f, 1.0f, -2.0f), ChildRotation, ChildScale));
+
+	const FMatrix& WorldMatrix = Child->GetWorldMatrix();
+	const FTransform RenderTransform = FTransform::MultiPly(Child->GetRelativeTransform(), Parent->GetRelativeTransform());
+	OutRenderDifference = MaxAbsDifference(WorldMatrix, MatrixProductGetMatrix(RenderTransform));
+	OutBaselineDifference = MaxAbsDifference(WorldMatrix, RecursiveWorldMatrix(Child.get()));
+}
+
+FTransform MakeRandomTransform(std::mt19937& Random, float MaxPosition)
+{
+	std::uniform_real_distribution<float> Angle(-180.0f, 180.0f);
+	std::uniform_real_distribution<float> Position(-MaxPosition, MaxPosition);
+	std::uniform_real_distribution<float> Scale(0.5f, 2.0f);
+	const float UniformScale = Scale(Random);
+	return FTransform(
+		FVector(Position(Random), Position(Random), Position(Random)),
+		FVector(Angle(Random), Angle(Random), Angle(Random)),
+		FVector(UniformScale, UniformScale, UniformScale)
+	);
+}
+
+/**
+ * FTransform::GetMatrix를 기존 Matrix 3개 곱과 비교하고,
+ * 부모 체인이 있는 Component에서 Matrix를 매번 새로 만드는 것과 캐시된 GetWorldMatrix를 비교합니다.
+ * 부모를 움직인 뒤 모든 자손의 WorldTransform이 부모 WorldTransform과 쿼터니언 합성한 값과 같은지도 검사합니다.
+ */
+void BenchmarkTransform()
+{
+	std::mt19937 Random(1234);
+
+	TArray<FTransform> Transforms;
+	Transforms.SetNum(NumTransforms);
+	for (FTransform& Transform : Transforms)
+	{
+		Transform = MakeRandomTransform(Random, 500.0f);
+	}
+
+	TArray<FMatrix> ProductMatrices;
+	TArray<FMatrix> DirectMatrices;
+	ProductMatrices.SetNum(NumTransforms);
+	DirectMatrices.SetNum(NumTransforms);
+	const double ProductMs = BenchmarkUtils::MeasureBestMs([&]
+	{
+		for (int32 Index = 0; Index < NumTransforms; ++Index)
+		{
+			ProductMatrices[Index] = MatrixProductGetMatrix(Transforms[Index]);
+		}
+	}, 5);
+	const double DirectMs = BenchmarkUtils::MeasureBestMs([&]
+	{
+		for (int32 Index = 0; Index < NumTransforms; ++Index)
+		{
+			DirectMatrices[Index] = Transforms[Index].GetMatrix();
+		}
+	}, 5);
+	int32 MatrixMismatches = 0;
+	for (int32 Index = 0; Index < NumTransforms; ++Index)
+	{
+		MatrixMismatches += CountValueMismatches(DirectMatrices[Index], ProductMatrices[Index]);
+	}
+
+	// Chain마다 Root 하나에 ChainDepth - 1 단계의 자식, 부모가 항상 앞에 오도록 저장
+	TArray<std::unique_ptr<USceneComponent>> Components;
+	Components.Reserve(NumChains * ChainDepth);
+	for (int32 Chain = 0; Chain < NumChains; ++Chain)
+	{
+		USceneComponent* Parent = nullptr;
+		for (int32 Depth = 0; Depth < ChainDepth; ++Depth)
+		{
+			std::unique_ptr<USceneComponent> Component = std::make_unique<USceneComponent>();
+			if (Parent != nullptr)
+			{
+				Component->SetupAttachment(Parent);
+			}
+			Component->SetRelativeTransform(MakeRandomTransform(Random, Depth == 0 ? 500.0f : 5.0f));
+			Parent = Component.get();
+			Components.Add(std::move(Component));
+		}
+	}
+	const int32 NumComponents = Components.Num();
+
+	// Root를 움직이면 자손 전체가 Dirty가 되고, 아래에서 처음 읽을 때 부모부터 갱신됨
+	const double PropagateMs = BenchmarkUtils::MeasureBestMs([&]
+	{
+		for (int32 Index = 0; Index < NumComponents; Index += ChainDepth)
+		{
+			Components[Index]->AddRelativePosition(FVector(1.0f, 0.0f, 0.0f));
+		}
+	}, 5);
+
+	int32 TransformMismatches = 0;
+	for (int32 Index = 0; Index < NumComponents; ++Index)
+	{
+		USceneComponent* Component = Components[Index].get();
+		if (USceneComponent* Parent = Component->GetParent())
+		{
+			const FTransform Expected = FTransform::MultiPly(Component->GetRelativeTransform(), Parent->GetWorldTransform());
+			TransformMismatches += Component->GetWorldTransform().Equal(Expected) ? 0 : 1;
+		}
+	}
+
+	TArray<FMatrix> RebuiltMatrices;
+	TArray<FMatrix> RecursiveMatrices;
+	TArray<FMatrix> CachedMatrices;
+	RebuiltMatrices.SetNum(NumComponents);
+	RecursiveMatrices.SetNum(NumComponents);
+	CachedMatrices.SetNum(NumComponents);
+	const double RebuiltMs = BenchmarkUtils::MeasureBestMs([&]
+	{
+		for (int32 Query = 0; Query < QueriesPerFrame; ++Query)
+		{
+			for (int32 Index = 0; Index < NumComponents; ++Index)
+			{
+				RebuiltMatrices[Index] = MatrixProductGetMatrix(Components[Index]->GetWorldTransform());
+			}
+		}
+	}, 5);
+	const double RecursiveMs = BenchmarkUtils::MeasureBestMs([&]
+	{
+		for (int32 Query = 0; Query < QueriesPerFrame; ++Query)
+		{
+			for (int32 Index = 0; Index < NumComponents; ++Index)
+			{
+				RecursiveMatrices[Index] = RecursiveWorldMatrix(Components[Index].get());
+			}
+		}
+	}, 5);
+	// 매 반복마다 Root를 움직여서, 첫 요청은 Matrix를 새로 만들고 나머지는 캐시를 읽도록 함
+	double CachedMs = 0.0;
+	for (int32 Iteration = 0; Iteration < 5; ++Iteration)
+	{
+		for (int32 Index = 0; Index < NumComponents; Index += ChainDepth)
+		{
+			Components[Index]->AddRelativePosition(FVector(0.0f, 1.0f, 0.0f));
+		}
+		const double IterationMs = BenchmarkUtils::MeasureBestMs([&]
+		{
+			for (int32 Query = 0; Query < QueriesPerFrame; ++Query)
+			{
+				for (int32 Index = 0; Index < NumComponents; ++Index)
+				{
+					CachedMatrices[Index] = Components[Index]->GetWorldMatrix();
+				}
+			}
+		}, 1);
+		CachedMs = Iteration == 0 ? IterationMs : FMath::Min(CachedMs, IterationMs);
+	}
+
+	int32 CacheMismatches = 0;
+	for (int32 Index = 0; Index < NumComponents; ++Index)
+	{
+		CacheMismatches += CountValueMismatches(CachedMatrices[Index], MatrixProductGetMatrix(Components[Index]->GetWorldTransform()));
+	}
+
+	// 회전 없는 균등 Scale 부모는 기존 합성과도 같아야 하고, 회전 + 비균등 Scale 부모는 렌더링 Matrix와만 같으면 됨
+	float UniformRenderDifference, UniformBaselineDifference;
+	float RotatedRenderDifference, RotatedBaselineDifference;
+	CompareScaledParent(
+		FVector(0.0f, 0.0f, 0.0f), FVector(2.0f, 2.0f, 2.0f), FVector(-15.0f, 20.0f, 75.0f), FVector(1.0f, 1.0f, 1.0f),
+		UniformRenderDifference, UniformBaselineDifference
+	);
+	CompareScaledParent(
+		FVector(30.0f, 45.0f, -60.0f), FVector(1.0f, 3.0f, 0.5f), FVector(-15.0f, 20.0f, 75.0f), FVector(2.0f, 1.0f, 1.0f),
+		RotatedRenderDifference, RotatedBaselineDifference
+	);
+	constexpr float MatrixTolerance = 1e-4f;
+	const bool bScaledParentOK = UniformRenderDifference < MatrixTolerance && UniformBaselineDifference < MatrixTolerance
+		&& RotatedRenderDifference < MatrixTolerance;
+
+	UE_LOG(
+		"[Bench] transform: GetMatrix of %d transforms: S*R*T product %.3f ms, direct %.3f ms (%.1fx), %d mismatches",
+		NumTransforms, ProductMs, DirectMs, ProductMs / DirectMs, MatrixMismatches
+	);
+	UE_LOG(
+		"[Bench] transform: %d components (%d chains x depth %d), mark roots dirty %.3f ms, %d world transform mismatches",
+		NumComponents, NumChains, ChainDepth, PropagateMs, TransformMismatches
+	);
+	UE_LOG(
+		"[Bench] transform: %d world matrix queries: rebuild %.3f ms, recursive chain %.3f ms, cached %.3f ms (%.1fx / %.1fx), %d mismatches",
+		NumComponents * QueriesPerFrame, RebuiltMs, RecursiveMs, CachedMs, RebuiltMs / CachedMs, RecursiveMs / CachedMs, CacheMismatches
+	);
+	UE_LOG(
+		"[Bench] transform: world matrix under uniformly scaled parent: vs render %.6f, vs old chain %.6f | rotated, non-uniformly scaled parent: vs render %.6f, vs old chain %.3f: %s",
+		UniformRenderDifference, UniformBaselineDifference, RotatedRenderDifference, RotatedBaselineDifference, bScaledParentOK ? "OK" : "MISMATCH"
+	);
+}
+
+/**
+ * 현재 World에서 아무것도 움직이지 않은 프레임과 일부 Actor만 움직인 프레임의 Transform 갱신 비용을 잽니다.
+ * 비교 기준은 기존 UPrimitiveComponent::Tick처럼 매 프레임 모든 Primitive의 Bounds를 다시 계산하는 비용입니다.
+ */
+void BenchmarkWorldTransform()
+{
+	UWorld* World = UEngine::Get().GetWorld();
+	if (World == nullptr || World->GetRenderComponents().Num() == 0)
+	{
+		UE_LOG("[Bench] worldtransform: no primitive in the world (spawn actors first)");
+		return;
+	}
+
+	TArray<USceneComponent*> SceneComponents;
+	TArray<USceneComponent*> MovedRoots;
+	const TArray<AActor*>& Actors = World->GetActors();
+	for (int32 ActorIndex = 0; ActorIndex < Actors.Num(); ++ActorIndex)
+	{
+		AActor* Actor = Actors[ActorIndex];
+		for (UActorComponent* Component : Actor->GetComponents())
+		{
+			if (USceneComponent* SceneComponent = dynamic_cast<USceneComponent*>(Component))
+			{
+				SceneComponents.Add(SceneComponent);
+			}
+		}
+		USceneComponent* Root = Actor->GetRootComponent();
+		if (Root != nullptr && ActorIndex % MovedActorStride == 0)
+		{
+			MovedRoots.Add(Root);
+		}
+	}
+	const TArray<UPrimitiveComponent*> Primitives = World->GetRenderComponents().Array();
+
+	World->FlushTransformUpdates();
+	const double StaticMs = BenchmarkUtils::MeasureBestMs([&]
+	{
+		World->FlushTransformUpdates();
+	}, 10);
+
+	const double AllBoundsMs = BenchmarkUtils::MeasureBestMs([&]
+	{
+		for (UPrimitiveComponent* Primitive : Primitives)
+		{
+			Primitive->UpdateBounds();
+		}
+	}, 3);
+
+	// 올렸다가 다시 내려서 Scene은 그대로 둠
+	double MovedMs = 0.0;
+	int32 NumDirtyAfterFlush = 0;
+	for (int32 Iteration = 0; Iteration < 6; ++Iteration)
+	{
+		const FVector Delta(0.0f, 0.0f, Iteration % 2 == 0 ? 1.0f : -1.0f);
+		for (USceneComponent* Root : MovedRoots)
+		{
+			Root->AddRelativePosition(Delta);
+		}
+		const double IterationMs = BenchmarkUtils::MeasureBestMs([&]
+		{
+			World->FlushTransformUpdates();
+		}, 1);
+		MovedMs = Iteration == 0 ? IterationMs : FMath::Min(MovedMs, IterationMs);
+
+		for (USceneComponent* SceneComponent : SceneComponents)
+		{
+			NumDirtyAfterFlush += SceneComponent->IsComponentToWorldUpdated() ? 0 : 1;
+		}
+	}
+
+	UE_LOG(
+		"[Bench] worldtransform: %d scene components, %d primitives: static frame %.4f ms, %d roots moved %.3f ms, all primitive bounds (old per-frame Tick) %.3f ms, %d dirty after flush",
+		SceneComponents.Num(), Primitives.Num(), StaticMs, MovedRoots.Num(), MovedMs, AllBoundsMs, NumDirtyAfterFlush
+	);
+}
+
+/**
+ * 같은 모양의 부모-자식 구조를 USceneComponent 객체 그래프와 FTransformHierarchy로 만들고,
+ * 매 프레임 모든 Root를 움직였을 때 자손의 World Transform / Matrix를 다시 계산하는 비용을 비교합니다.
+ * 두 쪽 모두 FTransform::MultiPly로 합성하므로 결과가 비트 단위로 같아야 합니다.
+ */
+void BenchmarkHierarchyShape(const char* ShapeName, int32 NumRoots, bool bDeep)
+{
+	std::mt19937 Random(42);
+	std::uniform_real_distribution<float> Angle(-10.0f, 10.0f);
+	std::uniform_real_distribution<float> Position(-1.0f, 1.0f);
+	std::uniform_real_distribution<float> Scale(0.99f, 1.01f);
+	auto MakeRandomTransform = [&]
+	{
+		return FTransform(
+			FVector(Position(Random), Position(Random), Position(Random)),
+			FVector(Angle(Random), Angle(Random), Angle(Random)),
+			FVector(Scale(Random), Scale(Random), Scale(Random))
+		);
+	};
+
+	const int32 NodesPerRoot = NumHierarchyNodes / NumRoots;
+	std::vector<std::unique_ptr<USceneComponent>> Components;
+	Components.reserve(NumHierarchyNodes);
+	TArray<int32> Handles;
+	TArray<int32> RootNodes;
+	FTransformHierarchy Hierarchy;
+	for (int32 RootIndex = 0; RootIndex < NumRoots; ++RootIndex)
+	{
+		const int32 RootNode = static_cast<int32>(Components.size());
+		RootNodes.Add(RootNode);
+		for (int32 Node = 0; Node < NodesPerRoot; ++Node)
+		{
+			// 깊은 모양은 바로 앞 Node, 넓은 모양은 Root가 부모
+			const int32 ParentNode = Node == 0 ? INDEX_NONE : (bDeep ? static_cast<int32>(Components.size()) - 1 : RootNode);
+			const FTransform Local = MakeRandomTransform();
+
+			std::unique_ptr<USceneComponent> Component = std::make_unique<USceneComponent>();
+			Component->SetComponentToWorld(Local);
+			if (ParentNode != INDEX_NONE)
+			{
+				Component->SetupAttachment(Components[ParentNode].get());
+			}
+			Components.push_back(std::move(Component));
+			Handles.Add(Hierarchy.Add(Local, ParentNode == INDEX_NONE ? INDEX_NONE : Handles[ParentNode], nullptr));
+		}
+	}
+
+	// Root는 두 Transform을 번갈아 가짐
+	const FTransform RootTransforms[2] = { MakeRandomTransform(), MakeRandomTransform() };
+	int32 ObjectFrame = 0;
+	int32 HierarchyFrame = 0;
+
+	Hierarchy.Update();
+	const double ObjectMs = BenchmarkUtils::MeasureBestMs([&]
+	{
+		const FTransform& RootTransform = RootTransforms[ObjectFrame++ % 2];
+		for (const int32 RootNode : RootNodes)
+		{
+			USceneComponent* Root = Components[RootNode].get();
+			Root->SetComponentToWorld(RootTransform);
+			Root->ConditionalUpdateComponentToWorld();
+			Root->UpdateChildTransforms();
+		}
+		for (const std::unique_ptr<USceneComponent>& Component : Components)
+		{
+			Component->GetWorldMatrix();
+		}
+	}, 5);
+	const double HierarchyMs = BenchmarkUtils::MeasureBestMs([&]
+	{
+		const FTransform& RootTransform = RootTransforms[HierarchyFrame++ % 2];
+		for (const int32 RootNode : RootNodes)
+		{
+			Hierarchy.SetLocalTransform(Handles[RootNode], RootTransform);
+		}
+		Hierarchy.Update();
+	}, 5);
+
+	int32 NumMismatches = 0;
+	if (ObjectFrame % 2 == HierarchyFrame % 2)
+	{
+		for (int32 Node = 0; Node < NumHierarchyNodes; ++Node)
+		{
+			const int32 Index = Hierarchy.GetIndex(Handles[Node]);
+			NumMismatches += CountBitwiseMismatches(Components[Node]->GetWorldTransform(), Hierarchy.GetWorldTransform(Index));
+			NumMismatches += std::memcmp(&Components[Node]->GetWorldMatrix(), &Hierarchy.GetWorldMatrix(Index), sizeof(FMatrix)) != 0 ? 1 : 0;
+		}
+	}
+
+	UE_LOG(
+		"[Bench] hierarchy: %s, %d roots x %d nodes: object graph walk %.3f ms, SoA hierarchy %.3f ms (%.1fx), %d mismatches",
+		ShapeName, NumRoots, NodesPerRoot, ObjectMs, HierarchyMs, ObjectMs / HierarchyMs, NumMismatches
+	);
+}
+
+void BenchmarkHierarchy()
+{
+	BenchmarkHierarchyShape("deep", DeepNumRoots, true);
+	BenchmarkHierarchyShape("wide", WideNumRoots, false);
+}
+}
+
+REGISTER_BENCHMARK("worldtransform", "Per-frame transform update cost of the current World, static vs partially moved vs refreshing every bounds", BenchmarkWorldTransform);
+
+REGISTER_BENCHMARK("hierarchy", "Moving every root of deep and wide hierarchies: USceneComponent graph walk vs FTransformHierarchy sweep, with bitwise comparison", BenchmarkHierarchy);
+
+REGISTER_BENCHMARK("transform", "FTransform::GetMatrix and cached USceneComponent world matrix vs per-query matrix products", BenchmarkTransform);
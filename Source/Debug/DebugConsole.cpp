@@ -1,12 +1,23 @@
 ﻿#include "Debug/DebugConsole.h"
 
+#include <cinttypes>
 #include <cstdarg>
+#include <cstdio>
+#include <sstream>
 #include <algorithm>
 #include "ImGui/imgui_internal.h"
 #include "Core/Container/String.h"
+#include "Debug/Benchmark/Benchmark.h"
+#include "Core/Engine.h"
+#include "Core/Stats/ProfilerServer.h"
+#include "Core/Stats/StatCounter.h"
+#include "Core/Stats/Stats.h"
+#include "Object/World/World.h"
+#include "Static/FPickingManager.h"
 
 
 std::vector<FString> Debug::items;
+bool Debug::bEchoToStdout = false;
 
 
 void Debug::ShowConsole(bool bWasWindowSizeUpdated, ImVec2 PreRatio, ImVec2 CurRatio)
@@ -85,6 +96,252 @@ void Debug::ProcessCommand(const FString& command, std::vector<FString>& log)
         log.push_back("Available commands:");
         log.push_back("- clear: Clears the console.");
         log.push_back("- help: Shows this help message.");
+        log.push_back("- bench [name|all]: Runs CPU benchmarks.");
+        log.push_back("- picking [cpu|gpu]: Selects the mouse picking path.");
+        log.push_back("- spatial [octree|grid]: Selects the world spatial index.");
+        log.push_back("- occlusion [on|off]: Toggles software HiZ occlusion culling.");
+        log.push_back("- drawsort [on|off]: Toggles sorting draws by pass / material / mesh / depth and skipping redundant binds.");
+        log.push_back("- fixedstep [off|Hz]: Runs TickFixed at a fixed rate with render interpolation.");
+        log.push_back("- pacing [fps]: Shows frame pacing stats, or sets the frame rate limit (0 = unlimited).");
+        log.push_back("- profiler [on|off]: Toggles SCOPE_CYCLE_COUNTER recording.");
+        log.push_back("- profiler export [path] [frames]: Saves the last frames as a chrome://tracing / Perfetto JSON.");
+        log.push_back("- framestats [reset]: Shows frame time p50 / p95 / p99 / max for the last 10 s and since reset.");
+        log.push_back("- hitch [ms|off|capture on|capture off]: Sets the hitch threshold and whether hitches save a profiler trace.");
+        log.push_back("- profiler serve [port|off]: Streams scopes / counters to JungleProfilerClient over 127.0.0.1, no argument shows the status.");
+        log.push_back("- stat [group|reset]: Lists stat counter groups, or shows a group's counters (last frame / average since reset).");
+    }
+    else if (command == "bench")
+    {
+        log.push_back("Available benchmarks:");
+        for (const FBenchmarkRegistry::FEntry& Entry : FBenchmarkRegistry::GetBenchmarks())
+        {
+            log.push_back(FString("- ") + Entry.Name + ": " + Entry.Description);
+        }
+    }
+    else if (command.Find("bench ", ESearchCase::IgnoreCase, ESearchDir::FromStart, 0) == 0)
+    {
+        const FString Name = std::string(*command + 6);
+        if (!FBenchmarkRegistry::Run(Name))
+        {
+            log.push_back("Unknown benchmark: " + Name);
+        }
+    }
+    else if (command == "picking cpu" || command == "picking gpu")
+    {
+        const bool bUseGPU = command == "picking gpu";
+        FPickingManager::Get().SetMode(bUseGPU ? EPickingMode::GPUAsync : EPickingMode::CPU);
+        log.push_back(bUseGPU ? "Picking: async GPU readback" : "Picking: CPU raycast");
+    }
+    else if (command == "spatial octree" || command == "spatial grid")
+    {
+        if (UWorld* World = UEngine::Get().GetWorld())
+        {
+            World->SetSpatialIndexType(command == "spatial grid" ? ESpatialIndexType::HashGrid : ESpatialIndexType::LooseOctree);
+        }
+    }
+    else if (command == "occlusion on" || command == "occlusion off")
+    {
+        if (UWorld* World = UEngine::Get().GetWorld())
+        {
+            World->SetOcclusionCullingEnabled(command == "occlusion on");
+            log.push_back(World->IsOcclusionCullingEnabled() ? "Occlusion culling: on" : "Occlusion culling: off");
+        }
+    }
+    else if (command == "drawsort on" || command == "drawsort off")
+    {
+        if (UWorld* World = UEngine::Get().GetWorld())
+        {
+            World->SetSortDrawCommandsEnabled(command == "drawsort on");
+            log.push_back(World->IsSortDrawCommandsEnabled() ? "Draw sort: on" : "Draw sort: off");
+        }
+    }
+    else if (command.Find("fixedstep ", ESearchCase::IgnoreCase, ESearchDir::FromStart, 0) == 0)
+    {
+        const FString Value = std::string(*command + 10);
+        const int32 TicksPerSecond = Value == "off" ? 0 : std::atoi(*Value);
+        UEngine& Engine = UEngine::Get();
+        Engine.SetFixedTickRate(TicksPerSecond, Engine.GetFixedTimestep().GetMaxStepsPerFrame());
+        log.push_back(TicksPerSecond > 0 ? "Fixed step: " + Value + " Hz" : "Fixed step: off");
+    }
+    else if (command == "profiler on" || command == "profiler off")
+    {
+        FProfiler::Get().SetEnabled(command == "profiler on");
+        log.push_back(FProfiler::IsEnabled() ? "Profiler: on" : "Profiler: off");
+    }
+    else if (command == "profiler export" || command.Find("profiler export ", ESearchCase::IgnoreCase, ESearchDir::FromStart, 0) == 0)
+    {
+        // profiler export [path] [frames]
+        std::istringstream Arguments(command.Len() > 16 ? *command + 16 : "");
+        std::string Path;
+        int32 NumFrames = 60;
+        if (!(Arguments >> Path))
+        {
+            Path = "ProfilerTrace.json";
+        }
+        Arguments >> NumFrames;
+
+        // 결과는 ExportChromeTrace가 로그로 남김
+        FProfiler::Get().ExportChromeTrace(Path, NumFrames);
+    }
+    else if (command == "profiler serve" || command.Find("profiler serve ", ESearchCase::IgnoreCase, ESearchDir::FromStart, 0) == 0)
+    {
+        // profiler serve [port|off], 결과는 Start가 로그로 남김
+        FProfilerServer& Server = FProfilerServer::Get();
+        const FString Value = command.Len() > 15 ? std::string(*command + 15) : std::string();
+        if (Value == "off")
+        {
+            Server.Stop();
+            log.push_back("Profiler server: off");
+        }
+        else if (!Value.IsEmpty())
+        {
+            Server.Start(static_cast<uint16>(std::atoi(*Value)));
+        }
+        else if (!Server.IsRunning())
+        {
+            Server.Start(ProfilerProtocol::DefaultPort);
+        }
+
+        if (Server.IsRunning())
+        {
+            const FProfilerServerStats Stats = Server.GetStats();
+            char Buffer[256];
+            snprintf(
+                Buffer, sizeof(Buffer), "Profiler server: 127.0.0.1:%u, %s, %" PRIu64 " frames sent (%.1f KB), %" PRIu64 " dropped",
+                Server.GetPort(), Server.HasClient() ? "client connected" : "waiting for client",
+                Stats.SentFrames, Stats.SentBytes / 1024.0, Stats.DroppedFrames
+            );
+            log.push_back(Buffer);
+        }
+    }
+    else if (command == "framestats" || command == "framestats reset")
+    {
+        FFrameStats& FrameStats = UEngine::Get().GetFrameStats();
+        if (command == "framestats reset")
+        {
+            FrameStats.ResetStats();
+            log.push_back("Frame stats: reset");
+        }
+        else
+        {
+            char Buffer[256];
+            const auto AddSummary = [&](const char* Label, const FFrameTimeSummary& Summary)
+            {
+                snprintf(
+                    Buffer, sizeof(Buffer), "%s: %" PRIu64 " frames, avg %.3f ms, p50 %.3f ms, p95 %.3f ms, p99 %.3f ms, max %.3f ms",
+                    Label, Summary.NumFrames, Summary.AverageMs, Summary.P50Ms, Summary.P95Ms, Summary.P99Ms, Summary.MaxMs
+                );
+                log.push_back(Buffer);
+            };
+            AddSummary("Last 10 s", FrameStats.GetWindowSummary());
+            AddSummary("Since reset", FrameStats.GetTotalSummary());
+            snprintf(
+                Buffer, sizeof(Buffer), "Hitches: %" PRIu64 " over %.1f ms (worst %.2f ms), %d trace(s) saved to %s",
+                FrameStats.GetNumHitches(), FrameStats.GetHitchSettings().ThresholdMs, FrameStats.GetWorstHitchMs(),
+                FrameStats.GetNumHitchCaptures(), *FrameStats.GetHitchSettings().CaptureDirectory
+            );
+            log.push_back(Buffer);
+        }
+    }
+    else if (command == "hitch" || command.Find("hitch ", ESearchCase::IgnoreCase, ESearchDir::FromStart, 0) == 0)
+    {
+        // hitch [ms|off|capture on|capture off]
+        FFrameStats& FrameStats = UEngine::Get().GetFrameStats();
+        FHitchSettings HitchSettings = FrameStats.GetHitchSettings();
+        const FString Value = command.Len() > 6 ? std::string(*command + 6) : std::string();
+        if (Value == "off")
+        {
+            HitchSettings.ThresholdMs = 0.0;
+        }
+        else if (Value == "capture on" || Value == "capture off")
+        {
+            HitchSettings.bCapture = Value == "capture on";
+        }
+        else if (!Value.IsEmpty())
+        {
+            HitchSettings.ThresholdMs = std::max(0.0, std::atof(*Value));
+        }
+        FrameStats.SetHitchSettings(HitchSettings);
+
+        char Buffer[256];
+        if (HitchSettings.ThresholdMs > 0.0)
+        {
+            snprintf(Buffer, sizeof(Buffer), "Hitch: over %.1f ms, capture %s", HitchSettings.ThresholdMs, HitchSettings.bCapture ? "on" : "off");
+        }
+        else
+        {
+            snprintf(Buffer, sizeof(Buffer), "Hitch: off, capture %s", HitchSettings.bCapture ? "on" : "off");
+        }
+        log.push_back(Buffer);
+    }
+    else if (command == "stat" || command == "stat reset")
+    {
+        FStatCounterRegistry& StatCounters = FStatCounterRegistry::Get();
+        if (command == "stat reset")
+        {
+            StatCounters.ResetTotals();
+            log.push_back("Stat counters: reset");
+        }
+        else
+        {
+            log.push_back("Stat groups:");
+            for (const char* Group : StatCounters.GetGroups())
+            {
+                log.push_back(FString("- ") + Group);
+            }
+        }
+    }
+    else if (command.Find("stat ", ESearchCase::IgnoreCase, ESearchDir::FromStart, 0) == 0)
+    {
+        // stat <group>, Group 이름은 대소문자 구분 없이
+        const FString Group = std::string(*command + 5);
+        const FStatCounterRegistry& StatCounters = FStatCounterRegistry::Get();
+        const double NumFrames = static_cast<double>(std::max<uint64>(1, StatCounters.GetNumFrames()));
+
+        bool bFound = false;
+        for (const FStatCounter* Counter : StatCounters.GetCounters())
+        {
+            if (!Group.Equals(Counter->GetGroup(), ESearchCase::IgnoreCase))
+            {
+                continue;
+            }
+            char Buffer[256];
+            snprintf(
+                Buffer, sizeof(Buffer), "%s: %" PRIu64 " last frame, %.1f avg over %" PRIu64 " frames",
+                Counter->GetName(), Counter->GetLastFrameValue(), static_cast<double>(Counter->GetTotalValue()) / NumFrames,
+                StatCounters.GetNumFrames()
+            );
+            log.push_back(Buffer);
+            bFound = true;
+        }
+        if (!bFound)
+        {
+            log.push_back("Unknown stat group: " + Group);
+        }
+    }
+    else if (command == "pacing")
+    {
+        const FFramePacer& FramePacer = UEngine::Get().GetFramePacer();
+        const FFramePacerStats& Stats = FramePacer.GetStats();
+        char Buffer[256];
+        snprintf(
+            Buffer, sizeof(Buffer), "Frame pacing: %d fps, %" PRIu64 " frames (%" PRIu64 " late), avg %.4f ms, jitter %.1f us",
+            FramePacer.GetTargetFPS(), Stats.NumFrames, Stats.NumLateFrames, Stats.AverageFrameMs, Stats.FrameJitterUs
+        );
+        log.push_back(Buffer);
+        snprintf(
+            Buffer, sizeof(Buffer), "Wake error avg %.1f us (max %.1f), sleep overshoot %.1f us, sleep %.1f ms / spin %.1f ms, wait CPU %.1f%%",
+            Stats.AverageWakeErrorUs, Stats.MaxWakeErrorUs, Stats.SleepOvershootUs, Stats.SleepMs, Stats.SpinMs, Stats.WaitCPUPercent
+        );
+        log.push_back(Buffer);
+    }
+    else if (command.Find("pacing ", ESearchCase::IgnoreCase, ESearchDir::FromStart, 0) == 0)
+    {
+        const FString Value = std::string(*command + 7);
+        FFramePacer& FramePacer = UEngine::Get().GetFramePacer();
+        FramePacer.SetTargetFPS(std::atoi(*Value));
+        FramePacer.ResetStats();
+        log.push_back(FramePacer.GetTargetFPS() > 0 ? "Frame rate limit: " + Value + " fps" : "Frame rate limit: off");
     }
     else
     {
@@ -100,6 +357,10 @@ void Debug::Log(const char* format, ...)
     vsnprintf(buffer, sizeof(buffer), format, args);
     va_end(args);
 
+    if (bEchoToStdout)
+    {
+        std::puts(buffer);
+    }
     items.emplace_back(buffer);
 }
 
@@ -18,8 +18,10 @@ class FString;
 class Debug
 {
     static std::vector<FString> items; // 출력 로그
+    static bool bEchoToStdout;         // Headless 모드처럼 Console 창이 없을 때 표준 출력으로도 출력
 
 public:
+    static void SetEchoToStdout(bool bEnable) { bEchoToStdout = bEnable; }
     static void ShowConsole(bool bWasWindowSizeUpdated, ImVec2 PreRatio, ImVec2 CurRatio);
     static void ProcessCommand(const FString& command, std::vector<FString>& log);
     static void Log(const char* format, ...);
@@ -1,5 +1,7 @@
 #include "DebugDrawManager.h"
 #include "Core/Engine.h"
+#include "Core/Math/BatchTransform.h"
+#include "Core/Rendering/RenderingThread.h"
 #include "Object/World/World.h"
 #include "Object/Actor/Camera.h"
 #include "Resource/DirectResource/Vertexbuffer.h"
@@ -19,8 +21,8 @@ using namespace std;
 
 UDebugDrawManager::UDebugDrawManager()
 {
-	VertexBuffer.SetNum(100);
-	IndexBuffer.SetNum(100);
+	RenderVertexBuffer.SetNum(MaxDebugVertices);
+	RenderIndexBuffer.SetNum(MaxDebugVertices);
 }
 
 UDebugDrawManager::~UDebugDrawManager()
@@ -30,8 +32,8 @@ UDebugDrawManager::~UDebugDrawManager()
 
 void UDebugDrawManager::Initialize()
 {
-	FVertexBuffer::Create(TEXT("DebugVertexBuffer"), VertexBuffer, true);
-	FIndexBuffer::Create(TEXT("DebugIndexBuffer"), IndexBuffer, true);
+	FVertexBuffer::Create(TEXT("DebugVertexBuffer"), RenderVertexBuffer, true);
+	FIndexBuffer::Create(TEXT("DebugIndexBuffer"), RenderIndexBuffer, true);
 	ClearDebug();
 
 	std::shared_ptr<FMesh> Mesh = FMesh::Create("DebugBatchMesh", "DebugVertexBuffer", "DebugIndexBuffer", D3D11_PRIMITIVE_TOPOLOGY_LINELIST);
@@ -117,58 +119,40 @@ void UDebugDrawManager::DrawBoundingBox(const FVector& LocalMin, const FVector&
 	const FVector LocalExtent = (LocalMax - LocalMin) * 0.5f;
 
 	// 로컬 공간의 8개 정점 계산
-	const FVector v0 = LocalCenter + FVector(-LocalExtent.X, -LocalExtent.Y, -LocalExtent.Z);
-	const FVector v1 = LocalCenter + FVector(LocalExtent.X, -LocalExtent.Y, -LocalExtent.Z);
-	const FVector v2 = LocalCenter + FVector(LocalExtent.X, LocalExtent.Y, -LocalExtent.Z);
-	const FVector v3 = LocalCenter + FVector(-LocalExtent.X, LocalExtent.Y, -LocalExtent.Z);
-	const FVector v4 = LocalCenter + FVector(-LocalExtent.X, -LocalExtent.Y, LocalExtent.Z);
-	const FVector v5 = LocalCenter + FVector(LocalExtent.X, -LocalExtent.Y, LocalExtent.Z);
-	const FVector v6 = LocalCenter + FVector(LocalExtent.X, LocalExtent.Y, LocalExtent.Z);
-	const FVector v7 = LocalCenter + FVector(-LocalExtent.X, LocalExtent.Y, LocalExtent.Z);
-
-	TArray<FVector> vertices;
-	const FVector WorldV0 = ModelMatrix.TransformVector4(FVector4(v0, 1));
-	const FVector WorldV1 = ModelMatrix.TransformVector4(FVector4(v1, 1));
-	const FVector WorldV2 = ModelMatrix.TransformVector4(FVector4(v2, 1));
-	const FVector WorldV3 = ModelMatrix.TransformVector4(FVector4(v3, 1));
-	const FVector WorldV4 = ModelMatrix.TransformVector4(FVector4(v4, 1));
-	const FVector WorldV5 = ModelMatrix.TransformVector4(FVector4(v5, 1));
-	const FVector WorldV6 = ModelMatrix.TransformVector4(FVector4(v6, 1));
-	const FVector WorldV7 = ModelMatrix.TransformVector4(FVector4(v7, 1));
-
-	FVector NewMin = FVector::ZeroVector;
-	FVector NewMax = FVector::ZeroVector;
-
-	vertices.Add(WorldV0);
-	vertices.Add(WorldV1);
-	vertices.Add(WorldV2);
-	vertices.Add(WorldV3);
-	vertices.Add(WorldV4);
-	vertices.Add(WorldV5);
-	vertices.Add(WorldV6);
-	vertices.Add(WorldV7);
-
-	FVector::CaculateMinMax(vertices, NewMin, NewMax);
-
-	DrawAABBBox(NewMin, NewMax, FVector4::BLUE, LifeTime);
+	FVector Vertices[8] = {
+		LocalCenter + FVector(-LocalExtent.X, -LocalExtent.Y, -LocalExtent.Z),
+		LocalCenter + FVector(LocalExtent.X, -LocalExtent.Y, -LocalExtent.Z),
+		LocalCenter + FVector(LocalExtent.X, LocalExtent.Y, -LocalExtent.Z),
+		LocalCenter + FVector(-LocalExtent.X, LocalExtent.Y, -LocalExtent.Z),
+		LocalCenter + FVector(-LocalExtent.X, -LocalExtent.Y, LocalExtent.Z),
+		LocalCenter + FVector(LocalExtent.X, -LocalExtent.Y, LocalExtent.Z),
+		LocalCenter + FVector(LocalExtent.X, LocalExtent.Y, LocalExtent.Z),
+		LocalCenter + FVector(-LocalExtent.X, LocalExtent.Y, LocalExtent.Z),
+	};
+
+	// World로 옮긴 뒤 감싸는 AABB
+	BatchTransform::TransformPositions(ModelMatrix, Vertices, Vertices);
+	const FBox WorldBox = BatchTransform::ComputeBounds(Vertices);
+
+	DrawAABBBox(WorldBox.Min, WorldBox.Max, FVector4::BLUE, LifeTime);
 
 	// 바닥면 (아래 사각형) 선 연결
-	DrawLine(WorldV0, WorldV1, Color, LifeTime);
-	DrawLine(WorldV1, WorldV2, Color, LifeTime);
-	DrawLine(WorldV2, WorldV3, Color, LifeTime);
-	DrawLine(WorldV3, WorldV0, Color, LifeTime);
+	DrawLine(Vertices[0], Vertices[1], Color, LifeTime);
+	DrawLine(Vertices[1], Vertices[2], Color, LifeTime);
+	DrawLine(Vertices[2], Vertices[3], Color, LifeTime);
+	DrawLine(Vertices[3], Vertices[0], Color, LifeTime);
 
 	// 천장면 (위 사각형) 선 연결
-	DrawLine(WorldV4, WorldV5, Color, LifeTime);
-	DrawLine(WorldV5, WorldV6, Color, LifeTime);
-	DrawLine(WorldV6, WorldV7, Color, LifeTime);
-	DrawLine(WorldV7, WorldV4, Color, LifeTime);
+	DrawLine(Vertices[4], Vertices[5], Color, LifeTime);
+	DrawLine(Vertices[5], Vertices[6], Color, LifeTime);
+	DrawLine(Vertices[6], Vertices[7], Color, LifeTime);
+	DrawLine(Vertices[7], Vertices[4], Color, LifeTime);
 
 	// 수직 엣지 연결
-	DrawLine(WorldV0, WorldV4, Color, LifeTime);
-	DrawLine(WorldV1, WorldV5, Color, LifeTime);
-	DrawLine(WorldV2, WorldV6, Color, LifeTime);
-	DrawLine(WorldV3, WorldV7, Color, LifeTime);
+	DrawLine(Vertices[0], Vertices[4], Color, LifeTime);
+	DrawLine(Vertices[1], Vertices[5], Color, LifeTime);
+	DrawLine(Vertices[2], Vertices[6], Color, LifeTime);
+	DrawLine(Vertices[3], Vertices[7], Color, LifeTime);
 }
 
 void UDebugDrawManager::DrawAABBBox(const FVector& InMin, const FVector& InMax, const FVector4& Color, float LifeTime)
@@ -236,8 +220,26 @@ void UDebugDrawManager::Render()
 	//RenderResourceCollection.GetMesh()->GetVertexBuffer()->SetVertexCount(VertexBuffer.Num());
 	//RenderResourceCollection.GetMesh()->GetIndexBuffer()->SetIndexCount(IndexBuffer.Num());
 
-	DebugConstantInfo.ViewProjectionMatrix = FMatrix::Transpose(UEngine::Get().GetWorld()->GetCamera()->GetViewProjectionMatrix());
-	RenderResourceCollection.Render();
+	const FMatrix ViewProjectionMatrix = FMatrix::Transpose(UEngine::Get().GetWorld()->GetCamera()->GetViewProjectionMatrix());
+
+	// Game Thread는 다음 프레임의 라인을 바로 쌓을 수 있도록, 이번 프레임의 라인은 복사해서 넘깁니다.
+	ENQUEUE_RENDER_COMMAND([this, ViewProjectionMatrix, Vertices = VertexBuffer, Indices = IndexBuffer, State = RenderResourceCollection.ResolvePipelineState()]
+	{
+		const int32 NumVertices = FMath::Min(Vertices.Num(), MaxDebugVertices);
+		const int32 NumIndices = FMath::Min(Indices.Num(), MaxDebugVertices);
+		for (int32 Index = 0; Index < MaxDebugVertices; ++Index)
+		{
+			if (Index < NumVertices)
+			{
+				RenderVertexBuffer[Index] = Vertices[Index];
+			}
+			// 남는 인덱스는 0번 정점만 가리키게 해서 그려지지 않도록 합니다.
+			RenderIndexBuffer[Index] = Index < NumIndices ? Indices[Index] : 0;
+		}
+
+		DebugConstantInfo.ViewProjectionMatrix = ViewProjectionMatrix;
+		RenderResourceCollection.Render(State);
+	});
 
 	ClearDebug();
 }
@@ -50,5 +50,11 @@ public:
 private:
 	TArray<FLineVertexSimple> VertexBuffer;
 	TArray<uint32> IndexBuffer;
+
+	// Dynamic Buffer가 읽는 Render Thread 쪽 배열 (크기 고정)
+	TArray<FLineVertexSimple> RenderVertexBuffer;
+	TArray<uint32> RenderIndexBuffer;
+
+	static constexpr int32 MaxDebugVertices = 100;
 };
 
@@ -18,6 +18,11 @@ void AActor::BeginPlay()
 		{
 			PrimitiveComponent->RegisterComponentWithWorld(World);
 		}
+
+		if (USceneComponent* SceneComponent = dynamic_cast<USceneComponent*>(Component))
+		{
+			World->RegisterSceneComponent(SceneComponent);
+		}
 	}
 }
 
@@ -32,6 +37,17 @@ void AActor::Tick(float DeltaTime)
 	}
 }
 
+void AActor::TickFixed(float FixedDeltaTime)
+{
+	for (auto& Component : Components)
+	{
+		if (Component->CanEverTick())
+		{
+			Component->TickFixed(FixedDeltaTime);
+		}
+	}
+}
+
 void AActor::LateTick(float DeltaTime)
 {
 }
@@ -61,11 +77,15 @@ void AActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
 			
 			GetWorld()->RemoveRenderComponent(PrimitiveComp);
 		}
+		if (const auto SceneComp = dynamic_cast<USceneComponent*>(Component))
+		{
+			World->UnregisterSceneComponent(SceneComp);
+		}
 		if (FEditorManager::Get().GetSelectedActor() == this)
 		{
 			FEditorManager::Get().SelectActor(nullptr);
 		}
-		UEngine::Get().GObjects.Remove(Component->GetUUID());
+		UEngine::Get().RemoveObject(Component->GetUUID());
 	}
 	Components.Empty();
 }
@@ -31,6 +31,7 @@ public:
 public:
 	virtual void BeginPlay();
 	virtual void Tick(float DeltaTime);
+	virtual void TickFixed(float FixedDeltaTime); // 고정 간격 시뮬레이션, 한 프레임에 0번 이상
 	virtual void LateTick (float DeltaTime); // 렌더 후 호출
 	
 	virtual void Destroyed();
@@ -10,6 +10,10 @@ void UActorComponent::Tick(float DeltaTime)
 {
 }
 
+void UActorComponent::TickFixed([[maybe_unused]] float FixedDeltaTime)
+{
+}
+
 void UActorComponent::EndPlay(const EEndPlayReason::Type Reason)
 {
 }
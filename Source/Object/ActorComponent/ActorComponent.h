@@ -14,6 +14,9 @@ public:
 
 	virtual void BeginPlay();
 	virtual void Tick(float DeltaTime);
+
+	/** 고정 간격 시뮬레이션, Fixed Step이 켜져 있으면 프레임 속도와 상관없이 초당 같은 횟수로 호출됨 (UEngine::SetFixedTickRate) */
+	virtual void TickFixed(float FixedDeltaTime);
 	virtual void EndPlay(EEndPlayReason::Type Reason);
 
 	bool CanEverTick() const { return bCanEverTick; }
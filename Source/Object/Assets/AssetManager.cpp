@@ -2,6 +2,7 @@
 #include <filesystem>
 #include <iostream>
 #include "SceneAsset.h"
+#include "Core/Stats/Stats.h"
 
 using namespace std;
 
@@ -47,6 +48,7 @@ void UAssetManager::RegisterAssetMetaData(const FString& name, const FString& pa
 
 void UAssetManager::LoadAssets()
 {
+	SCOPE_CYCLE_COUNTER("LoadAssets");
 	for (auto& asset : AssetMetaDatas)
 	{
 		switch (asset.Value.GetAssetType())
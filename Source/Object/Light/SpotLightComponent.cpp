@@ -1,5 +1,6 @@
 #include "SpotLightComponent.h"
 #include "Core/Engine.h"
+#include "Core/Rendering/RenderingThread.h"
 #include "Core/Rendering/URenderer.h"
 #include "Object/World/World.h"
 #include "Object/Actor/Camera.h"
@@ -73,7 +74,7 @@ void USpotLightComponent::Render()
 		// 스포트라이트 데이터를 상수 버퍼에 업데이트
 		// 이 부분은 렌더러 구현에 따라 달라질 수 있음
 		FMatrix ModelMatrix;
-		ModelMatrix = GetWorldTransform().GetMatrix();
+		ModelMatrix = GetWorldMatrix();
 
 		const FMatrix& ViewProjectionMatrix = UEngine::Get().GetWorld()->GetCamera()->GetViewProjectionMatrix();
 
@@ -82,12 +83,15 @@ void USpotLightComponent::Render()
 			ViewProjectionMatrix
 		);
 
-		FConstantsComponentData& Data = GetConstantsComponentData();
+		ENQUEUE_RENDER_COMMAND([this, MVP, State = GetRenderResourceCollection().ResolvePipelineState()]
+		{
+			FConstantsComponentData& Data = GetConstantsComponentData();
 
-		Data.MVP = MVP;
-		Data.bUseVertexColor = true;
+			Data.MVP = MVP;
+			Data.bUseVertexColor = true;
 
-		GetRenderResourceCollection().Render();
+			GetRenderResourceCollection().Render(State);
+		});
 		//GuideMesh->Render();
 	}
 }
@@ -130,6 +134,9 @@ void USpotLightComponent::SetOuterConeAngle(float InAngle)
 
 void USpotLightComponent::UpdateLightVisualization()
 {
+	// Dynamic Vertex Buffer가 VertexBuffer를 직접 읽으므로, 이전 프레임의 Draw가 끝난 뒤에 수정
+	FRenderingThread::Get().Flush();
+
 	// 시각화 메시 업데이트
 	CreateLightVisualizationMesh();
 }
@@ -1,5 +1,6 @@
 #include "UPrimitiveComponent.h"
 
+#include "Core/Rendering/RenderingThread.h"
 #include "Core/Rendering/URenderer.h"
 #include "Debug/EngineShowFlags.h"
 #include "Object/Actor/Actor.h"
@@ -30,12 +31,6 @@ void UPrimitiveComponent::BeginPlay()
 	Super::BeginPlay();
 }
 
-void UPrimitiveComponent::Tick(float DeltaTime)
-{
-	Super::Tick(DeltaTime); 
-	UpdateBounds();
-}
-
 // void UPrimitiveComponent::UpdateConstantPicking(const URenderer& Renderer, const FVector4 UUIDColor)const
 // {
 // 	Renderer.UpdateConstantPicking(UUIDColor);
@@ -49,10 +44,26 @@ void UPrimitiveComponent::Tick(float DeltaTime)
 void UPrimitiveComponent::Render()
 {
 	URenderer* Renderer = UEngine::Get().GetRenderer();
-	if (Renderer == nullptr || !FEngineShowFlags::Get().GetSingleFlag(EEngineShowFlags::SF_Primitives) || !bCanBeRendered)
+	FConstantsComponentData Data;
+	if (Renderer == nullptr || !PrepareDrawConstants(Data))
 	{
 		return;
 	}
+
+	// 상수 버퍼는 Render Thread가 읽으므로, Game Thread에서 계산한 값과 찾아 둔 PSO를 복사해서 넘깁니다.
+	ENQUEUE_RENDER_COMMAND([this, Renderer, Data, State = GetRenderResourceCollection().ResolvePipelineState()]
+	{
+		ConstantsComponentData = Data;
+		Renderer->Render(GetRenderResourceCollection(), State);
+	});
+}
+
+bool UPrimitiveComponent::PrepareDrawConstants(FConstantsComponentData& OutData)
+{
+	if (!FEngineShowFlags::Get().GetSingleFlag(EEngineShowFlags::SF_Primitives) || !bCanBeRendered)
+	{
+		return false;
+	}
 	// if (GetOwner()->Implements<IGizmoInterface>() == false) // TODO: RTTI 개선하면 사용
 	if (!dynamic_cast<IGizmoInterface*>(GetOwner()))
 	{
@@ -81,17 +92,13 @@ void UPrimitiveComponent::Render()
 
 	FVector4 UUIDCOlor = FEditorManager::EncodeUUID(ID);
 
-	FConstantsComponentData& Data = GetConstantsComponentData();
-
-	Data = {
+	OutData = {
 		.MVP = MVP,
 		.Color = GetCustomColor(),
 		.UUIDColor = UUIDCOlor,
 		.bUseVertexColor = IsUseVertexColor()
 	};
-	
-
-	Renderer->Render(GetRenderResourceCollection());
+	return true;
 }
 
 void UPrimitiveComponent::CalculateModelMatrix(FMatrix& OutMatrix)
@@ -119,13 +126,13 @@ void UPrimitiveComponent::CalculateModelMatrix(FMatrix& OutMatrix)
 		// 언리얼에서는 X가 전방이므로 이렇게 계산
 		//FVector forward = right.Cross(up).GetSafeNormal();
 
-		FMatrix rotationMatrix;
-
 		// 회전 행렬 구성
-		rotationMatrix.X = FVector4(lookDir.X, lookDir.Y, lookDir.Z, 0);
-		rotationMatrix.Y = FVector4(right.X, right.Y, right.Z, 0);
-		rotationMatrix.Z = FVector4(up.X, up.Y, up.Z, 0);
-		rotationMatrix.W = FVector4(0, 0, 0, 1);
+		const FMatrix rotationMatrix(
+			FVector4(lookDir.X, lookDir.Y, lookDir.Z, 0),
+			FVector4(right.X, right.Y, right.Z, 0),
+			FVector4(up.X, up.Y, up.Z, 0),
+			FVector4(0, 0, 0, 1)
+		);
 
 		FMatrix positionMatrix = FMatrix::GetTranslateMatrix(objectPosition);
 		FMatrix scaleMatrix = FMatrix::GetScaleMatrix(objectScale);
@@ -134,7 +141,7 @@ void UPrimitiveComponent::CalculateModelMatrix(FMatrix& OutMatrix)
 
 		return;
 	}
-	OutMatrix = GetWorldTransform().GetMatrix();
+	OutMatrix = GetRenderMatrix();
 	return;
 }
 
@@ -153,6 +160,75 @@ void UPrimitiveComponent::UpdateBounds()
 {
 	FBoxSphereBounds OriginalBounds = Bounds;
 	Super::UpdateBounds();
+
+	// 생성자에서 부르는 경우처럼 아직 World에 등록되지 않았으면 Tree에 넣을 것도 없음
+	if (PrimitiveProxyId != INDEX_NONE)
+	{
+		if (UWorld* World = UEngine::Get().GetWorld())
+		{
+			World->UpdatePrimitive(this);
+		}
+	}
+}
+
+FBox UPrimitiveComponent::GetPrimitiveWorldBox()
+{
+	const std::shared_ptr<FMesh> Mesh = GetMesh();
+	const FTransform& Transform = GetWorldTransform();
+	if (Mesh == nullptr)
+	{
+		return FBox(Transform.GetPosition(), Transform.GetPosition());
+	}
+
+	const FVector LocalMin = Mesh->GetVertexBuffer()->GetMin();
+	const FVector LocalMax = Mesh->GetVertexBuffer()->GetMax();
+	if (bIsBillboard)
+	{
+		// 회전이 Camera에 따라 바뀌므로, 원점에서 가장 먼 꼭짓점까지를 반지름으로
+		const FVector Scale = Transform.GetScale();
+		const float MaxScale = FMath::Max(FMath::Abs(Scale.X), FMath::Max(FMath::Abs(Scale.Y), FMath::Abs(Scale.Z)));
+		const FVector Farthest = FVector::Max(
+			FVector(FMath::Abs(LocalMin.X), FMath::Abs(LocalMin.Y), FMath::Abs(LocalMin.Z)),
+			FVector(FMath::Abs(LocalMax.X), FMath::Abs(LocalMax.Y), FMath::Abs(LocalMax.Z))
+		);
+		const float Radius = Farthest.Length() * MaxScale;
+		return FBox(Transform.GetPosition(), Transform.GetPosition()).ExpandBy(Radius);
+	}
+
+	return FBox(LocalMin, LocalMax).TransformBy(GetWorldMatrix());
+}
+
+bool UPrimitiveComponent::GetPrimitiveLocalBox(FBox& OutLocalBox, FMatrix& OutWorldMatrix)
+{
+	const std::shared_ptr<FMesh> Mesh = GetMesh();
+	if (Mesh == nullptr || bIsBillboard)
+	{
+		return false;
+	}
+
+	OutLocalBox = FBox(Mesh->GetVertexBuffer()->GetMin(), Mesh->GetVertexBuffer()->GetMax());
+	OutWorldMatrix = GetWorldMatrix();
+	return true;
+}
+
+bool UPrimitiveComponent::RaycastPrimitive(const FRay& WorldRay, float MaxDistance, float& OutDistance)
+{
+	const std::shared_ptr<FMesh> Mesh = GetMesh();
+	const FMeshBVH* BVH = Mesh ? Mesh->GetBVH() : nullptr;
+	if (BVH == nullptr)
+	{
+		return false;
+	}
+
+	FMatrix ModelMatrix;
+	CalculateModelMatrix(ModelMatrix);
+
+	// Local Ray는 방향을 정규화하지 않으므로 T가 World 거리와 같음
+	const FRay LocalRay = FRay::TransformRayToLocal(WorldRay, ModelMatrix.Inverse());
+
+	// 음수 Scale이면 감기는 방향이 뒤집혀서 앞면 판정도 뒤집힘
+	const bool bMirrored = ModelMatrix.Determinant() < 0.0f;
+	return BVH->RayCast(LocalRay, MaxDistance, true, bMirrored, OutDistance);
 }
 
 void UPrimitiveComponent::SetBoxExtent(const FVector& InExtent)
@@ -5,6 +5,7 @@
 
 #include "Core/Engine.h"
 #include "Core/Math/Matrix.h"
+#include "Core/Math/Ray.h"
 #include "Object/USceneComponent.h"
 #include "Primitive/PrimitiveVertices.h"
 #include "Resource/RenderResourceCollection.h"
@@ -43,15 +44,21 @@ public:
 
 public:
 	virtual void BeginPlay() override;
-	virtual void Tick(float DeltaTime) override;
 	//void UpdateConstantPicking(const URenderer& Renderer, FVector4 UUIDColor) const;
 	//void UpdateConstantDepth(const URenderer& Renderer, int Depth) const;
 	virtual void Render();
 	virtual void CalculateModelMatrix(FMatrix& OutMatrix);
 
+	/**
+	 * 이번 프레임에 상수 버퍼로 올릴 값 (MVP, 색, UUID)을 Game Thread에서 계산합니다.
+	 * @return Primitive Show Flag가 꺼져 있거나 그리지 않는 Component면 false
+	 */
+	bool PrepareDrawConstants(FConstantsComponentData& OutData);
+
 	virtual EPrimitiveType GetType() { return EPrimitiveType::EPT_None; }
 
 	bool IsUseVertexColor() const { return bUseVertexColor; }
+	bool IsBillboard() const { return bIsBillboard; }
 
 	void SetCustomColor(const FVector4& InColor)
 	{
@@ -70,6 +77,7 @@ public:
 
 public:
 	void SetCanBeRendered(bool bRender) { bCanBeRendered = bRender; }
+	bool CanBeRendered() const { return bCanBeRendered; }
 
 	void SetIsOrthoGraphic(bool IsOrtho) { bIsOrthoGraphic = IsOrtho; }
 	bool GetIsOrthoGraphic() const { return bIsOrthoGraphic;}
@@ -92,6 +100,35 @@ public:
 	virtual void UpdateBounds() override;
 protected:
 	float BoundsScale = 1.0f;
+
+public:
+	/** World의 Primitive Tree에 등록된 Proxy Id, 등록 전이면 INDEX_NONE */
+	int32 GetPrimitiveProxyId() const { return PrimitiveProxyId; }
+	void SetPrimitiveProxyId(int32 InProxyId) { PrimitiveProxyId = InProxyId; }
+
+	/** Mesh의 Local AABB를 World로 옮긴 Box, Billboard는 어느 방향을 봐도 감싸도록 구 기준으로 계산합니다. */
+	FBox GetPrimitiveWorldBox();
+
+	/**
+	 * GetPrimitiveWorldBox를 Local Box.TransformBy(World Matrix)로 나눈 것 (여러 Primitive를 한 번에 변환할 때 사용)
+	 * @return Mesh가 없거나 Billboard라서 Local Box로 표현할 수 없으면 false
+	 */
+	bool GetPrimitiveLocalBox(FBox& OutLocalBox, FMatrix& OutWorldMatrix);
+
+	/** UWorld가 Tick 동안 모아 두었다가 한 번에 Tree를 고칠 때 중복 등록을 막는 표시 */
+	bool IsPrimitiveUpdatePending() const { return bPrimitiveUpdatePending; }
+	void SetPrimitiveUpdatePending(bool bPending) { bPrimitiveUpdatePending = bPending; }
+
+	/**
+	 * 그려지는 삼각형과 World Ray의 가장 가까운 교차 (Narrow Phase, Mesh의 BVH를 Local 공간에서 검사)
+	 * DefaultRasterizer처럼 뒷면은 무시하고, 선 Mesh는 맞지 않습니다.
+	 * @param OutDistance Ray 시작점에서의 거리 (Ray 방향이 정규화되어 있어야 World 거리)
+	 */
+	virtual bool RaycastPrimitive(const FRay& WorldRay, float MaxDistance, float& OutDistance);
+
+private:
+	int32 PrimitiveProxyId = INDEX_NONE;
+	bool bPrimitiveUpdatePending = false;
 protected:
 	bool bCanBeRendered = false;
 	bool bIsBillboard = false;
@@ -201,6 +238,9 @@ public:
 	{
 		return EPrimitiveType::EPT_Line;
 	}
+
+	/** 선은 두께가 없으므로 Ray에 맞지 않습니다. */
+	virtual bool RaycastPrimitive(const FRay&, float, float&) override { return false; }
 };
 
 class UCylinderComp : public UPrimitiveComponent
@@ -1,6 +1,7 @@
 #include "UParticleSubUVComponent.h"
 #include "Core/Engine.h"
 #include "Core/Rendering/FDevice.h"
+#include "Core/Rendering/RenderingThread.h"
 #include "Core/Rendering/URenderer.h"
 #include "Object/Actor/Actor.h"
 #include "Object/World/World.h"
@@ -23,8 +24,8 @@ UParticleSubUVComponent::UParticleSubUVComponent()
 
 	GetRenderResourceCollection().SetMesh("Quad");
 	GetRenderResourceCollection().SetMaterial("SubUVMaterial");
-	GetRenderResourceCollection().SetConstantBufferBinding("SubUVVertexConstants", &GetVertexConstantsData(), 0, true, false);
-	GetRenderResourceCollection().SetConstantBufferBinding("SubUVPixelConstants", &GetPixelConstantsData(), 0, false, true);
+	GetRenderResourceCollection().SetConstantBufferBinding("SubUVVertexConstants", &RenderVertexConstants, 0, true, false);
+	GetRenderResourceCollection().SetConstantBufferBinding("SubUVPixelConstants", &RenderPixelConstants, 0, false, true);
 	GetRenderResourceCollection().SetTextureBinding("SubUVTexture", 1, false, true);
 	GetRenderResourceCollection().SetSamplerBinding("LinearSamplerState", 0, false, true);
 
@@ -97,12 +98,12 @@ void UParticleSubUVComponent::CalculateModelMatrix(FMatrix& OutMatrix)
 	FVector right = FVector(0, 0, 1).Cross(lookDir).GetSafeNormal();
 
 	FVector up = lookDir.Cross(right).GetSafeNormal();
-	FMatrix rotationMatrix;
-
-	rotationMatrix.X = FVector4(lookDir.X, lookDir.Y, lookDir.Z, 0);
-	rotationMatrix.Y = FVector4(right.X, right.Y, right.Z, 0);
-	rotationMatrix.Z = FVector4(up.X, up.Y, up.Z, 0);
-	rotationMatrix.W = FVector4(0, 0, 0, 1);
+	const FMatrix rotationMatrix(
+		FVector4(lookDir.X, lookDir.Y, lookDir.Z, 0),
+		FVector4(right.X, right.Y, right.Z, 0),
+		FVector4(up.X, up.Y, up.Z, 0),
+		FVector4(0, 0, 0, 1)
+	);
 
 	FMatrix positionMatrix = FMatrix::GetTranslateMatrix(objectPosition);
 	FMatrix scaleMatrix = FMatrix::GetScaleMatrix(objectScale);
@@ -132,7 +133,12 @@ void UParticleSubUVComponent::Render()
 
 	VertexConstants.MVP = MVP;
 
-	GetRenderResourceCollection().Render();
+	ENQUEUE_RENDER_COMMAND([this, Vertex = VertexConstants, Pixel = PixelConstants, State = GetRenderResourceCollection().ResolvePipelineState()]
+	{
+		RenderVertexConstants = Vertex;
+		RenderPixelConstants = Pixel;
+		GetRenderResourceCollection().Render(State);
+	});
 }
 
 void UParticleSubUVComponent::Play()
@@ -82,6 +82,10 @@ private:
 	FSubUVVertexConstantsData VertexConstants;
     FSubUVPixelConstantsData PixelConstants;
 
+	// Render Thread가 상수 버퍼로 올리는 복사본 (Game Thread는 위의 값만 수정)
+	FSubUVVertexConstantsData RenderVertexConstants;
+	FSubUVPixelConstantsData RenderPixelConstants;
+
 	std::shared_ptr<FVertexBuffer> VertexBuffer = nullptr;
 	std::shared_ptr<FIndexBuffer> IndexBuffer = nullptr;
 	std::shared_ptr<FInputLayout> InputLayout = nullptr;
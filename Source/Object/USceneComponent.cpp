@@ -2,6 +2,7 @@
 #include "Debug/DebugConsole.h"
 #include "PrimitiveComponent/UPrimitiveComponent.h"
 #include "Object/Actor/Actor.h"
+#include "Object/World/World.h"
 
 USceneComponent::USceneComponent()
 {
@@ -25,39 +26,29 @@ void USceneComponent::Tick(float DeltaTime)
 }
 
 // 내 월드 트랜스폼 반환
-const FTransform& USceneComponent::GetWorldTransform()
+// 부모 체인은 UpdateComponentToWorld에서 쿼터니언 합성(FTransform::MultiPly)으로 반영됨
+// World의 Flush 전에 읽어도 Dirty면 부모부터 바로 갱신하므로 항상 최신 값
+const FTransform& USceneComponent::GetWorldTransform() const
 {
+	const_cast<USceneComponent*>(this)->ConditionalUpdateComponentToWorld();
 	return WorldTransform;
 }
 
-FMatrix USceneComponent::GetWorldMatrix() const
+const FMatrix& USceneComponent::GetWorldMatrix() const
 {
-	if (Parent != nullptr)
-	{
-		FMatrix ParentWorld = Parent->GetWorldMatrix();
-		FMatrix MyLocalWithoutScale = RelativeTransform.GetLocalMatrixWithOutScale();
-		FMatrix LocalMatrix = MyLocalWithoutScale * ParentWorld;
-
-		return LocalMatrix * RelativeTransform.GetScaleMatrix();
-	}
-	else
+	const_cast<USceneComponent*>(this)->ConditionalUpdateComponentToWorld();
+	if (bWorldMatrixDirty)
 	{
-		return RelativeTransform.GetMatrix();
+		WorldMatrix = WorldTransform.GetMatrix();
+		bWorldMatrixDirty = false;
 	}
+	return WorldMatrix;
 }
 
-FTransform USceneComponent::GetWorldTransform() const
+void USceneComponent::SetWorldTransformInternal(const FTransform& NewTransform)
 {
-	if (Parent != nullptr)
-	{
-		FTransform parnetTrans = Parent->GetComponentTransform();
-		return parnetTrans;
-	}
-	else
-	{
-		// 부모가 없을 경우 내 로컬
-		return RelativeTransform;
-	}
+	WorldTransform = NewTransform;
+	bWorldMatrixDirty = true;
 }
 
 USceneComponent* USceneComponent::GetParent() const
@@ -77,19 +68,93 @@ bool USceneComponent::MoveComponent(const FVector& Delta, const FVector& NewRota
 
 void USceneComponent::UpdateChildTransforms()
 {
-	for (auto& Child : Children)
+	if (Children.Num() == 0)
 	{
-		if (Child->bComponentToWorldUpdated == false)
+		return;
+	}
+
+	// 자손 전체를 재귀 없이 한 번에 훑음, 앞에서부터 꺼내므로 부모가 항상 자식보다 먼저 갱신됨
+	// 중간에 Getter로 먼저 갱신된 Component 아래에도 Dirty가 남아 있을 수 있어서, 갱신된 것도 건너뛰지 않음
+	TArray<USceneComponent*> Descendants = Children.Array();
+	for (int32 Index = 0; Index < Descendants.Num(); ++Index)
+	{
+		USceneComponent* Child = Descendants[Index];
+
+		Child->ConditionalUpdateComponentToWorld();
+
+		for (USceneComponent* GrandChild : Child->Children)
 		{
-			Child->UpdateComponentToWorld();
+			Descendants.Add(GrandChild);
 		}
-		else
+	}
+}
+
+void USceneComponent::MarkTransformDirty()
+{
+	// 이미 Dirty여도 RelativeTransform은 바뀌었으므로 Hierarchy에는 항상 넘김
+	RequestTransformUpdate();
+
+	// 이미 Dirty면 자손도 모두 Dirty
+	if (bComponentToWorldUpdated == false)
+	{
+		return;
+	}
+
+	bComponentToWorldUpdated = false;
+	if (Children.Num() > 0)
+	{
+		TArray<USceneComponent*> Descendants = Children.Array();
+		for (int32 Index = 0; Index < Descendants.Num(); ++Index)
 		{
-			Child->UpdateComponentToWorld();
+			USceneComponent* Child = Descendants[Index];
+			if (Child->bComponentToWorldUpdated == false)
+			{
+				continue;
+			}
+
+			Child->bComponentToWorldUpdated = false;
+
+			// 부모가 등록되지 않았으면 Hierarchy에서는 Root라서 조상의 Dirty가 닿지 않음
+			if (Child->Parent->TransformHandle == INDEX_NONE)
+			{
+				Child->RequestTransformUpdate();
+			}
+
+			for (USceneComponent* GrandChild : Child->Children)
+			{
+				Descendants.Add(GrandChild);
+			}
 		}
 	}
 }
 
+void USceneComponent::RequestTransformUpdate()
+{
+	// World에 등록되기 전이면 등록할 때 넘어감 (UWorld::RegisterSceneComponent)
+	if (TransformHandle == INDEX_NONE)
+	{
+		return;
+	}
+
+	if (UWorld* World = UEngine::Get().GetWorld())
+	{
+		World->RequestTransformUpdate(this);
+	}
+}
+
+void USceneComponent::ApplyWorldTransform(const FTransform& NewTransform, const FMatrix& NewMatrix)
+{
+	// Getter에서 먼저 갱신됐으면 같은 값이므로 Bounds도 이미 맞음
+	bComponentToWorldUpdated = true;
+	if (WorldTransform.Equal(NewTransform) == false)
+	{
+		WorldTransform = NewTransform;
+		WorldMatrix = NewMatrix;
+		bWorldMatrixDirty = false;
+		UpdateBounds();
+	}
+}
+
 void USceneComponent::UpdateComponentToWorld()
 {
 	UpdateComponentToWorldWithParent(Parent, RelativeTransform.GetRotation());
@@ -100,7 +165,7 @@ FTransform USceneComponent::CalcNewWorldTransform(const FTransform& NewTransform
 	Parent = Parent ? Parent : GetParent();
 	if (Parent != nullptr)
 	{
-		const FTransform ParentToWorld = Parent->GetWorldTransform();
+		const FTransform& ParentToWorld = Parent->GetWorldTransform();
 		FTransform NewWorldTransform = FTransform::MultiPly(NewTransform, ParentToWorld);
 		return NewWorldTransform;
 	}
@@ -133,7 +198,7 @@ bool USceneComponent::InternalSetWorldPositionAndRotation(FVector& InPosition, c
 			RelativeTransform.SetRotation(NewRotation);
 		}
 
-		UpdateComponentToWorldWithParent(Parent, NewRotation);
+		MarkTransformDirty();
 		return true;
 	}
 
@@ -142,13 +207,9 @@ bool USceneComponent::InternalSetWorldPositionAndRotation(FVector& InPosition, c
 
 void USceneComponent::UpdateComponentToWorldWithParent(USceneComponent* Parent, const FQuat& RelativeRotationQuat)
 {
-	if (Parent != nullptr && Parent->bComponentToWorldUpdated == false)
+	if (Parent != nullptr)
 	{
-		Parent->UpdateComponentToWorld();
-		if (bComponentToWorldUpdated == true)
-		{
-			return;
-		}
+		Parent->ConditionalUpdateComponentToWorld();
 	}
 
 	bComponentToWorldUpdated = true;
@@ -161,7 +222,7 @@ void USceneComponent::UpdateComponentToWorldWithParent(USceneComponent* Parent,
 
 	bool bHasChanged;
 	
-	if (GetWorldTransform().Equal(NewTransform) == false)
+	if (WorldTransform.Equal(NewTransform) == false)
 	{
 		bHasChanged = true;
 	}
@@ -173,7 +234,7 @@ void USceneComponent::UpdateComponentToWorldWithParent(USceneComponent* Parent,
 
 	if (bHasChanged)
 	{
-		WorldTransform = NewTransform;
+		SetWorldTransformInternal(NewTransform);
 		PropagateTransformUpdate(true);
 	}
 	else
@@ -184,16 +245,15 @@ void USceneComponent::UpdateComponentToWorldWithParent(USceneComponent* Parent,
 
 void USceneComponent::PropagateTransformUpdate(bool bTransformChanged)
 {
+	UpdateBounds();
+
+	// 자식은 바로 갱신하지 않고 Dirty로만 표시, 읽히거나 World의 Flush에서 갱신됨
 	if (bTransformChanged)
 	{
-		UpdateBounds();
-		UpdateChildTransforms();
-	}
-	else
-	{
-		UpdateBounds();
-		// TODO: Update Bounds
-		UpdateChildTransforms();
+		for (USceneComponent* Child : Children)
+		{
+			Child->MarkTransformDirty();
+		}
 	}
 }
 
@@ -282,7 +342,7 @@ void USceneComponent::SetRelativeScale(const FVector& InScale)
 	if (InScale != GetRelativeScale())
 	{
 		RelativeTransform.SetScale(InScale);
-		UpdateComponentToWorld();
+		MarkTransformDirty();
 	}
 }
 
@@ -489,6 +549,9 @@ void USceneComponent::SetupAttachment(USceneComponent* InParent, bool bUpdateChi
 	{
 		Parent = InParent;
 		InParent->Children.Add(this);
+
+		// 등록된 Component면 Hierarchy의 부모도 여기서 바뀜 (UWorld::RequestTransformUpdate)
+		MarkTransformDirty();
 	}
 	else
 	{
@@ -527,6 +590,14 @@ void USceneComponent::UpdateBounds()
 	{
 		Bounds = CalcBounds(GetComponentTransform());
 	}
+
+	if (SpatialIndexId != INDEX_NONE)
+	{
+		if (UWorld* World = UEngine::Get().GetWorld())
+		{
+			World->UpdateSceneComponent(this);
+		}
+	}
 }
 
 FBoxSphereBounds USceneComponent::CalcBounds(const FTransform& LocalToWorld) const
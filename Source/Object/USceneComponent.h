@@ -74,18 +74,27 @@ public:
 	FVector GetRightVector() const;
 	FVector GetUpVector() const;
 
-	const FTransform& GetComponentTransform() const { return WorldTransform; }
+	const FTransform& GetComponentTransform() const { return GetWorldTransform(); }
 	FVector GetComponentLocation() const { return GetComponentTransform().GetPosition(); }
 	FQuat GetComponentRotation() const { return GetComponentTransform().GetRotation(); }
 	FVector GetComponentScale() const { return GetComponentTransform().GetScale(); }
 
 	/* 월드 트랜스폼을 반환, 이걸로 렌더링한다*/
-	const FTransform& GetWorldTransform();
-
-	FMatrix GetWorldMatrix() const;
+	const FTransform& GetWorldTransform() const;
+
+	/**
+	 * 월드 트랜스폼의 Matrix, 트랜스폼이 바뀐 뒤 처음 요청될 때만 다시 만든다
+	 * 예전에는 LocalNoScale * ParentWorld * LocalScale로 따로 곱해서, 렌더링에 쓰는 GetWorldTransform().GetMatrix()와
+	 * 부모가 회전되어 있거나 Scale이 비균등하면 달랐습니다. 지금은 항상 렌더링 Matrix와 같습니다. (Bench "transform"에서 비교)
+	 */
+	const FMatrix& GetWorldMatrix() const;
 	const FMatrix GetLocalMatrix() const { return RelativeTransform.GetMatrix(); }
 
-	FTransform GetWorldTransform() const;
+	/** 렌더링에 쓰는 Matrix, Fixed Step 사이에서 보간 중이면 보간된 값 (UWorld::InterpolateRenderTransforms) */
+	const FMatrix& GetRenderMatrix() const { return bHasRenderMatrix && bComponentToWorldUpdated ? RenderMatrix : GetWorldMatrix(); }
+	bool HasRenderMatrix() const { return bHasRenderMatrix; }
+	void SetRenderMatrix(const FMatrix& InMatrix) { RenderMatrix = InMatrix; bHasRenderMatrix = true; }
+	void ClearRenderMatrix() { bHasRenderMatrix = false; }
 
 	USceneComponent* GetParent() const;
 
@@ -95,7 +104,7 @@ public:
 	inline void SetComponentToWorld(const FTransform& NewTransform)
 	{
 		RelativeTransform = NewTransform;
-		bComponentToWorldUpdated = true;
+		MarkTransformDirty();
 	}
 
 	inline void ConditionalUpdateComponentToWorld()
@@ -109,7 +118,23 @@ public:
 public:
 	void UpdateComponentToWorld();
 
+	/** Dirty인 자손을 부모부터 차례로 갱신 */
 	void UpdateChildTransforms();
+
+	/**
+	 * RelativeTransform이나 부모가 바뀌면 호출합니다.
+	 * 자신과 자손을 Dirty로 표시하고 World의 FTransformHierarchy에 RelativeTransform을 넘겨, 다음 UWorld::Tick에서 한 번에 갱신합니다.
+	 */
+	void MarkTransformDirty();
+
+	/** UWorld::FlushTransformUpdates에서 FTransformHierarchy가 계산한 World Transform / Matrix를 받음 */
+	void ApplyWorldTransform(const FTransform& NewTransform, const FMatrix& NewMatrix);
+
+	bool IsComponentToWorldUpdated() const { return bComponentToWorldUpdated; }
+
+	/** World의 FTransformHierarchy에 등록된 Handle, 등록 전이면 INDEX_NONE */
+	int32 GetTransformHandle() const { return TransformHandle; }
+	void SetTransformHandle(int32 InHandle) { TransformHandle = InHandle; }
 protected:
 	FTransform CalcNewWorldTransform(const FTransform& NewTransform, const USceneComponent* Parent = nullptr) const;
 
@@ -119,6 +144,10 @@ protected:
 
 	void PropagateTransformUpdate(bool bTransformChanged);
 
+	void SetWorldTransformInternal(const FTransform& NewTransform);
+
+	void RequestTransformUpdate();
+
 	bool MoveComponentImpl(const FVector& Delta, const FQuat& NewRotation);
 
 	void Pick(bool bPicked);
@@ -142,6 +171,14 @@ protected:
 	// 이건 내 월드 트랜스폼
 	FTransform WorldTransform = FTransform();
 
+	// WorldTransform으로 만든 Matrix 캐시, bWorldMatrixDirty이면 GetWorldMatrix에서 다시 계산
+	mutable FMatrix WorldMatrix;
+	mutable bool bWorldMatrixDirty = true;
+
+	// 이전 Fixed Step과 보간한 Matrix, 그 뒤로 Transform이 바뀌어 Dirty가 되면 무시됨
+	FMatrix RenderMatrix;
+	bool bHasRenderMatrix = false;
+
 	// debug
 protected:
 	bool bIsPicked = false;
@@ -157,7 +194,10 @@ public:
 	// 정확도보다는 성능을 우선시하는 최적화 옵션으로, 계산 비용을 줄이는 대신 경계 계산의 정밀도가 다소 떨어질 수 있습니다.
 	bool bComputeFastLocalBounds = false;
 private:
+	/** false면 WorldTransform이 RelativeTransform / 부모와 맞지 않음, 이 Component가 Dirty면 자손도 모두 Dirty */
 	bool bComponentToWorldUpdated = false;
+
+	int32 TransformHandle = INDEX_NONE;
 public:
 	virtual FBoxSphereBounds GetLocalBounds() const;
 
@@ -166,6 +206,10 @@ public:
 	virtual void UpdateBounds();
 
 	virtual FBoxSphereBounds CalcBounds(const FTransform& LocalToWorld) const;
+
+	/** World의 Spatial Index에 등록된 Id, 등록 전이면 INDEX_NONE */
+	int32 GetSpatialIndexId() const { return SpatialIndexId; }
+	void SetSpatialIndexId(int32 InId) { SpatialIndexId = InId; }
 public:
 	FBoxSphereBounds Bounds;
 
@@ -174,4 +218,7 @@ public:
 	FVector Max;
 
 	//TODO : 빌보드 컴포넌트 추가
+
+private:
+	int32 SpatialIndexId = INDEX_NONE;
 };
\ No newline at end of file
@@ -1,8 +1,11 @@
 #include "World.h"
+#include <algorithm>
 #include <cassert>
-#include "Core/Utils/JsonSavehelper.h"
+#include <chrono>
+#include "Core/Utils/JsonSaveHelper.h"
 
 #include "Core/Container/Map.h"
+#include "Core/Math/BatchTransform.h"
 #include "Core/Input/PlayerInput.h"
 #include "Object/Actor/Camera.h"
 #include <Object/Gizmo/GizmoHandle.h>
@@ -12,15 +15,22 @@
 #include "Object/Actor/Cylinder.h"
 #include "Object/Actor/Sphere.h"
 #include "Object/PrimitiveComponent/UPrimitiveComponent.h"
+#include "Resource/Material.h"
+#include "Resource/Mesh.h"
 #include "Static/FEditorManager.h"
 #include "Static/FLineBatchManager.h"
 #include "Static/FUUIDBillBoard.h"
 #include <Core/Math/Ray.h>
 
+#include "Core/Rendering/DrawCommandList.h"
+#include "Core/Rendering/FDevice.h"
+#include "Core/Rendering/RenderingThread.h"
+#include "Core/Rendering/Software/SoftwareRasterizer.h"
 #include "Core/Rendering/URenderer.h"
 #include "Object/Actor/Arrow.h"
 #include "Object/Actor/Picker.h"
 #include "Core/Config/ConfigManager.h"
+#include "Core/Stats/Stats.h"
 #include "Object/Gizmo/GizmoActor.h"
 
 #include "Resource/Mesh.h"
@@ -32,6 +42,16 @@ void UWorld::InitWorld()
 {
 	//TODO : 
 	GridSize = FString::ToFloat(UConfigManager::Get().GetValue(TEXT("World"), TEXT("GridSize")));
+
+	// [World] SpatialIndex = Grid면 Hash Grid, 기본은 Loose Octree
+	const FString SpatialIndexValue = UConfigManager::Get().GetValue(TEXT("World"), TEXT("SpatialIndex"));
+	SpatialIndex = FSpatialIndex::Create(SpatialIndexValue == "Grid" ? ESpatialIndexType::HashGrid : ESpatialIndexType::LooseOctree);
+
+	// [Render] OcclusionCulling = false면 Frustum Culling만
+	bOcclusionCulling = UConfigManager::Get().GetValue(TEXT("Render"), TEXT("OcclusionCulling")) != "false";
+
+	// [Render] SortDrawCommands = false면 정렬 / 중복 바인딩 생략 없이 제출
+	bSortDrawCommands = UConfigManager::Get().GetValue(TEXT("Render"), TEXT("SortDrawCommands")) != "false";
 }
 
 void UWorld::BeginPlay()
@@ -47,26 +67,95 @@ void UWorld::BeginPlay()
 	}, GetUUID());
 }
 
-void UWorld::Tick(float DeltaTime)
+void UWorld::BeginPlayPendingActors()
 {
 	for (const auto& Actor : ActorsToSpawn)
 	{
 		Actor->BeginPlay();
 	}
 	ActorsToSpawn.Empty();
+}
 
+void UWorld::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER("World Tick");
+	BeginPlayPendingActors();
+
+	// Tick 동안 움직인 Component의 Transform과 Bounds, Tree 갱신은 모아서 한 번에
+	bDeferPrimitiveUpdates = true;
+	{
+		SCOPE_CYCLE_COUNTER("Actors Tick");
+		const auto CopyActors = Actors;
+		for (const auto& Actor : CopyActors)
+		{
+			if (Actor->CanEverTick())
+			{
+				Actor->Tick(DeltaTime);
+			}
+		}
+	}
+	FlushTransformUpdates();
+	FlushPrimitiveUpdates();
+}
+
+void UWorld::TickFixed(float FixedDeltaTime)
+{
+	SCOPE_CYCLE_COUNTER("World TickFixed");
+	BeginPlayPendingActors();
+
+	// Step 밖에서 바뀐 Transform은 보간 없이 먼저 반영하고, 지금 값을 보간의 시작으로 삼음
+	FlushTransformUpdates();
+	TransformHierarchy.BeginFixedStep();
+
+	bDeferPrimitiveUpdates = true;
 	const auto CopyActors = Actors;
 	for (const auto& Actor : CopyActors)
 	{
 		if (Actor->CanEverTick())
 		{
-			Actor->Tick(DeltaTime);
+			Actor->TickFixed(FixedDeltaTime);
+		}
+	}
+	FlushTransformUpdates(true);
+	FlushPrimitiveUpdates();
+}
+
+void UWorld::InterpolateRenderTransforms(float Alpha)
+{
+	ClearRenderTransforms();
+
+	for (const int32 Index : TransformHierarchy.GetInterpolatedIndices())
+	{
+		USceneComponent* Component = static_cast<USceneComponent*>(TransformHierarchy.GetUserData(Index));
+		if (Component == nullptr || Component->HasRenderMatrix() || !TransformHierarchy.IsInterpolated(Index))
+		{
+			continue;
 		}
+
+		// 등록되지 않은 조상 아래의 Component는 Hierarchy 값이 맞지 않으므로 보간하지 않음 (FlushTransformUpdates 참고)
+		const USceneComponent* Root = static_cast<USceneComponent*>(TransformHierarchy.GetUserData(TransformHierarchy.GetRootIndex(Index)));
+		if (Root == nullptr || Root->GetParent() != nullptr)
+		{
+			continue;
+		}
+
+		Component->SetRenderMatrix(TransformHierarchy.GetInterpolatedTransform(Index, Alpha).GetMatrix());
+		RenderInterpolatedComponents.Add(Component);
+	}
+}
+
+void UWorld::ClearRenderTransforms()
+{
+	for (USceneComponent* Component : RenderInterpolatedComponents)
+	{
+		Component->ClearRenderMatrix();
 	}
+	RenderInterpolatedComponents.Empty();
 }
 
 void UWorld::LateTick(float DeltaTime)
 {
+	SCOPE_CYCLE_COUNTER("World LateTick");
 	const auto CopyActors = Actors;
 	for (const auto& Actor : CopyActors)
 	{
@@ -79,7 +168,7 @@ void UWorld::LateTick(float DeltaTime)
 	for (const auto& PendingActor : PendingDestroyActors)
 	{
 		// Engine에서 제거
-		UEngine::Get().GObjects.Remove(PendingActor->GetUUID());
+		UEngine::Get().RemoveObject(PendingActor->GetUUID());
 	}
 	PendingDestroyActors.Empty();
 }
@@ -91,6 +180,7 @@ void UWorld::OnDestroy()
 
 void UWorld::Render()
 {
+	SCOPE_CYCLE_COUNTER("World Render");
 	URenderer* Renderer = UEngine::Get().GetRenderer();
 
 	//라인 렌더링 임시
@@ -99,6 +189,9 @@ void UWorld::Render()
 
 	if (Renderer == nullptr)
 	{
+		// Headless: Window가 없어도 Culling → Draw 목록 → Render Thread 제출까지는 같은 경로로 실행 (RHI는 Null 백엔드)
+		Camera->UpdateCameraMatrix();
+		SubmitMainDrawCommands();
 		return;
 	}
 
@@ -111,7 +204,7 @@ void UWorld::Render()
 	//	RenderPickingTexture(*Renderer);
 	//}
 
-	RenderMainTexture(*Renderer);
+	RenderMainTexture();
 
 	FLineBatchManager::Get().Render();
 
@@ -167,34 +260,240 @@ void UWorld::RenderPickingTexture(URenderer& Renderer)
 	}
 }
 
-void UWorld::RenderMainTexture(URenderer& Renderer)
+void UWorld::RenderMainTexture()
 {
+	SCOPE_CYCLE_COUNTER("RenderMainTexture");
 	// Renderer.Prepare();
 	// Renderer.PrepareShader();
 	// Renderer.PrepareMain();
 
 	//Renderer.PrepareMainShader();
-	for (auto& RenderComponent : RenderComponents)
+	SubmitMainDrawCommands();
+
+	ENQUEUE_RENDER_COMMAND([] { FDevice::Get().SetRenderTarget(); });
+}
+
+void UWorld::SubmitMainDrawCommands()
+{
+	CullRenderComponents(Camera->GetViewProjectionMatrix());
+
+	// 1. 보이는 것마다 정렬 키 + 상수 데이터를 만들고 정렬
+	std::shared_ptr<FDrawCommandList> DrawList = AcquireDrawCommandList();
+	BuildDrawCommands(*DrawList);
+	if (bSortDrawCommands)
 	{
-		if (RenderComponent->GetOwner()->GetDepth() > 0)
+		SCOPE_CYCLE_COUNTER("Sort Draw Commands");
+		DrawList->Sort();
+	}
+
+	// 2. Render Thread에서 정렬 순서대로 제출 (Main → Foreground)
+	ENQUEUE_RENDER_COMMAND([DrawList, bSkipRedundantBinds = bSortDrawCommands]
+	{
+		URenderer::SubmitDrawCommands(*DrawList, bSkipRedundantBinds);
+	});
+}
+
+void UWorld::BuildDrawCommands(FDrawCommandList& DrawList)
+{
+	SCOPE_CYCLE_COUNTER("Build Draw Commands");
+	DrawList.Reset();
+
+	const FVector ViewOrigin = Camera->GetActorTransform().GetPosition();
+	const FVector ViewForward = Camera->GetForward();
+
+	auto AddComponent = [&](EDrawPass Pass, UPrimitiveComponent* Component)
+	{
+		FRenderResourceCollection& Resources = Component->GetRenderResourceCollection();
+		const std::shared_ptr<FMesh> Mesh = Resources.GetMesh();
+		const std::shared_ptr<FMaterial> Material = Resources.GetMaterial();
+		FConstantsComponentData Constants;
+		// Headless에는 Material이 없으므로 Material 0으로 묶고 Mesh끼리 정렬
+		if (Mesh == nullptr || (Material == nullptr && FDevice::Get().IsInit()) || !Component->PrepareDrawConstants(Constants))
+		{
+			return;
+		}
+
+		const uint32 MaterialId = Material != nullptr ? Material->GetResourceId() : 0;
+		const float ViewDepth = (Component->GetWorldTransform().GetPosition() - ViewOrigin).Dot(ViewForward);
+		DrawList.Add(DrawSortKey::Make(Pass, MaterialId, Mesh->GetResourceId(), ViewDepth), Component, Resources.ResolvePipelineState(), Constants);
+	};
+
+	for (UPrimitiveComponent* RenderComponent : VisibleRenderComponents)
+	{
+		AddComponent(EDrawPass::Main, RenderComponent);
+	}
+	for (UPrimitiveComponent* RenderComponent : ZIgnoreRenderComponents)
+	{
+		AddComponent(EDrawPass::Foreground, RenderComponent);
+	}
+}
+
+std::shared_ptr<FDrawCommandList> UWorld::AcquireDrawCommandList()
+{
+	for (const std::shared_ptr<FDrawCommandList>& DrawList : DrawCommandListPool)
+	{
+		if (DrawList.use_count() == 1)
+		{
+			return DrawList;
+		}
+	}
+	DrawCommandListPool.Add(std::make_shared<FDrawCommandList>());
+	return DrawCommandListPool[DrawCommandListPool.Num() - 1];
+}
+
+void UWorld::RenderSoftware(FSoftwareRasterizer& Rasterizer)
+{
+	Camera->UpdateCameraMatrix();
+	const FMatrix& ViewProjectionMatrix = Camera->GetViewProjectionMatrix();
+
+	auto DrawComponent = [&Rasterizer, &ViewProjectionMatrix](UPrimitiveComponent* Component)
+	{
+		const std::shared_ptr<FMesh> Mesh = Component->GetRenderResourceCollection().GetMesh();
+		if (!Component->CanBeRendered() || Mesh == nullptr)
+		{
+			return;
+		}
+
+		FMatrix ModelMatrix;
+		Component->CalculateModelMatrix(ModelMatrix);
+
+		FSoftwareDrawState State;
+		State.MVP = ModelMatrix * ViewProjectionMatrix;
+		State.Color = Component->GetCustomColor();
+		State.UUID = Component->GetUUID();
+		State.bUseVertexColor = Component->IsUseVertexColor();
+
+		const std::span<const FVertexSimple> Vertices = Mesh->GetVertexBuffer()->GetCPUVertices<FVertexSimple>();
+		const std::span<const uint32> Indices = Mesh->GetIndexBuffer()->GetCPUIndices();
+		if (Mesh->GetTopology() == D3D11_PRIMITIVE_TOPOLOGY_LINELIST)
+		{
+			Rasterizer.DrawIndexedLines(Vertices, Indices, State);
+		}
+		else
+		{
+			Rasterizer.DrawIndexedTriangles(Vertices, Indices, State);
+		}
+	};
+
+	CullRenderComponents(ViewProjectionMatrix);
+	for (UPrimitiveComponent* RenderComponent : VisibleRenderComponents)
+	{
+		DrawComponent(RenderComponent);
+	}
+	Rasterizer.Flush();
+
+	// PickingPrepare처럼 비어 있는 별도 깊이 버퍼에 그려서 항상 위에 보임
+	Rasterizer.ClearDepth(1.0f);
+	for (auto& RenderComponent : ZIgnoreRenderComponents)
+	{
+		DrawComponent(RenderComponent);
+	}
+	Rasterizer.Flush();
+}
+
+void UWorld::CullRenderComponents(const FMatrix& ViewProjection)
+{
+	const auto Start = std::chrono::steady_clock::now();
+
+	CullingCandidates.Empty();
+	CullingBounds.Reset(RenderComponents.Num());
+	for (UPrimitiveComponent* RenderComponent : RenderComponents)
+	{
+		if (RenderComponent->GetOwner()->GetDepth() > 0 || !RenderComponent->CanBeRendered())
 		{
 			continue;
 		}
-		uint32 depth = RenderComponent->GetOwner()->GetDepth();
-		// RenderComponent->UpdateConstantDepth(Renderer, depth);
-		RenderComponent->Render();
+
+		// Tree의 Fat AABB는 UpdateBounds마다 갱신되고 실제 Box보다 조금 크므로, 보이는 것을 잘못 빼지 않음
+		// (USceneComponent::Bounds는 BoxExtent를 채우지 않는 Component가 있어서 쓰지 않음)
+		const int32 ProxyId = RenderComponent->GetPrimitiveProxyId();
+		CullingBounds.Add(ProxyId != INDEX_NONE ? PrimitiveTree.GetFatBox(ProxyId) : RenderComponent->GetPrimitiveWorldBox());
+		CullingCandidates.Add(RenderComponent);
 	}
 
-	FDevice::Get().PickingPrepare();
+	const int32 NumInFrustum = FrustumCulling::CullBoxes(FFrustum::FromViewProjection(ViewProjection), CullingBounds, CullingVisibleIndices);
+	VisibleRenderComponents.SetNum(NumInFrustum);
+	for (int32 Index = 0; Index < NumInFrustum; ++Index)
+	{
+		VisibleRenderComponents[Index] = CullingCandidates[CullingVisibleIndices[Index]];
+	}
 
-	//Renderer.PrepareZIgnore();
-	for (auto& RenderComponent: ZIgnoreRenderComponents)
+	CullingStats.NumOccluders = 0;
+	CullingStats.NumOccluded = 0;
+	CullingStats.OcclusionMs = 0.0;
+	if (bOcclusionCulling && Camera)
 	{
-		uint32 depth = RenderComponent->GetOwner()->GetDepth();
-		RenderComponent->Render();
+		CullOccludedComponents(ViewProjection);
+	}
+
+	const int32 NumVisible = VisibleRenderComponents.Num();
+	CullingStats.NumTested = CullingCandidates.Num();
+	CullingStats.NumVisible = NumVisible;
+	CullingStats.NumCulled = CullingCandidates.Num() - NumVisible;
+	CullingStats.CullMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - Start).count();
+}
+
+void UWorld::CullOccludedComponents(const FMatrix& ViewProjection)
+{
+	const auto Start = std::chrono::steady_clock::now();
+
+	auto GetVisibleBox = [this](int32 VisibleIndex)
+	{
+		const int32 Index = CullingVisibleIndices[VisibleIndex];
+		const FVector Center(CullingBounds.CenterX[Index], CullingBounds.CenterY[Index], CullingBounds.CenterZ[Index]);
+		const FVector Extent(CullingBounds.ExtentX[Index], CullingBounds.ExtentY[Index], CullingBounds.ExtentZ[Index]);
+		return FBox(Center - Extent, Center + Extent);
+	};
+
+	// 화면에서 큰 삼각형 Mesh만 Occluder 후보 (Billboard는 Camera를 향해 돌아서 Model 행렬이 실제와 다름)
+	const FVector ViewOrigin = Camera->GetActorTransform().GetPosition();
+	OccluderCandidates.Empty();
+	for (int32 VisibleIndex = 0; VisibleIndex < VisibleRenderComponents.Num(); ++VisibleIndex)
+	{
+		UPrimitiveComponent* Component = VisibleRenderComponents[VisibleIndex];
+		const std::shared_ptr<FMesh> Mesh = Component->GetRenderResourceCollection().GetMesh();
+		if (Mesh == nullptr || Mesh->GetTopology() != D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST || Component->IsBillboard()
+			|| Mesh->GetVertexBuffer()->GetCPUVertices<FVertexSimple>().empty())
+		{
+			continue;
+		}
+		OccluderCandidates.Add({FOcclusionCuller::GetOccluderScore(GetVisibleBox(VisibleIndex), ViewOrigin), VisibleIndex});
 	}
 
-	FDevice::Get().SetRenderTarget();
+	const int32 NumOccluders = std::min(OccluderCandidates.Num(), MaxOccluders);
+	std::partial_sort(
+		OccluderCandidates.GetData(), OccluderCandidates.GetData() + NumOccluders, OccluderCandidates.GetData() + OccluderCandidates.Num(),
+		[](const std::pair<float, int32>& A, const std::pair<float, int32>& B) { return A.first > B.first; }
+	);
+
+	OcclusionCuller.BeginFrame(ViewProjection);
+	for (int32 Rank = 0; Rank < NumOccluders; ++Rank)
+	{
+		UPrimitiveComponent* Component = VisibleRenderComponents[OccluderCandidates[Rank].second];
+		const std::shared_ptr<FMesh> Mesh = Component->GetRenderResourceCollection().GetMesh();
+
+		FMatrix ModelMatrix;
+		Component->CalculateModelMatrix(ModelMatrix);
+		OcclusionCuller.RenderOccluder(
+			Mesh->GetVertexBuffer()->GetCPUVertices<FVertexSimple>(), Mesh->GetIndexBuffer()->GetCPUIndices(), ModelMatrix
+		);
+	}
+	OcclusionCuller.BuildHierarchy();
+
+	// 순서를 지키며 가려진 것만 뺌 (Occluder 자신은 자기 깊이보다 앞에 있으므로 빠지지 않음)
+	int32 NumVisible = 0;
+	for (int32 VisibleIndex = 0; VisibleIndex < VisibleRenderComponents.Num(); ++VisibleIndex)
+	{
+		if (!OcclusionCuller.IsOccluded(GetVisibleBox(VisibleIndex)))
+		{
+			VisibleRenderComponents[NumVisible++] = VisibleRenderComponents[VisibleIndex];
+		}
+	}
+
+	CullingStats.NumOccluders = NumOccluders;
+	CullingStats.NumOccluded = VisibleRenderComponents.Num() - NumVisible;
+	VisibleRenderComponents.SetNum(NumVisible);
+	CullingStats.OcclusionMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - Start).count();
 }
 
 // void UWorld::DisplayPickingTexture(URenderer& Renderer)
@@ -252,147 +551,428 @@ void UWorld::SaveWorld()
 void UWorld::AddZIgnoreComponent(UPrimitiveComponent* InComponent)
 {
 	ZIgnoreRenderComponents.Add(InComponent);
+	RegisterPrimitive(InComponent);
 	//InComponent->SetIsOrthoGraphic(true);
 }
 
-void UWorld::LoadWorld(const char* InSceneName)
+void UWorld::RemoveZIgnoreComponent(UPrimitiveComponent* InComponent)
 {
-	if (InSceneName == nullptr || strcmp(InSceneName, "") == 0){
-		return;
-	}
+	ZIgnoreRenderComponents.Remove(InComponent);
+	UnregisterPrimitive(InComponent);
+}
 
-	const std::unique_ptr<UWorldInfo> WorldInfo = JsonSaveHelper::LoadScene(InSceneName);
-	if (WorldInfo == nullptr) return;
+void UWorld::AddRenderComponent(UPrimitiveComponent* Component)
+{
+	RenderComponents.Add(Component);
+	RegisterPrimitive(Component);
+}
 
-	ClearWorld();
+void UWorld::RemoveRenderComponent(UPrimitiveComponent* Component)
+{
+	RenderComponents.Remove(Component);
+	UnregisterPrimitive(Component);
+}
 
-	Version = WorldInfo->Version;
-	this->SceneName = WorldInfo->SceneName;
+void UWorld::RegisterPrimitive(UPrimitiveComponent* Component)
+{
+	if (Component->GetPrimitiveProxyId() == INDEX_NONE)
+	{
+		Component->SetPrimitiveProxyId(PrimitiveTree.CreateProxy(Component->GetPrimitiveWorldBox(), Component));
+	}
+}
 
-	// Type 확인
-	while (!WorldInfo->ObjectInfos.empty())
+void UWorld::UnregisterPrimitive(UPrimitiveComponent* Component)
+{
+	// Gizmo처럼 두 목록에 모두 있으면 마지막으로 빠질 때 제거
+	const int32 ProxyId = Component->GetPrimitiveProxyId();
+	if (ProxyId == INDEX_NONE || RenderComponents.Contains(Component) || ContainsZIgnoreComponent(Component))
 	{
-		const std::unique_ptr<UObjectInfo> ObjectInfo = std::move(WorldInfo->ObjectInfos.front());
-		WorldInfo->ObjectInfos.pop();
+		return;
+	}
+	if (Component->IsPrimitiveUpdatePending())
+	{
+		PendingPrimitiveUpdates.Remove(Component);
+		Component->SetPrimitiveUpdatePending(false);
+	}
+	PrimitiveTree.DestroyProxy(ProxyId);
+	Component->SetPrimitiveProxyId(INDEX_NONE);
+}
 
-		FTransform Transform = FTransform(ObjectInfo->Location, FQuat(), ObjectInfo->Scale);
-		Transform.Rotate(ObjectInfo->Rotation);
+void UWorld::UpdatePrimitive(UPrimitiveComponent* Component)
+{
+	const int32 ProxyId = Component->GetPrimitiveProxyId();
+	if (ProxyId == INDEX_NONE)
+	{
+		return;
+	}
 
-		AActor* Actor = nullptr;
-		
-		if (ObjectInfo->ObjectType == "Actor")
+	if (bDeferPrimitiveUpdates)
+	{
+		if (!Component->IsPrimitiveUpdatePending())
 		{
-			Actor = SpawnActor<AActor>();
+			Component->SetPrimitiveUpdatePending(true);
+			PendingPrimitiveUpdates.Add(Component);
 		}
-		else if (ObjectInfo->ObjectType == "Sphere")
+		return;
+	}
+	PrimitiveTree.MoveProxy(ProxyId, Component->GetPrimitiveWorldBox());
+}
+
+void UWorld::FlushPrimitiveUpdates()
+{
+	bDeferPrimitiveUpdates = false;
+	if (PendingPrimitiveUpdates.Num() == 0)
+	{
+		return;
+	}
+	SCOPE_CYCLE_COUNTER("FlushPrimitiveUpdates");
+
+	// Local Box로 표현되는 것만 앞쪽에 모아서 한 번에 변환, Billboard 등은 바로 처리
+	PendingLocalBoxes.SetNum(PendingPrimitiveUpdates.Num());
+	PendingWorldMatrices.SetNum(PendingPrimitiveUpdates.Num());
+	int32 NumBatched = 0;
+	for (UPrimitiveComponent* Component : PendingPrimitiveUpdates)
+	{
+		Component->SetPrimitiveUpdatePending(false);
+		if (Component->GetPrimitiveProxyId() == INDEX_NONE)
 		{
-			Actor = SpawnActor<ASphere>();
+			continue;
 		}
-		else if (ObjectInfo->ObjectType == "Cube")
+
+		if (Component->GetPrimitiveLocalBox(PendingLocalBoxes[NumBatched], PendingWorldMatrices[NumBatched]))
 		{
-			Actor = SpawnActor<ACube>();
+			PendingPrimitiveUpdates[NumBatched++] = Component;
 		}
-		else if (ObjectInfo->ObjectType == "Arrow")
+		else
 		{
-			Actor = SpawnActor<AArrow>();
+			PrimitiveTree.MoveProxy(Component->GetPrimitiveProxyId(), Component->GetPrimitiveWorldBox());
 		}
-		else if (ObjectInfo->ObjectType == "Cylinder")
+	}
+
+	PendingWorldBoxes.SetNum(NumBatched);
+	BatchTransform::TransformBoxes(
+		std::span<const FBox>(PendingLocalBoxes.GetData(), NumBatched),
+		std::span<const FMatrix>(PendingWorldMatrices.GetData(), NumBatched),
+		std::span<FBox>(PendingWorldBoxes.GetData(), NumBatched)
+	);
+	for (int32 Index = 0; Index < NumBatched; ++Index)
+	{
+		PrimitiveTree.MoveProxy(PendingPrimitiveUpdates[Index]->GetPrimitiveProxyId(), PendingWorldBoxes[Index]);
+	}
+	PendingPrimitiveUpdates.Empty();
+}
+
+UPrimitiveComponent* UWorld::LineTraceSingle(const FRay& Ray, float MaxDistance, float& OutDistance, const std::function<bool(UPrimitiveComponent*)>& Filter) const
+{
+	UPrimitiveComponent* HitComponent = nullptr;
+	PrimitiveTree.RayCast(Ray, MaxDistance, [&](int32 ProxyId, float CurrentMaxDistance)
+	{
+		UPrimitiveComponent* Component = static_cast<UPrimitiveComponent*>(PrimitiveTree.GetUserData(ProxyId));
+		if (!Component->CanBeRendered() || (Filter && !Filter(Component)))
 		{
-			Actor = SpawnActor<ACylinder>();
+			return CurrentMaxDistance;
 		}
-		else if (ObjectInfo->ObjectType == "Cone")
+
+		float Distance;
+		if (Component->RaycastPrimitive(Ray, CurrentMaxDistance, Distance))
 		{
-			Actor = SpawnActor<ACone>();
+			HitComponent = Component;
+			OutDistance = Distance;
+			return Distance;
 		}
-		
-		Actor->SetActorTransform(Transform);
+		return CurrentMaxDistance;
+	});
+	return HitComponent;
+}
+
+UPrimitiveComponent* UWorld::SegmentTraceSingle(const FVector& Start, const FVector& End, float& OutDistance, const std::function<bool(UPrimitiveComponent*)>& Filter) const
+{
+	const FVector Delta = End - Start;
+	const float Length = Delta.Length();
+	if (Length <= 0.0f)
+	{
+		return nullptr;
 	}
+	return LineTraceSingle(FRay(Start, Delta / Length), Length, OutDistance, Filter);
 }
 
-void UWorld::RayCasting(const FVector& MouseNDCPos)
+void UWorld::OverlapBox(const FBox& Box, TArray<UPrimitiveComponent*>& OutComponents) const
 {
-	FMatrix ProjMatrix = Camera->GetProjectionMatrix(); 
-	FRay worldRay = FRay(Camera->GetViewMatrix(), ProjMatrix, MouseNDCPos.X, MouseNDCPos.Y);
+	PrimitiveTree.QueryBox(Box, [this, &OutComponents](int32 ProxyId)
+	{
+		OutComponents.Add(static_cast<UPrimitiveComponent*>(PrimitiveTree.GetUserData(ProxyId)));
+		return true;
+	});
+}
 
-	FLineBatchManager::Get().AddLine(worldRay.GetOrigin(), worldRay.GetDirection() * Camera->GetFar(), FVector4::CYAN);
+void UWorld::QueryFrustum(const FFrustum& Frustum, TArray<UPrimitiveComponent*>& OutComponents) const
+{
+	PrimitiveTree.QueryFrustum(Frustum, [this, &OutComponents](int32 ProxyId)
+	{
+		OutComponents.Add(static_cast<UPrimitiveComponent*>(PrimitiveTree.GetUserData(ProxyId)));
+		return true;
+	});
+}
 
-	AActor* SelectedActor = nullptr;
-	float minDistance = FLT_MAX;
+void UWorld::RegisterSceneComponent(USceneComponent* Component)
+{
+	// 등록 전에 바뀐 Transform은 목록에 들어가지 않았으므로 여기서 Bounds까지 맞춤
+	Component->ConditionalUpdateComponentToWorld();
+	if (SpatialIndex && Component->GetSpatialIndexId() == INDEX_NONE)
+	{
+		Component->SetSpatialIndexId(SpatialIndex->Add(Component->Bounds.GetBox(), Component));
+	}
 
-	for (auto& Actor : Actors)
+	if (Component->GetTransformHandle() == INDEX_NONE)
 	{
-		UPrimitiveComponent* PrimitiveComponent = Actor->GetComponentByClass<UPrimitiveComponent>();
-		if (PrimitiveComponent == nullptr)
+		const USceneComponent* Parent = Component->GetParent();
+		const int32 ParentHandle = Parent ? Parent->GetTransformHandle() : INDEX_NONE;
+		const int32 Handle = TransformHierarchy.Add(Component->GetRelativeTransform(), ParentHandle, Component);
+		Component->SetTransformHandle(Handle);
+
+		// 먼저 등록된 자식은 Root로 들어가 있으므로 이어 붙임
+		for (USceneComponent* Child : Component->GetChildren())
 		{
-			continue;
+			if (Child->GetTransformHandle() != INDEX_NONE)
+			{
+				TransformHierarchy.SetParent(Child->GetTransformHandle(), Handle);
+			}
 		}
+	}
+}
 
-		FMatrix primWorldMat = PrimitiveComponent->GetComponentTransform().GetMatrix();
-		FRay localRay = FRay::TransformRayToLocal(worldRay, primWorldMat.Inverse());
+void UWorld::UnregisterSceneComponent(USceneComponent* Component)
+{
+	// 자식은 다음 Update에서 Hierarchy의 Root가 되고, Flush에서 부모 체인으로 계산됨
+	if (Component->GetTransformHandle() != INDEX_NONE)
+	{
+		TransformHierarchy.Remove(Component->GetTransformHandle());
+		Component->SetTransformHandle(INDEX_NONE);
+	}
+	if (Component->HasRenderMatrix())
+	{
+		Component->ClearRenderMatrix();
+		RenderInterpolatedComponents.Remove(Component);
+	}
 
-		std::shared_ptr<FMesh> CurMesh = PrimitiveComponent->GetMesh();
-		CurMesh->GetVertexBuffer();
+	const int32 Id = Component->GetSpatialIndexId();
+	if (SpatialIndex && Id != INDEX_NONE)
+	{
+		SpatialIndex->Remove(Id);
+		Component->SetSpatialIndexId(INDEX_NONE);
+	}
+}
 
-		float outT = 0.0f;
-		bool bHit = false;
+void UWorld::UpdateSceneComponent(USceneComponent* Component)
+{
+	const int32 Id = Component->GetSpatialIndexId();
+	if (SpatialIndex && Id != INDEX_NONE)
+	{
+		SpatialIndex->Update(Id, Component->Bounds.GetBox());
+	}
+}
 
-		switch (PrimitiveComponent->GetType())
-		{
-		case EPrimitiveType::EPT_Cube:
+void UWorld::RequestTransformUpdate(USceneComponent* Component)
+{
+	const int32 Handle = Component->GetTransformHandle();
+	if (Handle == INDEX_NONE)
+	{
+		return;
+	}
+
+	const USceneComponent* Parent = Component->GetParent();
+	TransformHierarchy.SetParent(Handle, Parent ? Parent->GetTransformHandle() : INDEX_NONE);
+	TransformHierarchy.SetLocalTransform(Handle, Component->GetRelativeTransform());
+}
+
+void UWorld::FlushTransformUpdates(bool bFixedStep)
+{
+	if (!TransformHierarchy.HasPendingUpdates())
+	{
+		return;
+	}
+	SCOPE_CYCLE_COUNTER("FlushTransformUpdates");
+
+	// 부모가 항상 앞에 있으므로 Index 순서대로 반영하면 UpdateBounds에서 읽는 부모도 이미 최신
+	TransformHierarchy.Update(bFixedStep);
+	for (const int32 Index : TransformHierarchy.GetUpdatedIndices())
+	{
+		USceneComponent* Component = static_cast<USceneComponent*>(TransformHierarchy.GetUserData(Index));
+		if (Component == nullptr)
 		{
-			bHit = FRayCast::IntersectRayAABB(localRay, FVector(-0.5f, -0.5f, -0.5f), FVector(0.5f, 0.5f, 0.5f), outT);
-			if (bHit)
-			{
-				UE_LOG("Cube Hit");
-			}
-			break;
+			continue;
 		}
-		case EPrimitiveType::EPT_Sphere:
+
+		// Hierarchy의 Root인데 부모가 있으면 등록되지 않은 조상을 빠뜨린 값이므로 부모 체인으로 계산
+		const USceneComponent* Root = static_cast<USceneComponent*>(TransformHierarchy.GetUserData(TransformHierarchy.GetRootIndex(Index)));
+		if (Root == nullptr || Root->GetParent() != nullptr)
 		{
-			bHit = FRayCast::InsertSectRaySphere(localRay, PrimitiveComponent->GetActorPosition(), 0.5f, outT);
-			if (bHit)
-			{
-				UE_LOG("Sphere Hit");
-			}
-			break;
+			Component->ConditionalUpdateComponentToWorld();
+			continue;
 		}
-		case EPrimitiveType::EPT_Cylinder:
+
+		Component->ApplyWorldTransform(TransformHierarchy.GetWorldTransform(Index), TransformHierarchy.GetWorldMatrix(Index));
+	}
+}
+
+void UWorld::SetSpatialIndexType(ESpatialIndexType Type)
+{
+	if (SpatialIndex && SpatialIndex->GetType() == Type)
+	{
+		return;
+	}
+
+	// 새 Index에 등록되어 있던 Component만 다시 넣음
+	SpatialIndex = FSpatialIndex::Create(Type);
+	for (AActor* Actor : Actors)
+	{
+		for (UActorComponent* Component : Actor->GetComponents())
 		{
-			bHit = FRayCast::IntersectRayAABB(localRay, FVector(0, -0.5f, 0), FVector(0, 0.5f, 0), outT);
-			if (bHit)
+			USceneComponent* SceneComponent = dynamic_cast<USceneComponent*>(Component);
+			if (SceneComponent && SceneComponent->GetSpatialIndexId() != INDEX_NONE)
 			{
-				UE_LOG("Cylinder Hit");
+				SceneComponent->SetSpatialIndexId(SpatialIndex->Add(SceneComponent->Bounds.GetBox(), SceneComponent));
 			}
-			break;
 		}
-		case EPrimitiveType::EPT_Cone:
-		{
-			break;
-		}
-		case EPrimitiveType::EPT_Triangle:
-		{
-			break; 
-		}
-		default:
-			break;
-		}
-		// 4. 교차가 발생했다면, 월드 좌표에서의 거리를 비교하여 최소 거리를 가진 액터 선택
-		if (bHit)
+	}
+	UE_LOG("Spatial Index: %s, %d components", SpatialIndex->GetName(), SpatialIndex->Num());
+}
+
+void UWorld::ResolveSpatialQuery(TArray<USceneComponent*>& OutComponents) const
+{
+	OutComponents.SetNum(SpatialQueryIds.Num());
+	for (int32 Index = 0; Index < SpatialQueryIds.Num(); ++Index)
+	{
+		OutComponents[Index] = static_cast<USceneComponent*>(SpatialIndex->GetUserData(SpatialQueryIds[Index]));
+	}
+}
+
+void UWorld::OverlapSphereComponents(const FVector& Center, float Radius, TArray<USceneComponent*>& OutComponents) const
+{
+	OutComponents.Empty();
+	if (SpatialIndex)
+	{
+		SpatialIndex->QuerySphere(Center, Radius, SpatialQueryIds);
+		ResolveSpatialQuery(OutComponents);
+	}
+}
+
+void UWorld::OverlapBoxComponents(const FBox& Box, TArray<USceneComponent*>& OutComponents) const
+{
+	OutComponents.Empty();
+	if (SpatialIndex)
+	{
+		SpatialIndex->QueryBox(Box, SpatialQueryIds);
+		ResolveSpatialQuery(OutComponents);
+	}
+}
+
+void UWorld::OverlapFrustumComponents(const FFrustum& Frustum, TArray<USceneComponent*>& OutComponents) const
+{
+	OutComponents.Empty();
+	if (SpatialIndex)
+	{
+		SpatialIndex->QueryFrustum(Frustum, SpatialQueryIds);
+		ResolveSpatialQuery(OutComponents);
+	}
+}
+
+void UWorld::FindNearestComponents(const FVector& Point, int32 Count, TArray<USceneComponent*>& OutComponents, float MaxDistance) const
+{
+	OutComponents.Empty();
+	if (SpatialIndex)
+	{
+		SpatialIndex->QueryNearest(Point, Count, SpatialQueryIds, MaxDistance);
+		ResolveSpatialQuery(OutComponents);
+	}
+}
+
+void UWorld::LoadWorld(const char* InSceneName)
+{
+	if (InSceneName == nullptr || strcmp(InSceneName, "") == 0){
+		return;
+	}
+	SCOPE_CYCLE_COUNTER("LoadWorld");
+
+	const std::unique_ptr<UWorldInfo> WorldInfo = JsonSaveHelper::LoadScene(InSceneName);
+	if (WorldInfo == nullptr) return;
+
+	ClearWorld();
+
+	Version = WorldInfo->Version;
+	this->SceneName = WorldInfo->SceneName;
+
+	// Type 확인
+	while (!WorldInfo->ObjectInfos.empty())
+	{
+		const std::unique_ptr<UObjectInfo> ObjectInfo = std::move(WorldInfo->ObjectInfos.front());
+		WorldInfo->ObjectInfos.pop();
+
+		FTransform Transform = FTransform(ObjectInfo->Location, FQuat(), ObjectInfo->Scale);
+		Transform.Rotate(ObjectInfo->Rotation);
+
+		if (AActor* Actor = SpawnActorByTypeName(ObjectInfo->ObjectType))
 		{
-			float distance = worldRay.GetPoint(outT).Length();
-			if (distance < minDistance)
-			{
-				minDistance = distance;
-				SelectedActor = Actor;
-				FUUIDBillBoard::Get().SetTarget(SelectedActor);
-			}
+			Actor->SetActorTransform(Transform);
 		}
 	}
+}
 
-	if (SelectedActor)
+AActor* UWorld::SpawnActorByTypeName(const std::string& TypeName)
+{
+	if (TypeName == "Actor")
 	{
-		FEditorManager::Get().SelectActor(SelectedActor);
+		return SpawnActor<AActor>();
 	}
+	if (TypeName == "Sphere")
+	{
+		return SpawnActor<ASphere>();
+	}
+	if (TypeName == "Cube")
+	{
+		return SpawnActor<ACube>();
+	}
+	if (TypeName == "Arrow")
+	{
+		return SpawnActor<AArrow>();
+	}
+	if (TypeName == "Cylinder")
+	{
+		return SpawnActor<ACylinder>();
+	}
+	if (TypeName == "Cone")
+	{
+		return SpawnActor<ACone>();
+	}
+
+	UE_LOG("Unknown actor type: %s", TypeName.c_str());
+	return nullptr;
+}
+
+void UWorld::RayCasting(const FVector& MouseNDCPos)
+{
+	FMatrix ProjMatrix = Camera->GetProjectionMatrix(); 
+	FRay worldRay = FRay(Camera->GetViewMatrix(), ProjMatrix, MouseNDCPos.X, MouseNDCPos.Y);
+
+	FLineBatchManager::Get().AddLine(worldRay.GetOrigin(), worldRay.GetDirection() * Camera->GetFar(), FVector4::CYAN);
+
+	// Primitive Tree로 후보를 줄이고, 그려지는 삼각형으로 정확히 검사
+	// FPickingManager::PickCPU와 같이 Gizmo (ZIgnore, Depth > 0)와 그리지 않는 Component는 제외
+	float Distance;
+	UPrimitiveComponent* HitComponent = LineTraceSingle(worldRay, Camera->GetFar(), Distance, [this](UPrimitiveComponent* Component)
+	{
+		const AActor* Owner = Component->GetOwner();
+		return RenderComponents.Contains(Component) && Owner->GetDepth() == 0 && dynamic_cast<const IGizmoInterface*>(Owner) == nullptr;
+	});
+	if (HitComponent == nullptr)
+	{
+		return;
+	}
+
+	AActor* SelectedActor = HitComponent->GetOwner();
+	UE_LOG("%s Hit (%.3f)", SelectedActor->GetTypeName(), Distance);
+	FUUIDBillBoard::Get().SetTarget(SelectedActor);
+	FEditorManager::Get().SelectActor(SelectedActor);
 }
 
 void UWorld::PickByPixel(const FVector& MousePos)
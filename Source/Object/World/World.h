@@ -1,18 +1,43 @@
 #pragma once
+#include <functional>
+#include <memory>
+
 #include "Core/Container/Array.h"
 #include "Core/Container/Set.h"
+#include "Core/Math/DynamicAABBTree.h"
+#include "Core/Math/FrustumCulling.h"
+#include "Core/Math/SpatialIndex.h"
+#include "Core/Math/TransformHierarchy.h"
 #include "Core/Math/Vector.h"
+#include "Core/Rendering/Software/OcclusionCuller.h"
 #include "Core/UObject/Object.h"
 #include "Core/UObject/ObjectMacros.h"
-#include "Core/Utils/JsonSavehelper.h"
+#include "Core/Utils/JsonSaveHelper.h"
 #include "Debug/DebugConsole.h"
 #include "Object/ObjectFactory.h"
 
 
 class URenderer;
 class AActor;
+class FDrawCommandList;
+class FSoftwareRasterizer;
 
 class UPrimitiveComponent;
+class USceneComponent;
+
+/** 마지막 Frustum / Occlusion Culling 결과 */
+struct FViewCullingStats
+{
+	int32 NumTested = 0;
+	int32 NumVisible = 0;
+	int32 NumCulled = 0;
+	double CullMs = 0.0;
+
+	/** Frustum Culling 뒤에 Occlusion으로 더 뺀 수 (NumVisible, NumCulled에 포함됨) */
+	int32 NumOccluders = 0;
+	int32 NumOccluded = 0;
+	double OcclusionMs = 0.0;
+};
 
 class UWorld :public UObject
 {
@@ -28,36 +53,133 @@ public:
 	void Tick(float DeltaTime);
 	void LateTick(float DeltaTime);
 
+	/** 고정 간격 시뮬레이션 한 번, Fixed Step이 켜져 있으면 Tick 전에 한 프레임에 0번 이상 호출됨 (UEngine) */
+	void TickFixed(float FixedDeltaTime);
+
+	/**
+	 * 마지막 Fixed Step에서 움직인 Component의 렌더링 Matrix를 그 Step 전의 Transform과 보간해서 설정합니다.
+	 * @param Alpha 마지막 Step 뒤에 쌓인 시간 / Step 간격 (0이면 Step 전, 1이면 마지막 Step)
+	 */
+	void InterpolateRenderTransforms(float Alpha);
+
+	/** 보간된 렌더링 Matrix를 모두 지움, Fixed Step을 끄면 호출 */
+	void ClearRenderTransforms();
+
 	void OnDestroy();
 
 	template <typename T>
 		requires std::derived_from<T, AActor>
 	T* SpawnActor();
   
+	/** Scene 파일과 같은 이름("Cube", "Sphere" 등)으로 Actor를 생성합니다. 모르는 이름이면 nullptr */
+	AActor* SpawnActorByTypeName(const std::string& TypeName);
+
 	bool DestroyActor(AActor* InActor);
 	
 	void Render();
 	void RenderPickingTexture(URenderer& Renderer);
 	//void DisplayPickingTexture(URenderer& Renderer);
-	void RenderMainTexture(URenderer& Renderer);
+	void RenderMainTexture();
+
+	/** RenderMainTexture와 같은 순서로 CPU Rasterizer에 그립니다. (Headless Golden Image용, Mesh의 CPU 사본 필요) */
+	void RenderSoftware(FSoftwareRasterizer& Rasterizer);
+
+	/**
+	 * RenderComponents 중 ViewProjection의 Frustum과 겹치는 것만 그릴 목록에 남깁니다.
+	 * Owner Depth가 0이 아니거나 그리지 않는 Component도 여기서 빠지므로, 목록 밖은 Render 비용이 없습니다.
+	 * Occlusion Culling이 켜져 있으면 그 뒤에 큰 Occluder에 완전히 가려진 것도 뺍니다.
+	 */
+	void CullRenderComponents(const FMatrix& ViewProjection);
+	const TArray<UPrimitiveComponent*>& GetVisibleRenderComponents() const { return VisibleRenderComponents; }
+	const FViewCullingStats& GetCullingStats() const { return CullingStats; }
+
+	/** [Render] OcclusionCulling = false면 Frustum Culling만 합니다. */
+	void SetOcclusionCullingEnabled(bool bEnabled) { bOcclusionCulling = bEnabled; }
+	bool IsOcclusionCullingEnabled() const { return bOcclusionCulling; }
+
+	/** [Render] SortDrawCommands = false면 Culling 순서 그대로, Draw마다 모든 리소스를 다시 바인딩합니다. (비교용) */
+	void SetSortDrawCommandsEnabled(bool bEnabled) { bSortDrawCommands = bEnabled; }
+	bool IsSortDrawCommandsEnabled() const { return bSortDrawCommands; }
 
 	void ClearWorld();
 	void LoadWorld(const char* InSceneName);
 	void SaveWorld();
 
 	void AddZIgnoreComponent(UPrimitiveComponent* InComponent);
-	void RemoveZIgnoreComponent(UPrimitiveComponent* InComponent) {ZIgnoreRenderComponents.Remove(InComponent); }
+	void RemoveZIgnoreComponent(UPrimitiveComponent* InComponent);
 	bool ContainsZIgnoreComponent(UPrimitiveComponent* InComponent) {return ZIgnoreRenderComponents.Find(InComponent) != -1; }
 	
 	// render
-	void AddRenderComponent(UPrimitiveComponent* Component) { RenderComponents.Add(Component); }
-	void RemoveRenderComponent(UPrimitiveComponent* Component) { RenderComponents.Remove(Component); }
+	void AddRenderComponent(UPrimitiveComponent* Component);
+	void RemoveRenderComponent(UPrimitiveComponent* Component);
+	const TSet<UPrimitiveComponent*>& GetRenderComponents() const { return RenderComponents; }
+	const TArray<UPrimitiveComponent*>& GetZIgnoreRenderComponents() const { return ZIgnoreRenderComponents; }
 
 	inline ACamera* GetCamera() const { return Camera; }
 	void SetCamera(ACamera* NewCamera) { Camera = NewCamera; }
 
 	void RayCasting(const FVector& MouseNDCPos);
 
+	// Primitive Tree
+	/**
+	 * Primitive의 Transform이나 Mesh가 바뀌면 호출, Fat AABB를 벗어났을 때만 Tree를 고칩니다.
+	 * Tick 중에는 모아 두었다가 Tick이 끝날 때 FlushPrimitiveUpdates에서 한 번에 처리합니다.
+	 */
+	void UpdatePrimitive(UPrimitiveComponent* Component);
+
+	/** 모아 둔 Primitive의 World Box를 BatchTransform::TransformBoxes로 한 번에 계산해서 Tree에 반영합니다. */
+	void FlushPrimitiveUpdates();
+	const FDynamicAABBTree& GetPrimitiveTree() const { return PrimitiveTree; }
+
+	/**
+	 * Ray가 처음 맞는 Primitive (삼각형 단위)
+	 * @param Filter false를 반환하는 Component는 건너뜁니다. (nullptr이면 모두 검사)
+	 */
+	UPrimitiveComponent* LineTraceSingle(const FRay& Ray, float MaxDistance, float& OutDistance, const std::function<bool(UPrimitiveComponent*)>& Filter = nullptr) const;
+
+	/** Start에서 End 사이에서 처음 맞는 Primitive, OutDistance는 Start부터의 거리 */
+	UPrimitiveComponent* SegmentTraceSingle(const FVector& Start, const FVector& End, float& OutDistance, const std::function<bool(UPrimitiveComponent*)>& Filter = nullptr) const;
+
+	/** Fat AABB가 Box와 겹치는 Primitive (보수적, 실제 모양과는 겹치지 않을 수 있음) */
+	void OverlapBox(const FBox& Box, TArray<UPrimitiveComponent*>& OutComponents) const;
+
+	/** Fat AABB가 Frustum과 겹치는 Primitive */
+	void QueryFrustum(const FFrustum& Frustum, TArray<UPrimitiveComponent*>& OutComponents) const;
+
+	// Spatial Index
+	/** Actor의 모든 Scene Component를 Bounds로 넣습니다. (Primitive Tree와 달리 Mesh가 없는 Component도 포함) */
+	void RegisterSceneComponent(USceneComponent* Component);
+	void UnregisterSceneComponent(USceneComponent* Component);
+
+	/** Component의 Bounds가 바뀌면 호출 (USceneComponent::UpdateBounds) */
+	void UpdateSceneComponent(USceneComponent* Component);
+
+	/** Transform이 Dirty가 된 Component의 RelativeTransform과 부모를 Hierarchy에 넘김 (USceneComponent::MarkTransformDirty) */
+	void RequestTransformUpdate(USceneComponent* Component);
+
+	/**
+	 * Hierarchy에서 바뀐 World Transform을 한 번에 계산해서 Component에 반영, 아무것도 안 움직였으면 비용 없음
+	 * @param bFixedStep TickFixed 안의 갱신이면 true, 움직인 Component는 렌더링할 때 Step 전의 Transform과 보간됨
+	 */
+	void FlushTransformUpdates(bool bFixedStep = false);
+	const FTransformHierarchy& GetTransformHierarchy() const { return TransformHierarchy; }
+
+	/** 등록된 Component를 유지한 채 Loose Octree / Hash Grid를 바꿉니다. */
+	void SetSpatialIndexType(ESpatialIndexType Type);
+	const FSpatialIndex* GetSpatialIndex() const { return SpatialIndex.get(); }
+
+	/** Bounds가 구와 겹치는 Component, OutComponents는 비우고 채웁니다. */
+	void OverlapSphereComponents(const FVector& Center, float Radius, TArray<USceneComponent*>& OutComponents) const;
+
+	/** Bounds가 Box와 겹치는 Component */
+	void OverlapBoxComponents(const FBox& Box, TArray<USceneComponent*>& OutComponents) const;
+
+	/** Bounds가 Frustum과 겹치는 Component */
+	void OverlapFrustumComponents(const FFrustum& Frustum, TArray<USceneComponent*>& OutComponents) const;
+
+	/** Point에서 Bounds까지 가까운 순서로 최대 Count개 */
+	void FindNearestComponents(const FVector& Point, int32 Count, TArray<USceneComponent*>& OutComponents, float MaxDistance = FLT_MAX) const;
+
 	void PickByPixel(const FVector& MousePos);
 
 	TArray<AActor*>& GetActors() { return Actors; }
@@ -84,6 +206,68 @@ protected:
 	TArray<AActor*> PendingDestroyActors; // TODO: 추후에 TQueue로 변경
 	TSet<UPrimitiveComponent*> RenderComponents;
 
+	/** RenderComponents와 ZIgnoreRenderComponents의 Primitive마다 Proxy 하나 (둘 다에 있어도 하나) */
+	FDynamicAABBTree PrimitiveTree;
+
+	/** 등록된 Scene Component의 Local / World Transform, UserData는 USceneComponent* */
+	FTransformHierarchy TransformHierarchy;
+
+	/** SetRenderMatrix로 보간된 Matrix를 받은 Component */
+	TArray<USceneComponent*> RenderInterpolatedComponents;
+
+	/** Tick 동안 UpdatePrimitive가 들어온 Primitive, Flush할 때 쓰는 Box / Matrix 배열은 매 프레임 재사용 */
+	bool bDeferPrimitiveUpdates = false;
+	TArray<UPrimitiveComponent*> PendingPrimitiveUpdates;
+	TArray<FBox> PendingLocalBoxes;
+	TArray<FMatrix> PendingWorldMatrices;
+	TArray<FBox> PendingWorldBoxes;
+
+	/** 모든 Scene Component의 Bounds, [World] SpatialIndex = Octree | Grid */
+	std::unique_ptr<FSpatialIndex> SpatialIndex;
+
+	/** Spatial Query의 Id 결과를 받는 배열 (Game Thread에서만 Query하므로 하나를 재사용) */
+	mutable TArray<int32> SpatialQueryIds;
+
+	/** Culling 입력 (CullingCandidates와 같은 순서의 Box), 매 프레임 재사용 */
+	FCullingBounds CullingBounds;
+	TArray<UPrimitiveComponent*> CullingCandidates;
+	TArray<int32> CullingVisibleIndices;
+
+	/** CullRenderComponents의 결과, RenderComponents를 순회한 순서 그대로 */
+	TArray<UPrimitiveComponent*> VisibleRenderComponents;
+	FViewCullingStats CullingStats;
+
+	/** Frustum Culling 뒤에 도는 Software HiZ, 화면에서 큰 Occluder MaxOccluders개만 그립니다. */
+	static constexpr int32 MaxOccluders = 16;
+	bool bOcclusionCulling = true;
+	FOcclusionCuller OcclusionCuller;
+	TArray<std::pair<float, int32>> OccluderCandidates;
+
+	/** Culling 뒤 Draw 목록을 만들고 정렬해서 Render Thread에 제출을 넘김 (Window와 Headless 공통) */
+	void SubmitMainDrawCommands();
+
+	/** 보이는 Primitive와 ZIgnore Primitive를 정렬 키와 함께 Draw 목록으로 */
+	void BuildDrawCommands(FDrawCommandList& DrawList);
+
+	/** Render Thread가 아직 제출하지 않은 목록 (use_count > 1)은 건너뛰고 재사용 */
+	std::shared_ptr<FDrawCommandList> AcquireDrawCommandList();
+
+	bool bSortDrawCommands = true;
+	TArray<std::shared_ptr<FDrawCommandList>> DrawCommandListPool;
+
+private:
+	/** SpawnActor로 생성된 Actor의 BeginPlay, Tick과 TickFixed 중 먼저 호출되는 쪽에서 처리 */
+	void BeginPlayPendingActors();
+
+	void RegisterPrimitive(UPrimitiveComponent* Component);
+	void UnregisterPrimitive(UPrimitiveComponent* Component);
+
+	/** VisibleRenderComponents (CullingVisibleIndices 순서)에서 Occluder에 가려진 것을 뺍니다. */
+	void CullOccludedComponents(const FMatrix& ViewProjection);
+
+	/** SpatialQueryIds를 Component로 바꿔서 OutComponents에 씁니다. */
+	void ResolveSpatialQuery(TArray<USceneComponent*>& OutComponents) const;
+
 // Editor Only
 public:
 	//TArray<class ULayer*> Layers;
@@ -2,6 +2,7 @@
 
 #include <d3dcompiler.h>
 #include "Core/Rendering/FDevice.h"
+#include "Core/RHI/D3D11RHI.h"
 #include "Debug/DebugConsole.h"
 
 
@@ -25,7 +26,12 @@ void FBlendState::Setting()
 		UE_LOG("Error: BlendState Setting Failed");
 	}
 
-	FDevice::Get().GetDeviceContext()->OMSetBlendState(State, nullptr, Mask);
+	FRHI::Get().SetBlendState(D3D11RHI::ToRHI(State), nullptr, Mask);
+}
+
+FRHIBlendState* FBlendState::GetRHIState() const
+{
+	return D3D11RHI::ToRHI(State);
 }
 
 void FBlendState::ResCreate(const D3D11_BLEND_DESC& _Desc)
@@ -5,6 +5,7 @@
 
 #include "Resource/Resource.h"
 #include "Core/Container/String.h"
+#include "Core/RHI/RHI.h"
 
 
 class FBlendState: public FResource<FBlendState> 
@@ -23,6 +24,9 @@ public:
 
 	void Setting();
 
+	FRHIBlendState* GetRHIState() const;
+	uint32 GetMask() const { return Mask; }
+
 protected:
 	void ResCreate(const D3D11_BLEND_DESC& _Desc);
 
@@ -2,10 +2,15 @@
 
 #include <d3dcompiler.h>
 #include "Core/Rendering/FDevice.h"
+#include "Core/RHI/D3D11RHI.h"
 
+#include "Core/Stats/StatCounter.h"
 #include "Debug/DebugConsole.h"
 
 
+DECLARE_STAT_COUNTER(STAT_ConstantBufferUpdates, "RHI", "Constant Buffer Updates");
+DECLARE_STAT_COUNTER(STAT_ConstantBufferBytes, "RHI", "Constant Buffer Upload Bytes");
+
 FConstantBuffer::FConstantBuffer()
 {
 }
@@ -29,63 +34,51 @@ void FConstantBuffer::ChangeData(const void* _Data, UINT _Size)
 		return;
 	}
 
-	D3D11_MAPPED_SUBRESOURCE Data = {};
-	
-	FDevice::Get().GetDeviceContext()->Map(Buffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &Data);
-
-	// 그래픽카드에 직접 슬수있는 주소값을 담아줍니다.
-	// Data
-
-	if (Data.pData == nullptr)
-	{
-		MsgBoxAssert("Error: not able to obtain the permission to modify the buffer") ;
-		return;
-	}
+	// Map 실패는 백엔드에서 처리합니다.
+	FRHI::Get().UpdateBuffer(GetRHIBuffer(), _Data, BufferInfo.ByteWidth);
+	INC_STAT_COUNTER(STAT_ConstantBufferUpdates, 1);
+	INC_STAT_COUNTER(STAT_ConstantBufferBytes, BufferInfo.ByteWidth);
 
-	memcpy_s(Data.pData, BufferInfo.ByteWidth, _Data, BufferInfo.ByteWidth);
-	
-	FDevice::Get().GetDeviceContext()->Unmap(Buffer, 0);
-	
 }
 
 void FConstantBuffer::VSSetting(UINT _Slot)
 {
-	if (nullptr == Buffer)
+	if (nullptr == GetRHIBuffer())
 	{
 		MsgBoxAssert("Error: FConstantBuffer Setting Failed") ;
 	}
 
-	FDevice::Get().GetDeviceContext()->VSSetConstantBuffers(_Slot, 1, &Buffer);
+	FRHI::Get().SetConstantBuffer(ERHIShaderStage::Vertex, _Slot, GetRHIBuffer());
 }
 
 void FConstantBuffer::PSSetting(UINT _Slot)
 {
-	if (nullptr == Buffer)
+	if (nullptr == GetRHIBuffer())
 	{
 		MsgBoxAssert("Error: FConstantBuffer Setting Failed") ;
 	}
 
-	FDevice::Get().GetDeviceContext()->PSSetConstantBuffers(_Slot, 1, &Buffer);
+	FRHI::Get().SetConstantBuffer(ERHIShaderStage::Pixel, _Slot, GetRHIBuffer());
 }
 
 void FConstantBuffer::CSSetting(UINT _Slot)
 {
-	if (nullptr == Buffer)
+	if (nullptr == GetRHIBuffer())
 	{
 		MsgBoxAssert("Error: FConstantBuffer Setting Failed") ;
 	}
 
-	FDevice::Get().GetDeviceContext()->CSSetConstantBuffers(_Slot, 1, &Buffer);
+	FRHI::Get().SetConstantBuffer(ERHIShaderStage::Compute, _Slot, GetRHIBuffer());
 }
 
 void FConstantBuffer::GSSetting(UINT _Slot)
 {
-	if (nullptr == Buffer)
+	if (nullptr == GetRHIBuffer())
 	{
 		MsgBoxAssert("Error: FConstantBuffer Setting Failed") ;
 	}
 
-	FDevice::Get().GetDeviceContext()->GSSetConstantBuffers(_Slot, 1, &Buffer);
+	FRHI::Get().SetConstantBuffer(ERHIShaderStage::Geometry, _Slot, GetRHIBuffer());
 }
 
 void FConstantBuffer::ResCreate(int _ByteSize)
@@ -99,6 +92,13 @@ void FConstantBuffer::ResCreate(int _ByteSize)
 
 
 	
+	// Headless: Device 대신 지금 RHI 백엔드에 만듦
+	if (nullptr == FDevice::Get().GetDevice())
+	{
+		CreateRHIBuffer(ERHIBufferUsage::Constant, nullptr);
+		return;
+	}
+
 	//                                                                 초기화
 	if (S_OK != FDevice::Get().GetDevice()->CreateBuffer(&BufferInfo, nullptr, &Buffer))
 	{
@@ -1,6 +1,7 @@
 #include "DepthStencilState.h"
 #include <d3dcompiler.h>
 #include "Core/Rendering/FDevice.h"
+#include "Core/RHI/D3D11RHI.h"
 #include "Debug/DebugConsole.h"
 
 FDepthStencilState::FDepthStencilState()
@@ -23,7 +24,12 @@ void FDepthStencilState::Setting()
 		UE_LOG("Error: FDepthStencilState Setting Failed");
 	}
 
-	FDevice::Get().GetDeviceContext()->OMSetDepthStencilState(State, 0);
+	FRHI::Get().SetDepthStencilState(D3D11RHI::ToRHI(State), 0);
+}
+
+FRHIDepthStencilState* FDepthStencilState::GetRHIState() const
+{
+	return D3D11RHI::ToRHI(State);
 }
 
 void FDepthStencilState::ResCreate(const D3D11_DEPTH_STENCIL_DESC& _Desc)
@@ -5,6 +5,7 @@
 
 #include "Resource/Resource.h"
 #include "Core/Container/String.h"
+#include "Core/RHI/RHI.h"
 
 
 class FDepthStencilState:
@@ -24,6 +25,8 @@ public:
 
 	void Setting();
 
+	FRHIDepthStencilState* GetRHIState() const;
+
 protected:
 	void ResCreate(const D3D11_DEPTH_STENCIL_DESC& _Desc);
 
@@ -1,5 +1,8 @@
 #include "DirectBuffer.h"
 
+#include "Core/RHI/D3D11RHI.h"
+#include "Core/Rendering/RenderingThread.h"
+
 FDirectBuffer::FDirectBuffer()
 {
 }
@@ -9,6 +12,19 @@ FDirectBuffer::~FDirectBuffer()
 	BufferRelease();
 }
 
+FRHIBuffer* FDirectBuffer::GetRHIBuffer() const
+{
+	return nullptr != Buffer ? D3D11RHI::ToRHI(Buffer) : HeadlessBuffer;
+}
+
+void FDirectBuffer::CreateRHIBuffer(ERHIBufferUsage Usage, const void* InitialData)
+{
+	// Null 백엔드의 Buffer 목록은 Render Thread에서도 읽으므로 남은 Command를 먼저 비움
+	FRenderingThread::Get().Flush();
+
+	HeadlessBuffer = FRHI::Get().CreateBuffer(Usage, BufferInfo.ByteWidth, BufferInfo.Usage == D3D11_USAGE_DYNAMIC, InitialData);
+}
+
 void FDirectBuffer::BufferRelease()
 {
 	if (nullptr != Buffer)
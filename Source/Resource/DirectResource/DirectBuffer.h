@@ -1,6 +1,8 @@
 #pragma once
 #include <d3d11.h>
 
+#include "Core/RHI/RHI.h"
+
 class FDirectBuffer
 {
 public:
@@ -14,11 +16,23 @@ public:
 	FDirectBuffer& operator=(const FDirectBuffer& _Other) = delete;
 	FDirectBuffer& operator=(FDirectBuffer&& _Other) noexcept = delete;
 
+	/** D3D11 Buffer, Device가 없으면 (Headless) 지금 RHI 백엔드에서 만든 Buffer */
+	FRHIBuffer* GetRHIBuffer() const;
+
 protected:
 	D3D11_BUFFER_DESC BufferInfo = {0};
 	// 모든 버퍼들은 그 용도가 무엇이건 나오는 인터페이스는 버퍼로 동일되다.
 	ID3D11Buffer* Buffer = nullptr;
+
+	/**
+	 * Headless: Device 대신 지금 RHI 백엔드 (Null)에 BufferInfo.ByteWidth 크기로 만듦
+	 * 백엔드가 해제까지 가지고 있으므로 BufferRelease에서 따로 해제하지 않습니다.
+	 */
+	void CreateRHIBuffer(ERHIBufferUsage Usage, const void* InitialData);
 	
 	void BufferRelease();
+
+private:
+	FRHIBuffer* HeadlessBuffer = nullptr;
 	
 };
@@ -1,16 +1,21 @@
 #include "IndexBuffer.h"
+
+#include <cstring>
+
 #include "Core/Engine.h"
 #include "Core/Rendering/URenderer.h"
 #include "Debug/DebugConsole.h"
 #include "d3d11.h"
 
 #include "Core/Rendering/FDevice.h"
+#include "Core/RHI/D3D11RHI.h"
 
 void FIndexBuffer::Setting() const
 {
 	// ID3D11Buffer* Arr[1];
 
-	if (nullptr == Buffer)
+	FRHIBuffer* RHIBuffer = GetRHIBuffer();
+	if (nullptr == RHIBuffer)
 	{
 		MsgBoxAssert("Error: FIndexBuffer Setting Failed");
 	}
@@ -18,19 +23,13 @@ void FIndexBuffer::Setting() const
 	if (bIsDynamic == false)
 	{
 		// 버텍스버퍼를 여러개 넣어줄수 있다.
-		FDevice::Get().GetDeviceContext()->IASetIndexBuffer(Buffer, Format, Offset);
+		FRHI::Get().SetIndexBuffer(RHIBuffer, D3D11RHI::ToRHIIndexFormat(Format), Offset);
 	}
 	else
 	{
-		// 버텍스 버퍼 업데이트
-		D3D11_MAPPED_SUBRESOURCE mappedResource;
 		// 인덱스 버퍼 업데이트
-		FDevice::Get().GetDeviceContext()->Map(Buffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &mappedResource);
-		memcpy(mappedResource.pData, CPUDataPtr, IndexSize * IndexCount);
-		FDevice::Get().GetDeviceContext()->Unmap(Buffer, 0);
-
-		
-		FDevice::Get().GetDeviceContext()->IASetIndexBuffer(Buffer, DXGI_FORMAT_R32_UINT, 0);
+		FRHI::Get().UpdateBuffer(RHIBuffer, CPUDataPtr, IndexSize * IndexCount);
+		FRHI::Get().SetIndexBuffer(RHIBuffer, ERHIIndexFormat::UInt32, 0);
 	}
 }
 
@@ -46,6 +45,17 @@ void FIndexBuffer::ResCreate(const void* _Data, size_t _IndexCount)
 	D3D11_SUBRESOURCE_DATA Data;
 	Data.pSysMem = _Data;
 
+	// CPU Picking, Software Rasterizer용 사본
+	CPUData.SetNum(static_cast<int32>(IndexCount));
+	std::memcpy(CPUData.GetData(), _Data, IndexCount * sizeof(uint32));
+
+	// Headless: Device 대신 지금 RHI 백엔드에 만듦
+	if (nullptr == FDevice::Get().GetDevice())
+	{
+		CreateRHIBuffer(ERHIBufferUsage::Index, _Data);
+		return;
+	}
+
 	if (S_OK != FDevice::Get().GetDevice()->CreateBuffer(&BufferInfo, &Data, &Buffer))
 	{
 		MsgBoxAssert("Error: FIndexBuffer Create Failed") ;
@@ -65,6 +75,12 @@ void FIndexBuffer::ResCreateDynamic(const void* _Data, size_t _IndexCount)
 	BufferInfo.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
 	BufferInfo.Usage = D3D11_USAGE_DYNAMIC;
 
+	if (nullptr == FDevice::Get().GetDevice())
+	{
+		CreateRHIBuffer(ERHIBufferUsage::Index, nullptr);
+		return;
+	}
+
 	if (S_OK != FDevice::Get().GetDevice()->CreateBuffer(&BufferInfo, nullptr, &Buffer))
 	{
 		MsgBoxAssert("Error: FIndexBuffer Create Failed") ;
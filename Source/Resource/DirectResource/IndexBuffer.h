@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <span>
 
 #include "Resource/Resource.h"
 #include "DirectBuffer.h"
@@ -39,6 +40,9 @@ static std::shared_ptr<FIndexBuffer> Create(const FString&  _Name, const TArray<
 		return IndexCount;
 	}
 
+	/** 정적 버퍼의 인덱스 사본 (CPU Picking, Software Rasterizer), 동적 버퍼는 비어 있습니다. */
+	std::span<const uint32> GetCPUIndices() const { return {CPUData.GetData(), static_cast<size_t>(CPUData.Num())}; }
+
 	inline void SetIndexCount(uint32 InIndexCount)
 	{
 		IndexSize = InIndexCount;
@@ -55,6 +59,7 @@ private:
 	uint32 Offset = 0;
 
 	const void* CPUDataPtr = nullptr;
+	TArray<uint32> CPUData;
 	bool bIsDynamic = false;
 
 	
@@ -1,6 +1,7 @@
 #include "InputLayout.h"
 #include "Resource/DirectResource/VertexShader.h"
 #include "Core/Rendering/FDevice.h"
+#include "Core/RHI/D3D11RHI.h"
 #include "Debug/DebugConsole.h"
 
 
@@ -20,6 +21,22 @@ FInputLayout::~FInputLayout()
 	}
 }
 
+std::shared_ptr<FInputLayout> FInputLayout::FindOrCreate(std::shared_ptr<FVertexShader> _Shader)
+{
+	// Layout 정보는 고정값이므로 Vertex Shader 이름으로 찾음
+	const FString ShaderName = _Shader->GetName();
+	if (std::shared_ptr<FInputLayout> Res = Find(ShaderName))
+	{
+		return Res;
+	}
+	return Create(ShaderName, _Shader);
+}
+
+FRHIInputLayout* FInputLayout::GetRHIInputLayout() const
+{
+	return D3D11RHI::ToRHI(LayOut);
+}
+
 void FInputLayout::ResCreate(std::shared_ptr<FVertexShader> _Shader)
 {
 	
@@ -46,5 +63,5 @@ void FInputLayout::Setting()
 	}
 
 	// 버텍스버퍼를 여러개 넣어줄수 있다.
-	FDevice::Get().GetDeviceContext()->IASetInputLayout(LayOut);
+	FRHI::Get().SetInputLayout(D3D11RHI::ToRHI(LayOut));
 }
@@ -7,6 +7,7 @@
 #include "Resource/Resource.h"
 #include "Core/Container/String.h"
 #include "Core/Container/Array.h"
+#include "Core/RHI/RHI.h"
 
 
 class FInputLayout:
@@ -27,11 +28,16 @@ public:
 		return Res;
 	}
 
+	/** Vertex Shader마다 하나만 만들어서 공유, 같은 Layout을 쓰는 Draw끼리는 다시 바인딩하지 않아도 됨 */
+	static std::shared_ptr<FInputLayout> FindOrCreate(std::shared_ptr<class FVertexShader> _Shader);
+
 	void ResCreate(
 	std::shared_ptr<FVertexShader> _Shader
 );
 
 	void Setting();
+
+	FRHIInputLayout* GetRHIInputLayout() const;
 	
 private:
 	
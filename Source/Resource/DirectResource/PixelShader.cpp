@@ -2,6 +2,7 @@
 
 #include <d3dcompiler.h>
 #include "Core/Rendering/FDevice.h"
+#include "Core/RHI/D3D11RHI.h"
 #include "Debug/DebugConsole.h"
 
 FPixelShader::FPixelShader()
@@ -24,7 +25,12 @@ void FPixelShader::Setting()
 		MsgBoxAssert("Error: FPixelShader Setting Failed");
 	}
 	
-	FDevice::Get().GetDeviceContext()->PSSetShader(ShaderPtr, nullptr, 0);
+	FRHI::Get().SetPixelShader(D3D11RHI::ToRHI(ShaderPtr));
+}
+
+FRHIPixelShader* FPixelShader::GetRHIShader() const
+{
+	return D3D11RHI::ToRHI(ShaderPtr);
 }
 
 void FPixelShader::ShaderLoad(const LPCWSTR& _Path, const FString& _EntryPoint, UINT _VersionHight, UINT _VersionLow)
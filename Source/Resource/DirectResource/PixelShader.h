@@ -7,7 +7,8 @@
 #include "Core/Container/String.h"
 #include "Core/Container/Array.h"
 #include "Shader.h"
-#include "Core/hal/PlatformType.h"
+#include "Core/HAL/PlatformType.h"
+#include "Core/RHI/RHI.h"
 
 
 class FPixelShader :
@@ -26,6 +27,8 @@ public:
 	}
 	
 	void Setting();
+
+	FRHIPixelShader* GetRHIShader() const;
 	
 private:
 	ID3D11PixelShader* ShaderPtr = nullptr;
@@ -1,6 +1,7 @@
 #include "Rasterizer.h"
 #include <d3dcompiler.h>
 #include "Core/Rendering/FDevice.h"
+#include "Core/RHI/D3D11RHI.h"
 #include "Debug/DebugConsole.h"
 #include "Core/Rendering/FViewMode.h"
 
@@ -30,7 +31,7 @@ void FRasterizer::Setting()
 		{
 			UE_LOG("Error: FRasterizer Setting Failed");
 		}
-		FDevice::Get().GetDeviceContext()->RSSetState(State);
+		FRHI::Get().SetRasterizerState(D3D11RHI::ToRHI(State));
 	}
 	else
 	{
@@ -38,6 +39,15 @@ void FRasterizer::Setting()
 	}
 }
 
+FRHIRasterizerState* FRasterizer::GetRHIState() const
+{
+	if (FViewMode::Get().GetViewMode() == EViewModeIndex::VMI_Default)
+	{
+		return D3D11RHI::ToRHI(State);
+	}
+	return D3D11RHI::ToRHI(FViewMode::Get().GetRasterizerState());
+}
+
 void FRasterizer::ResCreate(const D3D11_RASTERIZER_DESC& _Desc)
 {
 	Desc = _Desc;
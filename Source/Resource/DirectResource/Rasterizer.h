@@ -6,6 +6,7 @@
 
 #include "Resource/Resource.h"
 #include "Core/Container/String.h"
+#include "Core/RHI/RHI.h"
 
 
 class FRasterizer:
@@ -25,6 +26,9 @@ public:
 
 	void Setting();
 
+	/** Setting과 같은 규칙, View Mode가 Default가 아니면 View Mode의 Rasterizer State */
+	FRHIRasterizerState* GetRHIState() const;
+
 protected:
 	void ResCreate(const D3D11_RASTERIZER_DESC& _Desc);
 
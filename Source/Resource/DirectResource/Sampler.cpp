@@ -2,6 +2,7 @@
 
 #include <d3dcompiler.h>
 #include "Core/Rendering/FDevice.h"
+#include "Core/RHI/D3D11RHI.h"
 
 #include "Debug/DebugConsole.h"
 #include "DirectXTK/DDSTextureLoader.h"
@@ -21,12 +22,12 @@ FSampler::~FSampler()
 
 void FSampler::VSSetting(UINT _Slot)
 {
-	FDevice::Get().GetDeviceContext()->VSSetSamplers(_Slot, 1, &State);
+	FRHI::Get().SetSampler(ERHIShaderStage::Vertex, _Slot, D3D11RHI::ToRHI(State));
 }
 
 void FSampler::PSSetting(UINT _Slot)
 {
-	FDevice::Get().GetDeviceContext()->PSSetSamplers(_Slot, 1, &State);
+	FRHI::Get().SetSampler(ERHIShaderStage::Pixel, _Slot, D3D11RHI::ToRHI(State));
 }
 
 
@@ -5,7 +5,7 @@
 #include "Resource/Resource.h"
 #include "Core/Container/String.h"
 #include "Core/Container/Array.h"
-#include "Core/hal/PlatformType.h"
+#include "Core/HAL/PlatformType.h"
 
 class FSampler :
 	public FResource<FSampler> 
@@ -3,16 +3,24 @@
 
 void FConstantBufferBinding::Setting()
 {
+	UpdateData();
+	Bind();
+}
 
+void FConstantBufferBinding::UpdateData()
+{
 	if (nullptr == CPUDataPtr)
 	{
 		MsgBoxAssert("상수버퍼를 세팅해주지 않았습니다.");
 	}
 
+	Res->ChangeData(CPUDataPtr, DataSize);
+}
+
+void FConstantBufferBinding::Bind()
+{
 	//ShaderType Type = ParentShader->GetShaderType();
 
-	Res->ChangeData(CPUDataPtr, DataSize);
-	
 	if (bIsUseVertexShader == true)
 	{
 		Res->VSSetting(BindPoint);
@@ -34,6 +34,10 @@ public:
 	const void* CPUDataPtr = nullptr;
 	int DataSize = -1;
 
+	/** Setting = UpdateData + Bind, 같은 버퍼가 이미 바인딩되어 있으면 UpdateData만 해도 됨 */
+	void UpdateData();
+	void Bind();
+
 	void Setting() override;
 	void Reset() override;
 };
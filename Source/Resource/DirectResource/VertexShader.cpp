@@ -2,6 +2,7 @@
 
 #include <d3dcompiler.h>
 #include "Core/Rendering/FDevice.h"
+#include "Core/RHI/D3D11RHI.h"
 
 #include "Debug/DebugConsole.h"
 
@@ -28,7 +29,12 @@ void FVertexShader::Setting()
 	}
 	
 	// 버텍스버퍼를 여러개 넣어줄수 있다.
-	FDevice::Get().GetDeviceContext()->VSSetShader(ShaderPtr, nullptr, 0);
+	FRHI::Get().SetVertexShader(D3D11RHI::ToRHI(ShaderPtr));
+}
+
+FRHIVertexShader* FVertexShader::GetRHIShader() const
+{
+	return D3D11RHI::ToRHI(ShaderPtr);
 }
 
 void FVertexShader::ShaderLoad(const LPCWSTR& _Path, const FString& _EntryPoint, UINT _VersionHight, UINT _VersionLow)
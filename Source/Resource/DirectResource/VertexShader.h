@@ -7,7 +7,8 @@
 #include "Core/Container/String.h"
 #include "Core/Container/Array.h"
 #include "Shader.h"
-#include "Core/hal/PlatformType.h"
+#include "Core/HAL/PlatformType.h"
+#include "Core/RHI/RHI.h"
 
 
 
@@ -29,6 +30,8 @@ public:
 
 	
 	void Setting();
+
+	FRHIVertexShader* GetRHIShader() const;
 	
 private:
 	ID3D11VertexShader* ShaderPtr = nullptr;
@@ -1,39 +1,40 @@
 #include "Vertexbuffer.h"
+
+#include <cstring>
+
 #include "Core/Engine.h"
 #include "Core/Rendering/URenderer.h"
 #include "Debug/DebugConsole.h"
 #include "d3d11.h"
 #include "Core/Rendering/FDevice.h"
+#include "Core/RHI/D3D11RHI.h"
 
 
 
 
 void FVertexBuffer::Setting() const
 {
-	if (nullptr == Buffer)
+	FRHIBuffer* RHIBuffer = GetRHIBuffer();
+	if (nullptr == RHIBuffer)
 	{
 		UE_LOG("Error: Vertexbuffer Setting Failed");
 	}
 
 	if (bIsDynamic == false)
 	{
-		FDevice::Get().GetDeviceContext()->IASetVertexBuffers(0, 1, &Buffer, &VertexSize, &Offset);
+		FRHI::Get().SetVertexBuffer(RHIBuffer, VertexSize, Offset);
 	}
 	else
 	{
 		// 버텍스 버퍼 업데이트
-		D3D11_MAPPED_SUBRESOURCE mappedResource;
-		if (Buffer == nullptr)
+		if (RHIBuffer == nullptr)
 		{
 			MsgBoxAssert("Error: Vertexbuffer Setting Failed");
 			return;
 		}
 
-		FDevice::Get().GetDeviceContext()->Map(Buffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &mappedResource);
-		memcpy(mappedResource.pData, CPUDataPtr, VertexSize * VertexCount);
-		FDevice::Get().GetDeviceContext()->Unmap(Buffer, 0);
-
-		FDevice::Get().GetDeviceContext()->IASetVertexBuffers(0, 1, &Buffer, &VertexSize, &Offset);
+		FRHI::Get().UpdateBuffer(RHIBuffer, CPUDataPtr, VertexSize * VertexCount);
+		FRHI::Get().SetVertexBuffer(RHIBuffer, VertexSize, Offset);
 	}
 }
 
@@ -51,6 +52,17 @@ void FVertexBuffer::ResCreate(const void* _Data, size_t _VertexSize, size_t _Ver
 	BufferInfo.CPUAccessFlags = 0;
 	BufferInfo.Usage = D3D11_USAGE_DEFAULT;
 
+	// CPU Picking, Software Rasterizer용 사본
+	CPUData.SetNum(static_cast<int32>(BufferInfo.ByteWidth));
+	std::memcpy(CPUData.GetData(), _Data, BufferInfo.ByteWidth);
+
+	// Headless: Device 대신 지금 RHI 백엔드에 만듦
+	if (nullptr == FDevice::Get().GetDevice())
+	{
+		CreateRHIBuffer(ERHIBufferUsage::Vertex, _Data);
+		return;
+	}
+
 	if (S_OK != FDevice::Get().GetDevice()->CreateBuffer(&BufferInfo, &Data, &Buffer))
 	{
 		MsgBoxAssert("Error: Vertexbuffer Create Failed") ;
@@ -72,7 +84,11 @@ void FVertexBuffer::ResCreateDynamic(const void* _Data, size_t _VertexSize, size
 	BufferInfo.CPUAccessFlags = D3D11_CPU_ACCESS_FLAG::D3D11_CPU_ACCESS_WRITE;
 	BufferInfo.Usage = D3D11_USAGE_DYNAMIC;
 
-	
+	if (nullptr == FDevice::Get().GetDevice())
+	{
+		CreateRHIBuffer(ERHIBufferUsage::Vertex, nullptr);
+		return;
+	}
 
 	if (S_OK != FDevice::Get().GetDevice()->CreateBuffer(&BufferInfo, nullptr, &Buffer))
 	{
@@ -2,11 +2,13 @@
 #define _TCHAR_DEFINED
 #include <d3d11.h>
 #include <memory>
+#include <span>
 
 #include "DirectBuffer.h"
 #include "Resource/Resource.h"
 #include "Core/Container/String.h"
 #include "Core/Container/Array.h"
+#include "Core/Math/BatchTransform.h"
 #include "Core/Math/Vector.h"
 
 
@@ -20,11 +22,9 @@ public:
 	{
 		std::shared_ptr<FVertexBuffer> Res = FVertexBuffer::CreateRes(_Name);
 	
-		for(const auto& Vertex : _Data)
-		{
-			Res->Min = FVector::Min(Res->Min, FVector(Vertex.X, Vertex.Y, Vertex.Z));
-			Res->Max = FVector::Max(Res->Max, FVector(Vertex.X, Vertex.Y, Vertex.Z));
-		}
+		const FBox Bounds = BatchTransform::ComputeVertexBounds(std::span<const VertexType>(_Data.GetData(), _Data.Num()));
+		Res->Min = Bounds.Min;
+		Res->Max = Bounds.Max;
 
 		Res->bIsDynamic = _bIsDynamic;
 		if (Res->bIsDynamic == false)
@@ -50,6 +50,17 @@ public:
 
 	FVector GetMin() const { return Min; }
 	FVector GetMax() const { return Max; }
+
+	/** 정적 버퍼의 정점 사본 (CPU Picking, Software Rasterizer), 동적 버퍼는 비어 있습니다. */
+	template <typename VertexType>
+	std::span<const VertexType> GetCPUVertices() const
+	{
+		if (sizeof(VertexType) != VertexSize)
+		{
+			return {};
+		}
+		return {reinterpret_cast<const VertexType*>(CPUData.GetData()), CPUData.Num() / sizeof(VertexType)};
+	}
 	
 	void SetVertexCount(uint32 InVertexCount) { VertexCount = InVertexCount; }
 
@@ -65,6 +76,7 @@ private:
 	bool bIsDynamic = false;
 	
 	const void* CPUDataPtr = nullptr; //동적 업데이트용 포인터
+	TArray<uint8> CPUData;
 
 	FVector Min = D3D11_FLOAT32_MAX;
 	FVector Max = -D3D11_FLOAT32_MAX;
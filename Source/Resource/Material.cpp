@@ -6,6 +6,7 @@
 #include "Resource/DirectResource/VertexShader.h"
 #include "Resource/DirectResource/PixelShader.h"
 #include "Resource/DirectResource/Rasterizer.h"
+#include "Core/RHI/RHIPipelineState.h"
 
 FMaterial::FMaterial()
 {
@@ -137,3 +138,20 @@ void FMaterial::SetDepthState(const FString& InValue)
 	DepthStencil();
 
 }
+
+bool FMaterial::FillPipelineStateDesc(FRHIPipelineStateDesc& OutDesc) const
+{
+	if (nullptr == VertexShaderPtr || nullptr == PixelShaderPtr || nullptr == RasterizerPtr
+		|| nullptr == BlendStatePtr || nullptr == DepthStencilPtr)
+	{
+		return false;
+	}
+
+	OutDesc.VertexShader = VertexShaderPtr->GetRHIShader();
+	OutDesc.PixelShader = PixelShaderPtr->GetRHIShader();
+	OutDesc.RasterizerState = RasterizerPtr->GetRHIState();
+	OutDesc.BlendState = BlendStatePtr->GetRHIState();
+	OutDesc.SampleMask = BlendStatePtr->GetMask();
+	OutDesc.DepthStencilState = DepthStencilPtr->GetRHIState();
+	return true;
+}
@@ -7,6 +7,7 @@
 class FDepthStencilState;
 class FRasterizer;
 class FBlendState;
+struct FRHIPipelineStateDesc;
 
 class FMaterial : public FResource<FMaterial>
 {
@@ -44,6 +45,13 @@ public:
 	}
 
 	void Setting();
+
+	/**
+	 * Setting이 바인딩하는 Shader / State를 PSO Desc에 채움 (Input Layout, Topology는 Mesh 쪽에서)
+	 * Rasterizer는 지금 View Mode 기준이므로 View Mode가 바뀌면 다시 채워야 합니다.
+	 * @return 하나라도 없으면 false
+	 */
+	bool FillPipelineStateDesc(FRHIPipelineStateDesc& OutDesc) const;
 	
 private:
 	std::shared_ptr<FVertexShader> VertexShaderPtr = nullptr;
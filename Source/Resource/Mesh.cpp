@@ -1,6 +1,7 @@
 #include "Mesh.h"
 #include "Core/Engine.h"
 #include "Core/Rendering/FDevice.h"
+#include "Core/RHI/D3D11RHI.h"
 
 
 void FMesh::Setting()
@@ -12,7 +13,7 @@ void FMesh::Setting()
 	}
 	VertexBuffer->Setting();
 
-	FDevice::Get().GetDeviceContext()->IASetPrimitiveTopology(Topology);
+	FRHI::Get().SetPrimitiveTopology(D3D11RHI::ToRHITopology(Topology));
 
 	if (nullptr == IndexBuffer)
 	{
@@ -22,9 +23,48 @@ void FMesh::Setting()
 	IndexBuffer->Setting();
 }
 
+void FMesh::SettingBuffers()
+{
+	if (nullptr == VertexBuffer || nullptr == IndexBuffer)
+	{
+		MsgBoxAssert("매쉬가 세팅되어 있지 않습니다.");
+		return;
+	}
+	VertexBuffer->Setting();
+	IndexBuffer->Setting();
+}
+
+const FMeshBVH* FMesh::GetBVH()
+{
+	// Picking은 여러 스레드에서 할 수 있으므로 처음 한 번만 만듦
+	std::call_once(BVHBuildFlag, [this]
+	{
+		if (Topology != D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST || VertexBuffer == nullptr || IndexBuffer == nullptr)
+		{
+			return;
+		}
+
+		const std::span<const FVertexSimple> Vertices = VertexBuffer->GetCPUVertices<FVertexSimple>();
+		TArray<FVector> Positions;
+		Positions.Reserve(static_cast<int32>(Vertices.size()));
+		for (const FVertexSimple& Vertex : Vertices)
+		{
+			Positions.Add(FVector(Vertex.X, Vertex.Y, Vertex.Z));
+		}
+
+		std::unique_ptr<FMeshBVH> NewBVH = std::make_unique<FMeshBVH>();
+		NewBVH->Build({Positions.GetData(), static_cast<size_t>(Positions.Num())}, IndexBuffer->GetCPUIndices());
+		if (!NewBVH->IsEmpty())
+		{
+			BVH = std::move(NewBVH);
+		}
+	});
+	return BVH.get();
+}
+
 void FMesh::Draw()
 {
 	
-	FDevice::Get().GetDeviceContext()->DrawIndexed(IndexBuffer->GetIndexCount(), 0, 0);
+	FRHI::Get().DrawIndexed(IndexBuffer->GetIndexCount(), 0, 0);
 }
 
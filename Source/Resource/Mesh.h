@@ -2,8 +2,11 @@
 
 #define _TCHAR_DEFINED
 #include <d3d11.h>
+#include <memory>
+#include <mutex>
 
 #include "Resource/Resource.h"
+#include "Core/Math/MeshBVH.h"
 #include "Core/Container/String.h"
 #include "Core/Container/Array.h"
 #include "DirectResource/Shader.h"
@@ -65,6 +68,10 @@ public:
 	}
 
 	void Setting();
+
+	/** Vertex / Index Buffer만 바인딩, Topology는 PSO로 바인딩할 때 */
+	void SettingBuffers();
+
 	void Draw();
 
 	std::shared_ptr<FVertexBuffer> GetVertexBuffer()
@@ -76,8 +83,22 @@ public:
 	{
 		return IndexBuffer;
 	}
+
+	D3D_PRIMITIVE_TOPOLOGY GetTopology() const
+	{
+		return Topology;
+	}
+
+	/**
+	 * Ray 검사용 삼각형 BVH, 처음 부를 때 정점 / 인덱스의 CPU 사본으로 한 번만 만듭니다.
+	 * @return Triangle List가 아니거나 CPU 사본이 없으면 nullptr
+	 */
+	const FMeshBVH* GetBVH();
 	
 private:
+	std::once_flag BVHBuildFlag;
+	std::unique_ptr<FMeshBVH> BVH;
+
 	std::shared_ptr<FVertexBuffer> VertexBuffer = nullptr;
 	std::shared_ptr<FIndexBuffer> IndexBuffer = nullptr;
 	D3D_PRIMITIVE_TOPOLOGY Topology = D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
@@ -1,4 +1,8 @@
 #include "RenderResourceCollection.h"
+#include "Core/Rendering/FDevice.h"
+#include "Core/Rendering/RenderingThread.h"
+#include "Core/RHI/D3D11RHI.h"
+#include "Core/RHI/RHIPipelineState.h"
 #include "Debug/DebugConsole.h"
 #include "DirectResource/ShaderResourceBinding.h"
 #include "DirectResource/InputLayout.h"
@@ -7,81 +11,216 @@
 
 void FRenderResourceCollection::SetMesh(const FString& _Name)
 {
-	Mesh = FMesh::Find(_Name);
-
-	SetMesh(Mesh);
+	SetMesh(FMesh::Find(_Name));
 }
 
 void FRenderResourceCollection::SetMaterial(const FString& _Name)
 {
-	Material = FMaterial::Find(_Name);
-
-	SetMaterial(Material);
+	SetMaterial(FMaterial::Find(_Name));
 }
 
 void FRenderResourceCollection::SetMesh(std::shared_ptr<FMesh> _Mesh)
 {
+	// Render Thread가 이전 프레임에서 아직 사용 중일 수 있음
+	FlushIfQueuedForRender();
+
 	Mesh = _Mesh;
 
 	if (nullptr == Mesh)
 	{
 		MsgBoxAssert("존재하지 않는 매쉬를 세팅하려고 했습니다.");
+		return;
 	}
 
-	if (nullptr == Layout && nullptr != Material)
+	if (nullptr == Layout && nullptr != Material && nullptr != Material->GetVertexShader())
 	{
-		Layout = std::make_shared<FInputLayout>();
-		
-		Layout->ResCreate(Material->GetVertexShader());
+		Layout = FInputLayout::FindOrCreate(Material->GetVertexShader());
 	}
+	UpdatePipelineState();
 }
 
 void FRenderResourceCollection::SetMaterial(std::shared_ptr<FMaterial> _Material)
 {
+	// Render Thread가 이전 프레임에서 아직 사용 중일 수 있음
+	FlushIfQueuedForRender();
+
 	Material = _Material;
 
 
 	if (nullptr == Material)
 	{
-		MsgBoxAssert("존재하지 않는 머티리얼을 세팅하려고 했습니다.");
+		// Headless 모드에서는 Shader, State가 없으므로 Material도 만들지 않습니다.
+		if (FDevice::Get().IsInit())
+		{
+			MsgBoxAssert("존재하지 않는 머티리얼을 세팅하려고 했습니다.");
+		}
+		return;
+	}
+
+	if (nullptr == Layout && nullptr != Mesh && nullptr != Material->GetVertexShader())
+	{
+		Layout = FInputLayout::FindOrCreate(Material->GetVertexShader());
+	}
+	UpdatePipelineState();
+}
+
+void FRenderResourceCollection::UpdatePipelineState()
+{
+	PipelineState = nullptr;
+	PipelineViewMode = FViewMode::Get().GetViewMode();
+
+	// Headless: Shader / State 없이 Topology만 있는 PSO로 Null RHI까지 같은 순서로 제출
+	if (nullptr != Mesh && !FDevice::Get().IsInit())
+	{
+		FRHIPipelineStateDesc Desc;
+		Desc.Topology = D3D11RHI::ToRHITopology(Mesh->GetTopology());
+		PipelineState = FRHIPipelineStateCache::Get().FindOrCreate(Desc);
+		return;
+	}
+
+	if (nullptr == Mesh || nullptr == Material || nullptr == Layout)
+	{
+		return;
 	}
 
-	if (nullptr == Layout && nullptr != Mesh)
+	FRHIPipelineStateDesc Desc;
+	if (!Material->FillPipelineStateDesc(Desc))
+	{
+		return;
+	}
+	Desc.InputLayout = Layout->GetRHIInputLayout();
+	Desc.Topology = D3D11RHI::ToRHITopology(Mesh->GetTopology());
+	PipelineState = FRHIPipelineStateCache::Get().FindOrCreate(Desc);
+}
+
+const FRHIPipelineState* FRenderResourceCollection::ResolvePipelineState()
+{
+	bQueuedForRender = true;
+	if (PipelineViewMode != FViewMode::Get().GetViewMode())
 	{
-		Layout = std::make_shared<FInputLayout>();
-		Layout->ResCreate( Material->GetVertexShader());
+		UpdatePipelineState();
 	}
+	return PipelineState;
 }
 
-void FRenderResourceCollection::Render()
+void FRenderResourceCollection::FlushIfQueuedForRender() const
 {
-	Mesh->Setting();
-	Layout->Setting();
-	Material->Setting(); 
+	if (bQueuedForRender)
+	{
+		FRenderingThread::Get().Flush();
+	}
+}
 
+void FRenderResourceCollection::RebuildBindingLists()
+{
+	ConstantBufferList.Empty();
 	for (auto& Binding : ConstantBufferBindings)
 	{
-		Binding.Value->Setting();
+		ConstantBufferList.Add(Binding.Value.get());
 	}
-  
-  for (auto& Binding : TextureBindings)
+
+	TextureList.Empty();
+	for (auto& Binding : TextureBindings)
 	{
-		Binding.Value->Setting();
+		TextureList.Add(Binding.Value.get());
 	}
-	
+
+	SamplerList.Empty();
 	for (auto& Binding : SamplerBindings)
 	{
-		Binding.Value->Setting();
+		SamplerList.Add(Binding.Value.get());
 	}
-	
+}
+
+void FRenderResourceCollection::Render(const FRHIPipelineState* State)
+{
+	if (nullptr == State)
+	{
+		// Material / Input Layout이 없으면 그릴 수 없음
+		return;
+	}
+
+	Mesh->SettingBuffers();
+	FRHI::Get().SetPipelineState(*State);
+
+	for (FConstantBufferBinding* Binding : ConstantBufferList)
+	{
+		Binding->Setting();
+	}
+
+	// Headless에는 Texture / Sampler가 없음
+	for (FTextureBinding* Binding : TextureList)
+	{
+		if (nullptr != Binding->Res)
+		{
+			Binding->Setting();
+		}
+	}
+
+	for (FSamplerBinding* Binding : SamplerList)
+	{
+		if (nullptr != Binding->Res)
+		{
+			Binding->Setting();
+		}
+	}
+
+	Mesh->Draw();
+}
+
+void FRenderResourceCollection::Render(const FRHIPipelineState* State, FRenderResourceBindCache& Cache)
+{
+	if (nullptr == State)
+	{
+		return;
+	}
+
+	if (Cache.ShouldBind<FMesh>(Cache.Mesh, Mesh.get()))
+	{
+		Mesh->SettingBuffers();
+	}
+	if (Cache.ShouldBind<FRHIPipelineState>(Cache.PipelineState, State))
+	{
+		FRHI::Get().SetPipelineState(*State);
+	}
+
+	for (FConstantBufferBinding* ConstantBuffer : ConstantBufferList)
+	{
+		// 데이터는 Draw마다 다르므로 바인딩을 건너뛰어도 항상 올림
+		ConstantBuffer->UpdateData();
+		if (Cache.ShouldBindSlot(Cache.ConstantBuffers, ConstantBuffer->BindPoint, ConstantBuffer->Res.get(),
+			ConstantBuffer->bIsUseVertexShader, ConstantBuffer->bIsUsePixelShader))
+		{
+			ConstantBuffer->Bind();
+		}
+	}
+
+	for (FTextureBinding* Texture : TextureList)
+	{
+		if (nullptr != Texture->Res && Cache.ShouldBindSlot(Cache.Textures, Texture->BindPoint, Texture->Res.get(),
+			Texture->bIsUseVertexShader, Texture->bIsUsePixelShader))
+		{
+			Texture->Setting();
+		}
+	}
+
+	for (FSamplerBinding* Sampler : SamplerList)
+	{
+		if (nullptr != Sampler->Res && Cache.ShouldBindSlot(Cache.Samplers, Sampler->BindPoint, Sampler->Res.get(),
+			Sampler->bIsUseVertexShader, Sampler->bIsUsePixelShader))
+		{
+			Sampler->Setting();
+		}
+	}
+
 	Mesh->Draw();
 }
 
 void FRenderResourceCollection::Reset()
 {
-	for (auto& Binding : TextureBindings)
+	for (FTextureBinding* Binding : TextureList)
 	{
-		Binding.Value->Reset();
+		Binding->Reset();
 	}
 }
 
@@ -105,6 +244,7 @@ std::shared_ptr<FTextureBinding> FRenderResourceCollection::SetTextureBinding(co
 	Binding->BindPoint = _BindPoint;
 
 	TextureBindings.Add(_Name, Binding);
+	RebuildBindingLists();
 
 	return Binding;
 }
@@ -129,6 +269,7 @@ std::shared_ptr<FSamplerBinding> FRenderResourceCollection::SetSamplerBinding(co
 	Binding->BindPoint = _BindPoint;
 
 	SamplerBindings.Add(_Name, Binding);
+	RebuildBindingLists();
 
 	return Binding;
 }
@@ -159,7 +300,38 @@ std::shared_ptr<FConstantBufferBinding> FRenderResourceCollection::SetConstantBu
 	Binding->BindPoint = _BindPoint;
 
 	ConstantBufferBindings.Add(_Name, Binding);
+	RebuildBindingLists();
 
 	return Binding;
 }
 
+void FRenderResourceBindCache::Invalidate()
+{
+	Mesh = nullptr;
+	PipelineState = nullptr;
+	for (int32 Slot = 0; Slot < MaxSlots; ++Slot)
+	{
+		ConstantBuffers[Slot] = FSlot();
+		Textures[Slot] = FSlot();
+		Samplers[Slot] = FSlot();
+	}
+}
+
+bool FRenderResourceBindCache::ShouldBindSlot(FSlot* Slots, int32 BindPoint, const void* Res, bool bVertexShader, bool bPixelShader)
+{
+	if (BindPoint < 0 || BindPoint >= MaxSlots)
+	{
+		return true;
+	}
+
+	const uint8 Stages = static_cast<uint8>((bVertexShader ? 1 : 0) | (bPixelShader ? 2 : 0));
+	FSlot& Slot = Slots[BindPoint];
+	if (Slot.Res == Res && Slot.Stages == Stages)
+	{
+		++NumSkipped;
+		return false;
+	}
+	Slot.Res = Res;
+	Slot.Stages = Stages;
+	return true;
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Core/Engine.h"
+#include "Core/Rendering/FViewMode.h"
 #include "Resource/DirectResource/Vertexbuffer.h"
 #include "Resource/DirectResource/IndexBuffer.h"
 
@@ -11,6 +12,53 @@ enum class RenderMode
 };
 
 
+/**
+ * 정렬된 Draw를 이어서 제출할 때 직전까지 바인딩한 리소스 (Render Thread 전용)
+ *
+ * FRenderResourceCollection::Render(Cache)는 여기 기록된 것과 같은 리소스를 다시 바인딩하지 않습니다.
+ * 기록 밖에서 바인딩을 바꿨다면 (Line Batch, Billboard, ImGui 등) Invalidate 해야 합니다.
+ */
+struct FRenderResourceBindCache
+{
+	static constexpr int32 MaxSlots = 16;
+
+	/** Slot의 리소스와 Stage (bit 0 = Vertex Shader, bit 1 = Pixel Shader) */
+	struct FSlot
+	{
+		const void* Res = nullptr;
+		uint8 Stages = 0;
+	};
+
+	const class FMesh* Mesh = nullptr;
+	const class FRHIPipelineState* PipelineState = nullptr;
+
+	FSlot ConstantBuffers[MaxSlots];
+	FSlot Textures[MaxSlots];
+	FSlot Samplers[MaxSlots];
+
+	/** 건너뛴 바인딩 수 (Mesh / PSO / Slot 하나당 1) */
+	uint64 NumSkipped = 0;
+
+	void Invalidate();
+
+	/** 기록과 다르면 기록하고 true */
+	template <typename T>
+	bool ShouldBind(const T*& Cached, const T* Res)
+	{
+		if (Cached == Res)
+		{
+			++NumSkipped;
+			return false;
+		}
+		Cached = Res;
+		return true;
+	}
+
+	/** Slot에 같은 리소스가 같은 Stage로 있으면 false, MaxSlots 밖이면 항상 true */
+	bool ShouldBindSlot(FSlot* Slots, int32 BindPoint, const void* Res, bool bVertexShader, bool bPixelShader);
+};
+
+
 class FRenderResourceCollection
 {
 public:
@@ -37,7 +85,17 @@ public:
 		return Material;
 	}
 
-	void Render();
+	/**
+	 * 이번 프레임에 쓸 PSO, View Mode가 바뀌었으면 (Rasterizer가 달라짐) 다시 찾음 (Game Thread)
+	 * Render Command에 같이 넘겨서 Render Thread가 이 객체의 PSO 상태를 읽거나 쓰지 않게 합니다.
+	 */
+	const class FRHIPipelineState* ResolvePipelineState();
+
+	/** Vertex / Index Buffer, PSO, Slot 바인딩을 모두 다시 바인딩하고 그림, State가 nullptr면 그리지 않음 (Render Thread) */
+	void Render(const FRHIPipelineState* State);
+
+	/** Cache에 기록된 것과 같은 Mesh / PSO / Slot 바인딩은 건너뜀, 상수 버퍼 데이터는 항상 올림 */
+	void Render(const FRHIPipelineState* State, FRenderResourceBindCache& Cache);
 	void Reset();
 
 
@@ -61,6 +119,16 @@ public:
 	std::shared_ptr<class FSamplerBinding> SetSamplerBinding(const FString& _Name,
 		int _BindPoint,	bool bIsUseVertexShader, bool bIsUsePixelShader);
 	
+private:
+	/** Material + Input Layout + Mesh Topology로 PSO를 Cache에서 찾음, 하나라도 없으면 nullptr (Headless는 Mesh Topology만) */
+	void UpdatePipelineState();
+
+	/** Set*에서 Render Thread가 아직 이 객체를 쓰고 있을 수 있으면 기다림 */
+	void FlushIfQueuedForRender() const;
+
+	/** 이름으로 찾는 Map은 Set*Binding에서만 쓰고, Draw는 이 배열만 돕니다. */
+	void RebuildBindingLists();
+
 private:
 	//class UPrimitiveComponent* ParentRenderer = nullptr;
 
@@ -75,6 +143,17 @@ private:
 	TMap<FString, std::shared_ptr<FConstantBufferBinding>> ConstantBufferBindings;
 	TMap<FString, std::shared_ptr<FTextureBinding>> TextureBindings;
 	TMap<FString, std::shared_ptr<FSamplerBinding>> SamplerBindings;
+
+	TArray<FConstantBufferBinding*> ConstantBufferList;
+	TArray<FTextureBinding*> TextureList;
+	TArray<FSamplerBinding*> SamplerList;
+
+	/** SetMesh / SetMaterial 때 찾아 둔 PSO, PipelineViewMode와 지금 View Mode가 다르면 다시 찾음 */
+	const class FRHIPipelineState* PipelineState = nullptr;
+	EViewModeIndex PipelineViewMode = EViewModeIndex::VMI_Default;
+
+	/** ResolvePipelineState로 Render Command에 넘긴 적이 있음, 그 전에는 Set*에서 Flush하지 않음 (Spawn 중에는 대기 없음) */
+	bool bQueuedForRender = false;
 	
 	// // 테스트 상수버퍼
 	// std::shared_ptr<class FConstantBufferBinding> ConstantBufferBinding = nullptr;
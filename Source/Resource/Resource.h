@@ -1,8 +1,10 @@
 #pragma once
+#include <memory>
 #include <mutex>
 
 #include "Core/Container/String.h"
 #include "Core/Container/Map.h"
+#include "Core/HAL/PlatformType.h"
 
 
 template <typename ResourcesType>
@@ -59,6 +61,12 @@ public:
 		return Name;
 	}
 
+	/** 같은 타입 안에서 만든 순서대로 1부터, Draw 정렬 키처럼 이름 대신 작은 정수가 필요할 때 */
+	uint32 GetResourceId() const
+	{
+		return ResourceId;
+	}
+
 protected:
 	static std::shared_ptr<ResourcesType> CreateRes(const FString& InName)
 	{
@@ -66,6 +74,7 @@ protected:
 
 		std::lock_guard Lock(NameMutex);
 		NewRes->SetName(InName);
+		NewRes->ResourceId = ++NumCreated;
 		NameRes.Add(InName, NewRes);
 		return NewRes;
 	}
@@ -73,8 +82,10 @@ protected:
 private:
 	static std::mutex NameMutex;
 	static TMap<FString, std::shared_ptr<ResourcesType>> NameRes;
+	static uint32 NumCreated;
 
 	FString Name;
+	uint32 ResourceId = 0;
 };
 
 
@@ -83,3 +94,6 @@ TMap<FString, std::shared_ptr<ResourcesType>> FResource<ResourcesType>::NameRes;
 
 template <typename ResourcesType>
 std::mutex FResource<ResourcesType>::NameMutex;
+
+template <typename ResourcesType>
+uint32 FResource<ResourcesType>::NumCreated = 0;
@@ -2,6 +2,7 @@
 
 #include <d3dcompiler.h>
 #include "Core/Rendering/FDevice.h"
+#include "Core/RHI/D3D11RHI.h"
 
 #include "Debug/DebugConsole.h"
 #include "DirectXTK/DDSTextureLoader.h"
@@ -38,34 +39,31 @@ FTexture::~FTexture()
 
 void FTexture::VSSetting(UINT InSlot)
 {
-	FDevice::Get().GetDeviceContext()->VSSetShaderResources(InSlot, 1, &SRV);
+	FRHI::Get().SetShaderResource(ERHIShaderStage::Vertex, InSlot, D3D11RHI::ToRHI(SRV));
 }
 
 void FTexture::PSSetting(UINT InSlot)
 {
-	FDevice::Get().GetDeviceContext()->PSSetShaderResources(InSlot, 1, &SRV);
+	FRHI::Get().SetShaderResource(ERHIShaderStage::Pixel, InSlot, D3D11RHI::ToRHI(SRV));
 }
 
 void FTexture::CSSetting(UINT InSlot)
 {
-	FDevice::Get().GetDeviceContext()->CSSetShaderResources(InSlot, 1, &SRV);
+	FRHI::Get().SetShaderResource(ERHIShaderStage::Compute, InSlot, D3D11RHI::ToRHI(SRV));
 }
 
 void FTexture::VSReset(UINT InSlot)
 {
-	ID3D11ShaderResourceView* ResetRes = nullptr;
-	FDevice::Get().GetDeviceContext()->VSSetShaderResources(InSlot, 1, &ResetRes);
+	FRHI::Get().SetShaderResource(ERHIShaderStage::Vertex, InSlot, nullptr);
 }
 void FTexture::PSReset(UINT InSlot)
 {
-	ID3D11ShaderResourceView* ResetRes = nullptr;
-	FDevice::Get().GetDeviceContext()->PSSetShaderResources(InSlot, 1, &ResetRes);
+	FRHI::Get().SetShaderResource(ERHIShaderStage::Pixel, InSlot, nullptr);
 }
 
 void FTexture::CSReset(UINT InSlot)
 {
-	ID3D11ShaderResourceView* ResetRes = nullptr;
-	FDevice::Get().GetDeviceContext()->CSSetShaderResources(InSlot, 1, &ResetRes);
+	FRHI::Get().SetShaderResource(ERHIShaderStage::Compute, InSlot, nullptr);
 }
 
 
@@ -9,6 +9,10 @@
 #include "Core/Input/PlayerInput.h"
 #include "Resource/Texture.h"
 #include "Core/Rendering/FDevice.h"
+#include "Core/RHI/D3D11RHI.h"
+#include "Core/Rendering/RenderingThread.h"
+#include "Core/Config/ConfigManager.h"
+#include "Static/FPickingManager.h"
 
 void FEditorManager::Init()
 {
@@ -28,6 +32,10 @@ void FEditorManager::Init()
 	UUIDTexture = FTexture::Create("UUIDTexture", textureDesc);
 	UUIDTexture->CreateRenderTargetView();
 
+	// [Editor] PickingMode = GPU면 UUID Texture를 비동기로 읽음, 기본은 CPU Ray 검사
+	const FString PickingModeValue = UConfigManager::Get().GetValue(TEXT("Editor"), TEXT("PickingMode"));
+	FPickingManager::Get().SetMode(PickingModeValue == "GPU" ? EPickingMode::GPUAsync : EPickingMode::CPU);
+
 
 	//D3D11_TEXTURE2D_DESC DepthBufferDesc = {};
 	//DepthBufferDesc.Width = Width;
@@ -106,46 +114,34 @@ uint32 FEditorManager::DecodeUUID(FVector4 color)
 
 void FEditorManager::LateTick([[maybe_unused]] float DeltaTime)
 {
+	FPickingManager& PickingManager = FPickingManager::Get();
+
 	if (APlayerInput::Get().GetKeyDown(EKeyCode::LButton))
 	{
 		POINT pt;
 		GetCursorPos(&pt);
 		ScreenToClient(UEngine::Get().GetWindowHandle(), &pt);
 
-		//float Width = FDevice::Get().GetViewPortInfo().Width;
-		//float Height = FDevice::Get().GetViewPortInfo().Height;
-
-		//      float ratioX = UEngine::Get().GetInitializedScreenWidth() / Width;
-		//      float ratioY = UEngine::Get().GetInitializedScreenHeight() / Height;
-		//      pt.x = pt.x * ratioX;
-		//      pt.y = pt.y * ratioY;
-
-		const FVector4 color = GetPixel(FVector(pt.x, pt.y, 0));
-		const uint32_t UUID = DecodeUUID(color);
-
-		UActorComponent* PickedComponent = UEngine::Get().GetObjectByUUID<UActorComponent>(UUID);
+		const float Width = FDevice::Get().GetViewPortInfo().Width;
+		const float Height = FDevice::Get().GetViewPortInfo().Height;
+		const float X = FMath::Clamp(static_cast<float>(pt.x), 0.0f, Width - 1.0f);
+		const float Y = FMath::Clamp(static_cast<float>(pt.y), 0.0f, Height - 1.0f);
 
-		if (PickedComponent != nullptr)
+		if (PickingManager.GetMode() == EPickingMode::CPU && Camera != nullptr)
 		{
-			// Component의 Owner도 Engine.GObjects에서 관리되기에, Component가 존재한다면 항상 존재 해야함
-			AActor* PickedActor = PickedComponent->GetOwner();
-			assert(PickedActor);
-
-			// if (GetOwner()->Implements<IGizmoInterface>() == false) // TODO: RTTI 개선하면 사용
-			if (!dynamic_cast<IGizmoInterface*>(PickedActor))
-			{
-				// PickedActor를 한번 더 클릭하면 UnPicked
-				SelectActor(PickedActor);
-			}
-				
-			
-			UE_LOG("Pick - UUID: %d", UUID);
-
-			if (const UGizmoComponent* GizmoCom = Cast<UGizmoComponent>(PickedComponent))
-			{
-				Gizmo->SetSelectedAxis(GizmoCom->GetSelectedAxis());
-			}
+			OnPicked(PickingManager.PickCPU(*UEngine::Get().GetWorld(), *Camera, X, Y, Width, Height).UUID);
 		}
+		else if (!PickingManager.RequestGPUReadback(UUIDTexture, static_cast<uint32>(X), static_cast<uint32>(Y)))
+		{
+			UE_LOG("Pick - readback ring is full, click ignored");
+		}
+	}
+
+	// 비동기 GPU Readback은 몇 프레임 뒤에 결과가 나옴
+	uint32 ReadbackUUID;
+	while (PickingManager.PollGPUReadback(ReadbackUUID))
+	{
+		OnPicked(ReadbackUUID);
 	}
 
 	//if (APlayerInput::Get().GetKeyPress(EKeyCode::LButton))
@@ -238,72 +234,29 @@ void FEditorManager::OnResizeComplete()
 	UUIDTexture->CreateRenderTargetView();
 }
 
-FVector4 FEditorManager::GetPixel(FVector MPos) const
+void FEditorManager::OnPicked(uint32 UUID)
 {
+	UActorComponent* PickedComponent = UEngine::Get().GetObjectByUUID<UActorComponent>(UUID);
+	if (PickedComponent == nullptr)
+	{
+		return;
+	}
 
-	const float Width = FDevice::Get().GetViewPortInfo().Width;
-	const float Height = FDevice::Get().GetViewPortInfo().Height;
-    MPos.X = FMath::Clamp(MPos.X, 0.0f, Width);
-    MPos.Y = FMath::Clamp(MPos.Y, 0.0f, Height);
-    // 1. Staging 텍스처 생성 (1x1 픽셀)
-    D3D11_TEXTURE2D_DESC stagingDesc = {};
-    stagingDesc.Width = 1; // 픽셀 1개만 복사
-    stagingDesc.Height = 1;
-    stagingDesc.MipLevels = 1;
-    stagingDesc.ArraySize = 1;
-    stagingDesc.Format = DXGI_FORMAT_R32G32B32A32_UINT; // 원본 텍스처 포맷과 동일
-    stagingDesc.SampleDesc.Count = 1;
-    stagingDesc.Usage = D3D11_USAGE_STAGING;
-    stagingDesc.BindFlags = 0;
-    stagingDesc.CPUAccessFlags = D3D11_CPU_ACCESS_READ;
-
-    ID3D11Texture2D* stagingTexture = nullptr;
-    FDevice::Get().GetDevice()->CreateTexture2D(&stagingDesc, nullptr, &stagingTexture);
-
-    // 2. 복사할 영역 정의 (D3D11_BOX)
-    D3D11_BOX SrcBox;
-    SrcBox.left = static_cast<UINT>(MPos.X);
-    SrcBox.right = SrcBox.left + 1; // 1픽셀 너비
-    SrcBox.top = static_cast<UINT>(MPos.Y);
-    SrcBox.bottom = SrcBox.top + 1; // 1픽셀 높이
-    SrcBox.front = 0;
-    SrcBox.back = 1;
-    FVector4 color {1, 1, 1, 1};
-
-    if (stagingTexture == nullptr)
-        return color;
-
-    // 3. 특정 좌표만 복사
-    FDevice::Get().GetDeviceContext()->CopySubresourceRegion(
-        stagingTexture, // 대상 텍스처
-        0,              // 대상 서브리소스
-        0, 0, 0,        // 대상 좌표 (x, y, z)
-        UUIDTexture->GetTexture2D(), // 원본 텍스처
-        0,              // 원본 서브리소스
-        &SrcBox         // 복사 영역
-    );
-
-    // 4. 데이터 매핑
-    D3D11_MAPPED_SUBRESOURCE mapped = {};
-    FDevice::Get().GetDeviceContext()->Map(stagingTexture, 0, D3D11_MAP_READ, 0, &mapped);
-
-    // 5. 픽셀 데이터 추출 (1x1 텍스처이므로 offset = 0)
-    const BYTE* pixelData = static_cast<const BYTE*>(mapped.pData);
-
-    if (pixelData)
-    {
-        color.X = static_cast<float>(pixelData[0]); // R
-        color.Y = static_cast<float>(pixelData[1]); // G
-        color.Z = static_cast<float>(pixelData[2]); // B
-        color.W = static_cast<float>(pixelData[3]); // A
-    }
+	// Component의 Owner도 Engine.GObjects에서 관리되기에, Component가 존재한다면 항상 존재 해야함
+	AActor* PickedActor = PickedComponent->GetOwner();
+	assert(PickedActor);
 
-    std::cout << "X: " << (int)color.X << " Y: " << (int)color.Y 
-              << " Z: " << color.Z << " A: " << color.W << "\n";
+	// if (GetOwner()->Implements<IGizmoInterface>() == false) // TODO: RTTI 개선하면 사용
+	if (!dynamic_cast<IGizmoInterface*>(PickedActor))
+	{
+		// PickedActor를 한번 더 클릭하면 UnPicked
+		SelectActor(PickedActor);
+	}
 
-    // 6. 매핑 해제 및 정리
-    FDevice::Get().GetDeviceContext()->Unmap(stagingTexture, 0);
-    stagingTexture->Release();
+	UE_LOG("Pick - UUID: %d", UUID);
 
-    return color;
+	if (const UGizmoComponent* GizmoCom = Cast<UGizmoComponent>(PickedComponent))
+	{
+		Gizmo->SetSelectedAxis(GizmoCom->GetSelectedAxis());
+	}
 }
@@ -34,8 +34,10 @@ public:
 
 	void OnResizeComplete();
 
-	FVector4 GetPixel(FVector MPos) const;
-    
+private:
+	/** Picking 결과를 처리합니다. (Actor 선택, Gizmo 축 선택) */
+	void OnPicked(uint32 UUID);
+
 private:
     ACamera* Camera = nullptr;
     AActor* SelectedActor = nullptr;
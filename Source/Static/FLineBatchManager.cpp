@@ -3,6 +3,7 @@
 #include "Core/Rendering/URenderer.h"
 #include <d3dcompiler.h>
 #include "Core/Rendering/FDevice.h"
+#include "Core/Rendering/RenderingThread.h"
 
 #include "Object/Actor/Camera.h"
 #include "Object/World/World.h"
@@ -56,6 +57,8 @@ void FLineBatchManager::Flush()
 
 void FLineBatchManager::DrawWorldGrid(float GridSize, float GridSpacing, const FVector4& GridColor, bool bCenterGrid)
 {
+	// Dynamic Vertex Buffer가 VertexBuffer를 직접 읽으므로, 이전 프레임의 Draw가 끝난 뒤에 수정
+	FRenderingThread::Get().Flush();
 
 	VertexBuffer.Empty();
 	IndexBuffer.Empty();
@@ -121,10 +124,13 @@ void FLineBatchManager::Render()
 	if (VertexBuffer.Num() == 0)
 		return;
 
-	LineConstantInfo.ViewProjectionMatrix = FMatrix::Transpose(UEngine::Get().GetWorld()->GetCamera()->GetViewProjectionMatrix());
+	const FMatrix ViewProjectionMatrix = FMatrix::Transpose(UEngine::Get().GetWorld()->GetCamera()->GetViewProjectionMatrix());
 
-
-	RenderResourceCollection.Render();
+	ENQUEUE_RENDER_COMMAND([this, ViewProjectionMatrix, State = RenderResourceCollection.ResolvePipelineState()]
+	{
+		LineConstantInfo.ViewProjectionMatrix = ViewProjectionMatrix;
+		RenderResourceCollection.Render(State);
+	});
 
 }
 
@@ -0,0 +1,211 @@
+#include "FPickingManager.h"
+
+#include "Core/Container/Array.h"
+#include "Core/Math/Matrix.h"
+#include "Core/Rendering/FDevice.h"
+#include "Core/Rendering/RenderingThread.h"
+#include "Core/RHI/D3D11RHI.h"
+#include "Object/Actor/Camera.h"
+#include "Object/PrimitiveComponent/UPrimitiveComponent.h"
+#include "Object/World/World.h"
+#include "Resource/Texture.h"
+
+
+FRay FPickingManager::MakeCameraRay(const ACamera& Camera, float X, float Y, float Width, float Height, float& OutMaxDistance)
+{
+	// 픽셀 중심을 NDC로 (Y는 위가 +)
+	const float NDCX = (X + 0.5f) / Width * 2.0f - 1.0f;
+	const float NDCY = 1.0f - (Y + 0.5f) / Height * 2.0f;
+
+	const FRay Ray(Camera.GetViewMatrix(), Camera.GetProjectionMatrix(), NDCX, NDCY);
+
+	const FMatrix InvViewProjection = (Camera.GetViewMatrix() * Camera.GetProjectionMatrix()).Inverse();
+	const FVector4 FarPoint = InvViewProjection.TransformVector4(FVector4(NDCX, NDCY, 1.0f, 1.0f));
+	const FVector FarPosition = FarPoint.W != 0.0f ? FVector(FarPoint) / FarPoint.W : FVector(FarPoint);
+	OutMaxDistance = (FarPosition - Ray.GetOrigin()).Length();
+
+	return Ray;
+}
+
+FPickResult FPickingManager::Raycast(const FRay& Ray, float MaxDistance, std::span<UPrimitiveComponent* const> Components)
+{
+	FPickResult Result;
+	float Closest = MaxDistance;
+	for (UPrimitiveComponent* Component : Components)
+	{
+		if (!Component->CanBeRendered())
+		{
+			continue;
+		}
+
+		// LESS_EQUAL 깊이 검사처럼 거리가 같으면 나중에 그린 쪽이 남음
+		float Distance;
+		if (Component->RaycastPrimitive(Ray, Closest, Distance))
+		{
+			Closest = Distance;
+			Result.Component = Component;
+			Result.UUID = Component->GetUUID();
+			Result.Distance = Distance;
+		}
+	}
+	return Result;
+}
+
+FPickResult FPickingManager::PickCPU(UWorld& World, ACamera& Camera, float X, float Y, float Width, float Height)
+{
+	Camera.UpdateCameraMatrix();
+
+	float MaxDistance;
+	const FRay Ray = MakeCameraRay(Camera, X, Y, Width, Height, MaxDistance);
+
+	// PickingPrepare 이후에 그리는 ZIgnore Component가 UUID Texture를 덮어씁니다. (Gizmo 몇 개뿐이라 전부 검사)
+	const TArray<UPrimitiveComponent*>& ZIgnoreComponents = World.GetZIgnoreRenderComponents();
+	const FPickResult ZIgnoreResult = Raycast(Ray, MaxDistance, {ZIgnoreComponents.GetData(), static_cast<size_t>(ZIgnoreComponents.Num())});
+	if (ZIgnoreResult.IsHit())
+	{
+		return ZIgnoreResult;
+	}
+
+	// 나머지는 Primitive Tree로, Depth가 0인 Render Component만
+	const TSet<UPrimitiveComponent*>& RenderComponents = World.GetRenderComponents();
+	FPickResult Result;
+	World.GetPrimitiveTree().RayCast(Ray, MaxDistance, [&](int32 ProxyId, float CurrentMaxDistance)
+	{
+		UPrimitiveComponent* Component = static_cast<UPrimitiveComponent*>(World.GetPrimitiveTree().GetUserData(ProxyId));
+		if (!Component->CanBeRendered() || !RenderComponents.Contains(Component) || Component->GetOwner()->GetDepth() != 0)
+		{
+			return CurrentMaxDistance;
+		}
+
+		float Distance;
+		if (!Component->RaycastPrimitive(Ray, CurrentMaxDistance, Distance))
+		{
+			return CurrentMaxDistance;
+		}
+
+		// 거리가 같으면 UUID Texture처럼 나중에 그린 쪽, 드문 경우라 그릴 때만 순서를 찾음
+		if (Result.IsHit() && Distance == Result.Distance)
+		{
+			for (UPrimitiveComponent* DrawnComponent : RenderComponents)
+			{
+				if (DrawnComponent == Component)
+				{
+					return CurrentMaxDistance;
+				}
+				if (DrawnComponent == Result.Component)
+				{
+					break;
+				}
+			}
+		}
+
+		Result.Component = Component;
+		Result.UUID = Component->GetUUID();
+		Result.Distance = Distance;
+		return Distance;
+	});
+	return Result;
+}
+
+bool FPickingManager::RequestGPUReadback(const std::shared_ptr<FTexture>& UUIDTexture, uint32 X, uint32 Y)
+{
+	ID3D11Device* Device = FDevice::Get().GetDevice();
+	if (Device == nullptr || UUIDTexture == nullptr || NumReadbacks == ReadbackRingSize)
+	{
+		return false;
+	}
+
+	FReadbackSlot& Slot = ReadbackRing[ReadbackTail];
+	if (Slot.StagingTexture == nullptr)
+	{
+		D3D11_TEXTURE2D_DESC StagingDesc = {};
+		StagingDesc.Width = 1;
+		StagingDesc.Height = 1;
+		StagingDesc.MipLevels = 1;
+		StagingDesc.ArraySize = 1;
+		StagingDesc.Format = DXGI_FORMAT_R32G32B32A32_UINT; // UUIDTexture와 같은 포맷
+		StagingDesc.SampleDesc.Count = 1;
+		StagingDesc.Usage = D3D11_USAGE_STAGING;
+		StagingDesc.CPUAccessFlags = D3D11_CPU_ACCESS_READ;
+
+		if (S_OK != Device->CreateTexture2D(&StagingDesc, nullptr, &Slot.StagingTexture))
+		{
+			UE_LOG("Error: Picking staging texture create failed");
+			return false;
+		}
+	}
+
+	FRHIBox SrcBox;
+	SrcBox.Left = X;
+	SrcBox.Right = X + 1;
+	SrcBox.Top = Y;
+	SrcBox.Bottom = Y + 1;
+
+	Slot.State.store(EReadbackState::Copying, std::memory_order_relaxed);
+	ENQUEUE_RENDER_COMMAND([&Slot, UUIDTexture, SrcBox]
+	{
+		FRHI::Get().CopyTextureRegion(D3D11RHI::ToRHI(Slot.StagingTexture), 0, 0, D3D11RHI::ToRHI(UUIDTexture->GetTexture2D()), SrcBox);
+		Slot.State.store(EReadbackState::Copied, std::memory_order_release);
+	});
+
+	ReadbackTail = (ReadbackTail + 1) % ReadbackRingSize;
+	++NumReadbacks;
+	return true;
+}
+
+bool FPickingManager::PollGPUReadback(uint32& OutUUID)
+{
+	if (NumReadbacks == 0)
+	{
+		return false;
+	}
+
+	FReadbackSlot& Slot = ReadbackRing[ReadbackHead];
+	switch (Slot.State.load(std::memory_order_acquire))
+	{
+	case EReadbackState::Copied:
+		// GPU가 아직 복사 중이면 실패하고 Copied로 돌아가서 다음 프레임에 다시 시도
+		Slot.State.store(EReadbackState::Mapping, std::memory_order_relaxed);
+		ENQUEUE_RENDER_COMMAND([&Slot]
+		{
+			FRHICommandContext& RHI = FRHI::Get();
+			FRHIMappedData Mapped;
+			if (!RHI.MapTexture(D3D11RHI::ToRHI(Slot.StagingTexture), ERHIMapMode::ReadNoWait, Mapped))
+			{
+				Slot.State.store(EReadbackState::Copied, std::memory_order_release);
+				return;
+			}
+
+			// R32G32B32A32_UINT 채널마다 EncodeUUID의 byte 하나
+			const uint32* Texel = static_cast<const uint32*>(Mapped.Data);
+			Slot.UUID = (Texel[0] & 0xff) | ((Texel[1] & 0xff) << 8) | ((Texel[2] & 0xff) << 16) | ((Texel[3] & 0xff) << 24);
+			RHI.UnmapTexture(D3D11RHI::ToRHI(Slot.StagingTexture));
+			Slot.State.store(EReadbackState::Ready, std::memory_order_release);
+		});
+		return false;
+
+	case EReadbackState::Ready:
+		OutUUID = Slot.UUID;
+		Slot.State.store(EReadbackState::Free, std::memory_order_relaxed);
+		ReadbackHead = (ReadbackHead + 1) % ReadbackRingSize;
+		--NumReadbacks;
+		return true;
+
+	default:
+		return false;
+	}
+}
+
+void FPickingManager::Release()
+{
+	for (FReadbackSlot& Slot : ReadbackRing)
+	{
+		if (Slot.StagingTexture)
+		{
+			Slot.StagingTexture->Release();
+			Slot.StagingTexture = nullptr;
+		}
+		Slot.State.store(EReadbackState::Free, std::memory_order_relaxed);
+	}
+	ReadbackHead = ReadbackTail = NumReadbacks = 0;
+}
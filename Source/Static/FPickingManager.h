@@ -0,0 +1,98 @@
+#pragma once
+#include <atomic>
+#include <cfloat>
+#include <memory>
+#include <span>
+
+#include "Core/AbstractClass/Singleton.h"
+#include "Core/HAL/PlatformType.h"
+#include "Core/Math/Ray.h"
+
+class ACamera;
+class FTexture;
+class UPrimitiveComponent;
+class UWorld;
+struct ID3D11Texture2D;
+
+
+enum class EPickingMode : uint8
+{
+	CPU,        // Camera Ray와 Mesh 삼각형의 교차로 바로 찾습니다. (기본)
+	GPUAsync,   // UUID Texture를 Staging Ring에 복사해 두고, 몇 프레임 뒤 GPU가 끝나면 읽습니다.
+};
+
+struct FPickResult
+{
+	UPrimitiveComponent* Component = nullptr;
+	uint32 UUID = 0;
+
+	/** Ray 시작점(Near Plane)에서의 거리 */
+	float Distance = FLT_MAX;
+
+	bool IsHit() const { return Component != nullptr; }
+};
+
+
+/**
+ * 마우스 위치의 Component를 찾는 Picking 서비스
+ *
+ * CPU 모드는 UUID Texture와 같은 규칙으로 찾습니다.
+ * - ZIgnore Component(Gizmo)가 맞으면 항상 우선, 아니면 Depth가 0인 Render Component 중 가장 가까운 것
+ * - DefaultRasterizer처럼 뒷면(반시계 방향)은 무시하고, Line Mesh는 UUID를 쓰지 않으므로 제외
+ * - 선별(Broad Phase)은 World의 Primitive Tree로 가까운 Node부터 방문하고, 삼각형 검사는 UPrimitiveComponent::RaycastPrimitive
+ *
+ * GPUAsync 모드는 1x1 Staging Texture Ring을 재사용하고, Map은 DO_NOT_WAIT로 시도하므로 Pipeline을 멈추지 않습니다.
+ */
+class FPickingManager : public TSingleton<FPickingManager>
+{
+	enum class EReadbackState : uint8
+	{
+		Free,
+		Copying,    // Copy Command가 Render Thread에 기록됨
+		Copied,     // GPU에 Copy가 제출됨, Map 시도 가능
+		Mapping,    // Map 시도 Command가 기록됨
+		Ready,      // UUID를 읽음
+	};
+
+	struct FReadbackSlot
+	{
+		ID3D11Texture2D* StagingTexture = nullptr;
+		std::atomic<EReadbackState> State = EReadbackState::Free;
+		uint32 UUID = 0;
+	};
+
+public:
+	/** 화면 픽셀 (X, Y)의 중심을 지나는 Ray, OutMaxDistance는 Far Plane까지의 거리 */
+	static FRay MakeCameraRay(const ACamera& Camera, float X, float Y, float Width, float Height, float& OutMaxDistance);
+
+	/** Components 중 Ray가 처음 맞는 앞면 삼각형을 찾습니다. (Tree 없이 모두 검사) */
+	static FPickResult Raycast(const FRay& Ray, float MaxDistance, std::span<UPrimitiveComponent* const> Components);
+
+	/** UUID Texture의 (X, Y) 픽셀과 같은 결과를 CPU로 찾습니다. */
+	FPickResult PickCPU(UWorld& World, ACamera& Camera, float X, float Y, float Width, float Height);
+
+	/**
+	 * UUID Texture의 (X, Y) 픽셀을 비동기로 읽도록 요청합니다.
+	 * @return Ring이 가득 찼거나 Device가 없으면 false
+	 */
+	bool RequestGPUReadback(const std::shared_ptr<FTexture>& UUIDTexture, uint32 X, uint32 Y);
+
+	/** 요청 순서대로 완료된 Readback의 UUID를 하나 꺼냅니다. 아직 없으면 false */
+	bool PollGPUReadback(uint32& OutUUID);
+
+	/** Staging Texture 해제, Render Thread가 멈춘 뒤에 호출해야 합니다. */
+	void Release();
+
+	EPickingMode GetMode() const { return Mode; }
+	void SetMode(EPickingMode InMode) { Mode = InMode; }
+
+private:
+	static constexpr int32 ReadbackRingSize = 4;
+
+	EPickingMode Mode = EPickingMode::CPU;
+
+	FReadbackSlot ReadbackRing[ReadbackRingSize];
+	int32 ReadbackHead = 0;   // 가장 오래된 요청
+	int32 ReadbackTail = 0;   // 다음 요청을 넣을 위치
+	int32 NumReadbacks = 0;
+};
@@ -2,6 +2,8 @@
 #include "Core/Engine.h"
 #include "Core/Rendering/URenderer.h"
 #include "Core/Rendering/FontAtlas.h"
+#include "Core/Rendering/RenderingThread.h"
+#include "Core/RHI/D3D11RHI.h"
 #include "Object/World/World.h"
 #include "Object/Actor/Actor.h"
 #include "Object/Actor/Camera.h"
@@ -219,16 +221,15 @@ void FUUIDBillBoard::UpdateString(const std::wstring& String)
 		}
 	}
 
-	// 버텍스 버퍼 업데이트
-	D3D11_MAPPED_SUBRESOURCE mappedResource;
-	FDevice::Get().GetDeviceContext()->Map(FontVertexBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &mappedResource);
-	memcpy(mappedResource.pData, VertexBuffer.GetData(), sizeof(FVertexSimple) * VertexBuffer.Num());
-	FDevice::Get().GetDeviceContext()->Unmap(FontVertexBuffer, 0);
+	// GPU 버퍼 갱신은 Render Thread에서 (DeviceContext는 한 스레드에서만 사용)
+	ENQUEUE_RENDER_COMMAND([this, Vertices = VertexBuffer, Indices = IndexBuffer]
+	{
+		// 버텍스 버퍼 업데이트
+		FRHI::Get().UpdateBuffer(D3D11RHI::ToRHI(FontVertexBuffer), Vertices.GetData(), sizeof(FVertexSimple) * Vertices.Num());
 
-	// 인덱스 버퍼 업데이트
-	FDevice::Get().GetDeviceContext()->Map(FontIndexBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &mappedResource);
-	memcpy(mappedResource.pData, IndexBuffer.GetData(), sizeof(uint32) * IndexBuffer.Num());
-	FDevice::Get().GetDeviceContext()->Unmap(FontIndexBuffer, 0);
+		// 인덱스 버퍼 업데이트
+		FRHI::Get().UpdateBuffer(D3D11RHI::ToRHI(FontIndexBuffer), Indices.GetData(), sizeof(uint32) * Indices.Num());
+	});
 }
 
 void FUUIDBillBoard::Flush()
@@ -250,13 +251,13 @@ void FUUIDBillBoard::CalculateModelMatrix(FMatrix& OutMatrix)
 	FVector right = FVector(0, 0, 1).Cross(lookDir).GetSafeNormal();
 	FVector up = lookDir.Cross(right).GetSafeNormal();
 
-	FMatrix rotationMatrix;
-
 	// 회전 행렬 구성
-	rotationMatrix.X = FVector4(lookDir.X, lookDir.Y, lookDir.Z, 0);
-	rotationMatrix.Y = FVector4(right.X, right.Y, right.Z, 0);
-	rotationMatrix.Z = FVector4(up.X, up.Y, up.Z, 0);
-	rotationMatrix.W = FVector4(0, 0, 0, 1);
+	const FMatrix rotationMatrix(
+		FVector4(lookDir.X, lookDir.Y, lookDir.Z, 0),
+		FVector4(right.X, right.Y, right.Z, 0),
+		FVector4(up.X, up.Y, up.Z, 0),
+		FVector4(0, 0, 0, 1)
+	);
 
 	FMatrix positionMatrix = FMatrix::GetTranslateMatrix(objectPosition);
 	FMatrix scaleMatrix = FMatrix::GetScaleMatrix(objectScale);
@@ -281,55 +282,50 @@ void FUUIDBillBoard::Render()
 	if (VertexBuffer.Num() == 0 || !FEngineShowFlags::Get().GetSingleFlag(EEngineShowFlags::SF_BillboardText) || !TargetObject)
 		return;
 
-	//Prepare
-	ID3D11DeviceContext* DeviceContext = FDevice::Get().GetDeviceContext();
-
+	// Billboard
+	FMatrix ModelMatrix;
+	CalculateModelMatrix(ModelMatrix);
 
-	// 파이프라인 상태 설정
-	UINT stride = sizeof(FVertexSimple);
-	UINT offset = 0;
+	FFontConstantInfo Constants;
+	Constants.ViewProjectionMatrix = FMatrix::Transpose(
+		ModelMatrix
+		* UEngine::Get().GetWorld()->GetCamera()->GetViewProjectionMatrix()
+	);
 
-	// 기본 셰이더랑 InputLayout을 설정
+	ENQUEUE_RENDER_COMMAND([this, Constants, NumIndices = static_cast<UINT>(IndexBuffer.Num())]
+	{
+		RenderText(Constants, NumIndices);
+	});
+}
 
-	DeviceContext->IASetVertexBuffers(0, 1, &FontVertexBuffer, &stride, &offset);
-	DeviceContext->IASetIndexBuffer(FontIndexBuffer, DXGI_FORMAT_R32_UINT, 0);
-	DeviceContext->IASetPrimitiveTopology(PrimitiveTopology);
+void FUUIDBillBoard::RenderText(const FFontConstantInfo& Constants, UINT NumIndices)
+{
+	//Prepare
+	FRHICommandContext& RHI = FRHI::Get();
 
-	DeviceContext->VSSetShader(FontVertexShader, nullptr, 0);
-	DeviceContext->PSSetShader(FontPixelShader, nullptr, 0);
-	DeviceContext->IASetInputLayout(FontInputLayout);
+	// 기본 셰이더랑 InputLayout을 설정
+	RHI.SetVertexBuffer(D3D11RHI::ToRHI(FontVertexBuffer), sizeof(FVertexSimple), 0);
+	RHI.SetIndexBuffer(D3D11RHI::ToRHI(FontIndexBuffer), ERHIIndexFormat::UInt32, 0);
+	RHI.SetPrimitiveTopology(D3D11RHI::ToRHITopology(PrimitiveTopology));
 
-	DeviceContext->RSSetState(RasterizerState);
-	DeviceContext->OMSetBlendState(BlendState, BlendFactor, 0xffffffff);
-	DeviceContext->OMSetDepthStencilState(DepthStencilState, 0);
+	RHI.SetVertexShader(D3D11RHI::ToRHI(FontVertexShader));
+	RHI.SetPixelShader(D3D11RHI::ToRHI(FontPixelShader));
+	RHI.SetInputLayout(D3D11RHI::ToRHI(FontInputLayout));
 
-	// Billboard
-	FMatrix ModelMatrix;
-	CalculateModelMatrix(ModelMatrix);
+	RHI.SetRasterizerState(D3D11RHI::ToRHI(RasterizerState));
+	RHI.SetBlendState(D3D11RHI::ToRHI(BlendState), BlendFactor, 0xffffffff);
+	RHI.SetDepthStencilState(D3D11RHI::ToRHI(DepthStencilState), 0);
 
 	// 버텍스 쉐이더에 상수 버퍼를 설정
 	if (FontConstantBuffer)
 	{
-		DeviceContext->VSSetConstantBuffers(0, 1, &FontConstantBuffer);
-
-		D3D11_MAPPED_SUBRESOURCE ConstantBufferMSR;
-		FFontConstantInfo Constants;
-		URenderer* Renderer = UEngine::Get().GetRenderer();
-
-		Constants.ViewProjectionMatrix = FMatrix::Transpose(
-			ModelMatrix
-			* UEngine::Get().GetWorld()->GetCamera()->GetViewProjectionMatrix()
-		);
+		RHI.SetConstantBuffer(ERHIShaderStage::Vertex, 0, D3D11RHI::ToRHI(FontConstantBuffer));
 
-		// D3D11_MAP_WRITE_DISCARD는 이전 내용을 무시하고 새로운 데이터로 덮어쓰기 위해 사용
-		DeviceContext->Map(FontConstantBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &ConstantBufferMSR);
-		{
-			memcpy(ConstantBufferMSR.pData, &Constants, sizeof(FFontConstantInfo));
-		}
-		DeviceContext->Unmap(FontConstantBuffer, 0);
+		// WRITE_DISCARD로 이전 내용을 무시하고 새로운 데이터로 덮어씀
+		RHI.UpdateBuffer(D3D11RHI::ToRHI(FontConstantBuffer), &Constants, sizeof(FFontConstantInfo));
 	}
 
-	DeviceContext->DrawIndexed((UINT)IndexBuffer.Num(), 0, 0);
+	RHI.DrawIndexed(NumIndices, 0, 0);
 }
 
 void FUUIDBillBoard::Create()
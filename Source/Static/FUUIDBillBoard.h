@@ -25,6 +25,9 @@ public:
 private:
 	void CalculateModelMatrix(FMatrix& OutMatrix);
 	void Flush();
+
+	/** Render Thread에서 실행되는 실제 Draw */
+	void RenderText(const FFontConstantInfo& Constants, UINT NumIndices);
 private:
 	USceneComponent* TargetObject;
 
@@ -9,6 +9,7 @@
 #include "Core/Engine.h"
 #include "Core/Rendering/URenderer.h"
 #include "Core/Config/ConfigManager.h"
+#include "Core/Headless/HeadlessSettings.h"
 
 
 #define _CRTDBG_MAP_ALLOC
@@ -99,7 +100,26 @@ int WINAPI wWinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPWSTR lpCmdLi
 	uint32 ScreenHeight = std::stoi((UConfigManager::Get().GetValue(TEXT("Display"), TEXT("Height"))).GetData());
 
 	UEngine& Engine = UEngine::Get();
-	if (UConfigManager::Get().GetValue(TEXT("Display"), TEXT("Fullscreen")) == "true")
+
+	// -headless: Window 없이 World만 실행 (로그는 부모 Console로 출력)
+	TArray<FString> Args;
+	for (int Index = 1; Index < __argc; ++Index)
+	{
+		Args.Add(FString(__wargv[Index]));
+	}
+	const FHeadlessSettings HeadlessSettings = FHeadlessSettings::ParseCommandLine(Args);
+	if (HeadlessSettings.bEnabled)
+	{
+		if (!AttachConsole(ATTACH_PARENT_PROCESS))
+		{
+			AllocConsole();
+		}
+		FILE* Stream = nullptr;
+		freopen_s(&Stream, "CONOUT$", "w", stdout);
+
+		Engine.InitializeHeadless(HeadlessSettings, ScreenWidth, ScreenHeight);
+	}
+	else if (UConfigManager::Get().GetValue(TEXT("Display"), TEXT("Fullscreen")) == "true")
 	{
 		Engine.Initialize(hInstance, AppName.ToWideString().c_str(), L"JungleWindow", 1920, 1080, EScreenMode::Fullscreen);
 	}